@@ -334,6 +334,10 @@ let package = Package(
         "src/core/credentials/transport/transport_credentials.h",
         "src/core/credentials/transport/xds/xds_credentials.cc",
         "src/core/credentials/transport/xds/xds_credentials.h",
+        "src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_filter.cc",
+        "src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_filter.h",
+        "src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_limiter.cc",
+        "src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_limiter.h",
         "src/core/ext/filters/backend_metrics/backend_metric_filter.cc",
         "src/core/ext/filters/backend_metrics/backend_metric_filter.h",
         "src/core/ext/filters/backend_metrics/backend_metric_provider.h",
@@ -463,6 +467,10 @@ let package = Package(
         "src/core/ext/transport/inproc/inproc_transport.h",
         "src/core/ext/transport/inproc/legacy_inproc_transport.cc",
         "src/core/ext/transport/inproc/legacy_inproc_transport.h",
+        "src/core/ext/transport/shm/shm_endpoint.cc",
+        "src/core/ext/transport/shm/shm_endpoint.h",
+        "src/core/ext/transport/shm/shm_handshaker.cc",
+        "src/core/ext/transport/shm/shm_handshaker.h",
         "src/core/ext/upb-gen/envoy/admin/v3/certs.upb.h",
         "src/core/ext/upb-gen/envoy/admin/v3/certs.upb_minitable.c",
         "src/core/ext/upb-gen/envoy/admin/v3/certs.upb_minitable.h",
@@ -1426,6 +1434,7 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/set_socket_dualstack.cc",
         "src/core/lib/event_engine/posix_engine/tcp_socket_utils.cc",
         "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h",
+        "src/core/lib/event_engine/posix_engine/telemetry.h",
         "src/core/lib/event_engine/posix_engine/timer.cc",
         "src/core/lib/event_engine/posix_engine/timer.h",
         "src/core/lib/event_engine/posix_engine/timer_heap.cc",
@@ -1673,6 +1682,8 @@ let package = Package(
         "src/core/lib/resource_quota/telemetry.h",
         "src/core/lib/resource_quota/thread_quota.cc",
         "src/core/lib/resource_quota/thread_quota.h",
+        "src/core/lib/resource_tracker/cgroup_resource_tracker.cc",
+        "src/core/lib/resource_tracker/cgroup_resource_tracker.h",
         "src/core/lib/resource_tracker/resource_tracker.cc",
         "src/core/lib/resource_tracker/resource_tracker.h",
         "src/core/lib/security/authorization/audit_logging.cc",
@@ -1753,6 +1764,7 @@ let package = Package(
         "src/core/lib/transport/connectivity_state.h",
         "src/core/lib/transport/error_utils.cc",
         "src/core/lib/transport/error_utils.h",
+        "src/core/lib/transport/message_buffer_allocator.h",
         "src/core/lib/transport/promise_endpoint.cc",
         "src/core/lib/transport/promise_endpoint.h",
         "src/core/lib/transport/status_conversion.cc",
@@ -1879,7 +1891,13 @@ let package = Package(
         "src/core/service_config/service_config_impl.h",
         "src/core/service_config/service_config_parser.cc",
         "src/core/service_config/service_config_parser.h",
+        "src/core/telemetry/call_cpu.cc",
+        "src/core/telemetry/call_cpu_account.cc",
+        "src/core/telemetry/call_latency.cc",
         "src/core/telemetry/call_tracer.cc",
+        "src/core/telemetry/call_cpu.h",
+        "src/core/telemetry/call_cpu_account.h",
+        "src/core/telemetry/call_latency.h",
         "src/core/telemetry/call_tracer.h",
         "src/core/telemetry/context_list_entry.cc",
         "src/core/telemetry/context_list_entry.h",
@@ -2048,7 +2066,9 @@ let package = Package(
         "src/core/util/orphanable.h",
         "src/core/util/overload.h",
         "src/core/util/packed_table.h",
+        "src/core/util/mutex_profiler.cc",
         "src/core/util/per_cpu.cc",
+        "src/core/util/mutex_profiler.h",
         "src/core/util/per_cpu.h",
         "src/core/util/posix/cpu.cc",
         "src/core/util/posix/directory_reader.cc",
@@ -22,6 +22,7 @@ EXPERIMENT_ENABLES = {
     "channelz_use_v2_for_v1_service": "channelz_use_v2_for_v1_service",
     "chaotic_good_framing_layer": "chaotic_good_framing_layer",
     "chttp2_bound_write_size": "chttp2_bound_write_size",
+    "container_resource_tracker": "container_resource_tracker",
     "error_flatten": "error_flatten",
     "event_engine_client": "event_engine_client",
     "event_engine_dns": "event_engine_dns",
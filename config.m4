@@ -145,6 +145,8 @@ if test "$PHP_GRPC" != "no"; then
     src/core/credentials/transport/tls/tls_utils.cc \
     src/core/credentials/transport/transport_credentials.cc \
     src/core/credentials/transport/xds/xds_credentials.cc \
+    src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_filter.cc \
+    src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_limiter.cc \
     src/core/ext/filters/backend_metrics/backend_metric_filter.cc \
     src/core/ext/filters/census/grpc_context.cc \
     src/core/ext/filters/channel_idle/idle_filter_state.cc \
@@ -205,6 +207,8 @@ if test "$PHP_GRPC" != "no"; then
     src/core/ext/transport/chttp2/transport/writing.cc \
     src/core/ext/transport/inproc/inproc_transport.cc \
     src/core/ext/transport/inproc/legacy_inproc_transport.cc \
+    src/core/ext/transport/shm/shm_endpoint.cc \
+    src/core/ext/transport/shm/shm_handshaker.cc \
     src/core/ext/upb-gen/envoy/admin/v3/certs.upb_minitable.c \
     src/core/ext/upb-gen/envoy/admin/v3/clusters.upb_minitable.c \
     src/core/ext/upb-gen/envoy/admin/v3/config_dump.upb_minitable.c \
@@ -703,6 +707,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/lib/resource_quota/periodic_update.cc \
     src/core/lib/resource_quota/resource_quota.cc \
     src/core/lib/resource_quota/thread_quota.cc \
+    src/core/lib/resource_tracker/cgroup_resource_tracker.cc \
     src/core/lib/resource_tracker/resource_tracker.cc \
     src/core/lib/security/authorization/audit_logging.cc \
     src/core/lib/security/authorization/authorization_policy_provider_vtable.cc \
@@ -806,6 +811,9 @@ if test "$PHP_GRPC" != "no"; then
     src/core/service_config/service_config_channel_arg_filter.cc \
     src/core/service_config/service_config_impl.cc \
     src/core/service_config/service_config_parser.cc \
+    src/core/telemetry/call_cpu.cc \
+    src/core/telemetry/call_cpu_account.cc \
+    src/core/telemetry/call_latency.cc \
     src/core/telemetry/call_tracer.cc \
     src/core/telemetry/context_list_entry.cc \
     src/core/telemetry/default_tcp_tracer.cc \
@@ -880,6 +888,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/util/matchers.cc \
     src/core/util/mpscq.cc \
     src/core/util/msys/tmpfile.cc \
+    src/core/util/mutex_profiler.cc \
     src/core/util/per_cpu.cc \
     src/core/util/posix/cpu.cc \
     src/core/util/posix/directory_reader.cc \
@@ -1500,6 +1509,7 @@ if test "$PHP_GRPC" != "no"; then
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/credentials/transport/ssl)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/credentials/transport/tls)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/credentials/transport/xds)
+  PHP_ADD_BUILD_DIR($ext_builddir/src/core/ext/filters/adaptive_concurrency)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/ext/filters/backend_metrics)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/ext/filters/census)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/ext/filters/channel_idle)
@@ -1518,6 +1528,7 @@ if test "$PHP_GRPC" != "no"; then
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/ext/transport/chttp2/server)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/ext/transport/chttp2/transport)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/ext/transport/inproc)
+  PHP_ADD_BUILD_DIR($ext_builddir/src/core/ext/transport/shm)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/ext/upb-gen/envoy/admin/v3)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/ext/upb-gen/envoy/annotations)
   PHP_ADD_BUILD_DIR($ext_builddir/src/core/ext/upb-gen/envoy/config/accesslog/v3)
@@ -122,6 +122,27 @@ GRPCAPI grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
                                               gpr_timespec deadline,
                                               void* reserved);
 
+/** EXPERIMENTAL: Like grpc_completion_queue_next, but returns up to
+    'max_events' events from a single call.
+
+    Blocks until at least one event is available, the completion queue is
+    being shutdown or deadline is reached, with the same semantics as
+    grpc_completion_queue_next. Once an event is available, any further
+    events already queued are returned alongside it without blocking again.
+
+    Writes the events to 'events', which must have room for 'max_events'
+    (at least one) entries, and returns the number written. A
+    GRPC_QUEUE_TIMEOUT or GRPC_QUEUE_SHUTDOWN event is always returned on
+    its own, as the only entry.
+
+    Callers must not call grpc_completion_queue_next_batch and
+    grpc_completion_queue_pluck simultaneously on the same completion queue. */
+GRPCAPI size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                                grpc_event* events,
+                                                size_t max_events,
+                                                gpr_timespec deadline,
+                                                void* reserved);
+
 /** Blocks until an event with tag 'tag' is available, the completion queue is
     being shutdown or deadline is reached.
 
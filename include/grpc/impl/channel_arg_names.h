@@ -140,6 +140,13 @@
 /** Should we allow receipt of true-binary data on http2 connections?
     Defaults to on (1) */
 #define GRPC_ARG_HTTP2_ENABLE_TRUE_BINARY "grpc.http2.true_binary"
+/** If set to non-zero, DATA frames of concurrent streams are scheduled by
+    weighted fair queuing instead of round robin, using the per-call weight
+    carried in "grpc-stream-weight" metadata (1..256, default 16). A stream
+    sends at most one frame per turn, so small responses are not queued
+    behind bulk transfers on the same connection.
+  * Boolean valued. Defaults to 0 (false). */
+#define GRPC_ARG_HTTP2_WEIGHTED_FAIR_QUEUING "grpc.http2.weighted_fair_queuing"
 /** An experimental channel arg which determines whether the preferred crypto
  * frame size http2 setting sent to the peer at startup. If set to 0 (false
  * - default), the preferred frame size is not sent to the peer. Otherwise it
@@ -288,6 +295,27 @@
     Default value is -1(kReadBufferSizeUnset) indicating that the system will
     decide the buffer size. Range varies from 0 to INT_MAX. */
 #define GRPC_ARG_TCP_RECEIVE_BUFFER_SIZE "grpc.tcp_receive_buffer_size"
+/* If non-zero, connections over Unix domain sockets carry their bytes through
+   ring buffers in a shared memory segment set up when the connection is
+   established, and use the socket only to wake up an idle peer. It is set
+   automatically for "shm:" targets and ports. Connections stay on the socket
+   if the client has not enabled it or the segment cannot be set up (for
+   example, across users). If only the client has enabled it, its first
+   connection to the server fails within a second and later ones use the
+   socket. Linux only. Defaults to 0 (disabled). */
+#define GRPC_ARG_SHARED_MEMORY_TRANSPORT \
+  "grpc.experimental.shared_memory_transport"
+/* Size in bytes of each direction's ring buffer for the shared memory
+   transport, rounded up to a power of two. Chosen by the server.
+   Defaults to 4MB. */
+#define GRPC_ARG_SHARED_MEMORY_RING_SIZE \
+  "grpc.experimental.shared_memory_ring_size"
+/* If non-zero, posix TCP endpoints sample the kernel's TCP_INFO for their
+   socket at most this often, in milliseconds, as reads and writes are
+   started, and record the samples in the grpc.tcp.* histograms. Linux only.
+   Defaults to 0 (disabled). */
+#define GRPC_ARG_TCP_INFO_SAMPLE_INTERVAL_MS \
+  "grpc.experimental.tcp_info_sample_interval_ms"
 /* Timeout in milliseconds to use for calls to the grpclb load balancer.
    If 0 or unset, the balancer calls will have no deadline. Defaults to 0 ms. */
 #define GRPC_ARG_GRPCLB_CALL_TIMEOUT_MS "grpc.grpclb_call_timeout_ms"
@@ -394,6 +422,25 @@
 /** If set, uses a local subchannel pool within the channel. Otherwise, uses the
  * global subchannel pool. Boolean valued. Defaults to false. */
 #define GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL "grpc.use_local_subchannel_pool"
+/** EXPERIMENTAL. Maximum number of connections a subchannel may open to its
+ * address. Additional connections are opened only once every existing one is
+ * carrying GRPC_ARG_SUBCHANNEL_MAX_STREAMS_PER_CONNECTION calls, and are
+ * closed again once they sit idle for
+ * GRPC_ARG_SUBCHANNEL_EXTRA_CONNECTION_IDLE_TIMEOUT_MS. Int valued.
+ * Defaults to 1. */
+#define GRPC_ARG_MAX_CONNECTIONS_PER_SUBCHANNEL \
+  "grpc.experimental.max_connections_per_subchannel"
+/** EXPERIMENTAL. Number of concurrent calls a single subchannel connection is
+ * expected to carry before the subchannel opens another one (see
+ * GRPC_ARG_MAX_CONNECTIONS_PER_SUBCHANNEL). Should match the server's
+ * MAX_CONCURRENT_STREAMS setting. Int valued. Defaults to 100. */
+#define GRPC_ARG_SUBCHANNEL_MAX_STREAMS_PER_CONNECTION \
+  "grpc.experimental.subchannel_max_streams_per_connection"
+/** EXPERIMENTAL. How long an additional subchannel connection (see
+ * GRPC_ARG_MAX_CONNECTIONS_PER_SUBCHANNEL) may go without starting a call
+ * before it is closed. Int valued, milliseconds. Defaults to 30 seconds. */
+#define GRPC_ARG_SUBCHANNEL_EXTRA_CONNECTION_IDLE_TIMEOUT_MS \
+  "grpc.experimental.subchannel_extra_connection_idle_timeout_ms"
 /** gRPC Objective-C channel pooling domain string. */
 #define GRPC_ARG_CHANNEL_POOL_DOMAIN "grpc.channel_pooling_domain"
 /** gRPC Objective-C channel pooling id. */
@@ -424,6 +471,40 @@
  * If unspecified, it is unlimited */
 #define GRPC_ARG_MAX_ALLOWED_INCOMING_CONNECTIONS \
   "grpc.max_allowed_incoming_connections"
+/** EXPERIMENTAL. If non-zero, the server limits the number of concurrent
+ * calls per method to an adaptive limit derived from observed call latency,
+ * and rejects calls over the limit with RESOURCE_EXHAUSTED and a retry
+ * pushback. Boolean valued. Defaults to false. */
+#define GRPC_ARG_ENABLE_ADAPTIVE_CONCURRENCY_LIMIT \
+  "grpc.experimental.enable_adaptive_concurrency_limit"
+/** EXPERIMENTAL. Concurrency limit each method starts out with when
+ * GRPC_ARG_ENABLE_ADAPTIVE_CONCURRENCY_LIMIT is set. Int valued. Defaults to
+ * 20. */
+#define GRPC_ARG_ADAPTIVE_CONCURRENCY_INITIAL_LIMIT \
+  "grpc.experimental.adaptive_concurrency_initial_limit"
+/** EXPERIMENTAL. Lower bound of the adaptive concurrency limit. Int valued.
+ * Defaults to 4. */
+#define GRPC_ARG_ADAPTIVE_CONCURRENCY_MIN_LIMIT \
+  "grpc.experimental.adaptive_concurrency_min_limit"
+/** EXPERIMENTAL. Upper bound of the adaptive concurrency limit. Int valued.
+ * Defaults to 1000. */
+#define GRPC_ARG_ADAPTIVE_CONCURRENCY_MAX_LIMIT \
+  "grpc.experimental.adaptive_concurrency_max_limit"
+/** EXPERIMENTAL. Name of the request metadata key that carries a call's
+ * priority class for the adaptive concurrency limit: "critical", "default"
+ * or "sheddable". Calls without it, or when this is unset, are "default".
+ * String valued. */
+#define GRPC_ARG_ADAPTIVE_CONCURRENCY_PRIORITY_METADATA_KEY \
+  "grpc.experimental.adaptive_concurrency_priority_metadata_key"
+/** EXPERIMENTAL. If non-zero, a C++ server runs the handlers of its
+ * synchronous methods on EventEngine threads instead of on threads of its
+ * own. The EventEngine's thread pool grows while handlers block. The
+ * server's ResourceQuota max threads, if set, bounds how many handlers run at
+ * once; requests past it fail with RESOURCE_EXHAUSTED. The ServerBuilder's
+ * sync server options (CQs, pollers) do not apply. Boolean valued. Defaults
+ * to false. */
+#define GRPC_ARG_SERVER_SYNC_HANDLERS_ON_EVENT_ENGINE \
+  "grpc.experimental.server_sync_handlers_on_event_engine"
 /** Configure per-channel or per-server stats plugins. */
 #define GRPC_ARG_EXPERIMENTAL_STATS_PLUGINS "grpc.experimental.stats_plugins"
 /** If non-zero, allow security frames to be sent and received. */
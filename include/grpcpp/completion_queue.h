@@ -201,6 +201,52 @@ class CompletionQueue : private grpc::internal::GrpcLibrary {
     return AsyncNextInternal(tag, ok, deadline_tp.raw_time());
   }
 
+  /// EXPERIMENTAL
+  /// Read up to \a max_events events from the queue at once, blocking until
+  /// at least one event is available or the queue is shutting down. Events
+  /// that are already queued behind the first one are returned without
+  /// blocking again, which saves a trip through the completion queue per
+  /// event on busy queues.
+  ///
+  /// \param[out] tags Updated to point to the read events' tags. Must have
+  ///        room for \a max_events entries.
+  /// \param[out] oks Updated with each read event's success, with the same
+  ///        meaning as for \a Next. Must have room for \a max_events entries.
+  /// \param[in] max_events Maximum number of events to read; must be > 0.
+  ///
+  /// \return The number of events read, or 0 if the queue is fully drained
+  ///         and shut down.
+  size_t NextBatch(void** tags, bool* oks, size_t max_events) {
+    size_t num_events = 0;
+    if (AsyncNextBatchInternal(tags, oks, max_events, &num_events,
+                               gpr_inf_future(GPR_CLOCK_REALTIME)) !=
+        GOT_EVENT) {
+      return 0;
+    }
+    return num_events;
+  }
+
+  /// EXPERIMENTAL
+  /// Read up to \a max_events events from the queue at once, blocking up to
+  /// \a deadline (or the queue's shutdown) for the first one. See
+  /// \a NextBatch and \a AsyncNext.
+  ///
+  /// \param[out] tags Upon success, updated to point to the events' tags.
+  /// \param[out] oks Upon success, updated with each event's success.
+  /// \param[in] max_events Maximum number of events to read; must be > 0.
+  /// \param[out] num_events Upon success, the number of events read.
+  /// \param[in] deadline How long to block in wait for the first event.
+  ///
+  /// \return GOT_EVENT if at least one event was read, otherwise the reason
+  ///         no event was read.
+  template <typename T>
+  NextStatus AsyncNextBatch(void** tags, bool* oks, size_t max_events,
+                            size_t* num_events, const T& deadline) {
+    grpc::TimePoint<T> deadline_tp(deadline);
+    return AsyncNextBatchInternal(tags, oks, max_events, num_events,
+                                  deadline_tp.raw_time());
+  }
+
   /// EXPERIMENTAL
   /// First executes \a F, then reads from the queue, blocking up to
   /// \a deadline (or the queue's shutdown).
@@ -314,6 +360,8 @@ class CompletionQueue : private grpc::internal::GrpcLibrary {
   };
 
   NextStatus AsyncNextInternal(void** tag, bool* ok, gpr_timespec deadline);
+  NextStatus AsyncNextBatchInternal(void** tags, bool* oks, size_t max_events,
+                                    size_t* num_events, gpr_timespec deadline);
 
   /// Wraps \a grpc_completion_queue_pluck.
   /// \warning Must not be mixed with calls to \a Next.
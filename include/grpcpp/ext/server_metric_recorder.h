@@ -22,6 +22,7 @@
 #include <grpcpp/impl/sync.h>
 #include <grpcpp/support/string_ref.h>
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
@@ -90,6 +91,13 @@ class ServerMetricRecorder {
   /// Clears a named utilization value if exists.
   void ClearNamedUtilization(string_ref name);
 
+  /// Reports the CPU and memory utilization of the container (cgroup) the
+  /// process runs in, when gRPC can measure them, whenever the CPU or memory
+  /// utilization has not been set.  Applies to out-of-band reports and to
+  /// per-call reports on servers that enabled call metric recording with
+  /// this recorder.  Disabled by default.
+  void SetContainerUtilizationFallback(bool enabled);
+
  private:
   // To access GetMetrics().
   friend class grpc::BackendMetricState;
@@ -113,6 +121,7 @@ class ServerMetricRecorder {
   mutable grpc::internal::Mutex mu_;
   std::shared_ptr<const BackendMetricDataState> metric_state_
       ABSL_GUARDED_BY(mu_);
+  std::atomic<bool> container_utilization_fallback_{false};
 };
 
 }  // namespace experimental
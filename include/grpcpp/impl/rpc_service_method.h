@@ -24,7 +24,10 @@
 #include <grpcpp/support/config.h>
 #include <grpcpp/support/status.h>
 
+#include <atomic>
+#include <chrono>
 #include <climits>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
@@ -126,10 +129,34 @@ class RpcServiceMethod : public RpcMethod {
     api_type_ = type;
   }
 
+  /// Callback API only: lets the handler run on the thread that read the
+  /// request instead of on an EventEngine thread, for as long as its recent
+  /// run time stays within \a budget.
+  void SetInlineHandlerBudget(std::chrono::nanoseconds budget) {
+    inline_budget_ns_ = budget.count();
+  }
+  bool inline_handler_enabled() const { return inline_budget_ns_ > 0; }
+  /// Whether the handler is currently cheap enough to run inline.
+  bool ShouldRunHandlerInline() const {
+    return inline_budget_ns_ > 0 &&
+           handler_run_time_ns_.load(std::memory_order_relaxed) <=
+               inline_budget_ns_;
+  }
+  /// Folds one handler run into the moving average ShouldRunHandlerInline()
+  /// compares against the budget.
+  void RecordHandlerRunTime(std::chrono::nanoseconds run_time) {
+    const int64_t average =
+        handler_run_time_ns_.load(std::memory_order_relaxed);
+    handler_run_time_ns_.store(average + (run_time.count() - average) / 8,
+                               std::memory_order_relaxed);
+  }
+
  private:
   void* server_tag_;
   ApiType api_type_;
   std::unique_ptr<MethodHandler> handler_;
+  int64_t inline_budget_ns_ = 0;
+  std::atomic<int64_t> handler_run_time_ns_{0};
 
   const char* TypeToString(RpcServiceMethod::ApiType type) {
     switch (type) {
@@ -223,6 +223,7 @@ class Service {
 
  private:
   friend class Server;
+  friend class ServerBuilder;
   friend class ServerInterface;
   ServerInterface* server_;
   std::vector<std::unique_ptr<internal::RpcServiceMethod>> methods_;
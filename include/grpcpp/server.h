@@ -350,6 +350,14 @@ class Server : public ServerInterface, private internal::GrpcLibrary {
   // Whetner per-call load reporting is enabled.
   bool call_metric_recording_enabled_ = false;
 
+  // Whether sync methods' handlers run on EventEngine threads rather than on
+  // the threads of sync_req_mgrs_.
+  bool sync_handlers_on_event_engine_ = false;
+
+  // When handlers run on EventEngine threads, the ResourceQuota whose thread
+  // quota each running handler holds a thread of, if one was set.
+  grpc_resource_quota* sync_handler_resource_quota_ = nullptr;
+
   // Interface to read or update server-wide metrics. Optional.
   experimental::ServerMetricRecorder* server_metric_recorder_ = nullptr;
 };
@@ -33,9 +33,12 @@
 #include <grpcpp/security/server_credentials.h>
 #include <grpcpp/server.h>
 #include <grpcpp/support/config.h>
+#include <grpcpp/support/message_buffer_allocator.h>
 #include <grpcpp/support/server_interceptor.h>
 
+#include <chrono>
 #include <climits>
+#include <functional>
 #include <map>
 #include <memory>
 #include <vector>
@@ -234,7 +237,9 @@ class ServerBuilder {
     CQ_TIMEOUT_MSEC  ///< Completion queue timeout in milliseconds.
   };
 
-  /// Only useful if this is a Synchronous server.
+  /// Only useful if this is a Synchronous server. Ignored when
+  /// GRPC_ARG_SERVER_SYNC_HANDLERS_ON_EVENT_ENGINE is set; use the
+  /// ResourceQuota's max threads to bound handlers then.
   ServerBuilder& SetSyncServerOption(SyncServerOption option, int value);
 
   /// Add a channel argument (an escape hatch to tuning core library parameters
@@ -307,6 +312,25 @@ class ServerBuilder {
         std::shared_ptr<grpc::ServerCredentials> creds,
         std::unique_ptr<grpc::experimental::PassiveListener>& passive_listener);
 
+    /// Runs the handler of the callback method \a method_name (such as
+    /// "/package.Service/Method") on the thread that read the request rather
+    /// than handing it off to an EventEngine thread, saving a thread hop per
+    /// call. Only suitable for handlers that take a few microseconds and
+    /// never block, since the thread can't make progress on other calls
+    /// while the handler runs. Whenever the handler's average run time
+    /// exceeds \a budget, its calls are handed off again until it is back
+    /// under budget.
+    void EnableInlineCallbackHandler(
+        const std::string& method_name,
+        std::chrono::nanoseconds budget = std::chrono::microseconds(20));
+
+    /// Assembles messages received on \a method_name (such as
+    /// "/package.Service/Method") into buffers from \a allocator. See
+    /// grpc::experimental::MessageBufferAllocator.
+    void SetMessageBufferAllocator(
+        const std::string& method_name,
+        std::shared_ptr<grpc::experimental::MessageBufferAllocator> allocator);
+
    private:
     ServerBuilder* builder_;
   };
@@ -447,6 +471,11 @@ class ServerBuilder {
   std::shared_ptr<experimental::AuthorizationPolicyProviderInterface>
       authorization_provider_;
   experimental::ServerMetricRecorder* server_metric_recorder_ = nullptr;
+  std::map<std::string, std::chrono::nanoseconds> inline_callback_handlers_;
+  std::map<std::string,
+           std::shared_ptr<grpc::experimental::MessageBufferAllocator>,
+           std::less<>>
+      message_buffer_allocators_;
 };
 
 }  // namespace grpc
@@ -0,0 +1,61 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPCPP_SUPPORT_MESSAGE_BUFFER_ALLOCATOR_H
+#define GRPCPP_SUPPORT_MESSAGE_BUFFER_ALLOCATOR_H
+
+#include <stddef.h>
+
+namespace grpc {
+namespace experimental {
+
+// NOTE: This is an API for advanced users who need to control where large
+// received messages live in memory.
+//
+// Supplies memory for the serialized messages received on a method.  Once the
+// transport has read a message's length prefix it asks the allocator for a
+// buffer of that size and copies the payload into it as frames arrive, so the
+// message reaches the application in a single buffer it owns, with one copy
+// from the transport's read buffers.  The message is delivered as a
+// grpc::ByteBuffer holding a single slice over that buffer, which handlers
+// that take ByteBuffer (generic or raw methods) can consume in place.
+// Messages that are compressed on the wire are decompressed into gRPC's own
+// buffers as usual.
+//
+// Registered with ServerBuilder::experimental().SetMessageBufferAllocator().
+// Implementations need to be thread-safe and must not block.
+class MessageBufferAllocator {
+ public:
+  virtual ~MessageBufferAllocator() = default;
+
+  /// Returns a buffer of \a length bytes to receive a message into, or
+  /// nullptr to have gRPC use its own buffers for this message.
+  ///
+  /// \a length is read from the message prefix sent by the peer, before any
+  /// of the payload has arrived, so it must not be trusted.  gRPC only calls
+  /// Allocate() for lengths within the server's maximum receive message
+  /// length (GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH, or 4 MiB when receive size
+  /// is unlimited); larger messages always use gRPC's own buffers.
+  virtual void* Allocate(size_t length) = 0;
+
+  /// Called once neither gRPC nor the application references \a buffer,
+  /// which was returned by Allocate(\a length).
+  virtual void Release(void* buffer, size_t length) = 0;
+};
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_SUPPORT_MESSAGE_BUFFER_ALLOCATOR_H
@@ -70,6 +70,7 @@ bool DebugStringBuilder::IsAllowListed(const absl::string_view key) const {
         allow_list.insert(std::string(GrpcRetryPushbackMsMetadata::key()));
         allow_list.insert(std::string(GrpcServerStatsBinMetadata::key()));
         allow_list.insert(std::string(GrpcStatusMetadata::key()));
+        allow_list.insert(std::string(GrpcStreamWeightMetadata::key()));
         allow_list.insert(std::string(GrpcTagsBinMetadata::key()));
         allow_list.insert(std::string(GrpcTimeoutMetadata::key()));
         allow_list.insert(std::string(GrpcTraceBinMetadata::key()));
@@ -447,6 +447,30 @@ struct GrpcPreviousRpcAttemptsMetadata
   static absl::string_view key() { return "grpc-previous-rpc-attempts"; }
 };
 
+// grpc-stream-weight metadata trait.
+// Relative share of a connection's bandwidth for the call's DATA frames when
+// the HTTP/2 transport uses weighted fair queuing (1..256, as HTTP/2 stream
+// priority weights). Malformed values are treated as the default weight.
+struct GrpcStreamWeightMetadata : public SimpleIntBasedMetadataBase<uint32_t> {
+  static constexpr bool kRepeatable = false;
+  static constexpr bool kTransferOnTrailersOnly = false;
+  using CompressionTraits = NoCompressionCompressor;
+  static constexpr uint32_t kMinWeight = 1;
+  static constexpr uint32_t kMaxWeight = 256;
+  static constexpr uint32_t kDefaultWeight = 16;
+  static absl::string_view key() { return "grpc-stream-weight"; }
+  static uint32_t ParseMemento(Slice value, bool,
+                               MetadataParseErrorFn on_error) {
+    uint32_t out;
+    if (!absl::SimpleAtoi(value.as_string_view(), &out) || out < kMinWeight ||
+        out > kMaxWeight) {
+      on_error("not a stream weight", value);
+      out = kDefaultWeight;
+    }
+    return out;
+  }
+};
+
 // grpc-retry-pushback-ms metadata trait.
 struct GrpcRetryPushbackMsMetadata {
   static constexpr bool kRepeatable = false;
@@ -1645,7 +1669,8 @@ using grpc_metadata_batch_base = grpc_core::MetadataMap<
     grpc_core::GrpcEncodingMetadata, grpc_core::GrpcInternalEncodingRequest,
     grpc_core::GrpcAcceptEncodingMetadata, grpc_core::GrpcStatusMetadata,
     grpc_core::GrpcTimeoutMetadata, grpc_core::GrpcPreviousRpcAttemptsMetadata,
-    grpc_core::GrpcRetryPushbackMsMetadata, grpc_core::UserAgentMetadata,
+    grpc_core::GrpcRetryPushbackMsMetadata, grpc_core::GrpcStreamWeightMetadata,
+    grpc_core::UserAgentMetadata,
     grpc_core::GrpcMessageMetadata, grpc_core::HostMetadata,
     grpc_core::EndpointLoadMetricsBinMetadata,
     grpc_core::GrpcServerStatsBinMetadata, grpc_core::GrpcTraceBinMetadata,
@@ -30,6 +30,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -55,7 +56,7 @@ ChannelzRegistry* ChannelzRegistry::Default() {
 std::vector<WeakRefCountedPtr<BaseNode>>
 ChannelzRegistry::InternalGetAllEntities() {
   return std::get<0>(QueryNodes(
-      0, [](const BaseNode*) { return true; },
+      0, std::nullopt, [](const BaseNode*) { return true; },
       std::numeric_limits<size_t>::max()));
 }
 
@@ -71,7 +72,7 @@ void ChannelzRegistry::InternalRegister(BaseNode* node) {
   const size_t node_shard_index = NodeShardIndex(node);
   NodeShard& node_shard = node_shards_[node_shard_index];
   MutexLock lock(&node_shard.mu);
-  node_shard.nursery.AddToHead(node);
+  node_shard.nursery[TypeIndex(node->type())].AddToHead(node);
 }
 
 void ChannelzRegistry::InternalUnregister(BaseNode* node) {
@@ -80,7 +81,9 @@ void ChannelzRegistry::InternalUnregister(BaseNode* node) {
   node_shard.mu.Lock();
   CHECK_EQ(node->orphaned_index_, 0u);
   intptr_t uuid = node->uuid_.load(std::memory_order_relaxed);
-  NodeList& remove_list = uuid == -1 ? node_shard.nursery : node_shard.numbered;
+  const size_t type_index = TypeIndex(node->type());
+  NodeList& remove_list =
+      uuid == -1 ? node_shard.nursery[type_index] : node_shard.numbered;
   remove_list.Remove(node);
   if (max_orphaned_per_shard_ == 0) {
     // We are not tracking orphaned nodes... remove from the index
@@ -88,12 +91,12 @@ void ChannelzRegistry::InternalUnregister(BaseNode* node) {
     node_shard.mu.Unlock();
     if (uuid != -1) {
       MutexLock lock(&index_mu_);
-      index_.erase(uuid);
+      RemoveFromIndex(node, uuid);
     }
     return;
   }
-  NodeList& add_list =
-      uuid != -1 ? node_shard.orphaned_numbered : node_shard.orphaned;
+  NodeList& add_list = uuid != -1 ? node_shard.orphaned_numbered
+                                  : node_shard.orphaned[type_index];
   // Ref counting: once a node becomes orphaned we add a single weak ref to it.
   // We hold that ref until it gets garbage collected later.
   node->WeakRef().release();
@@ -107,19 +110,18 @@ void ChannelzRegistry::InternalUnregister(BaseNode* node) {
     return;
   }
   CHECK_EQ(node_shard.TotalOrphaned(), max_orphaned_per_shard_ + 1);
-  NodeList* gc_list;
   // choose the oldest node to evict, regardless of numbered or not
-  if (node_shard.orphaned.tail == nullptr) {
-    CHECK_NE(node_shard.orphaned_numbered.tail, nullptr);
-    gc_list = &node_shard.orphaned_numbered;
-  } else if (node_shard.orphaned_numbered.tail == nullptr) {
-    gc_list = &node_shard.orphaned;
-  } else if (node_shard.orphaned.tail->orphaned_index_ <
-             node_shard.orphaned_numbered.tail->orphaned_index_) {
-    gc_list = &node_shard.orphaned;
-  } else {
-    gc_list = &node_shard.orphaned_numbered;
+  NodeList* gc_list = node_shard.orphaned_numbered.tail != nullptr
+                         ? &node_shard.orphaned_numbered
+                         : nullptr;
+  for (NodeList& list : node_shard.orphaned) {
+    if (list.tail != nullptr &&
+        (gc_list == nullptr ||
+         list.tail->orphaned_index_ < gc_list->tail->orphaned_index_)) {
+      gc_list = &list;
+    }
   }
+  CHECK_NE(gc_list, nullptr);
   auto* n = gc_list->tail;
   CHECK_GT(n->orphaned_index_, 0u);
   gc_list->Remove(n);
@@ -129,11 +131,19 @@ void ChannelzRegistry::InternalUnregister(BaseNode* node) {
   node_shard.mu.Unlock();
   if (gc_list == &node_shard.orphaned_numbered) {
     MutexLock lock(&index_mu_);
-    intptr_t uuid = n->uuid_.load(std::memory_order_relaxed);
-    index_.erase(uuid);
+    RemoveFromIndex(n, n->uuid_.load(std::memory_order_relaxed));
   }
 }
 
+void ChannelzRegistry::RemoveFromIndex(BaseNode* node, intptr_t uuid) {
+  index_.erase(uuid);
+  type_index_[TypeIndex(node->type())].erase(uuid);
+  if (!log_removals_) return;
+  removal_log_.push_back(Removal{uuid, node->type()});
+  ++removals_logged_;
+  if (removal_log_.size() > kMaxLoggedRemovals) removal_log_.pop_front();
+}
+
 void ChannelzRegistry::LoadConfig() {
   const auto max_orphaned = ConfigVars::Get().ChannelzMaxOrphanedNodes();
   if (max_orphaned == 0) {
@@ -143,78 +153,121 @@ void ChannelzRegistry::LoadConfig() {
   }
 }
 
-std::tuple<std::vector<WeakRefCountedPtr<BaseNode>>, bool>
-ChannelzRegistry::QueryNodes(
-    intptr_t start_node, absl::FunctionRef<bool(const BaseNode*)> discriminator,
-    size_t max_results) {
+void ChannelzRegistry::NumberNodes(
+    std::optional<BaseNode::EntityType> type,
+    absl::FunctionRef<bool(const BaseNode*)> discriminator) {
   // Mitigate drain hotspotting by randomizing the drain order each query.
   std::vector<size_t> nursery_visitation_order;
   for (size_t i = 0; i < kNodeShards; ++i) {
     nursery_visitation_order.push_back(i);
   }
   absl::c_shuffle(nursery_visitation_order, SharedBitGen());
-  // In the iteration below, even once we have max_results nodes, we need
-  // to find the next node in order to know if we've hit the end.  If we get
-  // through the loop without returning, then we return end=true.  But if we
-  // find a node to add after we already have max_results nodes, then we
-  // return with end=false before exiting the loop.  However, in the latter
-  // case, we will have already increased the ref count of the next node,
-  // so we need to unref it, but we can't do that while holding the lock.
-  // So instead, we store it in node_after_end, which will be unreffed
-  // after releasing the lock.
-  WeakRefCountedPtr<BaseNode> node_after_end;
-  std::vector<WeakRefCountedPtr<BaseNode>> result;
-  MutexLock index_lock(&index_mu_);
-  for (auto it = index_.lower_bound(start_node); it != index_.end(); ++it) {
-    BaseNode* node = it->second;
-    if (!discriminator(node)) continue;
-    auto node_ref = node->WeakRefIfNonZero();
-    if (node_ref == nullptr) continue;
-    if (result.size() == max_results) {
-      node_after_end = std::move(node_ref);
-      return std::tuple(std::move(result), false);
-    }
-    result.emplace_back(std::move(node_ref));
-  }
+  // index_mu_ is taken per shard rather than for the whole drain, so that
+  // Get() and NumberNode() can make progress in between.
   for (auto nursery_index : nursery_visitation_order) {
     NodeShard& node_shard = node_shards_[nursery_index];
+    MutexLock index_lock(&index_mu_);
     MutexLock shard_lock(&node_shard.mu);
-    for (auto [nursery, numbered] :
-         {std::pair(&node_shard.nursery, &node_shard.numbered),
-          std::pair(&node_shard.orphaned, &node_shard.orphaned_numbered)}) {
-      if (nursery->head == nullptr) continue;
-      BaseNode* n = nursery->head;
-      while (n != nullptr) {
-        if (!discriminator(n)) {
-          n = n->next_;
-          continue;
-        }
-        auto node_ref = n->WeakRefIfNonZero();
-        if (node_ref == nullptr) {
-          n = n->next_;
-          continue;
-        }
-        BaseNode* next = n->next_;
-        nursery->Remove(n);
-        numbered->AddToHead(n);
-        n->uuid_ = uuid_generator_;
-        ++uuid_generator_;
-        index_.emplace(n->uuid_, n);
-        if (n->uuid_ >= start_node) {
-          if (result.size() == max_results) {
-            node_after_end = std::move(node_ref);
-            return std::tuple(std::move(result), false);
+    for (size_t type_index = 0; type_index < kNumEntityTypes; ++type_index) {
+      if (type.has_value() && type_index != TypeIndex(*type)) continue;
+      for (auto [nursery, numbered] :
+           {std::pair(&node_shard.nursery[type_index], &node_shard.numbered),
+            std::pair(&node_shard.orphaned[type_index],
+                      &node_shard.orphaned_numbered)}) {
+        BaseNode* n = nursery->head;
+        while (n != nullptr) {
+          BaseNode* next = n->next_;
+          if (discriminator(n)) {
+            nursery->Remove(n);
+            numbered->AddToHead(n);
+            n->uuid_ = uuid_generator_;
+            ++uuid_generator_;
+            index_.emplace(n->uuid_, n);
+            type_index_[type_index].emplace(n->uuid_, n);
           }
-          result.emplace_back(std::move(node_ref));
+          n = next;
         }
-        n = next;
       }
     }
   }
+}
+
+std::tuple<std::vector<WeakRefCountedPtr<BaseNode>>, bool>
+ChannelzRegistry::QueryNodes(
+    intptr_t start_node, std::optional<BaseNode::EntityType> type,
+    absl::FunctionRef<bool(const BaseNode*)> discriminator,
+    size_t max_results) {
+  // Number everything the query could return first: uuids are assigned in
+  // increasing order, so from then on a walk of the index in uuid order sees
+  // every matching node, including any numbered while the walk has
+  // index_mu_ released.
+  NumberNodes(type, discriminator);
+  // Even once we have max_results nodes, we need to find the next node in
+  // order to know if we've hit the end.  If we walk off the end of the index,
+  // then we return end=true.  But if we find a node to add after we already
+  // have max_results nodes, then we return with end=false.  However, in the
+  // latter case, we will have already increased the ref count of the next
+  // node, so we need to unref it, but we can't do that while holding the
+  // lock.  So instead, we store it in node_after_end, which will be unreffed
+  // after releasing the lock.
+  WeakRefCountedPtr<BaseNode> node_after_end;
+  std::vector<WeakRefCountedPtr<BaseNode>> result;
+  intptr_t cursor = start_node;
+  while (true) {
+    MutexLock index_lock(&index_mu_);
+    const auto& index =
+        type.has_value() ? type_index_[TypeIndex(*type)] : index_;
+    auto it = index.lower_bound(cursor);
+    for (size_t visited = 0; it != index.end() && visited < kIndexWalkChunk;
+         ++it, ++visited) {
+      BaseNode* node = it->second;
+      if (!discriminator(node)) continue;
+      auto node_ref = node->WeakRefIfNonZero();
+      if (node_ref == nullptr) continue;
+      if (result.size() == max_results) {
+        node_after_end = std::move(node_ref);
+        return std::tuple(std::move(result), false);
+      }
+      result.emplace_back(std::move(node_ref));
+    }
+    if (it == index.end()) break;
+    cursor = it->first;
+  }
   CHECK(node_after_end == nullptr);
   return std::tuple(std::move(result), true);
 }
 
+ChannelzRegistry::Changes ChannelzRegistry::InternalGetChanges(
+    BaseNode::EntityType type, ChangeCursor since, size_t max_results) {
+  {
+    MutexLock lock(&index_mu_);
+    log_removals_ = true;
+  }
+  Changes changes;
+  std::tie(changes.added, changes.end) = QueryNodes(
+      since.next_uuid, type, [](const BaseNode*) { return true; },
+      max_results);
+  changes.next.next_uuid = changes.added.empty()
+                               ? since.next_uuid
+                               : changes.added.back()->uuid() + 1;
+  MutexLock lock(&index_mu_);
+  changes.next.next_removal = removals_logged_;
+  if (since.next_uuid == 0) {
+    // Starting over: everything still registered is in `added`, and the
+    // caller has nothing that could have been removed.
+    changes.complete = true;
+    return changes;
+  }
+  const uint64_t first_logged = removals_logged_ - removal_log_.size();
+  changes.complete = since.next_removal >= first_logged;
+  for (uint64_t i = std::max(since.next_removal, first_logged);
+       i < removals_logged_; ++i) {
+    const Removal& removal = removal_log_[i - first_logged];
+    if (removal.type == type) changes.removed.push_back(removal.uuid);
+  }
+  return changes;
+}
+
 WeakRefCountedPtr<BaseNode> ChannelzRegistry::InternalGet(intptr_t uuid) {
   MutexLock index_lock(&index_mu_);
   auto it = index_.find(uuid);
@@ -236,14 +289,16 @@ intptr_t ChannelzRegistry::InternalNumberNode(BaseNode* node) {
   uuid = uuid_generator_;
   ++uuid_generator_;
   node->uuid_ = uuid;
+  const size_t type_index = TypeIndex(node->type());
   if (node->orphaned_index_ > 0) {
-    node_shard.orphaned.Remove(node);
+    node_shard.orphaned[type_index].Remove(node);
     node_shard.orphaned_numbered.AddToHead(node);
   } else {
-    node_shard.nursery.Remove(node);
+    node_shard.nursery[type_index].Remove(node);
     node_shard.numbered.AddToHead(node);
   }
   index_.emplace(uuid, node);
+  type_index_[type_index].emplace(uuid, node);
   return uuid;
 }
 
@@ -296,11 +351,15 @@ void ChannelzRegistry::TestOnlyReset() {
   std::vector<WeakRefCountedPtr<BaseNode>> free_nodes;
   for (size_t i = 0; i < kNodeShards; i++) {
     MutexLock lock(&p->node_shards_[i].mu);
-    CHECK(p->node_shards_[i].nursery.head == nullptr);
+    for (NodeList& nursery : p->node_shards_[i].nursery) {
+      CHECK(nursery.head == nullptr);
+    }
     CHECK(p->node_shards_[i].numbered.head == nullptr);
-    while (p->node_shards_[i].orphaned.head != nullptr) {
-      free_nodes.emplace_back(p->node_shards_[i].orphaned.head);
-      p->node_shards_[i].orphaned.Remove(p->node_shards_[i].orphaned.head);
+    for (NodeList& orphaned : p->node_shards_[i].orphaned) {
+      while (orphaned.head != nullptr) {
+        free_nodes.emplace_back(orphaned.head);
+        orphaned.Remove(orphaned.head);
+      }
     }
     while (p->node_shards_[i].orphaned_numbered.head != nullptr) {
       free_nodes.emplace_back(p->node_shards_[i].orphaned_numbered.head);
@@ -312,6 +371,10 @@ void ChannelzRegistry::TestOnlyReset() {
   replace_node_shards.swap(p->node_shards_);
   MutexLock lock(&p->index_mu_);
   p->index_.clear();
+  for (auto& index : p->type_index_) index.clear();
+  p->log_removals_ = false;
+  p->removal_log_.clear();
+  p->removals_logged_ = 0;
 }
 
 }  // namespace channelz
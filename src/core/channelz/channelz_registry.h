@@ -21,9 +21,14 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <array>
 #include <cstdint>
+#include <deque>
 #include <map>
+#include <optional>
 #include <string>
+#include <tuple>
+#include <vector>
 
 #include "absl/container/btree_map.h"
 #include "absl/functional/function_ref.h"
@@ -130,6 +135,40 @@ class ChannelzRegistry final {
     return Default()->InternalGetNodes(start_node, max_results);
   }
 
+  // Position in the registry's history for GetChanges().  A default
+  // constructed cursor is before any node was numbered.
+  struct ChangeCursor {
+    intptr_t next_uuid = 0;
+    uint64_t next_removal = 0;
+  };
+
+  struct Changes {
+    // Nodes numbered since the cursor, in uuid order.
+    std::vector<WeakRefCountedPtr<BaseNode>> added;
+    // Uuids of nodes dropped from the registry since the cursor.  May
+    // include nodes never reported as added.
+    std::vector<intptr_t> removed;
+    // Cursor for the next call.
+    ChangeCursor next;
+    // True if every added node was returned; otherwise call again with
+    // `next` for the rest.
+    bool end;
+    // False if removals since the cursor were dropped from the bounded
+    // removal log: the caller should discard what it has and start over
+    // from a default constructed cursor.  Always true for a default
+    // constructed cursor, which reports no removals.
+    bool complete;
+  };
+
+  // Incremental query for periodic scrapers: returns the nodes of `type`
+  // added and removed since `since`, so that a scrape costs time
+  // proportional to the churn rather than the number of nodes.  Removals are
+  // only logged once the first GetChanges() call has been made.
+  static Changes GetChanges(BaseNode::EntityType type, ChangeCursor since,
+                            size_t max_results) {
+    return Default()->InternalGetChanges(type, since, max_results);
+  }
+
   // Test only helper function to dump the JSON representation to std out.
   // This can aid in debugging channelz code.
   static void LogAllEntities() { Default()->InternalLogAllEntities(); }
@@ -158,6 +197,12 @@ class ChannelzRegistry final {
     };
   }
 
+  static constexpr size_t kNumEntityTypes =
+      static_cast<size_t>(BaseNode::EntityType::kResourceQuota) + 1;
+  static size_t TypeIndex(BaseNode::EntityType type) {
+    return static_cast<size_t>(type);
+  }
+
   struct NodeList {
     BaseNode* head = nullptr;
     BaseNode* tail = nullptr;
@@ -176,23 +221,33 @@ class ChannelzRegistry final {
   // address. A shard tracks the four lists of nodes
   // independently - we strive to have no cross-talk between
   // shards as these are very global objects.
+  // The un-numbered lists are kept per entity type, so that a query for one
+  // type doesn't walk the (possibly many) un-numbered nodes of the others.
   struct alignas(GPR_CACHELINE_SIZE) NodeShard {
     Mutex mu;
     // Nursery nodes have no uuid and are not orphaned.
-    NodeList nursery ABSL_GUARDED_BY(mu);
+    std::array<NodeList, kNumEntityTypes> nursery ABSL_GUARDED_BY(mu);
     // Numbered nodes have been assigned a uuid, and are not orphaned.
     NodeList numbered ABSL_GUARDED_BY(mu);
     // Orphaned nodes have no uuid, but have been orphaned.
-    NodeList orphaned ABSL_GUARDED_BY(mu);
+    std::array<NodeList, kNumEntityTypes> orphaned ABSL_GUARDED_BY(mu);
     // Finally, orphaned numbered nodes are orphaned, and have been assigned a
     // uuid.
     NodeList orphaned_numbered ABSL_GUARDED_BY(mu);
     uint64_t next_orphan_index ABSL_GUARDED_BY(mu) = 1;
     size_t TotalOrphaned() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu) {
-      return orphaned.count + orphaned_numbered.count;
+      size_t total = orphaned_numbered.count;
+      for (const NodeList& list : orphaned) total += list.count;
+      return total;
     }
   };
 
+  // A node dropped from the index, for GetChanges().
+  struct Removal {
+    intptr_t uuid;
+    BaseNode::EntityType type;
+  };
+
   // Returned the singleton instance of ChannelzRegistry;
   static ChannelzRegistry* Default();
 
@@ -213,20 +268,30 @@ class ChannelzRegistry final {
   // This function takes care of all the gnarly locking, and allows high level
   // code to request a start node and maximum number of results (for pagination
   // purposes).
+  // If `type` is set, only nodes of that type are visited.
   // `discriminator` allows callers to choose which nodes will be returned - if
   // it returns true, the node is included in the result.
   // `discriminator` *MUST NOT* ref the node, nor call into ChannelzRegistry via
   // any code path (locks are held during the call).
   std::tuple<std::vector<WeakRefCountedPtr<BaseNode>>, bool> QueryNodes(
-      intptr_t start_node,
+      intptr_t start_node, std::optional<BaseNode::EntityType> type,
       absl::FunctionRef<bool(const BaseNode*)> discriminator,
       size_t max_results);
 
+  // Numbers the un-numbered nodes of `type` (or of all types) accepted by
+  // `discriminator`, so that QueryNodes() can find them in the index.
+  void NumberNodes(std::optional<BaseNode::EntityType> type,
+                   absl::FunctionRef<bool(const BaseNode*)> discriminator);
+
+  // Removes a numbered node from the indexes.
+  void RemoveFromIndex(BaseNode* node, intptr_t uuid)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(index_mu_);
+
   std::tuple<std::vector<WeakRefCountedPtr<BaseNode>>, bool>
   InternalGetChildren(const BaseNode* parent, intptr_t start_node,
                       size_t max_results) {
     return QueryNodes(
-        start_node,
+        start_node, std::nullopt,
         [parent](const BaseNode* n) { return n->HasParent(parent); },
         max_results);
   }
@@ -235,10 +300,8 @@ class ChannelzRegistry final {
   InternalGetChildrenOfType(intptr_t start_node, const BaseNode* parent,
                             BaseNode::EntityType type, size_t max_results) {
     return QueryNodes(
-        start_node,
-        [type, parent](const BaseNode* n) {
-          return n->type() == type && n->HasParent(parent);
-        },
+        start_node, type,
+        [parent](const BaseNode* n) { return n->HasParent(parent); },
         max_results);
   }
 
@@ -246,16 +309,19 @@ class ChannelzRegistry final {
   InternalGetNodesOfType(intptr_t start_node, BaseNode::EntityType type,
                          size_t max_results) {
     return QueryNodes(
-        start_node, [type](const BaseNode* n) { return n->type() == type; },
-        max_results);
+        start_node, type, [](const BaseNode*) { return true; }, max_results);
   }
 
   std::tuple<std::vector<WeakRefCountedPtr<BaseNode>>, bool> InternalGetNodes(
       intptr_t start_node, size_t max_results) {
     return QueryNodes(
-        start_node, [](const BaseNode*) { return true; }, max_results);
+        start_node, std::nullopt, [](const BaseNode*) { return true; },
+        max_results);
   }
 
+  Changes InternalGetChanges(BaseNode::EntityType type, ChangeCursor since,
+                             size_t max_results);
+
   template <typename T, BaseNode::EntityType entity_type>
   WeakRefCountedPtr<T> InternalGetTyped(intptr_t uuid) {
     WeakRefCountedPtr<BaseNode> node = InternalGet(uuid);
@@ -271,8 +337,7 @@ class ChannelzRegistry final {
     const int kPaginationLimit = 100;
     std::vector<WeakRefCountedPtr<T>> top_level_channels;
     const auto [nodes, end] = QueryNodes(
-        start_id,
-        [](const BaseNode* node) { return node->type() == entity_type; },
+        start_id, entity_type, [](const BaseNode*) { return true; },
         kPaginationLimit);
     for (const auto& p : nodes) {
       top_level_channels.emplace_back(p->template WeakRefAsSubclass<T>());
@@ -288,10 +353,26 @@ class ChannelzRegistry final {
     return absl::HashOf(node) % kNodeShards;
   }
 
+  // QueryNodes() releases index_mu_ after visiting this many index entries,
+  // so that a query over a large registry doesn't stall numbering and
+  // unregistration for its whole length.
+  static constexpr size_t kIndexWalkChunk = 1024;
+  // Removals kept for GetChanges().
+  static constexpr size_t kMaxLoggedRemovals = 16384;
+
   int64_t uuid_generator_{1};
   std::vector<NodeShard> node_shards_{kNodeShards};
   Mutex index_mu_;
   absl::btree_map<intptr_t, BaseNode*> index_ ABSL_GUARDED_BY(index_mu_);
+  // The same nodes as index_, by type.
+  std::array<absl::btree_map<intptr_t, BaseNode*>, kNumEntityTypes> type_index_
+      ABSL_GUARDED_BY(index_mu_);
+  // Set by the first GetChanges() call.
+  bool log_removals_ ABSL_GUARDED_BY(index_mu_) = false;
+  // The most recent removals; the first has sequence number
+  // removals_logged_ - removal_log_.size().
+  std::deque<Removal> removal_log_ ABSL_GUARDED_BY(index_mu_);
+  uint64_t removals_logged_ ABSL_GUARDED_BY(index_mu_) = 0;
   size_t max_orphaned_per_shard_;
 };
 
@@ -87,6 +87,7 @@
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/resolver/resolver_registry.h"
 #include "src/core/service_config/service_config_impl.h"
+#include "src/core/telemetry/call_cpu.h"
 #include "src/core/telemetry/metrics.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/debug_location.h"
@@ -850,10 +851,12 @@ void ClientChannel::Ping(grpc_completion_queue*, void*) {
 grpc_call* ClientChannel::CreateCall(
     grpc_call* parent_call, uint32_t propagation_mask,
     grpc_completion_queue* cq, grpc_pollset_set* /*pollset_set_alternative*/,
-    Slice path, std::optional<Slice> authority, Timestamp deadline, bool) {
+    Slice path, std::optional<Slice> authority, Timestamp deadline,
+    bool registered_method) {
   auto arena = call_arena_allocator()->MakeArena();
   arena->SetContext<grpc_event_engine::experimental::EventEngine>(
       event_engine());
+  MaybeAddClientCallCpuAccount(arena.get(), path, registered_method);
   return MakeClientCall(parent_call, propagation_mask, cq, std::move(path),
                         std::move(authority), false, deadline,
                         compression_options(), std::move(arena), Ref());
@@ -1413,6 +1416,13 @@ absl::Status ClientChannel::ApplyServiceConfigToCall(
         !wait_for_ready->explicitly_set) {
       wait_for_ready->value = method_params->wait_for_ready().value();
     }
+    // The service config's stream weight applies unless the application
+    // set one on the call.
+    if (method_params->stream_weight().has_value() &&
+        !client_initial_metadata.get(GrpcStreamWeightMetadata()).has_value()) {
+      client_initial_metadata.Set(GrpcStreamWeightMetadata(),
+                                  *method_params->stream_weight());
+    }
   }
   return absl::OkStatus();
 }
@@ -1852,6 +1852,13 @@ grpc_error_handle ClientChannelFilter::CallData::ApplyServiceConfigToCallLocked(
         !wait_for_ready->explicitly_set) {
       wait_for_ready->value = method_params->wait_for_ready().value();
     }
+    // The service config's stream weight applies unless the application
+    // set one on the call.
+    if (method_params->stream_weight().has_value() &&
+        !send_initial_metadata()->get(GrpcStreamWeightMetadata()).has_value()) {
+      send_initial_metadata()->Set(GrpcStreamWeightMetadata(),
+                                   *method_params->stream_weight());
+    }
   }
   return absl::OkStatus();
 }
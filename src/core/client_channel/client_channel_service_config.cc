@@ -26,6 +26,7 @@
 #include "absl/status/statusor.h"
 #include "absl/strings/ascii.h"
 #include "absl/strings/str_cat.h"
+#include "src/core/call/metadata_batch.h"
 #include "src/core/load_balancing/lb_policy_registry.h"
 
 // As per the retry design, we do not allow more than 5 retry attempts.
@@ -114,10 +115,24 @@ const JsonLoaderInterface* ClientChannelMethodParsedConfig::JsonLoader(
           .OptionalField("timeout", &ClientChannelMethodParsedConfig::timeout_)
           .OptionalField("waitForReady",
                          &ClientChannelMethodParsedConfig::wait_for_ready_)
+          .OptionalField("streamWeight",
+                         &ClientChannelMethodParsedConfig::stream_weight_)
           .Finish();
   return loader;
 }
 
+void ClientChannelMethodParsedConfig::JsonPostLoad(const Json&,
+                                                   const JsonArgs&,
+                                                   ValidationErrors* errors) {
+  // Weights are HTTP/2 priority weights, as in grpc-stream-weight metadata.
+  if (stream_weight_.has_value() &&
+      (*stream_weight_ < GrpcStreamWeightMetadata::kMinWeight ||
+       *stream_weight_ > GrpcStreamWeightMetadata::kMaxWeight)) {
+    ValidationErrors::ScopedField field(errors, ".streamWeight");
+    errors->AddError("must be in the range [1, 256]");
+  }
+}
+
 //
 // ClientChannelServiceConfigParser
 //
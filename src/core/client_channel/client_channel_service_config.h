@@ -19,6 +19,7 @@
 
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include <memory>
 #include <optional>
@@ -77,11 +78,16 @@ class ClientChannelMethodParsedConfig final
 
   std::optional<bool> wait_for_ready() const { return wait_for_ready_; }
 
+  std::optional<uint32_t> stream_weight() const { return stream_weight_; }
+
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
+  void JsonPostLoad(const Json& json, const JsonArgs&,
+                    ValidationErrors* errors);
 
  private:
   Duration timeout_;
   std::optional<bool> wait_for_ready_;
+  std::optional<uint32_t> stream_weight_;
 };
 
 class ClientChannelServiceConfigParser final
@@ -123,8 +123,11 @@ RetryFilter::RetryFilter(const grpc_channel_element_args& args)
 const RetryMethodConfig* RetryFilter::GetRetryPolicy(Arena* arena) {
   auto* svc_cfg_call_data = arena->GetContext<ServiceConfigCallData>();
   if (svc_cfg_call_data == nullptr) return nullptr;
-  return static_cast<const RetryMethodConfig*>(
+  const auto* config = static_cast<const RetryMethodConfig*>(
       svc_cfg_call_data->GetMethodParsedConfig(service_config_parser_index_));
+  // Hedging is only implemented in RetryInterceptor.
+  if (config != nullptr && config->hedging()) return nullptr;
+  return config;
 }
 
 const grpc_channel_filter RetryFilter::kVtable = {
@@ -14,10 +14,13 @@
 
 #include "src/core/client_channel/retry_interceptor.h"
 
+#include <algorithm>
+
 #include "src/core/lib/promise/cancel_callback.h"
 #include "src/core/lib/promise/for_each.h"
 #include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/sleep.h"
+#include "src/core/lib/promise/status_flag.h"
 #include "src/core/service_config/service_config_call_data.h"
 
 namespace grpc_core {
@@ -129,6 +132,73 @@ std::optional<Duration> RetryState::ShouldRetry(
   return next_attempt_timeout;
 }
 
+HedgingState::HedgingState(
+    const internal::RetryMethodConfig* hedging_policy,
+    RefCountedPtr<internal::RetryThrottler> retry_throttler)
+    : hedging_policy_(hedging_policy),
+      retry_throttler_(std::move(retry_throttler)) {
+  CHECK(hedging_policy_ != nullptr);
+  CHECK(hedging_policy_->hedging());
+}
+
+bool HedgingState::CanStartAttempt() {
+  if (stopped_) return false;
+  if (num_attempts_started_ >= hedging_policy_->max_attempts()) return false;
+  // Hedged attempts are not started while retries are throttled.
+  return retry_throttler_ == nullptr || !retry_throttler_->IsThrottled();
+}
+
+std::optional<Duration> HedgingState::OnAttemptFailed(
+    const ServerMetadata& md, bool committed,
+    absl::FunctionRef<std::string()> lazy_attempt_debug_string) {
+  const auto status = md.get(GrpcStatusMetadata());
+  if (status.has_value()) {
+    if (GPR_LIKELY(*status == GRPC_STATUS_OK)) {
+      if (retry_throttler_ != nullptr) {
+        retry_throttler_->RecordSuccess();
+      }
+      GRPC_TRACE_LOG(retry, INFO)
+          << lazy_attempt_debug_string() << " call succeeded";
+      return std::nullopt;
+    }
+    if (!hedging_policy_->non_fatal_status_codes().Contains(*status)) {
+      GRPC_TRACE_LOG(retry, INFO) << lazy_attempt_debug_string() << ": status "
+                                  << grpc_status_code_to_string(*status)
+                                  << " is fatal for hedging";
+      return std::nullopt;
+    }
+  }
+  // As with retries, only non-fatal failures count against the throttle.
+  // Once throttled, attempts already in flight continue, but no new ones
+  // are started.
+  if (retry_throttler_ != nullptr && !retry_throttler_->RecordFailure()) {
+    GRPC_TRACE_LOG(retry, INFO)
+        << lazy_attempt_debug_string() << " hedging throttled";
+    stopped_ = true;
+  }
+  if (committed) {
+    GRPC_TRACE_LOG(retry, INFO)
+        << lazy_attempt_debug_string() << " hedging already committed";
+    return std::nullopt;
+  }
+  const auto server_pushback = md.get(GrpcRetryPushbackMsMetadata());
+  if (server_pushback.has_value()) {
+    if (*server_pushback < Duration::Zero()) {
+      GRPC_TRACE_LOG(retry, INFO)
+          << lazy_attempt_debug_string()
+          << " no further hedged attempts due to server push-back";
+      stopped_ = true;
+      return Duration::Zero();
+    }
+    GRPC_TRACE_LOG(retry, INFO)
+        << lazy_attempt_debug_string()
+        << " server push-back: next hedged attempt in " << *server_pushback;
+    return *server_pushback;
+  }
+  // Non-fatal failure: the next hedged attempt starts immediately.
+  return Duration::Zero();
+}
+
 }  // namespace retry_detail
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -191,10 +261,19 @@ RetryInterceptor::Call::Call(RefCountedPtr<RetryInterceptor> interceptor,
                              CallHandler call_handler)
     : call_handler_(std::move(call_handler)),
       interceptor_(std::move(interceptor)),
-      retry_state_(interceptor_->GetRetryPolicy(),
+      hedging_(interceptor_->GetRetryPolicy() != nullptr &&
+               interceptor_->GetRetryPolicy()->hedging()),
+      retry_state_(hedging_ ? nullptr : interceptor_->GetRetryPolicy(),
                    interceptor_->retry_throttler_) {
-  GRPC_TRACE_LOG(retry, INFO)
-      << DebugTag() << " retry call created: " << retry_state_;
+  if (hedging_) {
+    hedging_state_.emplace(interceptor_->GetRetryPolicy(),
+                           interceptor_->retry_throttler_);
+    GRPC_TRACE_LOG(retry, INFO)
+        << DebugTag() << " hedging call created: " << *hedging_state_;
+  } else {
+    GRPC_TRACE_LOG(retry, INFO)
+        << DebugTag() << " retry call created: " << retry_state_;
+  }
 }
 
 auto RetryInterceptor::Call::ClientToBuffer() {
@@ -240,19 +319,175 @@ void RetryInterceptor::Call::Start() {
 }
 
 void RetryInterceptor::Call::StartAttempt() {
-  if (current_attempt_ != nullptr) {
-    current_attempt_->Cancel();
+  AttemptList to_cancel;
+  RefCountedPtr<Attempt> attempt;
+  uint64_t hedge_timer_generation = 0;
+  Duration hedging_delay;
+  {
+    MutexLockIfHedging lock(&mu_, hedging_);
+    if (hedging_) {
+      // This is the first attempt; later ones are started by the hedging
+      // timer.
+      attempt = MakeAttemptLocked(0);
+      if (hedging_state_->CanStartAttempt()) {
+        hedge_timer_generation = ++hedge_timer_generation_;
+        hedging_delay = hedging_state_->hedging_delay();
+      }
+    } else {
+      // A retry replaces the previous attempt.
+      to_cancel = TakeAttemptsExceptLocked(nullptr);
+      attempt = MakeAttemptLocked(retry_state_.num_attempts_completed());
+    }
+  }
+  for (auto& cancelled_attempt : to_cancel) {
+    cancelled_attempt->CancelChildCall();
+  }
+  attempt->Start();
+  if (hedge_timer_generation != 0) {
+    ScheduleHedgedAttempt(hedging_delay, hedge_timer_generation);
+  }
+}
+
+RefCountedPtr<RetryInterceptor::Attempt>
+RetryInterceptor::Call::MakeAttemptLocked(int num_previous_attempts) {
+  auto attempt = call_handler_.arena()->MakeRefCounted<Attempt>(
+      Ref(), num_previous_attempts);
+  attempts_.push_back(attempt.get());
+  return attempt;
+}
+
+RetryInterceptor::Call::AttemptList
+RetryInterceptor::Call::TakeAttemptsExceptLocked(Attempt* keep) {
+  AttemptList to_cancel;
+  bool kept = false;
+  for (Attempt* attempt : attempts_) {
+    if (attempt == keep) {
+      kept = true;
+      continue;
+    }
+    if (!attempt->MarkCancelled()) continue;
+    auto ref = attempt->RefIfNonZero();
+    if (ref != nullptr) to_cancel.push_back(std::move(ref));
+  }
+  attempts_.clear();
+  if (kept) attempts_.push_back(keep);
+  return to_cancel;
+}
+
+void RetryInterceptor::Call::RemoveAttempt(Attempt* attempt) {
+  MutexLockIfHedging lock(&mu_, hedging_);
+  auto it = std::find(attempts_.begin(), attempts_.end(), attempt);
+  if (it != attempts_.end()) attempts_.erase(it);
+}
+
+bool RetryInterceptor::Call::CommitAttempt(Attempt* attempt) {
+  AttemptList to_cancel;
+  {
+    MutexLockIfHedging lock(&mu_, hedging_);
+    if (committed_attempt_ != nullptr) return committed_attempt_ == attempt;
+    if (std::find(attempts_.begin(), attempts_.end(), attempt) ==
+        attempts_.end()) {
+      return false;
+    }
+    committed_attempt_ = attempt;
+    request_buffer_.Commit(attempt->reader());
+    to_cancel = TakeAttemptsExceptLocked(attempt);
+  }
+  for (auto& cancelled_attempt : to_cancel) {
+    GRPC_TRACE_LOG(retry, INFO)
+        << DebugTag() << " cancelling losing attempt "
+        << cancelled_attempt->DebugTag();
+    cancelled_attempt->CancelChildCall();
+  }
+  return true;
+}
+
+bool RetryInterceptor::Call::ShouldCommitHedgedResponse(
+    Attempt* attempt, const ServerMetadata& md,
+    absl::FunctionRef<std::string()> lazy_attempt_debug_string) {
+  uint64_t hedge_timer_generation = 0;
+  Duration delay;
+  {
+    MutexLock lock(&mu_);
+    // If another attempt already won, this one is simply finished.
+    if (committed_attempt_ != nullptr) return committed_attempt_ == attempt;
+    auto next_attempt_delay = hedging_state_->OnAttemptFailed(
+        md, request_buffer_.committed(), lazy_attempt_debug_string);
+    if (!next_attempt_delay.has_value()) return true;
+    if (CanStartHedgedAttemptLocked()) {
+      hedge_timer_generation = ++hedge_timer_generation_;
+      delay = *next_attempt_delay;
+    } else if (attempts_.size() <= 1) {
+      // Nothing else is in flight and nothing more will be started, so
+      // this failure is the call's result.
+      return true;
+    }
+    auto it = std::find(attempts_.begin(), attempts_.end(), attempt);
+    if (it != attempts_.end()) attempts_.erase(it);
+    // The attempt's child call is already done; this only stops its request
+    // buffer reader from failing the call once another attempt commits.
+    std::ignore = attempt->MarkCancelled();
+  }
+  if (hedge_timer_generation != 0) {
+    ScheduleHedgedAttempt(delay, hedge_timer_generation);
+  }
+  return false;
+}
+
+bool RetryInterceptor::Call::CanStartHedgedAttemptLocked() {
+  return committed_attempt_ == nullptr && !request_buffer_.committed() &&
+         hedging_state_->CanStartAttempt();
+}
+
+void RetryInterceptor::Call::ScheduleHedgedAttempt(Duration delay,
+                                                   uint64_t generation) {
+  call_handler_.SpawnGuardedUntilCallCompletes(
+      "hedge_timer", [self = Ref(), delay, generation]() {
+        return Map(Sleep(delay), [self, generation](absl::Status) {
+          self->MaybeStartHedgedAttempt(generation);
+          return absl::OkStatus();
+        });
+      });
+}
+
+void RetryInterceptor::Call::MaybeStartHedgedAttempt(uint64_t generation) {
+  RefCountedPtr<Attempt> attempt;
+  uint64_t next_generation = 0;
+  Duration hedging_delay;
+  {
+    MutexLock lock(&mu_);
+    // A newer timer superseded this one.
+    if (generation != hedge_timer_generation_) return;
+    if (!CanStartHedgedAttemptLocked()) return;
+    const int num_previous_attempts = hedging_state_->num_attempts_started();
+    hedging_state_->RecordAttemptStarted();
+    attempt = MakeAttemptLocked(num_previous_attempts);
+    if (hedging_state_->CanStartAttempt()) {
+      next_generation = ++hedge_timer_generation_;
+      hedging_delay = hedging_state_->hedging_delay();
+    }
+  }
+  GRPC_TRACE_LOG(retry, INFO)
+      << DebugTag() << " starting hedged attempt " << attempt->DebugTag();
+  attempt->Start();
+  if (next_generation != 0) {
+    ScheduleHedgedAttempt(hedging_delay, next_generation);
   }
-  auto current_attempt = call_handler_.arena()->MakeRefCounted<Attempt>(Ref());
-  current_attempt_ = current_attempt.get();
-  current_attempt->Start();
 }
 
 void RetryInterceptor::Call::MaybeCommit(size_t buffered) {
   GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " buffered:" << buffered << "/"
                               << interceptor_->per_rpc_retry_buffer_size_;
   if (buffered >= interceptor_->per_rpc_retry_buffer_size_) {
-    std::ignore = current_attempt_->Commit();
+    // Commit to the oldest attempt still in flight: it has the best chance
+    // of finishing first.
+    RefCountedPtr<Attempt> oldest;
+    {
+      MutexLockIfHedging lock(&mu_, hedging_);
+      if (committed_attempt_ != nullptr || attempts_.empty()) return;
+      oldest = attempts_.front()->RefIfNonZero();
+    }
+    if (oldest != nullptr) std::ignore = oldest->Commit();
   }
 }
 
@@ -263,8 +498,11 @@ std::string RetryInterceptor::Call::DebugTag() {
 ////////////////////////////////////////////////////////////////////////////////
 // RetryInterceptor::Attempt
 
-RetryInterceptor::Attempt::Attempt(RefCountedPtr<Call> call)
-    : call_(std::move(call)), reader_(call_->request_buffer()) {
+RetryInterceptor::Attempt::Attempt(RefCountedPtr<Call> call,
+                                   int num_previous_attempts)
+    : call_(std::move(call)),
+      reader_(call_->request_buffer()),
+      num_previous_attempts_(num_previous_attempts) {
   GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " retry attempt created";
 }
 
@@ -310,16 +548,32 @@ auto RetryInterceptor::Attempt::ServerToClientGotTrailersOnlyResponse() {
         GRPC_TRACE_LOG(retry, INFO)
             << self->DebugTag()
             << " got server trailing metadata: " << md->DebugString();
-        auto delay = self->call_->ShouldRetry(
-            *md,
-            [self = self.get()]() -> std::string { return self->DebugTag(); });
+        auto lazy_attempt_debug_string = [self = self.get()]() -> std::string {
+          return self->DebugTag();
+        };
+        std::optional<Duration> delay;
+        bool finished = false;
+        if (self->call_->hedging()) {
+          finished = !self->call_->ShouldCommitHedgedResponse(
+              self.get(), *md, lazy_attempt_debug_string);
+        } else {
+          delay = self->call_->ShouldRetry(*md, lazy_attempt_debug_string);
+        }
         return If(
-            delay.has_value(),
+            finished || delay.has_value(),
             [self, delay]() {
-              return Map(Sleep(*delay), [call = self->call_](absl::Status) {
-                call->StartAttempt();
-                return absl::OkStatus();
-              });
+              return If(
+                  delay.has_value(),
+                  [self, delay]() {
+                    return Map(Sleep(*delay),
+                               [call = self->call_](absl::Status) {
+                                 call->StartAttempt();
+                                 return absl::OkStatus();
+                               });
+                  },
+                  // A hedged attempt that failed non-fatally just finishes;
+                  // the call continues on its other attempts.
+                  []() { return []() { return absl::OkStatus(); }; });
             },
             [self, md = std::move(md)]() mutable {
               if (!self->Commit()) return absl::CancelledError();
@@ -347,12 +601,30 @@ auto RetryInterceptor::Attempt::ServerToClient() {
 }
 
 bool RetryInterceptor::Attempt::Commit(SourceLocation whence) {
-  if (committed_) return true;
   GRPC_TRACE_LOG(retry, INFO) << DebugTag() << " commit attempt from "
                               << whence.file() << ":" << whence.line();
-  if (!call_->IsCurrentAttempt(this)) return false;
-  committed_ = true;
-  call_->request_buffer()->Commit(reader());
+  return call_->CommitAttempt(this);
+}
+
+bool RetryInterceptor::Attempt::MarkCancelled() {
+  MutexLockIfHedging lock(&mu_, call_->hedging());
+  cancelled_ = true;
+  return child_call_started_;
+}
+
+bool RetryInterceptor::Attempt::MaybeStartChildCall(
+    ClientMetadataHandle metadata) {
+  {
+    MutexLockIfHedging lock(&mu_, call_->hedging());
+    // A hedged attempt may be cancelled before it got this far.
+    if (cancelled_) return false;
+    initiator_ = call_->interceptor()->MakeChildCall(
+        std::move(metadata), call_->call_handler()->arena()->Ref());
+    child_call_started_ = true;
+  }
+  call_->call_handler()->AddChildCall(initiator_);
+  initiator_.SpawnGuarded("server_to_client",
+                          [self = Ref()]() { return self->ServerToClient(); });
   return true;
 }
 
@@ -360,33 +632,40 @@ auto RetryInterceptor::Attempt::ClientToServer() {
   return TrySeq(
       reader_.PullClientInitialMetadata(),
       [self = Ref()](ClientMetadataHandle metadata) {
-        int num_attempts_completed = self->call_->num_attempts_completed();
-        if (GPR_UNLIKELY(num_attempts_completed > 0)) {
+        if (GPR_UNLIKELY(self->num_previous_attempts_ > 0)) {
           metadata->Set(GrpcPreviousRpcAttemptsMetadata(),
-                        num_attempts_completed);
+                        self->num_previous_attempts_);
         } else {
           metadata->Remove(GrpcPreviousRpcAttemptsMetadata());
         }
-        self->initiator_ = self->call_->interceptor()->MakeChildCall(
-            std::move(metadata), self->call_->call_handler()->arena()->Ref());
-        self->call_->call_handler()->AddChildCall(self->initiator_);
-        self->initiator_.SpawnGuarded(
-            "server_to_client", [self]() { return self->ServerToClient(); });
-        return ForEach(MessagesFrom(&self->reader_),
-                       [self](MessageHandle message) {
-                         self->initiator_.SpawnPushMessage(std::move(message));
-                         return Success{};
-                       });
+        const bool started = self->MaybeStartChildCall(std::move(metadata));
+        return If(
+            started,
+            [self]() {
+              return ForEach(MessagesFrom(&self->reader_),
+                             [self](MessageHandle message) {
+                               self->initiator_.SpawnPushMessage(
+                                   std::move(message));
+                               return Success{};
+                             });
+            },
+            []() { return []() -> StatusFlag { return Failure{}; }; });
       });
 }
 
 void RetryInterceptor::Attempt::Start() {
   call_->call_handler()->SpawnGuardedUntilCallCompletes(
-      "buffer_to_server", [self = Ref()]() { return self->ClientToServer(); });
+      "buffer_to_server", [self = Ref()]() {
+        return Map(self->ClientToServer(),
+                   [self](StatusFlag status) -> StatusFlag {
+                     // Once another attempt commits, reads from the request
+                     // buffer by this one fail; that must not fail the call.
+                     if (!status.ok() && self->cancelled()) return Success{};
+                     return status;
+                   });
+      });
 }
 
-void RetryInterceptor::Attempt::Cancel() { initiator_.SpawnCancel(); }
-
 std::string RetryInterceptor::Attempt::DebugTag() const {
   return absl::StrFormat("%s attempt:%p", call_->DebugTag(), this);
 }
@@ -15,6 +15,8 @@
 #ifndef GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_INTERCEPTOR_H
 #define GRPC_SRC_CORE_CLIENT_CHANNEL_RETRY_INTERCEPTOR_H
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/inlined_vector.h"
 #include "src/core/call/interception_chain.h"
 #include "src/core/call/request_buffer.h"
 #include "src/core/client_channel/client_channel_args.h"
@@ -22,6 +24,7 @@
 #include "src/core/client_channel/retry_throttle.h"
 #include "src/core/filter/filter_args.h"
 #include "src/core/util/backoff.h"
+#include "src/core/util/sync.h"
 
 namespace grpc_core {
 
@@ -56,6 +59,48 @@ class RetryState {
   BackOff retry_backoff_;
 };
 
+// Tracks the hedgingPolicy decisions for a single call.
+// Unlike RetryState, more than one attempt may be in flight at a time: a new
+// attempt is started every hedging_delay() until one of them commits or
+// max_attempts() have been started.
+class HedgingState {
+ public:
+  HedgingState(const internal::RetryMethodConfig* hedging_policy,
+               RefCountedPtr<internal::RetryThrottler> retry_throttler);
+
+  // Returns true if another hedged attempt may be started now.
+  // Does not count the first attempt, which is always started.
+  bool CanStartAttempt();
+  void RecordAttemptStarted() { ++num_attempts_started_; }
+
+  // Called when an attempt gets a trailers-only response.
+  // if nullopt --> commit this attempt's response
+  // if duration --> the failure was non-fatal: start the next hedged attempt
+  //                 after duration, if CanStartAttempt() permits it
+  std::optional<Duration> OnAttemptFailed(
+      const ServerMetadata& md, bool committed,
+      absl::FunctionRef<std::string()> lazy_attempt_debug_string);
+
+  int num_attempts_started() const { return num_attempts_started_; }
+  Duration hedging_delay() const { return hedging_policy_->hedging_delay(); }
+
+  template <typename Sink>
+  friend void AbslStringify(Sink& sink, const HedgingState& state) {
+    sink.Append(absl::StrCat("policy:{", *state.hedging_policy_,
+                             "} throttler:", state.retry_throttler_ != nullptr,
+                             " attempts:", state.num_attempts_started_,
+                             " stopped:", state.stopped_));
+  }
+
+ private:
+  const internal::RetryMethodConfig* const hedging_policy_;
+  RefCountedPtr<internal::RetryThrottler> retry_throttler_;
+  int num_attempts_started_ = 1;
+  // Set by server push-back or throttling: no further attempts are started,
+  // but those already in flight may still succeed.
+  bool stopped_ = false;
+};
+
 }  // namespace retry_detail
 
 class RetryInterceptor : public Interceptor {
@@ -78,6 +123,28 @@ class RetryInterceptor : public Interceptor {
  private:
   class Attempt;
 
+  // Locks mu only for a hedged call.  A call with a retryPolicy runs one
+  // attempt at a time, and its attempts' state is touched only as the
+  // interceptor did before hedging, without a lock; this keeps mutex traffic
+  // off every retry call.
+  class ABSL_SCOPED_LOCKABLE MutexLockIfHedging {
+   public:
+    MutexLockIfHedging(Mutex* mu, bool hedging)
+        ABSL_EXCLUSIVE_LOCK_FUNCTION(mu)
+        : mu_(hedging ? mu : nullptr) {
+      if (mu_ != nullptr) mu_->Lock();
+    }
+    ~MutexLockIfHedging() ABSL_UNLOCK_FUNCTION() {
+      if (mu_ != nullptr) mu_->Unlock();
+    }
+
+    MutexLockIfHedging(const MutexLockIfHedging&) = delete;
+    MutexLockIfHedging& operator=(const MutexLockIfHedging&) = delete;
+
+   private:
+    Mutex* const mu_;
+  };
+
   class Call final
       : public RefCounted<Call, NonPolymorphicRefCount, UnrefCallDtor> {
    public:
@@ -89,6 +156,7 @@ class RetryInterceptor : public Interceptor {
     RequestBuffer* request_buffer() { return &request_buffer_; }
     CallHandler* call_handler() { return &call_handler_; }
     RetryInterceptor* interceptor() { return interceptor_.get(); }
+    bool hedging() const { return hedging_; }
     // if nullopt --> commit & don't retry
     // if duration --> retry after duration
     std::optional<Duration> ShouldRetry(
@@ -97,44 +165,82 @@ class RetryInterceptor : public Interceptor {
       return retry_state_.ShouldRetry(md, request_buffer_.committed(),
                                       lazy_attempt_debug_string);
     }
+    // Hedging counterpart of ShouldRetry(): called when a hedged attempt
+    // gets a trailers-only response.  Returns true if that response should
+    // be committed and surfaced to the application, or false if the call
+    // continues on other attempts (in which case the caller's attempt is
+    // finished).
+    bool ShouldCommitHedgedResponse(
+        Attempt* attempt, const ServerMetadata& md,
+        absl::FunctionRef<std::string()> lazy_attempt_debug_string);
     int num_attempts_completed() const {
       return retry_state_.num_attempts_completed();
     }
-    void RemoveAttempt(Attempt* attempt) {
-      if (current_attempt_ == attempt) current_attempt_ = nullptr;
-    }
-    bool IsCurrentAttempt(Attempt* attempt) {
-      CHECK(attempt != nullptr);
-      return current_attempt_ == attempt;
-    }
+    void RemoveAttempt(Attempt* attempt);
+    // Commits the call to attempt and cancels every other attempt.
+    // Returns false if a different attempt has already won.
+    bool CommitAttempt(Attempt* attempt);
 
     std::string DebugTag();
 
    private:
+    using AttemptList = absl::InlinedVector<RefCountedPtr<Attempt>, 1>;
+
     void MaybeCommit(size_t buffered);
     auto ClientToBuffer();
+    RefCountedPtr<Attempt> MakeAttemptLocked(int num_previous_attempts)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+    // Removes all attempts other than keep from attempts_, marking them
+    // cancelled.  Returns those whose child call must be cancelled, which
+    // is done after releasing mu_.
+    AttemptList TakeAttemptsExceptLocked(Attempt* keep)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+    bool CanStartHedgedAttemptLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+    void ScheduleHedgedAttempt(Duration delay, uint64_t generation);
+    void MaybeStartHedgedAttempt(uint64_t generation);
 
     RequestBuffer request_buffer_;
     CallHandler call_handler_;
     RefCountedPtr<RetryInterceptor> interceptor_;
-    Attempt* current_attempt_ = nullptr;
+    const bool hedging_;
+    Mutex mu_;
+    // Attempts that may still commit, in the order they were started.
+    // With a retryPolicy there is at most one; with a hedgingPolicy there
+    // may be up to maxAttempts.
+    absl::InlinedVector<Attempt*, 1> attempts_ ABSL_GUARDED_BY(mu_);
+    Attempt* committed_attempt_ ABSL_GUARDED_BY(mu_) = nullptr;
     retry_detail::RetryState retry_state_;
+    std::optional<retry_detail::HedgingState> hedging_state_
+        ABSL_GUARDED_BY(mu_);
+    // Bumped whenever the hedging timer is rescheduled, so that a stale
+    // timer firing does not start an extra attempt.
+    uint64_t hedge_timer_generation_ ABSL_GUARDED_BY(mu_) = 0;
   };
 
   class Attempt final
       : public RefCounted<Attempt, NonPolymorphicRefCount, UnrefCallDtor> {
    public:
-    explicit Attempt(RefCountedPtr<Call> call);
+    Attempt(RefCountedPtr<Call> call, int num_previous_attempts);
     ~Attempt();
 
     void Start();
-    void Cancel();
+    // Marks the attempt as abandoned, so that it will not start a child call
+    // and its failure to read the request buffer does not fail the call.
+    // Returns true if a child call was already started, in which case
+    // CancelChildCall() must be called to cancel it.
+    GRPC_MUST_USE_RESULT bool MarkCancelled();
+    void CancelChildCall() { initiator_.SpawnCancel(); }
     GRPC_MUST_USE_RESULT bool Commit(SourceLocation whence = {});
     RequestBuffer::Reader* reader() { return &reader_; }
 
     std::string DebugTag() const;
 
    private:
+    bool cancelled() {
+      MutexLockIfHedging lock(&mu_, call_->hedging());
+      return cancelled_;
+    }
+    bool MaybeStartChildCall(ClientMetadataHandle metadata);
     auto ClientToServer();
     auto ServerToClient();
     auto ServerToClientGotInitialMetadata(ServerMetadataHandle md);
@@ -143,7 +249,10 @@ class RetryInterceptor : public Interceptor {
     RefCountedPtr<Call> call_;
     RequestBuffer::Reader reader_;
     CallInitiator initiator_;
-    bool committed_ = false;
+    const int num_previous_attempts_;
+    Mutex mu_;
+    bool cancelled_ ABSL_GUARDED_BY(mu_) = false;
+    bool child_call_started_ ABSL_GUARDED_BY(mu_) = false;
   };
 
   const internal::RetryMethodConfig* GetRetryPolicy();
@@ -41,6 +41,48 @@
 namespace grpc_core {
 namespace internal {
 
+namespace {
+
+// Validates maxAttempts for either a retryPolicy or a hedgingPolicy.
+void ValidateMaxAttempts(absl::string_view policy_name, int* max_attempts,
+                         ValidationErrors* errors) {
+  ValidationErrors::ScopedField field(errors, ".maxAttempts");
+  if (errors->FieldHasErrors()) return;
+  if (*max_attempts <= 1) {
+    errors->AddError("must be at least 2");
+  } else if (*max_attempts > MAX_MAX_RETRY_ATTEMPTS) {
+    LOG(ERROR) << "service config: clamped " << policy_name
+               << ".maxAttempts at " << MAX_MAX_RETRY_ATTEMPTS;
+    *max_attempts = MAX_MAX_RETRY_ATTEMPTS;
+  }
+}
+
+// Parses an optional list of status code names, such as
+// retryableStatusCodes or nonFatalStatusCodes.
+StatusCodeSet LoadStatusCodeSet(const Json& json, const JsonArgs& args,
+                                absl::string_view field_name,
+                                ValidationErrors* errors) {
+  StatusCodeSet status_codes;
+  auto status_code_list = LoadJsonObjectField<std::vector<std::string>>(
+      json.object(), args, field_name, errors, /*required=*/false);
+  if (status_code_list.has_value()) {
+    for (size_t i = 0; i < status_code_list->size(); ++i) {
+      ValidationErrors::ScopedField field(
+          errors, absl::StrCat(".", field_name, "[", i, "]"));
+      grpc_status_code status;
+      if (!grpc_status_code_from_string((*status_code_list)[i].c_str(),
+                                        &status)) {
+        errors->AddError("failed to parse status code");
+      } else {
+        status_codes.Add(status);
+      }
+    }
+  }
+  return status_codes;
+}
+
+}  // namespace
+
 //
 // RetryGlobalConfig
 //
@@ -134,18 +176,7 @@ const JsonLoaderInterface* RetryMethodConfig::JsonLoader(const JsonArgs&) {
 void RetryMethodConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
                                      ValidationErrors* errors) {
   // Validate maxAttempts.
-  {
-    ValidationErrors::ScopedField field(errors, ".maxAttempts");
-    if (!errors->FieldHasErrors()) {
-      if (max_attempts_ <= 1) {
-        errors->AddError("must be at least 2");
-      } else if (max_attempts_ > MAX_MAX_RETRY_ATTEMPTS) {
-        LOG(ERROR) << "service config: clamped retryPolicy.maxAttempts at "
-                   << MAX_MAX_RETRY_ATTEMPTS;
-        max_attempts_ = MAX_MAX_RETRY_ATTEMPTS;
-      }
-    }
-  }
+  ValidateMaxAttempts("retryPolicy", &max_attempts_, errors);
   // Validate initialBackoff.
   {
     ValidationErrors::ScopedField field(errors, ".initialBackoff");
@@ -168,22 +199,8 @@ void RetryMethodConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
     }
   }
   // Parse retryableStatusCodes.
-  auto status_code_list = LoadJsonObjectField<std::vector<std::string>>(
-      json.object(), args, "retryableStatusCodes", errors,
-      /*required=*/false);
-  if (status_code_list.has_value()) {
-    for (size_t i = 0; i < status_code_list->size(); ++i) {
-      ValidationErrors::ScopedField field(
-          errors, absl::StrCat(".retryableStatusCodes[", i, "]"));
-      grpc_status_code status;
-      if (!grpc_status_code_from_string((*status_code_list)[i].c_str(),
-                                        &status)) {
-        errors->AddError("failed to parse status code");
-      } else {
-        retryable_status_codes_.Add(status);
-      }
-    }
-  }
+  retryable_status_codes_ =
+      LoadStatusCodeSet(json, args, "retryableStatusCodes", errors);
   // Validate perAttemptRecvTimeout.
   if (args.IsEnabled(GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING)) {
     if (per_attempt_recv_timeout_.has_value()) {
@@ -213,6 +230,17 @@ void RetryMethodConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
   }
 }
 
+std::unique_ptr<RetryMethodConfig> RetryMethodConfig::MakeHedgingPolicy(
+    int max_attempts, Duration hedging_delay,
+    StatusCodeSet non_fatal_status_codes) {
+  auto config = std::make_unique<RetryMethodConfig>();
+  config->max_attempts_ = max_attempts;
+  config->hedging_ = true;
+  config->hedging_delay_ = hedging_delay;
+  config->non_fatal_status_codes_ = non_fatal_status_codes;
+  return config;
+}
+
 //
 // RetryServiceConfigParser
 //
@@ -253,16 +281,51 @@ RetryServiceConfigParser::ParseGlobalParams(const ChannelArgs& /*args*/,
 
 namespace {
 
+struct HedgingPolicy {
+  int max_attempts = 0;
+  Duration hedging_delay;
+  StatusCodeSet non_fatal_status_codes;
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<HedgingPolicy>()
+            // Note: The "nonFatalStatusCodes" field requires custom parsing,
+            // so it's handled in JsonPostLoad() instead.
+            .Field("maxAttempts", &HedgingPolicy::max_attempts)
+            .OptionalField("hedgingDelay", &HedgingPolicy::hedging_delay)
+            .Finish();
+    return loader;
+  }
+
+  void JsonPostLoad(const Json& json, const JsonArgs& args,
+                    ValidationErrors* errors) {
+    ValidateMaxAttempts("hedgingPolicy", &max_attempts, errors);
+    non_fatal_status_codes =
+        LoadStatusCodeSet(json, args, "nonFatalStatusCodes", errors);
+  }
+};
+
 struct MethodConfig {
   std::unique_ptr<RetryMethodConfig> retry_policy;
+  std::optional<HedgingPolicy> hedging_policy;
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
     static const auto* loader =
         JsonObjectLoader<MethodConfig>()
             .OptionalField("retryPolicy", &MethodConfig::retry_policy)
+            .OptionalField("hedgingPolicy", &MethodConfig::hedging_policy,
+                           GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING)
             .Finish();
     return loader;
   }
+
+  void JsonPostLoad(const Json& /*json*/, const JsonArgs& /*args*/,
+                    ValidationErrors* errors) {
+    if (retry_policy != nullptr && hedging_policy.has_value()) {
+      ValidationErrors::ScopedField field(errors, ".hedgingPolicy");
+      errors->AddError("may not be specified together with retryPolicy");
+    }
+  }
 };
 
 }  // namespace
@@ -273,6 +336,12 @@ RetryServiceConfigParser::ParsePerMethodParams(const ChannelArgs& args,
                                                ValidationErrors* errors) {
   auto method_params =
       LoadFromJson<MethodConfig>(json, JsonChannelArgs(args), errors);
+  if (method_params.hedging_policy.has_value()) {
+    const HedgingPolicy& hedging_policy = *method_params.hedging_policy;
+    return RetryMethodConfig::MakeHedgingPolicy(
+        hedging_policy.max_attempts, hedging_policy.hedging_delay,
+        hedging_policy.non_fatal_status_codes);
+  }
   return std::move(method_params.retry_policy);
 }
 
@@ -65,12 +65,32 @@ class RetryMethodConfig final : public ServiceConfigParser::ParsedConfig {
     return per_attempt_recv_timeout_;
   }
 
+  // True if this config came from a hedgingPolicy rather than a
+  // retryPolicy.  In that case, only max_attempts(), hedging_delay(), and
+  // non_fatal_status_codes() are meaningful.
+  bool hedging() const { return hedging_; }
+  Duration hedging_delay() const { return hedging_delay_; }
+  StatusCodeSet non_fatal_status_codes() const {
+    return non_fatal_status_codes_;
+  }
+
+  static std::unique_ptr<RetryMethodConfig> MakeHedgingPolicy(
+      int max_attempts, Duration hedging_delay,
+      StatusCodeSet non_fatal_status_codes);
+
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
   void JsonPostLoad(const Json& json, const JsonArgs& args,
                     ValidationErrors* errors);
 
   template <typename Sink>
   friend void AbslStringify(Sink& sink, const RetryMethodConfig& config) {
+    if (config.hedging_) {
+      sink.Append(absl::StrCat(
+          "hedging max_attempts:", config.max_attempts_,
+          " hedging_delay:", config.hedging_delay_, " non_fatal_status_codes:",
+          config.non_fatal_status_codes_.ToString()));
+      return;
+    }
     sink.Append(absl::StrCat(
         "max_attempts:", config.max_attempts_, " initial_backoff:",
         config.initial_backoff_, " max_backoff:", config.max_backoff_,
@@ -89,6 +109,9 @@ class RetryMethodConfig final : public ServiceConfigParser::ParsedConfig {
   float backoff_multiplier_ = 0;
   StatusCodeSet retryable_status_codes_;
   std::optional<Duration> per_attempt_recv_timeout_;
+  bool hedging_ = false;
+  Duration hedging_delay_;
+  StatusCodeSet non_fatal_status_codes_;
 };
 
 class RetryServiceConfigParser final : public ServiceConfigParser::Parser {
@@ -130,5 +130,15 @@ void RetryThrottler::RecordSuccess() {
                                  std::numeric_limits<intptr_t>::max())));
 }
 
+bool RetryThrottler::IsThrottled() {
+  // First, check if we are stale and need to be replaced.
+  RetryThrottler* throttle_data = this;
+  GetReplacementThrottleDataIfNeeded(&throttle_data);
+  // Same threshold as RecordFailure(), but without spending a token.
+  return static_cast<uintptr_t>(
+             throttle_data->milli_tokens_.load(std::memory_order_relaxed)) <=
+         throttle_data->max_milli_tokens_ / 2;
+}
+
 }  // namespace internal
 }  // namespace grpc_core
@@ -49,6 +49,10 @@ class RetryThrottler final : public Blackboard::Entry {
   /// Records a success.
   void RecordSuccess();
 
+  /// Returns true if retries and hedged attempts are currently throttled.
+  /// Does not modify the token count.
+  bool IsThrottled();
+
   // Exposed for testing purposes only.
   uintptr_t max_milli_tokens() const { return max_milli_tokens_; }
   uintptr_t milli_token_ratio() const { return milli_token_ratio_; }
@@ -24,6 +24,7 @@
 #include <limits.h>
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <new>
 #include <optional>
@@ -78,6 +79,10 @@
 #define GRPC_SUBCHANNEL_RECONNECT_MAX_BACKOFF_SECONDS 120
 #define GRPC_SUBCHANNEL_RECONNECT_JITTER 0.2
 
+// Connection scaling parameters.
+#define GRPC_SUBCHANNEL_MAX_STREAMS_PER_CONNECTION 100
+#define GRPC_SUBCHANNEL_EXTRA_CONNECTION_IDLE_TIMEOUT_SECONDS 30
+
 // Conversion between subchannel call and call stack.
 #define SUBCHANNEL_CALL_TO_CALL_STACK(call) \
   (grpc_call_stack*)((char*)(call) +        \
@@ -100,6 +105,31 @@ ConnectedSubchannel::ConnectedSubchannel(const ChannelArgs& args)
                                                        : nullptr),
       args_(args) {}
 
+//
+// ConnectionCallCounter
+//
+
+// Tracks the calls started on a connection.
+class ConnectionCallCounter {
+ public:
+  void CallStarted() {
+    calls_started_.fetch_add(1, std::memory_order_relaxed);
+    active_calls_.fetch_add(1, std::memory_order_relaxed);
+  }
+  void CallFinished() { active_calls_.fetch_sub(1, std::memory_order_relaxed); }
+
+  size_t active_calls() const {
+    return active_calls_.load(std::memory_order_relaxed);
+  }
+  uint64_t calls_started() const {
+    return calls_started_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<size_t> active_calls_{0};
+  std::atomic<uint64_t> calls_started_{0};
+};
+
 //
 // LegacyConnectedSubchannel
 //
@@ -160,9 +190,17 @@ class LegacyConnectedSubchannel : public ConnectedSubchannel {
     elem->filter->start_transport_op(elem, op);
   }
 
+  size_t active_calls() const override { return call_counter_.active_calls(); }
+  uint64_t calls_started() const override {
+    return call_counter_.calls_started();
+  }
+
+  ConnectionCallCounter& call_counter() { return call_counter_; }
+
  private:
   RefCountedPtr<channelz::SubchannelNode> channelz_node_;
   RefCountedPtr<grpc_channel_stack> channel_stack_;
+  ConnectionCallCounter call_counter_;
 };
 
 //
@@ -178,7 +216,16 @@ class NewConnectedSubchannel : public ConnectedSubchannel {
 
     ClientTransport* transport() { return transport_.get(); }
 
+    const ConnectionCallCounter& call_counter() const { return call_counter_; }
+
     void HandleCall(CallHandler handler) override {
+      call_counter_.CallStarted();
+      if (!handler.OnDone(
+              [self = WeakRefAsSubclass<TransportCallDestination>()](bool) {
+                self->call_counter_.CallFinished();
+              })) {
+        call_counter_.CallFinished();
+      }
       transport_->StartCall(std::move(handler));
     }
 
@@ -186,6 +233,7 @@ class NewConnectedSubchannel : public ConnectedSubchannel {
 
    private:
     OrphanablePtr<ClientTransport> transport_;
+    ConnectionCallCounter call_counter_;
   };
 
   NewConnectedSubchannel(
@@ -222,6 +270,13 @@ class NewConnectedSubchannel : public ConnectedSubchannel {
 
   channelz::SubchannelNode* channelz_node() const override { return nullptr; }
 
+  size_t active_calls() const override {
+    return transport_->call_counter().active_calls();
+  }
+  uint64_t calls_started() const override {
+    return transport_->call_counter().calls_started();
+  }
+
  private:
   RefCountedPtr<UnstartedCallDestination> call_destination_;
   RefCountedPtr<TransportCallDestination> transport_;
@@ -260,6 +315,8 @@ SubchannelCall::SubchannelCall(Args args, grpc_error_handle* error)
     return;
   }
   grpc_call_stack_set_pollset_or_pollset_set(callstk, args.pollent);
+  connected_subchannel_->call_counter().CallStarted();
+  counted_ = true;
   auto* channelz_node = connected_subchannel_->channelz_node();
   if (channelz_node != nullptr) {
     channelz_node->RecordCallStarted();
@@ -311,8 +368,9 @@ void SubchannelCall::Destroy(void* arg, grpc_error_handle /*error*/) {
   SubchannelCall* self = static_cast<SubchannelCall*>(arg);
   // Keep some members before destroying the subchannel call.
   grpc_closure* after_call_stack_destroy = self->after_call_stack_destroy_;
-  RefCountedPtr<ConnectedSubchannel> connected_subchannel =
+  RefCountedPtr<LegacyConnectedSubchannel> connected_subchannel =
       std::move(self->connected_subchannel_);
+  if (self->counted_) connected_subchannel->call_counter().CallFinished();
   // Destroy the subchannel call.
   self->~SubchannelCall();
   // Destroy the call stack. This should be after destroying the subchannel
@@ -391,8 +449,9 @@ class Subchannel::ConnectedSubchannelStateWatcher final
     : public AsyncConnectivityStateWatcherInterface {
  public:
   // Must be instantiated while holding c->mu.
-  explicit ConnectedSubchannelStateWatcher(WeakRefCountedPtr<Subchannel> c)
-      : subchannel_(std::move(c)) {}
+  ConnectedSubchannelStateWatcher(WeakRefCountedPtr<Subchannel> c,
+                                  uint64_t connection_id)
+      : subchannel_(std::move(c)), connection_id_(connection_id) {}
 
   ~ConnectedSubchannelStateWatcher() override {
     subchannel_.reset(DEBUG_LOCATION, "state_watcher");
@@ -404,9 +463,6 @@ class Subchannel::ConnectedSubchannelStateWatcher final
     Subchannel* c = subchannel_.get();
     {
       MutexLock lock(&c->mu_);
-      // If we're either shutting down or have already seen this connection
-      // failure (i.e., c->connected_subchannel_ is null), do nothing.
-      //
       // The transport reports TRANSIENT_FAILURE upon GOAWAY but SHUTDOWN
       // upon connection close.  So if the server gracefully shuts down,
       // we will see TRANSIENT_FAILURE followed by SHUTDOWN, but if not, we
@@ -414,41 +470,13 @@ class Subchannel::ConnectedSubchannelStateWatcher final
       // see, ignoring anything that happens after that.
       if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE ||
           new_state == GRPC_CHANNEL_SHUTDOWN) {
-        RefCountedPtr<ConnectedSubchannel> connected_subchannel =
-            std::move(c->connected_subchannel_);
-        if (connected_subchannel == nullptr) return;
-        GRPC_TRACE_LOG(subchannel, INFO)
-            << "subchannel " << c << " " << c->key_.ToString()
-            << ": Connected subchannel " << connected_subchannel.get()
-            << " reports " << ConnectivityStateName(new_state) << ": "
-            << status;
-        if (c->channelz_node() != nullptr) {
-          if (connected_subchannel->channelz_node() != nullptr) {
-            connected_subchannel->channelz_node()->RemoveParent(
-                c->channelz_node());
-          }
-        }
-        // If the subchannel was created from an endpoint, then we report
-        // TRANSIENT_FAILURE here instead of IDLE. The subchannel will never
-        // leave TRANSIENT_FAILURE state, because there is no way for us to
-        // establish a new connection.
-        //
-        // Otherwise, we report IDLE here. Note that even though we're not
-        // reporting TRANSIENT_FAILURE, we pass along the status from the
-        // transport, since it may have keepalive info attached to it that the
-        // channel needs.
-        // TODO(roth): Consider whether there's a cleaner way to propagate the
-        // keepalive info.
-        c->SetConnectivityStateLocked(c->created_from_endpoint_
-                                          ? GRPC_CHANNEL_TRANSIENT_FAILURE
-                                          : GRPC_CHANNEL_IDLE,
-                                      status);
-        c->backoff_.Reset();
+        c->OnConnectionFailedLocked(connection_id_, new_state, status);
       }
     }
   }
 
   WeakRefCountedPtr<Subchannel> subchannel_;
+  const uint64_t connection_id_;
 };
 
 //
@@ -516,6 +544,28 @@ BackOff::Options ParseArgsForBackoffValues(const ChannelArgs& args,
       .set_max_backoff(max_backoff);
 }
 
+size_t GetMaxConnections(const ChannelArgs& args) {
+  // A subchannel created from an endpoint has no way to open another
+  // connection.
+  if (args.Contains(GRPC_ARG_SUBCHANNEL_ENDPOINT)) return 1;
+  return std::max(
+      1, args.GetInt(GRPC_ARG_MAX_CONNECTIONS_PER_SUBCHANNEL).value_or(1));
+}
+
+size_t GetMaxStreamsPerConnection(const ChannelArgs& args) {
+  return std::max(1, args.GetInt(GRPC_ARG_SUBCHANNEL_MAX_STREAMS_PER_CONNECTION)
+                         .value_or(GRPC_SUBCHANNEL_MAX_STREAMS_PER_CONNECTION));
+}
+
+Duration GetExtraConnectionIdleTimeout(const ChannelArgs& args) {
+  return std::max(
+      Duration::Milliseconds(100),
+      args.GetDurationFromIntMillis(
+              GRPC_ARG_SUBCHANNEL_EXTRA_CONNECTION_IDLE_TIMEOUT_MS)
+          .value_or(Duration::Seconds(
+              GRPC_SUBCHANNEL_EXTRA_CONNECTION_IDLE_TIMEOUT_SECONDS)));
+}
+
 }  // namespace
 
 Subchannel::Subchannel(SubchannelKey key,
@@ -531,6 +581,9 @@ Subchannel::Subchannel(SubchannelKey key,
       connector_(std::move(connector)),
       watcher_list_(this),
       work_serializer_(args_.GetObjectRef<EventEngine>()),
+      max_connections_(GetMaxConnections(args_)),
+      max_streams_per_connection_(GetMaxStreamsPerConnection(args_)),
+      extra_connection_idle_timeout_(GetExtraConnectionIdleTimeout(args_)),
       backoff_(ParseArgsForBackoffValues(args_, &min_connect_timeout_)),
       event_engine_(args_.GetObjectRef<EventEngine>()) {
   // A grpc_init is added here to ensure that grpc_shutdown does not happen
@@ -685,6 +738,11 @@ void Subchannel::Orphaned() {
   shutdown_ = true;
   connector_.reset();
   connected_subchannel_.reset();
+  extra_connections_.clear();
+  if (extra_connection_idle_timer_handle_.has_value()) {
+    event_engine_->Cancel(*extra_connection_idle_timer_handle_);
+    extra_connection_idle_timer_handle_.reset();
+  }
 }
 
 void Subchannel::GetOrAddDataProducer(
@@ -759,10 +817,14 @@ void Subchannel::StartConnectingLocked() {
   // Report CONNECTING.
   SetConnectivityStateLocked(GRPC_CHANNEL_CONNECTING, absl::OkStatus());
   // Start connection attempt.
+  ConnectLocked(std::max(next_attempt_time_, min_deadline));
+}
+
+void Subchannel::ConnectLocked(Timestamp deadline) {
   SubchannelConnector::Args args;
   args.address = &address_for_connect_;
   args.interested_parties = pollset_set_;
-  args.deadline = std::max(next_attempt_time_, min_deadline);
+  args.deadline = deadline;
   args.channel_args = args_;
   WeakRef(DEBUG_LOCATION, "Connect").release();  // Ref held by callback.
   connector_->Connect(args, &connecting_result_, &on_connecting_finished_);
@@ -782,6 +844,20 @@ void Subchannel::OnConnectingFinishedLocked(grpc_error_handle error) {
     connecting_result_.Reset();
     return;
   }
+  // An extra connection failing to come up does not affect the state of
+  // the subchannel; we just hold off on trying again for a while.
+  if (connecting_extra_) {
+    if (connecting_result_.transport == nullptr || !PublishTransportLocked()) {
+      GRPC_TRACE_LOG(subchannel, INFO)
+          << "subchannel " << this << " " << key_.ToString()
+          << ": extra connection attempt failed ("
+          << StatusToString(error) << ")";
+      connecting_extra_ = false;
+      next_extra_connection_attempt_time_ =
+          Timestamp::Now() + min_connect_timeout_;
+    }
+    return;
+  }
   // If we didn't get a transport or we fail to publish it, report
   // TRANSIENT_FAILURE and start the retry timer.
   // Note that if the connection attempt took longer than the backoff
@@ -821,6 +897,7 @@ void Subchannel::OnConnectingFinishedLocked(grpc_error_handle error) {
 
 bool Subchannel::PublishTransportLocked() {
   auto socket_node = connecting_result_.transport->GetSocketNode();
+  RefCountedPtr<ConnectedSubchannel> connected_subchannel;
   if (connecting_result_.transport->filter_stack_transport() != nullptr) {
     // Construct channel stack.
     // Builder takes ownership of transport.
@@ -838,7 +915,7 @@ bool Subchannel::PublishTransportLocked() {
                  << ": error initializing subchannel stack: " << stack.status();
       return false;
     }
-    connected_subchannel_ = MakeRefCounted<LegacyConnectedSubchannel>(
+    connected_subchannel = MakeRefCounted<LegacyConnectedSubchannel>(
         std::move(*stack), args_, channelz_node_);
   } else {
     OrphanablePtr<ClientTransport> transport(
@@ -877,28 +954,196 @@ bool Subchannel::PublishTransportLocked() {
                  << call_destination.status();
       return false;
     }
-    connected_subchannel_ = MakeRefCounted<NewConnectedSubchannel>(
+    connected_subchannel = MakeRefCounted<NewConnectedSubchannel>(
         std::move(*call_destination), std::move(transport_destination), args_);
   }
   connecting_result_.Reset();
   // Publish.
+  const uint64_t connection_id = next_connection_id_++;
   GRPC_TRACE_LOG(subchannel, INFO)
       << "subchannel " << this << " " << key_.ToString()
-      << ": new connected subchannel at " << connected_subchannel_.get();
+      << ": new connected subchannel at " << connected_subchannel.get()
+      << (connecting_extra_ ? " (extra connection)" : "");
   if (channelz_node_ != nullptr) {
     if (socket_node != nullptr) {
       socket_node->AddParent(channelz_node_.get());
     }
   }
   // Start watching connected subchannel.
-  connected_subchannel_->StartWatch(
+  connected_subchannel->StartWatch(
       pollset_set_, MakeOrphanable<ConnectedSubchannelStateWatcher>(
-                        WeakRef(DEBUG_LOCATION, "state_watcher")));
+                        WeakRef(DEBUG_LOCATION, "state_watcher"),
+                        connection_id));
+  if (std::exchange(connecting_extra_, false)) {
+    extra_connections_.push_back(
+        {connection_id, std::move(connected_subchannel),
+         /*calls_started_at_last_idle_check=*/0});
+    if (!extra_connection_idle_timer_handle_.has_value()) {
+      extra_connection_idle_timer_handle_ = event_engine_->RunAfter(
+          extra_connection_idle_timeout_,
+          [self = WeakRef(DEBUG_LOCATION, "ExtraConnectionIdleTimer")]()
+              mutable {
+                ExecCtx exec_ctx;
+                self->OnExtraConnectionIdleTimer();
+                // See comment in the retry timer callback above.
+                self.reset();
+              });
+    }
+    return true;
+  }
+  connected_subchannel_ = std::move(connected_subchannel);
+  connection_id_ = connection_id;
   // Report initial state.
   SetConnectivityStateLocked(GRPC_CHANNEL_READY, absl::Status());
   return true;
 }
 
+void Subchannel::OnConnectionFailedLocked(uint64_t connection_id,
+                                          grpc_connectivity_state new_state,
+                                          const absl::Status& status) {
+  // If we're either shutting down or have already seen this connection
+  // failure (i.e., the connection is no longer tracked), do nothing.
+  RefCountedPtr<ConnectedSubchannel> connected_subchannel;
+  const bool is_primary =
+      connected_subchannel_ != nullptr && connection_id == connection_id_;
+  if (is_primary) {
+    connected_subchannel = std::move(connected_subchannel_);
+  } else {
+    auto it = std::find_if(extra_connections_.begin(), extra_connections_.end(),
+                           [&](const ExtraConnection& extra) {
+                             return extra.id == connection_id;
+                           });
+    if (it == extra_connections_.end()) return;
+    connected_subchannel = std::move(it->connected_subchannel);
+    extra_connections_.erase(it);
+  }
+  GRPC_TRACE_LOG(subchannel, INFO)
+      << "subchannel " << this << " " << key_.ToString()
+      << ": Connected subchannel " << connected_subchannel.get()
+      << (is_primary ? "" : " (extra connection)") << " reports "
+      << ConnectivityStateName(new_state) << ": " << status;
+  if (channelz_node() != nullptr) {
+    if (connected_subchannel->channelz_node() != nullptr) {
+      connected_subchannel->channelz_node()->RemoveParent(channelz_node());
+    }
+  }
+  if (!is_primary) return;
+  // If we have extra connections, one of them takes over, and the
+  // subchannel remains READY.
+  if (!extra_connections_.empty()) {
+    connected_subchannel_ =
+        std::move(extra_connections_.back().connected_subchannel);
+    connection_id_ = extra_connections_.back().id;
+    extra_connections_.pop_back();
+    GRPC_TRACE_LOG(subchannel, INFO)
+        << "subchannel " << this << " " << key_.ToString()
+        << ": extra connection " << connected_subchannel_.get()
+        << " takes over";
+    return;
+  }
+  backoff_.Reset();
+  // If an extra connection attempt is in flight, it becomes the
+  // subchannel's reconnection attempt.
+  if (connecting_extra_) {
+    connecting_extra_ = false;
+    next_attempt_time_ = Timestamp::Now() + backoff_.NextAttemptDelay();
+    SetConnectivityStateLocked(GRPC_CHANNEL_CONNECTING, absl::OkStatus());
+    return;
+  }
+  // If the subchannel was created from an endpoint, then we report
+  // TRANSIENT_FAILURE here instead of IDLE. The subchannel will never
+  // leave TRANSIENT_FAILURE state, because there is no way for us to
+  // establish a new connection.
+  //
+  // Otherwise, we report IDLE here. Note that even though we're not
+  // reporting TRANSIENT_FAILURE, we pass along the status from the
+  // transport, since it may have keepalive info attached to it that the
+  // channel needs.
+  // TODO(roth): Consider whether there's a cleaner way to propagate the
+  // keepalive info.
+  SetConnectivityStateLocked(created_from_endpoint_
+                                 ? GRPC_CHANNEL_TRANSIENT_FAILURE
+                                 : GRPC_CHANNEL_IDLE,
+                             status);
+}
+
+RefCountedPtr<ConnectedSubchannel> Subchannel::PickConnectedSubchannelLocked() {
+  if (connected_subchannel_ == nullptr) return nullptr;
+  if (max_connections_ == 1) return connected_subchannel_;
+  // Use the first connection that has room for another call, so that
+  // calls stay packed onto as few connections as possible and extra
+  // connections drain once load drops.  If every connection is full, use
+  // the least loaded one and try to open another.
+  ConnectedSubchannel* picked = connected_subchannel_.get();
+  size_t picked_calls = picked->active_calls();
+  for (const ExtraConnection& extra : extra_connections_) {
+    if (picked_calls < max_streams_per_connection_) break;
+    const size_t calls = extra.connected_subchannel->active_calls();
+    if (calls < picked_calls) {
+      picked = extra.connected_subchannel.get();
+      picked_calls = calls;
+    }
+  }
+  if (picked_calls >= max_streams_per_connection_) {
+    MaybeStartExtraConnectionLocked();
+  }
+  return picked->Ref();
+}
+
+void Subchannel::MaybeStartExtraConnectionLocked() {
+  if (shutdown_ || state_ != GRPC_CHANNEL_READY || connecting_extra_ ||
+      1 + extra_connections_.size() >= max_connections_) {
+    return;
+  }
+  const Timestamp now = Timestamp::Now();
+  if (now < next_extra_connection_attempt_time_) return;
+  GRPC_TRACE_LOG(subchannel, INFO)
+      << "subchannel " << this << " " << key_.ToString()
+      << ": all " << 1 + extra_connections_.size()
+      << " connections are at their stream limit, opening another";
+  connecting_extra_ = true;
+  ConnectLocked(now + min_connect_timeout_);
+}
+
+void Subchannel::OnExtraConnectionIdleTimer() {
+  std::vector<RefCountedPtr<ConnectedSubchannel>> idle_connections;
+  {
+    MutexLock lock(&mu_);
+    extra_connection_idle_timer_handle_.reset();
+    if (shutdown_) return;
+    // Close extras that have not started a call since the last check and
+    // have no calls in flight.
+    for (auto it = extra_connections_.begin();
+         it != extra_connections_.end();) {
+      const uint64_t calls_started = it->connected_subchannel->calls_started();
+      if (it->connected_subchannel->active_calls() == 0 &&
+          calls_started == it->calls_started_at_last_idle_check) {
+        GRPC_TRACE_LOG(subchannel, INFO)
+            << "subchannel " << this << " " << key_.ToString()
+            << ": closing idle extra connection "
+            << it->connected_subchannel.get();
+        idle_connections.push_back(std::move(it->connected_subchannel));
+        it = extra_connections_.erase(it);
+      } else {
+        it->calls_started_at_last_idle_check = calls_started;
+        ++it;
+      }
+    }
+    if (!extra_connections_.empty()) {
+      extra_connection_idle_timer_handle_ = event_engine_->RunAfter(
+          extra_connection_idle_timeout_,
+          [self = WeakRef(DEBUG_LOCATION, "ExtraConnectionIdleTimer")]()
+              mutable {
+                ExecCtx exec_ctx;
+                self->OnExtraConnectionIdleTimer();
+                self.reset();
+              });
+    }
+  }
+  // The connections are shut down as the last refs go away, outside of
+  // the lock.
+}
+
 ChannelArgs Subchannel::MakeSubchannelArgs(
     const ChannelArgs& channel_args, const ChannelArgs& address_args,
     const RefCountedPtr<SubchannelPoolInterface>& subchannel_pool,
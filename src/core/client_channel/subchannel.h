@@ -21,10 +21,13 @@
 #include <grpc/impl/connectivity_state.h>
 #include <grpc/support/port_platform.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include <functional>
 #include <map>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
@@ -87,6 +90,12 @@ class ConnectedSubchannel : public RefCounted<ConnectedSubchannel> {
 
   virtual channelz::SubchannelNode* channelz_node() const = 0;
 
+  // Number of calls currently in flight on this connection, and the total
+  // number of calls ever started on it.  Used by the subchannel to spread
+  // calls across its connections.
+  virtual size_t active_calls() const = 0;
+  virtual uint64_t calls_started() const = 0;
+
  protected:
   explicit ConnectedSubchannel(const ChannelArgs& args);
 
@@ -156,6 +165,8 @@ class SubchannelCall final {
   grpc_closure* original_recv_trailing_metadata_ = nullptr;
   grpc_metadata_batch* recv_trailing_metadata_ = nullptr;
   Timestamp deadline_;
+  // Whether this call was counted against the connection's active calls.
+  bool counted_ = false;
 };
 
 // A subchannel that knows how to connect to exactly one target address. It
@@ -234,16 +245,21 @@ class Subchannel final : public DualRefCounted<Subchannel> {
   void CancelConnectivityStateWatch(ConnectivityStateWatcherInterface* watcher)
       ABSL_LOCKS_EXCLUDED(mu_);
 
+  // Returns the connection that the next call should be started on, or
+  // null if the subchannel is not connected.  If the subchannel has
+  // several connections, this is the first one that is not yet carrying
+  // its maximum number of calls.
   RefCountedPtr<ConnectedSubchannel> connected_subchannel()
       ABSL_LOCKS_EXCLUDED(mu_) {
     MutexLock lock(&mu_);
-    return connected_subchannel_;
+    return PickConnectedSubchannelLocked();
   }
 
   RefCountedPtr<UnstartedCallDestination> call_destination() {
     MutexLock lock(&mu_);
-    if (connected_subchannel_ == nullptr) return nullptr;
-    return connected_subchannel_->unstarted_call_destination();
+    auto connected_subchannel = PickConnectedSubchannelLocked();
+    if (connected_subchannel == nullptr) return nullptr;
+    return connected_subchannel->unstarted_call_destination();
   }
 
   // Attempt to connect to the backend.  Has no effect if already connected.
@@ -316,6 +332,15 @@ class Subchannel final : public DualRefCounted<Subchannel> {
 
   class ConnectedSubchannelStateWatcher;
 
+  // A connection opened in addition to connected_subchannel_ because
+  // all existing connections were carrying their maximum number of calls.
+  struct ExtraConnection {
+    uint64_t id;
+    RefCountedPtr<ConnectedSubchannel> connected_subchannel;
+    // Value of connected_subchannel->calls_started() at the last idle check.
+    uint64_t calls_started_at_last_idle_check = 0;
+  };
+
   // Sets the subchannel's connectivity state to \a state.
   void SetConnectivityStateLocked(grpc_connectivity_state state,
                                   const absl::Status& status)
@@ -330,6 +355,18 @@ class Subchannel final : public DualRefCounted<Subchannel> {
   void OnConnectingFinishedLocked(grpc_error_handle error)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   bool PublishTransportLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void ConnectLocked(Timestamp deadline) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Invoked when the connection with the specified id reports a failure.
+  void OnConnectionFailedLocked(uint64_t connection_id,
+                                grpc_connectivity_state new_state,
+                                const absl::Status& status)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  // Methods for connection scaling.
+  RefCountedPtr<ConnectedSubchannel> PickConnectedSubchannelLocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void MaybeStartExtraConnectionLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void OnExtraConnectionIdleTimer() ABSL_LOCKS_EXCLUDED(mu_);
 
   // The subchannel pool this subchannel is in.
   RefCountedPtr<SubchannelPoolInterface> subchannel_pool_;
@@ -376,6 +413,24 @@ class Subchannel final : public DualRefCounted<Subchannel> {
 
   // Active connection, or null.
   RefCountedPtr<ConnectedSubchannel> connected_subchannel_ ABSL_GUARDED_BY(mu_);
+  uint64_t connection_id_ ABSL_GUARDED_BY(mu_) = 0;
+  uint64_t next_connection_id_ ABSL_GUARDED_BY(mu_) = 0;
+
+  // Connection scaling.  Once every connection is carrying
+  // max_streams_per_connection_ calls, up to max_connections_ - 1 extra
+  // connections are opened.  Extras that start no calls for
+  // extra_connection_idle_timeout_ are closed again.  If
+  // connected_subchannel_ fails while extras exist, one of them takes its
+  // place.
+  const size_t max_connections_;
+  const size_t max_streams_per_connection_;
+  const Duration extra_connection_idle_timeout_;
+  std::vector<ExtraConnection> extra_connections_ ABSL_GUARDED_BY(mu_);
+  // True while connector_ is busy opening an extra connection.
+  bool connecting_extra_ ABSL_GUARDED_BY(mu_) = false;
+  Timestamp next_extra_connection_attempt_time_ ABSL_GUARDED_BY(mu_);
+  std::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+      extra_connection_idle_timer_handle_ ABSL_GUARDED_BY(mu_);
 
   // Backoff state.
   BackOff backoff_ ABSL_GUARDED_BY(mu_);
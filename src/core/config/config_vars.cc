@@ -81,6 +81,14 @@ ABSL_FLAG(absl::optional<bool>, grpc_cpp_experimental_disable_reflection, {},
           "EXPERIMENTAL. Only respected when there is a dependency on "
           ":grpc++_reflection. If true, no reflection server will be "
           "automatically added.");
+ABSL_FLAG(absl::optional<bool>, grpc_experimental_call_latency_histograms, {},
+          "EXPERIMENTAL. If true, record per-method histograms of where call "
+          "latency is spent (name resolution, LB pick, transport write queue, "
+          "kernel send, network, server queueing and handler).");
+ABSL_FLAG(absl::optional<bool>, grpc_experimental_call_cpu_accounting, {},
+          "EXPERIMENTAL. If true, measure the thread CPU time gRPC spends on "
+          "each call, record it per method, and report it to ORCA as a "
+          "request cost.");
 ABSL_FLAG(
     absl::optional<int32_t>, grpc_channelz_max_orphaned_nodes, {},
     "EXPERIMENTAL: If non-zero, extend the lifetime of channelz nodes past the "
@@ -131,6 +139,14 @@ ConfigVars::ConfigVars(const Overrides& overrides)
           LoadConfig(FLAGS_grpc_cpp_experimental_disable_reflection,
                      "GRPC_CPP_EXPERIMENTAL_DISABLE_REFLECTION",
                      overrides.cpp_experimental_disable_reflection, false)),
+      experimental_call_latency_histograms_(
+          LoadConfig(FLAGS_grpc_experimental_call_latency_histograms,
+                     "GRPC_EXPERIMENTAL_CALL_LATENCY_HISTOGRAMS",
+                     overrides.experimental_call_latency_histograms, false)),
+      experimental_call_cpu_accounting_(
+          LoadConfig(FLAGS_grpc_experimental_call_cpu_accounting,
+                     "GRPC_EXPERIMENTAL_CALL_CPU_ACCOUNTING",
+                     overrides.experimental_call_cpu_accounting, false)),
       dns_resolver_(LoadConfig(FLAGS_grpc_dns_resolver, "GRPC_DNS_RESOLVER",
                                overrides.dns_resolver, "")),
       verbosity_(LoadConfig(FLAGS_grpc_verbosity, "GRPC_VERBOSITY",
@@ -183,6 +199,10 @@ std::string ConfigVars::ToString() const {
       ", ssl_cipher_suites: ", "\"", absl::CEscape(SslCipherSuites()), "\"",
       ", cpp_experimental_disable_reflection: ",
       CppExperimentalDisableReflection() ? "true" : "false",
+      ", experimental_call_latency_histograms: ",
+      ExperimentalCallLatencyHistograms() ? "true" : "false",
+      ", experimental_call_cpu_accounting: ",
+      ExperimentalCallCpuAccounting() ? "true" : "false",
       ", channelz_max_orphaned_nodes: ", ChannelzMaxOrphanedNodes(),
       ", experimental_target_memory_pressure: ",
       ExperimentalTargetMemoryPressure(),
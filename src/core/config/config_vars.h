@@ -43,6 +43,8 @@ class GPR_DLL ConfigVars {
     absl::optional<bool> use_system_roots_over_language_callback;
     absl::optional<bool> not_use_system_ssl_roots;
     absl::optional<bool> cpp_experimental_disable_reflection;
+    absl::optional<bool> experimental_call_latency_histograms;
+    absl::optional<bool> experimental_call_cpu_accounting;
     absl::optional<std::string> dns_resolver;
     absl::optional<std::string> verbosity;
     absl::optional<std::string> poll_strategy;
@@ -112,6 +114,17 @@ class GPR_DLL ConfigVars {
   bool CppExperimentalDisableReflection() const {
     return cpp_experimental_disable_reflection_;
   }
+  // EXPERIMENTAL. If true, record per-method histograms of where call latency
+  // is spent (name resolution, LB pick, transport write queue, kernel send,
+  // network, server queueing and handler).
+  bool ExperimentalCallLatencyHistograms() const {
+    return experimental_call_latency_histograms_;
+  }
+  // EXPERIMENTAL. If true, measure the thread CPU time gRPC spends on each
+  // call, record it per method, and report it to ORCA as a request cost.
+  bool ExperimentalCallCpuAccounting() const {
+    return experimental_call_cpu_accounting_;
+  }
   // EXPERIMENTAL: If non-zero, extend the lifetime of channelz nodes past the
   // underlying object lifetime, up to this many nodes. The value may be
   // adjusted slightly to account for implementation limits.
@@ -143,6 +156,8 @@ class GPR_DLL ConfigVars {
   bool use_system_roots_over_language_callback_;
   bool not_use_system_ssl_roots_;
   bool cpp_experimental_disable_reflection_;
+  bool experimental_call_latency_histograms_;
+  bool experimental_call_cpu_accounting_;
   std::string dns_resolver_;
   std::string verbosity_;
   std::string poll_strategy_;
@@ -0,0 +1,285 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_filter.h"
+
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/status.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/hash/hash.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/string_view.h"
+#include "src/core/config/core_configuration.h"
+#include "src/core/lib/channel/channel_stack.h"
+#include "src/core/lib/promise/context.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/surface/channel_stack_type.h"
+#include "src/core/util/latent_see.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+namespace {
+
+constexpr absl::string_view kMetricLabelMethod = "grpc.method";
+constexpr absl::string_view kMetricLabelPriority =
+    "grpc.adaptive_concurrency.priority";
+// Method label for calls to unregistered methods, and to registered methods
+// beyond kMaxTrackedMethods.
+constexpr absl::string_view kOtherMethodLabel = "other";
+
+const auto kMetricRejectedCalls =
+    GlobalInstrumentsRegistry::RegisterUInt64Counter(
+        "grpc.server.adaptive_concurrency.rejected_calls",
+        "EXPERIMENTAL.  Number of calls rejected for exceeding the adaptive "
+        "concurrency limit.",
+        "{call}", false)
+        .Labels(kMetricLabelMethod, kMetricLabelPriority)
+        .Build();
+
+const auto kMetricLimit =
+    GlobalInstrumentsRegistry::RegisterCallbackInt64Gauge(
+        "grpc.server.adaptive_concurrency.limit",
+        "EXPERIMENTAL.  Current adaptive concurrency limit.", "{call}", false)
+        .Labels(kMetricLabelMethod)
+        .Build();
+
+const auto kMetricInFlightCalls =
+    GlobalInstrumentsRegistry::RegisterCallbackInt64Gauge(
+        "grpc.server.adaptive_concurrency.in_flight_calls",
+        "EXPERIMENTAL.  Number of calls admitted by the adaptive concurrency "
+        "limiter that have not yet completed.",
+        "{call}", false)
+        .Labels(kMetricLabelMethod)
+        .Build();
+
+const auto kMetricNoLoadLatency =
+    GlobalInstrumentsRegistry::RegisterCallbackDoubleGauge(
+        "grpc.server.adaptive_concurrency.no_load_latency",
+        "EXPERIMENTAL.  Latency the adaptive concurrency limiter currently "
+        "assumes for an unloaded server.",
+        "s", false)
+        .Labels(kMetricLabelMethod)
+        .Build();
+
+AdaptiveConcurrencyLimiter::Options OptionsFromChannelArgs(
+    const ChannelArgs& args) {
+  AdaptiveConcurrencyLimiter::Options options;
+  options.min_limit = std::max(
+      1, args.GetInt(GRPC_ARG_ADAPTIVE_CONCURRENCY_MIN_LIMIT)
+             .value_or(static_cast<int>(options.min_limit)));
+  options.max_limit = std::max(
+      static_cast<int>(options.min_limit),
+      args.GetInt(GRPC_ARG_ADAPTIVE_CONCURRENCY_MAX_LIMIT)
+          .value_or(static_cast<int>(options.max_limit)));
+  options.initial_limit = std::clamp(
+      args.GetInt(GRPC_ARG_ADAPTIVE_CONCURRENCY_INITIAL_LIMIT)
+          .value_or(static_cast<int>(options.initial_limit)),
+      static_cast<int>(options.min_limit),
+      static_cast<int>(options.max_limit));
+  return options;
+}
+
+ServerMetadataHandle RejectCall(Duration pushback) {
+  auto md = GetContext<Arena>()->MakePooled<ServerMetadata>();
+  md->Set(GrpcStatusMetadata(), GRPC_STATUS_RESOURCE_EXHAUSTED);
+  md->Set(GrpcMessageMetadata(),
+          Slice::FromStaticString("Adaptive concurrency limit exceeded"));
+  md->Set(GrpcRetryPushbackMsMetadata(), pushback);
+  return md;
+}
+
+ChannelArgs EnsureAdaptiveConcurrencyLimitsInChannelArgs(ChannelArgs args) {
+  if (!args.GetBool(GRPC_ARG_ENABLE_ADAPTIVE_CONCURRENCY_LIMIT)
+           .value_or(false) ||
+      args.GetObject<AdaptiveConcurrencyLimits>() != nullptr) {
+    return args;
+  }
+  return args.SetObject(MakeRefCounted<AdaptiveConcurrencyLimits>(args));
+}
+
+}  // namespace
+
+//
+// AdaptiveConcurrencyLimits
+//
+
+AdaptiveConcurrencyLimits::AdaptiveConcurrencyLimits(const ChannelArgs& args)
+    : options_(OptionsFromChannelArgs(args)),
+      priority_metadata_key_(absl::AsciiStrToLower(
+          args.GetString(GRPC_ARG_ADAPTIVE_CONCURRENCY_PRIORITY_METADATA_KEY)
+              .value_or(""))),
+      stats_plugins_(GlobalStatsPluginRegistry::GetStatsPluginsForServer(args)),
+      other_limiter_(options_) {
+  metric_callback_ = stats_plugins_->RegisterCallback(
+      [this](CallbackMetricReporter& reporter) { ReportMetrics(reporter); },
+      Duration::Seconds(5), kMetricLimit, kMetricInFlightCalls,
+      kMetricNoLoadLatency);
+}
+
+AdaptiveConcurrencyLimits::~AdaptiveConcurrencyLimits() {
+  // Stop metric callbacks before the limiters they report on go away.
+  metric_callback_.reset();
+  for (auto& slot : methods_) delete slot.load(std::memory_order_relaxed);
+}
+
+AdaptiveConcurrencyLimiter* AdaptiveConcurrencyLimits::GetLimiter(
+    const void* registered_method, absl::string_view path,
+    absl::string_view* label) {
+  *label = kOtherMethodLabel;
+  if (registered_method == nullptr) return &other_limiter_;
+  const size_t start = absl::HashOf(registered_method) % methods_.size();
+  MethodLimiter* created = nullptr;
+  for (size_t i = 0; i < methods_.size(); ++i) {
+    std::atomic<MethodLimiter*>& slot =
+        methods_[(start + i) % methods_.size()];
+    MethodLimiter* entry = slot.load(std::memory_order_acquire);
+    if (entry == nullptr) {
+      if (created == nullptr) {
+        if (num_methods_.fetch_add(1, std::memory_order_relaxed) >=
+            kMaxTrackedMethods) {
+          num_methods_.fetch_sub(1, std::memory_order_relaxed);
+          return &other_limiter_;
+        }
+        created = new MethodLimiter(registered_method, path, options_);
+      }
+      if (slot.compare_exchange_strong(entry, created,
+                                       std::memory_order_acq_rel,
+                                       std::memory_order_acquire)) {
+        entry = created;
+        created = nullptr;
+      }
+    }
+    // Either ours, or the entry that beat us to this slot.
+    if (entry->registered_method == registered_method) {
+      if (created != nullptr) {
+        delete created;
+        num_methods_.fetch_sub(1, std::memory_order_relaxed);
+      }
+      *label = entry->label;
+      return &entry->limiter;
+    }
+  }
+  GPR_UNREACHABLE_CODE(return &other_limiter_);
+}
+
+void AdaptiveConcurrencyLimits::RecordRejection(
+    absl::string_view label, AdaptiveConcurrencyLimiter::Priority priority) {
+  stats_plugins_->AddCounter(
+      kMetricRejectedCalls, 1,
+      {label, AdaptiveConcurrencyLimiter::PriorityName(priority)}, {});
+}
+
+void AdaptiveConcurrencyLimits::ReportMetrics(
+    CallbackMetricReporter& reporter) {
+  auto report = [&](absl::string_view label,
+                    const AdaptiveConcurrencyLimiter& limiter) {
+    reporter.Report(kMetricLimit, limiter.limit(), {label}, {});
+    reporter.Report(kMetricInFlightCalls, limiter.in_flight(), {label}, {});
+    reporter.Report(kMetricNoLoadLatency, limiter.no_load_latency().seconds(),
+                    {label}, {});
+  };
+  for (const auto& slot : methods_) {
+    const MethodLimiter* entry = slot.load(std::memory_order_acquire);
+    if (entry != nullptr) report(entry->label, entry->limiter);
+  }
+  report(kOtherMethodLabel, other_limiter_);
+}
+
+//
+// AdaptiveConcurrencyFilter
+//
+
+const grpc_channel_filter AdaptiveConcurrencyFilter::kFilter =
+    MakePromiseBasedFilter<AdaptiveConcurrencyFilter,
+                           FilterEndpoint::kServer>();
+
+absl::StatusOr<std::unique_ptr<AdaptiveConcurrencyFilter>>
+AdaptiveConcurrencyFilter::Create(const ChannelArgs& args,
+                                  ChannelFilter::Args) {
+  auto limits = args.GetObjectRef<AdaptiveConcurrencyLimits>();
+  // Channel args that did not go through preconditioning get limits of
+  // their own.
+  if (limits == nullptr) {
+    limits = MakeRefCounted<AdaptiveConcurrencyLimits>(args);
+  }
+  return std::make_unique<AdaptiveConcurrencyFilter>(std::move(limits));
+}
+
+ServerMetadataHandle AdaptiveConcurrencyFilter::Call::OnClientInitialMetadata(
+    ClientMetadata& md, AdaptiveConcurrencyFilter* filter) {
+  GRPC_LATENT_SEE_SCOPE(
+      "AdaptiveConcurrencyFilter::Call::OnClientInitialMetadata");
+  AdaptiveConcurrencyLimits& limits = *filter->limits_;
+  const Slice* path = md.get_pointer(HttpPathMetadata());
+  absl::string_view label;
+  AdaptiveConcurrencyLimiter* limiter = limits.GetLimiter(
+      md.get(GrpcRegisteredMethod()).value_or(nullptr),
+      path == nullptr ? absl::string_view() : path->as_string_view(), &label);
+  auto priority = AdaptiveConcurrencyLimiter::Priority::kDefault;
+  if (!limits.priority_metadata_key().empty()) {
+    std::string buffer;
+    auto value = md.GetStringValue(limits.priority_metadata_key(), &buffer);
+    if (value.has_value()) {
+      priority = AdaptiveConcurrencyLimiter::ParsePriority(*value);
+    }
+  }
+  if (!limiter->TryAcquire(priority)) {
+    limits.RecordRejection(label, priority);
+    // Suggest retrying after roughly one call's worth of latency, by which
+    // time some of the calls in flight should have completed.
+    return RejectCall(
+        std::max(Duration::Milliseconds(1), limiter->recent_latency()));
+  }
+  limiter_ = limiter;
+  start_ = gpr_get_cycle_counter();
+  return nullptr;
+}
+
+void AdaptiveConcurrencyFilter::Call::OnFinalize(
+    const grpc_call_final_info* final_info, AdaptiveConcurrencyFilter*) {
+  if (limiter_ == nullptr) return;
+  switch (final_info->final_status) {
+    case GRPC_STATUS_CANCELLED:
+      limiter_->OnDropped(/*overloaded=*/false);
+      break;
+    case GRPC_STATUS_DEADLINE_EXCEEDED:
+      limiter_->OnDropped(/*overloaded=*/true);
+      break;
+    default:
+      limiter_->OnSample(std::max(
+          Duration::Epsilon(),
+          Timestamp::FromCycleCounterRoundUp(gpr_get_cycle_counter()) -
+              Timestamp::FromCycleCounterRoundDown(start_)));
+      break;
+  }
+}
+
+void RegisterAdaptiveConcurrencyFilter(CoreConfiguration::Builder* builder) {
+  builder->channel_args_preconditioning()->RegisterStage(
+      EnsureAdaptiveConcurrencyLimitsInChannelArgs);
+  builder->channel_init()
+      ->RegisterFilter<AdaptiveConcurrencyFilter>(GRPC_SERVER_CHANNEL)
+      .IfChannelArg(GRPC_ARG_ENABLE_ADAPTIVE_CONCURRENCY_LIMIT, false);
+}
+
+}  // namespace grpc_core
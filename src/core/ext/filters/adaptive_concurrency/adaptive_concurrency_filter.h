@@ -0,0 +1,150 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_ADAPTIVE_CONCURRENCY_ADAPTIVE_CONCURRENCY_FILTER_H
+#define GRPC_SRC_CORE_EXT_FILTERS_ADAPTIVE_CONCURRENCY_ADAPTIVE_CONCURRENCY_FILTER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_limiter.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/channel_fwd.h"
+#include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/telemetry/metrics.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/time_precise.h"
+#include "src/core/util/useful.h"
+
+namespace grpc_core {
+
+// Per-method adaptive concurrency limiters for one server. Created once per
+// server by channel args preconditioning, so that every connection's filter
+// instance shares the same limits.
+//
+// Limiters are keyed by the server's registered method, and are found
+// without locking: slots of a fixed open-addressed table are claimed with a
+// CAS on the first call to a method and never released. Calls to
+// unregistered methods share a single limiter.
+class AdaptiveConcurrencyLimits final
+    : public RefCounted<AdaptiveConcurrencyLimits> {
+ public:
+  // Registered methods beyond this many share the unregistered methods'
+  // limiter.
+  static constexpr size_t kMaxTrackedMethods = 256;
+
+  static absl::string_view ChannelArgName() {
+    return "grpc.internal.adaptive_concurrency_limits";
+  }
+  static int ChannelArgsCompare(const AdaptiveConcurrencyLimits* a,
+                                const AdaptiveConcurrencyLimits* b) {
+    return QsortCompare(a, b);
+  }
+
+  explicit AdaptiveConcurrencyLimits(const ChannelArgs& args);
+  ~AdaptiveConcurrencyLimits() override;
+
+  // Priority metadata key, or empty if priorities are not configured.
+  absl::string_view priority_metadata_key() const {
+    return priority_metadata_key_;
+  }
+
+  // Returns the limiter for \a registered_method (the value of
+  // GrpcRegisteredMethod, null for unregistered methods), creating it on
+  // first use with \a path as its metrics label. The returned pointer is
+  // valid for the lifetime of this object; the label to report metrics under
+  // is returned in \a label.
+  AdaptiveConcurrencyLimiter* GetLimiter(const void* registered_method,
+                                         absl::string_view path,
+                                         absl::string_view* label);
+
+  void RecordRejection(absl::string_view label,
+                       AdaptiveConcurrencyLimiter::Priority priority);
+
+ private:
+  struct MethodLimiter {
+    MethodLimiter(const void* registered_method, absl::string_view path,
+                  const AdaptiveConcurrencyLimiter::Options& options)
+        : registered_method(registered_method),
+          label(path),
+          limiter(options) {}
+
+    const void* const registered_method;
+    const std::string label;
+    AdaptiveConcurrencyLimiter limiter;
+  };
+
+  void ReportMetrics(CallbackMetricReporter& reporter);
+
+  const AdaptiveConcurrencyLimiter::Options options_;
+  const std::string priority_metadata_key_;
+  std::shared_ptr<GlobalStatsPluginRegistry::StatsPluginGroup> stats_plugins_;
+
+  // Twice kMaxTrackedMethods, so that probes stay short.
+  std::array<std::atomic<MethodLimiter*>, 2 * kMaxTrackedMethods> methods_{};
+  std::atomic<size_t> num_methods_{0};
+  AdaptiveConcurrencyLimiter other_limiter_;
+
+  // Must be destroyed before the state it reports on.
+  std::unique_ptr<RegisteredMetricCallback> metric_callback_;
+};
+
+// Server filter enforcing AdaptiveConcurrencyLimits.
+class AdaptiveConcurrencyFilter
+    : public ImplementChannelFilter<AdaptiveConcurrencyFilter> {
+ public:
+  static const grpc_channel_filter kFilter;
+
+  static absl::string_view TypeName() { return "adaptive_concurrency"; }
+
+  static absl::StatusOr<std::unique_ptr<AdaptiveConcurrencyFilter>> Create(
+      const ChannelArgs& args, ChannelFilter::Args);
+
+  explicit AdaptiveConcurrencyFilter(
+      RefCountedPtr<AdaptiveConcurrencyLimits> limits)
+      : limits_(std::move(limits)) {}
+
+  class Call {
+   public:
+    ServerMetadataHandle OnClientInitialMetadata(
+        ClientMetadata& md, AdaptiveConcurrencyFilter* filter);
+    static inline const NoInterceptor OnServerInitialMetadata;
+    static inline const NoInterceptor OnServerTrailingMetadata;
+    static inline const NoInterceptor OnClientToServerMessage;
+    static inline const NoInterceptor OnClientToServerHalfClose;
+    static inline const NoInterceptor OnServerToClientMessage;
+    void OnFinalize(const grpc_call_final_info* final_info,
+                    AdaptiveConcurrencyFilter* filter);
+
+   private:
+    // Set if the call was admitted, and must be released on finalize.
+    AdaptiveConcurrencyLimiter* limiter_ = nullptr;
+    gpr_cycle_counter start_;
+  };
+
+ private:
+  RefCountedPtr<AdaptiveConcurrencyLimits> limits_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_ADAPTIVE_CONCURRENCY_ADAPTIVE_CONCURRENCY_FILTER_H
@@ -0,0 +1,161 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_limiter.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "absl/strings/match.h"
+#include "src/core/util/grpc_check.h"
+
+namespace grpc_core {
+
+namespace {
+
+// Share of the limit available to each priority class.
+double PriorityShare(AdaptiveConcurrencyLimiter::Priority priority) {
+  switch (priority) {
+    case AdaptiveConcurrencyLimiter::Priority::kCritical:
+      return 1.0;
+    case AdaptiveConcurrencyLimiter::Priority::kDefault:
+      return 0.9;
+    case AdaptiveConcurrencyLimiter::Priority::kSheddable:
+      return 0.5;
+  }
+  GPR_UNREACHABLE_CODE(return 1.0);
+}
+
+// Weight of each sample in recent_latency_.
+constexpr double kRecentLatencyWeight = 0.1;
+
+}  // namespace
+
+AdaptiveConcurrencyLimiter::AdaptiveConcurrencyLimiter(const Options& options)
+    : options_(options) {
+  GRPC_CHECK_GT(options_.min_limit, 0u);
+  GRPC_CHECK_LE(options_.min_limit, options_.max_limit);
+  limit_.store(std::clamp(options_.initial_limit, options_.min_limit,
+                          options_.max_limit),
+               std::memory_order_relaxed);
+}
+
+AdaptiveConcurrencyLimiter::Priority AdaptiveConcurrencyLimiter::ParsePriority(
+    absl::string_view name) {
+  if (absl::EqualsIgnoreCase(name, "critical")) return Priority::kCritical;
+  if (absl::EqualsIgnoreCase(name, "sheddable")) return Priority::kSheddable;
+  return Priority::kDefault;
+}
+
+absl::string_view AdaptiveConcurrencyLimiter::PriorityName(Priority priority) {
+  switch (priority) {
+    case Priority::kCritical:
+      return "critical";
+    case Priority::kDefault:
+      return "default";
+    case Priority::kSheddable:
+      return "sheddable";
+  }
+  GPR_UNREACHABLE_CODE(return "default");
+}
+
+uint32_t AdaptiveConcurrencyLimiter::LimitFor(Priority priority) const {
+  return std::max<uint32_t>(
+      1, static_cast<uint32_t>(limit() * PriorityShare(priority)));
+}
+
+template <typename F>
+void AdaptiveConcurrencyLimiter::UpdateLimit(F update) {
+  double limit = limit_.load(std::memory_order_relaxed);
+  while (!limit_.compare_exchange_weak(
+      limit,
+      std::clamp<double>(update(limit), options_.min_limit,
+                         options_.max_limit),
+      std::memory_order_relaxed)) {
+  }
+}
+
+bool AdaptiveConcurrencyLimiter::TryAcquire(Priority priority) {
+  const uint32_t limit = LimitFor(priority);
+  uint32_t in_flight = in_flight_.load(std::memory_order_relaxed);
+  do {
+    if (in_flight >= limit) return false;
+  } while (!in_flight_.compare_exchange_weak(in_flight, in_flight + 1,
+                                             std::memory_order_relaxed));
+  return true;
+}
+
+void AdaptiveConcurrencyLimiter::OnSample(Duration latency) {
+  // Number of calls in flight while this one was, including itself.
+  const uint32_t in_flight =
+      in_flight_.fetch_sub(1, std::memory_order_relaxed);
+  const int64_t latency_ms = std::max<int64_t>(1, latency.millis());
+  double recent = recent_latency_.load(std::memory_order_relaxed);
+  while (!recent_latency_.compare_exchange_weak(
+      recent,
+      recent == 0 ? latency_ms
+                  : recent * (1 - kRecentLatencyWeight) +
+                        latency_ms * kRecentLatencyWeight,
+      std::memory_order_relaxed)) {
+  }
+  int64_t window_min = current_window_min_.load(std::memory_order_relaxed);
+  while (latency_ms < window_min &&
+         !current_window_min_.compare_exchange_weak(
+             window_min, latency_ms, std::memory_order_relaxed)) {
+  }
+  if ((samples_.fetch_add(1, std::memory_order_relaxed) + 1) %
+          kWindowSamples ==
+      0) {
+    previous_window_min_.store(
+        current_window_min_.exchange(kNoSample, std::memory_order_relaxed),
+        std::memory_order_relaxed);
+  }
+  const int64_t no_load =
+      std::min(current_window_min_.load(std::memory_order_relaxed),
+               previous_window_min_.load(std::memory_order_relaxed));
+  const double gradient = std::clamp(
+      kTolerance * static_cast<double>(std::min(no_load, latency_ms)) /
+          latency_ms,
+      0.5, 1.0);
+  UpdateLimit([&](double limit) {
+    double new_limit = limit * gradient + std::sqrt(std::max(limit, 1.0));
+    // Don't grow the limit while the workload isn't using it; otherwise a
+    // quiet period would leave it arbitrarily large when load returns.
+    if (in_flight < limit / 2) new_limit = std::min(new_limit, limit);
+    return limit * (1 - kSmoothing) + new_limit * kSmoothing;
+  });
+}
+
+void AdaptiveConcurrencyLimiter::OnDropped(bool overloaded) {
+  in_flight_.fetch_sub(1, std::memory_order_relaxed);
+  if (!overloaded) return;
+  UpdateLimit([](double limit) { return limit * kDropBackoff; });
+}
+
+Duration AdaptiveConcurrencyLimiter::no_load_latency() const {
+  const int64_t no_load =
+      std::min(current_window_min_.load(std::memory_order_relaxed),
+               previous_window_min_.load(std::memory_order_relaxed));
+  if (no_load == kNoSample) return Duration::Zero();
+  return Duration::Milliseconds(no_load);
+}
+
+Duration AdaptiveConcurrencyLimiter::recent_latency() const {
+  return Duration::Milliseconds(static_cast<int64_t>(
+      std::ceil(recent_latency_.load(std::memory_order_relaxed))));
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,128 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_ADAPTIVE_CONCURRENCY_ADAPTIVE_CONCURRENCY_LIMITER_H
+#define GRPC_SRC_CORE_EXT_FILTERS_ADAPTIVE_CONCURRENCY_ADAPTIVE_CONCURRENCY_LIMITER_H
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <limits>
+
+#include "absl/strings/string_view.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+// Gradient-based adaptive concurrency limit.
+//
+// The limiter learns the no-load latency of a workload as the minimum latency
+// seen over a sliding window of samples, and compares each new sample
+// against it. While samples stay close to the no-load latency the limit
+// grows by roughly sqrt(limit) per sample; once latency rises above
+// kTolerance times the no-load latency, the limit shrinks in proportion to
+// the ratio, so the number of in-flight calls settles where queueing starts.
+// Latencies are measured in whole milliseconds, rounded up, so queueing of
+// less than about a millisecond is not treated as overload.
+//
+// Thread safe and lock-free: all state is kept in atomics, and concurrent
+// samples may interleave their updates.
+class AdaptiveConcurrencyLimiter {
+ public:
+  struct Options {
+    uint32_t initial_limit = 20;
+    uint32_t min_limit = 4;
+    uint32_t max_limit = 1000;
+  };
+
+  // Priority class of a call. Lower priority calls are admitted against a
+  // smaller share of the limit, so they are shed first under load and
+  // higher priority calls always find some headroom.
+  enum class Priority : uint8_t {
+    kCritical,
+    kDefault,
+    kSheddable,
+  };
+
+  // Samples per no-load latency window. The no-load latency is the minimum
+  // over the current and the previous window, so it can drift upwards if the
+  // workload itself gets slower.
+  static constexpr uint64_t kWindowSamples = 500;
+  // Latency growth, relative to the no-load latency, that is tolerated
+  // before the limit starts shrinking.
+  static constexpr double kTolerance = 1.5;
+  // Weight of each new sample's computed limit.
+  static constexpr double kSmoothing = 0.2;
+  // Multiplicative decrease applied when a call is dropped (e.g. it ran past
+  // its deadline), since such calls carry no useful latency.
+  static constexpr double kDropBackoff = 0.9;
+
+  explicit AdaptiveConcurrencyLimiter(const Options& options);
+
+  AdaptiveConcurrencyLimiter(const AdaptiveConcurrencyLimiter&) = delete;
+  AdaptiveConcurrencyLimiter& operator=(const AdaptiveConcurrencyLimiter&) =
+      delete;
+
+  // Parses a priority class name ("critical", "default" or "sheddable").
+  // Unknown names map to kDefault.
+  static Priority ParsePriority(absl::string_view name);
+  static absl::string_view PriorityName(Priority priority);
+
+  // Tries to admit a call of the given priority. On success the call is
+  // counted as in flight until OnSample() or OnDropped() is called for it.
+  bool TryAcquire(Priority priority);
+
+  // An admitted call completed after \a latency.
+  void OnSample(Duration latency);
+  // An admitted call completed without a usable latency measurement.
+  // If \a overloaded is true the call is assumed to have failed because of
+  // load (e.g. it exceeded its deadline) and the limit is reduced.
+  void OnDropped(bool overloaded);
+
+  uint32_t limit() const {
+    return static_cast<uint32_t>(limit_.load(std::memory_order_relaxed));
+  }
+  uint32_t in_flight() const {
+    return in_flight_.load(std::memory_order_relaxed);
+  }
+  // Current no-load latency estimate; zero until the first sample.
+  Duration no_load_latency() const;
+  // Smoothed recent latency; used as the retry pushback for rejected calls.
+  Duration recent_latency() const;
+
+ private:
+  // Window minimum before any sample.
+  static constexpr int64_t kNoSample = std::numeric_limits<int64_t>::max();
+
+  // Limit for a given priority class, as a share of limit().
+  uint32_t LimitFor(Priority priority) const;
+  // Replaces the limit with update(limit), clamped to the options' bounds.
+  template <typename F>
+  void UpdateLimit(F update);
+
+  const Options options_;
+  std::atomic<uint32_t> in_flight_{0};
+  std::atomic<double> limit_;
+  std::atomic<uint64_t> samples_{0};
+  // Minimum latency in milliseconds over the current and previous windows.
+  std::atomic<int64_t> current_window_min_{kNoSample};
+  std::atomic<int64_t> previous_window_min_{kNoSample};
+  // In milliseconds.
+  std::atomic<double> recent_latency_{0};
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_ADAPTIVE_CONCURRENCY_ADAPTIVE_CONCURRENCY_LIMITER_H
@@ -37,6 +37,7 @@
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "src/core/load_balancing/backend_metric_data.h"
+#include "src/core/telemetry/call_cpu_account.h"
 #include "src/core/util/latent_see.h"
 #include "upb/base/string_view.h"
 #include "upb/mem/arena.hpp"
@@ -45,8 +46,12 @@
 namespace grpc_core {
 
 namespace {
+// Request cost carrying the CPU time gRPC has spent on the call so far, when
+// GRPC_EXPERIMENTAL_CALL_CPU_ACCOUNTING is set.
+constexpr absl::string_view kCallCpuTimeCost = "grpc.call.cpu_time_ns";
+
 std::optional<std::string> MaybeSerializeBackendMetrics(
-    BackendMetricProvider* provider) {
+    BackendMetricProvider* provider, const CallCpuAccount* cpu_account) {
   if (provider == nullptr) return std::nullopt;
   BackendMetricData data = provider->GetBackendMetricData();
   upb::Arena arena;
@@ -83,6 +88,14 @@ std::optional<std::string> MaybeSerializeBackendMetrics(
         p.second, arena.ptr());
     has_data = true;
   }
+  if (cpu_account != nullptr) {
+    xds_data_orca_v3_OrcaLoadReport_request_cost_set(
+        response,
+        upb_StringView_FromDataAndSize(kCallCpuTimeCost.data(),
+                                       kCallCpuTimeCost.size()),
+        static_cast<double>(cpu_account->cpu_ns()), arena.ptr());
+    has_data = true;
+  }
   for (const auto& p : data.utilization) {
     xds_data_orca_v3_OrcaLoadReport_utilization_set(
         response,
@@ -124,7 +137,8 @@ void BackendMetricFilter::Call::OnServerTrailingMetadata(ServerMetadata& md) {
         << "[" << this << "] No BackendMetricProvider.";
     return;
   }
-  std::optional<std::string> serialized = MaybeSerializeBackendMetrics(ctx);
+  std::optional<std::string> serialized =
+      MaybeSerializeBackendMetrics(ctx, MaybeGetContext<CallCpuAccount>());
   if (serialized.has_value() && !serialized->empty()) {
     GRPC_TRACE_LOG(backend_metric_filter, INFO)
         << "[" << this
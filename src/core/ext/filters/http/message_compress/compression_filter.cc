@@ -46,6 +46,7 @@
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/surface/call.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/telemetry/call_cpu_account.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/latent_see.h"
@@ -120,8 +121,13 @@ MessageHandle ChannelCompression::CompressMessage(
   // Try to compress the payload.
   SliceBuffer tmp;
   SliceBuffer* payload = message->payload();
-  bool did_compress = grpc_msg_compress(algorithm, payload->c_slice_buffer(),
-                                        tmp.c_slice_buffer());
+  bool did_compress;
+  {
+    // Charged to the call, if it's being accounted.
+    CallCpuMeter cpu_meter(MaybeGetContext<Arena>());
+    did_compress = grpc_msg_compress(algorithm, payload->c_slice_buffer(),
+                                     tmp.c_slice_buffer());
+  }
   // If we achieved compression send it as compressed, otherwise send it as (to
   // avoid spending cycles on the receiver decompressing).
   if (did_compress) {
@@ -181,8 +187,15 @@ absl::StatusOr<MessageHandle> ChannelCompression::DecompressMessage(
   }
   // Try to decompress the payload.
   SliceBuffer decompressed_slices;
-  if (grpc_msg_decompress(args.algorithm, message->payload()->c_slice_buffer(),
-                          decompressed_slices.c_slice_buffer()) == 0) {
+  int decompressed;
+  {
+    // Charged to the call, if it's being accounted.
+    CallCpuMeter cpu_meter(MaybeGetContext<Arena>());
+    decompressed = grpc_msg_decompress(args.algorithm,
+                                       message->payload()->c_slice_buffer(),
+                                       decompressed_slices.c_slice_buffer());
+  }
+  if (decompressed == 0) {
     return absl::InternalError(
         absl::StrCat("Unexpected error decompressing data for algorithm ",
                      CompressionAlgorithmAsString(args.algorithm)));
@@ -109,6 +109,7 @@ using http2::Http2ErrorCode;
 const char kUnixUriPrefix[] = "unix:";
 const char kUnixAbstractUriPrefix[] = "unix-abstract:";
 const char kVSockUriPrefix[] = "vsock:";
+const char kShmUriPrefix[] = "shm:";
 
 namespace {
 Timestamp GetConnectionDeadline(const ChannelArgs& args) {
@@ -629,6 +630,7 @@ absl::StatusOr<int> Chttp2ServerAddPort(Server* server, const char* addr,
   std::vector<grpc_error_handle> error_list;
   std::string parsed_addr = URI::PercentDecode(addr);
   absl::string_view parsed_addr_unprefixed{parsed_addr};
+  ChannelArgs listener_args = args;
   // Using lambda to avoid use of goto.
   grpc_error_handle error = [&]() {
     grpc_error_handle error;
@@ -647,6 +649,11 @@ absl::StatusOr<int> Chttp2ServerAddPort(Server* server, const char* addr,
     } else if (absl::ConsumePrefix(&parsed_addr_unprefixed, kVSockUriPrefix)) {
       resolved = grpc_resolve_vsock_address(parsed_addr_unprefixed);
       GRPC_RETURN_IF_ERROR(resolved.status());
+    } else if (absl::ConsumePrefix(&parsed_addr_unprefixed, kShmUriPrefix)) {
+      // A Unix domain socket whose connections are moved onto shared memory.
+      resolved = grpc_resolve_unix_domain_address(parsed_addr_unprefixed);
+      GRPC_RETURN_IF_ERROR(resolved.status());
+      listener_args = args.Set(GRPC_ARG_SHARED_MEMORY_TRANSPORT, true);
     } else {
       if (IsEventEngineDnsNonClientChannelEnabled() &&
           !grpc_event_engine::experimental::
@@ -685,7 +692,8 @@ absl::StatusOr<int> Chttp2ServerAddPort(Server* server, const char* addr,
         grpc_event_engine::experimental::ResolvedAddressSetPort(addr, port_num);
       }
       int port_temp = -1;
-      error = NewChttp2ServerListener::Create(server, addr, args, &port_temp);
+      error = NewChttp2ServerListener::Create(server, addr, listener_args,
+                                              &port_temp);
       if (!error.ok()) {
         error_list.push_back(error);
       } else {
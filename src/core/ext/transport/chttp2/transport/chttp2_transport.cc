@@ -539,6 +539,23 @@ static void read_channel_args(grpc_chttp2_transport* t,
   t->max_concurrent_streams_reject_on_client =
       channel_args.GetBool(GRPC_ARG_MAX_CONCURRENT_STREAMS_REJECT_ON_CLIENT)
           .value_or(false);
+
+  t->weighted_fair_queuing =
+      channel_args.GetBool(GRPC_ARG_HTTP2_WEIGHTED_FAIR_QUEUING)
+          .value_or(false);
+
+  t->message_buffer_allocator =
+      channel_args.GetObjectRef<grpc_core::MessageBufferAllocator>();
+  // The allocator is asked for buffers before the payload arrives, so a
+  // length prefix from the peer must not be able to make it allocate more
+  // than the receive limit.  With no limit, keep to the default one.
+  const int max_recv_message_length =
+      channel_args.GetInt(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH)
+          .value_or(GRPC_DEFAULT_MAX_RECV_MESSAGE_LENGTH);
+  t->message_buffer_max_length =
+      max_recv_message_length < 0
+          ? GRPC_DEFAULT_MAX_RECV_MESSAGE_LENGTH
+          : static_cast<uint32_t>(max_recv_message_length);
 }
 
 static void init_keepalive_pings_if_enabled_locked(
@@ -603,6 +620,7 @@ void grpc_chttp2_transport::ChannelzDataSource::AddData(
                        t->max_concurrent_streams_overload_protection)
                   .Set("max_concurrent_streams_reject_on_client",
                        t->max_concurrent_streams_reject_on_client)
+                  .Set("weighted_fair_queuing", t->weighted_fair_queuing)
                   .Set("ping_on_rst_stream_percent",
                        t->ping_on_rst_stream_percent)
                   .Set("last_window_update", t->last_window_update_time)
@@ -1511,6 +1529,12 @@ static bool contains_non_ok_status(grpc_metadata_batch* batch) {
          GRPC_STATUS_OK;
 }
 
+static void maybe_set_stream_weight(grpc_chttp2_stream* s,
+                                    const grpc_metadata_batch& md) {
+  auto weight = md.get(grpc_core::GrpcStreamWeightMetadata());
+  if (weight.has_value()) grpc_chttp2_wfq_set_stream_weight(s, *weight);
+}
+
 static void log_metadata(const grpc_metadata_batch* md_batch, uint32_t id,
                          const bool is_client, const bool is_initial) {
   VLOG(2) << "--metadata--";
@@ -1550,6 +1574,12 @@ static void send_initial_metadata_locked(
         std::min(s->deadline,
                  s->send_initial_metadata->get(grpc_core::GrpcTimeoutMetadata())
                      .value_or(grpc_core::Timestamp::InfFuture()));
+    maybe_set_stream_weight(s, *s->send_initial_metadata);
+    if (t->message_buffer_allocator != nullptr) {
+      auto* path =
+          s->send_initial_metadata->get_pointer(grpc_core::HttpPathMetadata());
+      if (path != nullptr) s->method = path->Ref();
+    }
   }
   if (contains_non_ok_status(s->send_initial_metadata)) {
     s->seen_error = true;
@@ -2244,6 +2274,10 @@ void grpc_chttp2_maybe_complete_recv_initial_metadata(grpc_chttp2_transport* t,
     if (s->seen_error) {
       grpc_slice_buffer_reset_and_unref(&s->frame_storage);
     }
+    if (!t->is_client) {
+      // Responses are scheduled with the weight the client asked for.
+      maybe_set_stream_weight(s, s->initial_metadata_buffer);
+    }
     *s->recv_initial_metadata = std::move(s->initial_metadata_buffer);
     s->recv_initial_metadata->Set(grpc_core::PeerString(),
                                   t->peer_string.Ref());
@@ -2281,6 +2315,7 @@ void grpc_chttp2_maybe_complete_recv_message(grpc_chttp2_transport* t,
         << " seen_error=" << s->seen_error;
     if (s->final_metadata_requested && s->seen_error) {
       grpc_slice_buffer_reset_and_unref(&s->frame_storage);
+      grpc_chttp2_discard_recv_message_buffer(s);
       s->recv_message->reset();
     } else {
       if (s->frame_storage.length != 0) {
@@ -2296,6 +2331,7 @@ void grpc_chttp2_maybe_complete_recv_message(grpc_chttp2_transport* t,
           if (r.pending()) {
             if (s->read_closed) {
               grpc_slice_buffer_reset_and_unref(&s->frame_storage);
+              grpc_chttp2_discard_recv_message_buffer(s);
               s->recv_message->reset();
               break;
             } else {
@@ -2307,6 +2343,7 @@ void grpc_chttp2_maybe_complete_recv_message(grpc_chttp2_transport* t,
             if (!error.ok()) {
               s->seen_error = true;
               grpc_slice_buffer_reset_and_unref(&s->frame_storage);
+              grpc_chttp2_discard_recv_message_buffer(s);
               break;
             } else {
               if (t->channelz_socket != nullptr) {
@@ -2317,6 +2354,7 @@ void grpc_chttp2_maybe_complete_recv_message(grpc_chttp2_transport* t,
           }
         }
       } else if (s->read_closed) {
+        grpc_chttp2_discard_recv_message_buffer(s);
         s->recv_message->reset();
       } else {
         upd.SetMinProgressSize(GRPC_HEADER_SIZE_IN_BYTES);
@@ -2336,7 +2374,7 @@ void grpc_chttp2_maybe_complete_recv_message(grpc_chttp2_transport* t,
     }
   }();
 
-  upd.SetPendingSize(s->frame_storage.length);
+  upd.SetPendingSize(s->frame_storage.length + s->recv_message_buffer_filled);
   grpc_chttp2_act_on_flowctl_action(upd.MakeAction(), t, s);
 }
 
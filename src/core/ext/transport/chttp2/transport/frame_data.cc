@@ -22,6 +22,9 @@
 #include <grpc/support/port_platform.h>
 #include <stdlib.h>
 
+#include <algorithm>
+#include <utility>
+
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
 #include "src/core/ext/transport/chttp2/transport/call_tracer_wrapper.h"
@@ -84,12 +87,45 @@ void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
   call_tracer->RecordOutgoingBytes({header_size, 0, 0});
 }
 
+// Moves as much of the message payload as has arrived into the application's
+// message buffer, and delivers the buffer once it is full.
+static grpc_core::Poll<grpc_error_handle> fill_recv_message_buffer(
+    grpc_chttp2_stream* s, int64_t* min_progress_size,
+    grpc_core::SliceBuffer* stream_out, uint32_t* message_flags) {
+  grpc_slice_buffer* slices = &s->frame_storage;
+  const size_t remaining =
+      s->recv_message_buffer.size() - s->recv_message_buffer_filled;
+  const size_t n = std::min(remaining, slices->length);
+  grpc_slice_buffer_move_first_into_buffer(
+      slices, n, s->recv_message_buffer.data() + s->recv_message_buffer_filled);
+  s->recv_message_buffer_filled += n;
+  if (n < remaining) {
+    if (min_progress_size != nullptr) *min_progress_size = remaining - n;
+    return grpc_core::Pending{};
+  }
+  if (min_progress_size != nullptr) *min_progress_size = 0;
+  if (message_flags != nullptr) *message_flags = s->recv_message_buffer_flags;
+  stream_out->Append(grpc_core::Slice(std::move(s->recv_message_buffer)));
+  s->recv_message_buffer_filled = 0;
+  return absl::OkStatus();
+}
+
+void grpc_chttp2_discard_recv_message_buffer(grpc_chttp2_stream* s) {
+  s->recv_message_buffer = grpc_core::MutableSlice();
+  s->recv_message_buffer_filled = 0;
+}
+
 grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
     grpc_chttp2_stream* s, int64_t* min_progress_size,
     grpc_core::SliceBuffer* stream_out, uint32_t* message_flags) {
   grpc_slice_buffer* slices = &s->frame_storage;
   grpc_error_handle error;
 
+  if (!s->recv_message_buffer.empty()) {
+    return fill_recv_message_buffer(s, min_progress_size, stream_out,
+                                    message_flags);
+  }
+
   if (slices->length < GRPC_HEADER_SIZE_IN_BYTES) {
     if (min_progress_size != nullptr) {
       *min_progress_size = GRPC_HEADER_SIZE_IN_BYTES - slices->length;
@@ -123,6 +159,31 @@ grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
                   (static_cast<uint32_t>(header[3]) << 8) |
                   static_cast<uint32_t>(header[4]);
 
+  // Once the length is known the payload can be assembled straight into
+  // application-owned memory, releasing read buffers as frames arrive.  The
+  // length is the peer's word, so larger messages take the normal path
+  // (where they are only buffered as they actually arrive, and rejected by
+  // the message size filter).
+  if (stream_out != nullptr && length > 0 &&
+      length <= s->t->message_buffer_max_length &&
+      s->t->message_buffer_allocator != nullptr && !s->method.empty()) {
+    grpc_core::MutableSlice buffer = s->t->message_buffer_allocator->Allocate(
+        s->method.as_string_view(), length);
+    if (!buffer.empty()) {
+      GRPC_CHECK_EQ(buffer.size(), length);
+      s->call_tracer_wrapper.RecordIncomingBytes(
+          {GRPC_HEADER_SIZE_IN_BYTES, length, 0});
+      grpc_slice_buffer_move_first_into_buffer(
+          slices, GRPC_HEADER_SIZE_IN_BYTES, header);
+      s->recv_message_buffer = std::move(buffer);
+      s->recv_message_buffer_filled = 0;
+      s->recv_message_buffer_flags =
+          header[0] == 1 ? GRPC_WRITE_INTERNAL_COMPRESS : 0;
+      return fill_recv_message_buffer(s, min_progress_size, stream_out,
+                                      message_flags);
+    }
+  }
+
   if (slices->length < length + GRPC_HEADER_SIZE_IN_BYTES) {
     if (min_progress_size != nullptr) {
       *min_progress_size = length + GRPC_HEADER_SIZE_IN_BYTES - slices->length;
@@ -72,6 +72,7 @@
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/surface/init_internally.h"
 #include "src/core/lib/transport/connectivity_state.h"
+#include "src/core/lib/transport/message_buffer_allocator.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/lib/transport/transport_framing_endpoint_extension.h"
 #include "src/core/telemetry/call_tracer.h"
@@ -92,6 +93,12 @@
 //   bits being used for flags defined above)
 #define CLOSURE_BARRIER_FIRST_REF_BIT (1 << 16)
 
+// Range and default of stream weights for weighted fair queuing, matching
+//   HTTP/2 priority weights
+#define GRPC_CHTTP2_MIN_STREAM_WEIGHT 1
+#define GRPC_CHTTP2_MAX_STREAM_WEIGHT 256
+#define GRPC_CHTTP2_DEFAULT_STREAM_WEIGHT 16
+
 // streams are kept in various linked lists depending on what things need to
 // happen to them... this enum labels each list
 typedef enum {
@@ -582,6 +589,12 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   /// MAX_CONCURRENT_STREAMS
   bool max_concurrent_streams_overload_protection = false;
   bool max_concurrent_streams_reject_on_client = false;
+  /// True if DATA frames are scheduled by weighted fair queuing rather than
+  /// round robin (GRPC_ARG_HTTP2_WEIGHTED_FAIR_QUEUING)
+  bool weighted_fair_queuing = false;
+  /// Virtual time of the weighted fair queue: the start tag of the stream
+  /// most recently taken from the writable list
+  uint64_t wfq_virtual_time = 0;
 
   // What percentage of rst_stream frames on the server should cause a ping
   // frame to be generated.
@@ -591,6 +604,12 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   grpc_core::Timestamp last_window_update_time =
       grpc_core::Timestamp::InfPast();
 
+  /// Supplies application-owned memory to assemble received messages into
+  grpc_core::RefCountedPtr<grpc_core::MessageBufferAllocator>
+      message_buffer_allocator;
+  /// Largest message length (as sent by the peer) to ask the allocator for
+  uint32_t message_buffer_max_length = 0;
+
   std::shared_ptr<grpc_core::Http2StatsCollector> http2_stats;
   grpc_core::Http2ZTraceCollector http2_ztrace_collector;
 
@@ -682,6 +701,15 @@ struct grpc_chttp2_stream {
   grpc_metadata_batch trailing_metadata_buffer;
 
   grpc_slice_buffer frame_storage;  // protected by t combiner
+  /// Request path, used to ask the transport's message buffer allocator for
+  /// memory to receive messages into; only set when there is an allocator
+  grpc_core::Slice method;
+  /// Application-provided buffer the message being received is assembled
+  /// into once its length is known, how much of it has arrived, and the
+  /// message's flags
+  grpc_core::MutableSlice recv_message_buffer;
+  size_t recv_message_buffer_filled = 0;
+  uint32_t recv_message_buffer_flags = 0;
 
   grpc_core::Timestamp deadline = grpc_core::Timestamp::InfFuture();
 
@@ -703,6 +731,15 @@ struct grpc_chttp2_stream {
   /// Number of times written
   int64_t write_counter = 0;
 
+  /// Weight of this stream's DATA frames under weighted fair queuing, from
+  /// grpc-stream-weight metadata
+  uint32_t weight = GRPC_CHTTP2_DEFAULT_STREAM_WEIGHT;
+  /// Weighted fair queuing tags, in virtual bytes: the stream is ordered in
+  /// the writable list by start tag, and its finish tag advances by the bytes
+  /// it sends scaled inversely by its weight
+  uint64_t wfq_start_tag = 0;
+  uint64_t wfq_finish_tag = 0;
+
   grpc_core::Chttp2CallTracerWrapper call_tracer_wrapper;
   // null by default, set by the transport data source upon first query
   grpc_core::RefCountedPtr<grpc_core::channelz::CallNode> channelz_call_node;
@@ -69,6 +69,7 @@
 #include "src/core/lib/transport/bdp_estimator.h"
 #include "src/core/lib/transport/error_utils.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/telemetry/call_cpu_account.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/core/telemetry/stats.h"
 #include "src/core/telemetry/stats_data.h"
@@ -934,6 +935,9 @@ static grpc_error_handle parse_frame_slice(grpc_chttp2_transport* t,
                            << GRPC_SLICE_LENGTH(slice) << "b "
                            << (is_last ? "last " : "") << "frame fragment with "
                            << t->parser.name;
+  // HPACK decoding and message reassembly for a stream are charged to its
+  // call, if it's being accounted.
+  grpc_core::CallCpuMeter cpu_meter(s == nullptr ? nullptr : s->arena);
   grpc_error_handle err =
       t->parser.parser(t->parser.user_data, t, s, slice, is_last);
   intptr_t unused;
@@ -1008,6 +1012,12 @@ grpc_error_handle grpc_chttp2_header_parser_parse(void* hpack_parser,
         }
         s->published_metadata[s->header_frames_received] =
             GRPC_METADATA_PUBLISHED_FROM_WIRE;
+        if (s->header_frames_received == 0 && !t->is_client &&
+            t->message_buffer_allocator != nullptr) {
+          auto* path = s->initial_metadata_buffer.get_pointer(
+              grpc_core::HttpPathMetadata());
+          if (path != nullptr) s->method = path->Ref();
+        }
         maybe_complete_funcs[s->header_frames_received](t, s);
         s->header_frames_received++;
       }
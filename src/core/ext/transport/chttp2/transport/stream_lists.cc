@@ -20,6 +20,8 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <algorithm>
+
 #include "absl/log/log.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
 #include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
@@ -27,6 +29,7 @@
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/util/bitset.h"
 #include "src/core/util/grpc_check.h"
+#include "src/core/util/useful.h"
 
 static const char* stream_list_id_string(grpc_chttp2_stream_list_id id) {
   switch (id) {
@@ -166,11 +169,62 @@ static bool stream_list_prepend(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
   return true;
 }
 
+// weighted fair queuing: the writable list is kept sorted by start tag, with
+// ties served in arrival order
+
+static void stream_list_add_by_start_tag(grpc_chttp2_transport* t,
+                                         grpc_chttp2_stream* s,
+                                         grpc_chttp2_stream_list_id id) {
+  GRPC_CHECK(!s->included.is_set(id));
+  s->wfq_start_tag = std::max(t->wfq_virtual_time, s->wfq_finish_tag);
+  // Newly writable streams usually start at the current virtual time, which is
+  // no earlier than any queued start tag, so search from the tail.
+  grpc_chttp2_stream* prev = t->lists[id].tail;
+  while (prev != nullptr && prev->wfq_start_tag > s->wfq_start_tag) {
+    prev = prev->links[id].prev;
+  }
+  if (prev == nullptr) {
+    stream_list_add_head(t, s, id);
+    return;
+  }
+  grpc_chttp2_stream* next = prev->links[id].next;
+  s->links[id].prev = prev;
+  s->links[id].next = next;
+  prev->links[id].next = s;
+  if (next) {
+    next->links[id].prev = s;
+  } else {
+    t->lists[id].tail = s;
+  }
+  s->included.set(id);
+  GRPC_TRACE_LOG(http2_stream_state, INFO)
+      << t << "[" << s->id << "][" << (t->is_client ? "cli" : "svr")
+      << "]: add to " << stream_list_id_string(id)
+      << " with start tag " << s->wfq_start_tag;
+}
+
+void grpc_chttp2_wfq_set_stream_weight(grpc_chttp2_stream* s,
+                                       uint32_t weight) {
+  s->weight = grpc_core::Clamp<uint32_t>(weight, GRPC_CHTTP2_MIN_STREAM_WEIGHT,
+                                         GRPC_CHTTP2_MAX_STREAM_WEIGHT);
+}
+
+void grpc_chttp2_wfq_charge_stream(grpc_chttp2_stream* s, size_t bytes) {
+  s->wfq_finish_tag =
+      s->wfq_start_tag + static_cast<uint64_t>(bytes) *
+                             GRPC_CHTTP2_MAX_STREAM_WEIGHT / s->weight;
+}
+
 // wrappers for specializations
 
 bool grpc_chttp2_list_add_writable_stream(grpc_chttp2_transport* t,
                                           grpc_chttp2_stream* s) {
   GRPC_CHECK_NE(s->id, 0u);
+  if (t->weighted_fair_queuing) {
+    if (s->included.is_set(GRPC_CHTTP2_LIST_WRITABLE)) return false;
+    stream_list_add_by_start_tag(t, s, GRPC_CHTTP2_LIST_WRITABLE);
+    return true;
+  }
   if (grpc_core::IsPrioritizeFinishedRequestsEnabled() &&
       s->send_trailing_metadata != nullptr) {
     return stream_list_prepend(t, s, GRPC_CHTTP2_LIST_WRITABLE);
@@ -180,7 +234,11 @@ bool grpc_chttp2_list_add_writable_stream(grpc_chttp2_transport* t,
 
 bool grpc_chttp2_list_pop_writable_stream(grpc_chttp2_transport* t,
                                           grpc_chttp2_stream** s) {
-  return stream_list_pop(t, s, GRPC_CHTTP2_LIST_WRITABLE);
+  if (!stream_list_pop(t, s, GRPC_CHTTP2_LIST_WRITABLE)) return false;
+  if (t->weighted_fair_queuing) {
+    t->wfq_virtual_time = std::max(t->wfq_virtual_time, (*s)->wfq_start_tag);
+  }
+  return true;
 }
 
 bool grpc_chttp2_list_remove_writable_stream(grpc_chttp2_transport* t,
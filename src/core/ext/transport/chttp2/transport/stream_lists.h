@@ -30,6 +30,13 @@ bool grpc_chttp2_list_pop_writable_stream(grpc_chttp2_transport* t,
 bool grpc_chttp2_list_remove_writable_stream(grpc_chttp2_transport* t,
                                              grpc_chttp2_stream* s);
 
+/// Set the weight a stream is scheduled with under weighted fair queuing,
+/// clamped to [GRPC_CHTTP2_MIN_STREAM_WEIGHT, GRPC_CHTTP2_MAX_STREAM_WEIGHT]
+void grpc_chttp2_wfq_set_stream_weight(grpc_chttp2_stream* s, uint32_t weight);
+/// Charge a stream taken from the writable list for the DATA bytes it sent,
+/// which delays its next turn in proportion to bytes / weight
+void grpc_chttp2_wfq_charge_stream(grpc_chttp2_stream* s, size_t bytes);
+
 bool grpc_chttp2_list_add_writing_stream(grpc_chttp2_transport* t,
                                          grpc_chttp2_stream* s);
 bool grpc_chttp2_list_have_writing_streams(grpc_chttp2_transport* t);
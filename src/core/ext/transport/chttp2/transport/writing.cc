@@ -63,6 +63,7 @@
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/transport/bdp_estimator.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/telemetry/call_cpu_account.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/core/telemetry/context_list_entry.h"
 #include "src/core/telemetry/stats.h"
@@ -572,9 +573,19 @@ class StreamWriteContext {
       return;  // early out: nothing to do
     }
 
-    while (s_->flow_controlled_buffer.length > 0 &&
-           data_send_context.max_outgoing() > 0) {
+    if (t_->weighted_fair_queuing) {
+      // One frame per turn: the stream goes back into the writable list
+      // behind streams with earlier start tags, so frames of concurrent
+      // streams interleave in proportion to their weights.
+      const size_t sending_bytes_before = s_->sending_bytes;
       data_send_context.FlushBytes();
+      grpc_chttp2_wfq_charge_stream(s_,
+                                    s_->sending_bytes - sending_bytes_before);
+    } else {
+      while (s_->flow_controlled_buffer.length > 0 &&
+             data_send_context.max_outgoing() > 0) {
+        data_send_context.FlushBytes();
+      }
     }
     grpc_chttp2_reset_ping_clock(t_);
     if (data_send_context.is_last_frame()) {
@@ -716,10 +727,15 @@ grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
     StreamWriteContext stream_ctx(&ctx, s);
     size_t orig_len = t->outbuf.c_slice_buffer()->length;
     int64_t num_stream_bytes = 0;
-    stream_ctx.FlushInitialMetadata();
-    stream_ctx.FlushWindowUpdates();
-    stream_ctx.FlushData();
-    stream_ctx.FlushTrailingMetadata();
+    {
+      // HPACK encoding and framing for a stream are charged to its call, if
+      // it's being accounted.
+      grpc_core::CallCpuMeter cpu_meter(s->arena);
+      stream_ctx.FlushInitialMetadata();
+      stream_ctx.FlushWindowUpdates();
+      stream_ctx.FlushData();
+      stream_ctx.FlushTrailingMetadata();
+    }
     if (t->outbuf.c_slice_buffer()->length > orig_len) {
       // Add this stream to the list of the contexts to be traced at TCP
       num_stream_bytes = t->outbuf.c_slice_buffer()->length - orig_len;
@@ -0,0 +1,603 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/shm/shm_endpoint.h"
+
+#include <grpc/event_engine/slice.h>
+#include <grpc/event_engine/slice_buffer.h>
+#include <errno.h>
+#include <grpc/support/port_platform.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/memory/memory.h"
+#include "absl/random/distributions.h"
+#include "absl/status/status.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/shared_bit_gen.h"
+#include "src/core/util/strerror.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/useful.h"
+
+#ifdef GPR_LINUX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif  // GPR_LINUX
+
+namespace grpc_core {
+
+namespace {
+
+constexpr uint32_t kShmMagic = 0x6d687367;  // "gshm"
+constexpr uint32_t kShmVersion = 1;
+constexpr size_t kMinRingSize = 64 * 1024;
+constexpr size_t kMaxRingSize = 1024 * 1024 * 1024;
+constexpr absl::string_view kShmNamePrefix = "/grpc-shm-";
+
+}  // namespace
+
+namespace {
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "shared memory rings need address-free atomics");
+static_assert(std::atomic<uint32_t>::is_always_lock_free,
+              "shared memory rings need address-free atomics");
+
+struct SegmentHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t ring_size;
+  ShmSegment::RingHeader rings[2];
+};
+
+constexpr size_t kDataOffset = (sizeof(SegmentHeader) + 4095) & ~size_t{4095};
+
+}  // namespace
+
+ShmSegment::ShmSegment(std::string name, void* base, size_t mapped_size,
+                       size_t ring_size, bool linked)
+    : name_(std::move(name)),
+      base_(base),
+      mapped_size_(mapped_size),
+      ring_size_(ring_size),
+      linked_(linked) {}
+
+ShmSegment::RingHeader* ShmSegment::ring_header(int index) const {
+  return &static_cast<SegmentHeader*>(base_)->rings[index];
+}
+
+uint8_t* ShmSegment::ring_data(int index) const {
+  return static_cast<uint8_t*>(base_) + kDataOffset + index * ring_size_;
+}
+
+#ifdef GPR_LINUX
+
+absl::StatusOr<std::unique_ptr<ShmSegment>> ShmSegment::Create(
+    size_t ring_size) {
+  ring_size = RoundUpToPowerOf2(static_cast<uint32_t>(
+      Clamp(ring_size, kMinRingSize, kMaxRingSize)));
+  SharedBitGen g;
+  std::string name = absl::StrCat(kShmNamePrefix, getpid(), "-",
+                                  absl::Hex(absl::Uniform<uint64_t>(g)));
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) {
+    return absl::InternalError(
+        absl::StrCat("shm_open(", name, "): ", StrError(errno)));
+  }
+  const size_t mapped_size = kDataOffset + 2 * ring_size;
+  void* base = MAP_FAILED;
+  if (ftruncate(fd, mapped_size) == 0) {
+    base = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+                0);
+  }
+  const int err = errno;
+  close(fd);
+  if (base == MAP_FAILED) {
+    shm_unlink(name.c_str());
+    return absl::InternalError(
+        absl::StrCat("mapping shared memory segment: ", StrError(err)));
+  }
+  // The segment is zero filled, which is the initial state of both rings.
+  auto* header = new (base) SegmentHeader();
+  header->magic = kShmMagic;
+  header->version = kShmVersion;
+  header->ring_size = ring_size;
+  return absl::WrapUnique(
+      new ShmSegment(std::move(name), base, mapped_size, ring_size, true));
+}
+
+absl::StatusOr<std::unique_ptr<ShmSegment>> ShmSegment::Open(
+    absl::string_view name) {
+  // Only open segments that a peer could have created with Create().
+  if (!absl::StartsWith(name, kShmNamePrefix) ||
+      name.find('/', 1) != absl::string_view::npos) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("invalid shared memory segment name: ", name));
+  }
+  std::string name_str(name);
+  int fd = shm_open(name_str.c_str(), O_RDWR, 0);
+  if (fd < 0) {
+    return absl::InternalError(
+        absl::StrCat("shm_open(", name, "): ", StrError(errno)));
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 ||
+      static_cast<size_t>(st.st_size) < kDataOffset + 2 * kMinRingSize) {
+    close(fd);
+    return absl::FailedPreconditionError(
+        absl::StrCat("shared memory segment ", name, " is too small"));
+  }
+  const size_t mapped_size = st.st_size;
+  void* base =
+      mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  const int err = errno;
+  close(fd);
+  if (base == MAP_FAILED) {
+    return absl::InternalError(
+        absl::StrCat("mapping shared memory segment: ", StrError(err)));
+  }
+  const auto* header = static_cast<const SegmentHeader*>(base);
+  const uint64_t ring_size = header->ring_size;
+  if (header->magic != kShmMagic || header->version != kShmVersion ||
+      ring_size < kMinRingSize || ring_size > kMaxRingSize ||
+      (ring_size & (ring_size - 1)) != 0 ||
+      kDataOffset + 2 * ring_size > mapped_size) {
+    munmap(base, mapped_size);
+    return absl::FailedPreconditionError(
+        absl::StrCat("unrecognized shared memory segment ", name));
+  }
+  return absl::WrapUnique(new ShmSegment(std::move(name_str), base,
+                                         mapped_size, ring_size, true));
+}
+
+ShmSegment::~ShmSegment() {
+  Unlink();
+  munmap(base_, mapped_size_);
+}
+
+void ShmSegment::Unlink() {
+  if (!linked_) return;
+  shm_unlink(name_.c_str());
+  linked_ = false;
+}
+
+#else  // GPR_LINUX
+
+absl::StatusOr<std::unique_ptr<ShmSegment>> ShmSegment::Create(size_t) {
+  return absl::UnimplementedError(
+      "shared memory transport is only supported on Linux");
+}
+
+absl::StatusOr<std::unique_ptr<ShmSegment>> ShmSegment::Open(
+    absl::string_view) {
+  return absl::UnimplementedError(
+      "shared memory transport is only supported on Linux");
+}
+
+ShmSegment::~ShmSegment() {}
+
+void ShmSegment::Unlink() {}
+
+#endif  // GPR_LINUX
+
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+
+class ShmEndpoint final : public EventEngine::Endpoint {
+ public:
+  ShmEndpoint(std::unique_ptr<ShmSegment> segment, bool is_client,
+              std::unique_ptr<EventEngine::Endpoint> control,
+              std::shared_ptr<EventEngine> event_engine)
+      : impl_(MakeRefCounted<Impl>(std::move(segment), is_client,
+                                   std::move(control),
+                                   std::move(event_engine))) {
+    impl_->Start();
+  }
+
+  ~ShmEndpoint() override { impl_->Shutdown(); }
+
+  bool Read(absl::AnyInvocable<void(absl::Status)> on_read,
+            grpc_event_engine::experimental::SliceBuffer* buffer,
+            ReadArgs /*args*/) override {
+    return impl_->Read(std::move(on_read), buffer);
+  }
+
+  bool Write(absl::AnyInvocable<void(absl::Status)> on_writable,
+             grpc_event_engine::experimental::SliceBuffer* data,
+             WriteArgs /*args*/) override {
+    return impl_->Write(std::move(on_writable), data);
+  }
+
+  const EventEngine::ResolvedAddress& GetPeerAddress() const override {
+    return impl_->peer_address();
+  }
+
+  const EventEngine::ResolvedAddress& GetLocalAddress() const override {
+    return impl_->local_address();
+  }
+
+  std::shared_ptr<TelemetryInfo> GetTelemetryInfo() const override {
+    return nullptr;
+  }
+
+ private:
+  class Impl : public RefCounted<Impl> {
+   public:
+    Impl(std::unique_ptr<ShmSegment> segment, bool is_client,
+         std::unique_ptr<EventEngine::Endpoint> control,
+         std::shared_ptr<EventEngine> event_engine)
+        : segment_(std::move(segment)),
+          ring_size_(segment_->ring_size()),
+          tx_(segment_->ring_header(is_client ? 0 : 1)),
+          tx_data_(segment_->ring_data(is_client ? 0 : 1)),
+          rx_(segment_->ring_header(is_client ? 1 : 0)),
+          rx_data_(segment_->ring_data(is_client ? 1 : 0)),
+          peer_address_(control->GetPeerAddress()),
+          local_address_(control->GetLocalAddress()),
+          event_engine_(std::move(event_engine)),
+          control_(std::move(control)) {}
+
+    void Start() {
+      Completions done;
+      {
+        MutexLock lock(&mu_);
+        ReadDoorbellLocked(&done);
+      }
+      RunCompletions(done);
+    }
+
+    void Shutdown() {
+      Completions done;
+      std::unique_ptr<EventEngine::Endpoint> control;
+      {
+        MutexLock lock(&mu_);
+        if (status_.ok()) {
+          status_ = absl::UnavailableError("shared memory endpoint shutdown");
+        }
+        FailPendingLocked(&done);
+        control = std::move(control_);
+      }
+      // Closing the socket also tells the peer we are gone.
+      control.reset();
+      RunCompletionsLater(done);
+    }
+
+    bool Read(absl::AnyInvocable<void(absl::Status)> on_read,
+              grpc_event_engine::experimental::SliceBuffer* buffer) {
+      buffer->Clear();
+      MutexLock lock(&mu_);
+      GRPC_CHECK(on_read_ == nullptr);
+      do {
+        if (ReadRingLocked(buffer) > 0) return true;
+        if (!status_.ok()) {
+          FailLocked(std::move(on_read));
+          return false;
+        }
+      } while (ParkConsumerLocked());
+      on_read_ = std::move(on_read);
+      read_buffer_ = buffer;
+      return false;
+    }
+
+    bool Write(absl::AnyInvocable<void(absl::Status)> on_writable,
+               grpc_event_engine::experimental::SliceBuffer* data) {
+      MutexLock lock(&mu_);
+      GRPC_CHECK(on_writable_ == nullptr);
+      if (status_.ok()) {
+        do {
+          if (WriteRingLocked(data)) return true;
+        } while (status_.ok() && ParkProducerLocked());
+      }
+      if (!status_.ok()) {
+        FailLocked(std::move(on_writable));
+        return false;
+      }
+      on_writable_ = std::move(on_writable);
+      write_data_ = data;
+      return false;
+    }
+
+    const EventEngine::ResolvedAddress& peer_address() const {
+      return peer_address_;
+    }
+    const EventEngine::ResolvedAddress& local_address() const {
+      return local_address_;
+    }
+
+   private:
+    struct Completion {
+      absl::AnyInvocable<void(absl::Status)> callback;
+      absl::Status status;
+    };
+    using Completions = absl::InlinedVector<Completion, 2>;
+
+    static void RunCompletions(Completions& done) {
+      for (auto& completion : done) {
+        completion.callback(std::move(completion.status));
+      }
+    }
+
+    // Fails `callback` and whatever else is pending with status_, off the
+    // caller's stack.
+    void FailLocked(absl::AnyInvocable<void(absl::Status)> callback)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+      Completions done;
+      done.push_back({std::move(callback), status_});
+      FailPendingLocked(&done);
+      RunCompletionsLater(done);
+    }
+
+    void RunCompletionsLater(Completions& done) {
+      for (auto& completion : done) {
+        event_engine_->Run([completion = std::move(completion)]() mutable {
+          completion.callback(std::move(completion.status));
+        });
+      }
+    }
+
+    // Moves every readable byte into `buffer`, returning how many there were.
+    size_t ReadRingLocked(grpc_event_engine::experimental::SliceBuffer* buffer)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+      const uint64_t tail = rx_->tail.load(std::memory_order_relaxed);
+      const uint64_t head = rx_->head.load(std::memory_order_acquire);
+      const size_t n = head - tail;
+      if (n == 0) return 0;
+      if (n > ring_size_) {
+        status_ = absl::DataLossError("shared memory ring corrupted");
+        return 0;
+      }
+      auto slice =
+          grpc_event_engine::experimental::MutableSlice::CreateUninitialized(n);
+      const size_t offset = tail & (ring_size_ - 1);
+      const size_t first = std::min(n, ring_size_ - offset);
+      memcpy(slice.data(), rx_data_ + offset, first);
+      memcpy(slice.data() + first, rx_data_, n - first);
+      buffer->Append(grpc_event_engine::experimental::Slice(std::move(slice)));
+      rx_->tail.store(tail + n, std::memory_order_seq_cst);
+      rx_->consumer_parked.store(0, std::memory_order_relaxed);
+      if (rx_->producer_parked.exchange(0, std::memory_order_seq_cst) != 0) {
+        RingDoorbellLocked();
+      }
+      return n;
+    }
+
+    // Copies as much of `data` as fits, returning true once all of it has
+    // been written.  Sets status_ if the peer has corrupted the ring.
+    bool WriteRingLocked(grpc_event_engine::experimental::SliceBuffer* data)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+      const uint64_t head = tx_->head.load(std::memory_order_relaxed);
+      const uint64_t tail = tx_->tail.load(std::memory_order_acquire);
+      // The peer owns tail, so it may claim to have consumed bytes that were
+      // never written; trusting it would write past the ring.
+      if (head - tail > ring_size_) {
+        status_ = absl::DataLossError("shared memory ring corrupted");
+        return false;
+      }
+      const size_t n = std::min<size_t>(ring_size_ - (head - tail),
+                                        data->Length());
+      if (n == 0) return data->Length() == 0;
+      const size_t offset = head & (ring_size_ - 1);
+      const size_t first = std::min(n, ring_size_ - offset);
+      data->MoveFirstNBytesIntoBuffer(first, tx_data_ + offset);
+      if (n > first) data->MoveFirstNBytesIntoBuffer(n - first, tx_data_);
+      tx_->head.store(head + n, std::memory_order_seq_cst);
+      tx_->producer_parked.store(0, std::memory_order_relaxed);
+      if (tx_->consumer_parked.exchange(0, std::memory_order_seq_cst) != 0) {
+        RingDoorbellLocked();
+      }
+      return data->Length() == 0;
+    }
+
+    // Both return true if the ring changed while parking, in which case the
+    // caller retries instead of waiting for the doorbell.
+    bool ParkConsumerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+      rx_->consumer_parked.store(1, std::memory_order_seq_cst);
+      if (rx_->head.load(std::memory_order_seq_cst) !=
+          rx_->tail.load(std::memory_order_relaxed)) {
+        rx_->consumer_parked.store(0, std::memory_order_relaxed);
+        return true;
+      }
+      return false;
+    }
+
+    bool ParkProducerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+      tx_->producer_parked.store(1, std::memory_order_seq_cst);
+      if (tx_->head.load(std::memory_order_relaxed) -
+              tx_->tail.load(std::memory_order_seq_cst) <
+          ring_size_) {
+        tx_->producer_parked.store(0, std::memory_order_relaxed);
+        return true;
+      }
+      return false;
+    }
+
+    // Makes progress on parked operations after the peer changed the rings.
+    void ServicePendingLocked(Completions* done)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+      if (on_read_ != nullptr) {
+        do {
+          if (ReadRingLocked(read_buffer_) > 0) {
+            done->push_back({std::move(on_read_), absl::OkStatus()});
+            on_read_ = nullptr;
+            break;
+          }
+          if (!status_.ok()) {
+            done->push_back({std::move(on_read_), status_});
+            on_read_ = nullptr;
+            break;
+          }
+        } while (ParkConsumerLocked());
+      }
+      if (on_writable_ != nullptr) {
+        bool written = false;
+        if (status_.ok()) {
+          do {
+            written = WriteRingLocked(write_data_);
+          } while (!written && status_.ok() && ParkProducerLocked());
+        }
+        if (written || !status_.ok()) {
+          done->push_back({std::move(on_writable_),
+                           written ? absl::OkStatus() : status_});
+          on_writable_ = nullptr;
+        }
+      }
+      // A write may have found the ring corrupted after the read parked.
+      if (on_read_ != nullptr && !status_.ok()) {
+        done->push_back({std::move(on_read_), status_});
+        on_read_ = nullptr;
+      }
+    }
+
+    void FailPendingLocked(Completions* done)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+      if (on_read_ != nullptr) {
+        done->push_back({std::move(on_read_), status_});
+        on_read_ = nullptr;
+      }
+      if (on_writable_ != nullptr) {
+        done->push_back({std::move(on_writable_), status_});
+        on_writable_ = nullptr;
+      }
+    }
+
+    // Keeps a read outstanding on the socket: every byte that arrives is a
+    // doorbell, and end of stream means the peer is gone.
+    void ReadDoorbellLocked(Completions* done)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+      while (control_ != nullptr) {
+        doorbell_in_.Clear();
+        if (!control_->Read(
+                [self = Ref()](absl::Status status) {
+                  self->OnDoorbell(std::move(status));
+                },
+                &doorbell_in_, EventEngine::Endpoint::ReadArgs())) {
+          return;
+        }
+        ServicePendingLocked(done);
+      }
+    }
+
+    void OnDoorbell(absl::Status status) {
+      Completions done;
+      {
+        MutexLock lock(&mu_);
+        if (!status.ok() && status_.ok()) {
+          status_ = absl::UnavailableError(
+              absl::StrCat("shared memory peer closed: ", status.message()));
+        }
+        // Data the peer wrote before going away is still delivered.
+        ServicePendingLocked(&done);
+        if (status.ok()) ReadDoorbellLocked(&done);
+      }
+      RunCompletions(done);
+    }
+
+    void RingDoorbellLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+      if (control_ == nullptr) return;
+      if (doorbell_write_in_flight_) {
+        ring_again_ = true;
+        return;
+      }
+      doorbell_write_in_flight_ = true;
+      WriteDoorbellLocked();
+    }
+
+    void WriteDoorbellLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+      do {
+        ring_again_ = false;
+        doorbell_out_.Clear();
+        doorbell_out_.Append(
+            grpc_event_engine::experimental::Slice::FromCopiedString("!"));
+        if (!control_->Write(
+                [self = Ref()](absl::Status status) {
+                  self->OnDoorbellWritten(std::move(status));
+                },
+                &doorbell_out_, EventEngine::Endpoint::WriteArgs())) {
+          return;
+        }
+      } while (ring_again_);
+      doorbell_write_in_flight_ = false;
+    }
+
+    void OnDoorbellWritten(absl::Status status) {
+      MutexLock lock(&mu_);
+      // A failed write means the socket is going away, which the doorbell
+      // read reports.
+      if (!status.ok() || control_ == nullptr || !ring_again_) {
+        doorbell_write_in_flight_ = false;
+        return;
+      }
+      WriteDoorbellLocked();
+    }
+
+    const std::unique_ptr<ShmSegment> segment_;
+    const size_t ring_size_;
+    ShmSegment::RingHeader* const tx_;
+    uint8_t* const tx_data_;
+    ShmSegment::RingHeader* const rx_;
+    const uint8_t* const rx_data_;
+    const EventEngine::ResolvedAddress peer_address_;
+    const EventEngine::ResolvedAddress local_address_;
+    const std::shared_ptr<EventEngine> event_engine_;
+
+    Mutex mu_;
+    std::unique_ptr<EventEngine::Endpoint> control_ ABSL_GUARDED_BY(mu_);
+    absl::Status status_ ABSL_GUARDED_BY(mu_);
+    absl::AnyInvocable<void(absl::Status)> on_read_ ABSL_GUARDED_BY(mu_);
+    grpc_event_engine::experimental::SliceBuffer* read_buffer_
+        ABSL_GUARDED_BY(mu_) = nullptr;
+    absl::AnyInvocable<void(absl::Status)> on_writable_ ABSL_GUARDED_BY(mu_);
+    grpc_event_engine::experimental::SliceBuffer* write_data_
+        ABSL_GUARDED_BY(mu_) = nullptr;
+    grpc_event_engine::experimental::SliceBuffer doorbell_in_
+        ABSL_GUARDED_BY(mu_);
+    grpc_event_engine::experimental::SliceBuffer doorbell_out_
+        ABSL_GUARDED_BY(mu_);
+    bool doorbell_write_in_flight_ ABSL_GUARDED_BY(mu_) = false;
+    bool ring_again_ ABSL_GUARDED_BY(mu_) = false;
+  };
+
+  const RefCountedPtr<Impl> impl_;
+};
+
+}  // namespace
+
+std::unique_ptr<grpc_event_engine::experimental::EventEngine::Endpoint>
+CreateShmEndpoint(
+    std::unique_ptr<ShmSegment> segment, bool is_client,
+    std::unique_ptr<grpc_event_engine::experimental::EventEngine::Endpoint>
+        control,
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+        event_engine) {
+  return std::make_unique<ShmEndpoint>(std::move(segment), is_client,
+                                       std::move(control),
+                                       std::move(event_engine));
+}
+
+}  // namespace grpc_core
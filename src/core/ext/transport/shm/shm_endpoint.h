@@ -0,0 +1,103 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_ENDPOINT_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_ENDPOINT_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+// A shared memory segment holding two single-producer single-consumer byte
+// rings, one per direction.  The server creates the segment and sends its
+// name to the client over the connection's Unix domain socket; the client
+// opens it by name, after which the name is unlinked so the segment goes
+// away with the last mapping.
+class ShmSegment {
+ public:
+  static constexpr size_t kDefaultRingSize = 4 * 1024 * 1024;
+
+  // Creates a new segment with rings of at least `ring_size` bytes each.
+  static absl::StatusOr<std::unique_ptr<ShmSegment>> Create(size_t ring_size);
+  // Maps an existing segment created by a peer.
+  static absl::StatusOr<std::unique_ptr<ShmSegment>> Open(
+      absl::string_view name);
+
+  ShmSegment(const ShmSegment&) = delete;
+  ShmSegment& operator=(const ShmSegment&) = delete;
+  ~ShmSegment();
+
+  const std::string& name() const { return name_; }
+  size_t ring_size() const { return ring_size_; }
+  // Removes the segment's name; existing mappings stay valid.
+  void Unlink();
+
+  // Ring layout, shared between the processes.  Positions are byte counts
+  // since the segment was created; a ring holds `head - tail` readable
+  // bytes.  Each side parks by setting its flag and re-checking the ring, and
+  // whoever next changes the ring clears the flag and rings the doorbell, so
+  // an active peer is never woken through the socket.  Everything here is
+  // written by the peer too, so readers must validate it.
+  struct RingHeader {
+    static constexpr size_t kCacheLineSize = 64;
+    // Advanced by the producer only.
+    alignas(kCacheLineSize) std::atomic<uint64_t> head;
+    // Advanced by the consumer only.
+    alignas(kCacheLineSize) std::atomic<uint64_t> tail;
+    // Set while the consumer waits for data.
+    alignas(kCacheLineSize) std::atomic<uint32_t> consumer_parked;
+    // Set while the producer waits for space.
+    alignas(kCacheLineSize) std::atomic<uint32_t> producer_parked;
+  };
+  // Ring `index` of the segment: ring 0 carries client to server bytes,
+  // ring 1 server to client.
+  RingHeader* ring_header(int index) const;
+  uint8_t* ring_data(int index) const;
+
+ private:
+  ShmSegment(std::string name, void* base, size_t mapped_size,
+             size_t ring_size, bool linked);
+
+  const std::string name_;
+  void* const base_;
+  const size_t mapped_size_;
+  const size_t ring_size_;
+  bool linked_;
+};
+
+// Creates an endpoint that writes into and reads from the rings of `segment`,
+// using `control` (the Unix domain socket the segment was negotiated over)
+// only to wake the peer when it is parked waiting for data or for space.
+// Read and write completions are reported on `event_engine`.
+std::unique_ptr<grpc_event_engine::experimental::EventEngine::Endpoint>
+CreateShmEndpoint(
+    std::unique_ptr<ShmSegment> segment, bool is_client,
+    std::unique_ptr<grpc_event_engine::experimental::EventEngine::Endpoint>
+        control,
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+        event_engine);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_ENDPOINT_H
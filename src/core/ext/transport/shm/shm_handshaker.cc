@@ -0,0 +1,535 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/shm/shm_handshaker.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "src/core/ext/transport/shm/shm_endpoint.h"
+#include "src/core/handshaker/handshaker.h"
+#include "src/core/handshaker/handshaker_factory.h"
+#include "src/core/handshaker/handshaker_registry.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/event_engine_shims/endpoint.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/iomgr_fwd.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::grpc_event_engine_endpoint_create;
+using grpc_event_engine::experimental::grpc_take_wrapped_event_engine_endpoint;
+
+namespace {
+
+// The client opens with a request: the magic and the highest version it
+// speaks.  The server answers with a hello: the magic, a version byte, the
+// length of the segment name and the name; a zero length name means the
+// server could not or would not set up a segment.  The client answers a hello
+// naming a segment with one byte: kAck once it has mapped the segment, kNack
+// if it could not.  Unless the segment is acknowledged, both sides carry on
+// over the socket as if this handshaker had not run.
+//
+// The server only ever answers a request, so a client that has not enabled
+// shared memory, whose first bytes are its own protocol's preface, is served
+// without delay.  A server that has not enabled shared memory reads the
+// request as the start of the client's preface, which breaks the connection.
+// The client waits up to kServerHelloTimeout for a hello, and if the server
+// sends anything else, closes, or stays quiet (chaotic_good servers wait for
+// the client), fails the connection and remembers the peer for
+// kPlainServerMemory: reconnections to it skip the request and go straight
+// to the socket.
+constexpr char kHelloMagic[] = {'G', 'S', 'H', 'M'};
+constexpr uint8_t kProtocolVersion = 1;
+constexpr size_t kRequestSize = sizeof(kHelloMagic) + 1;
+constexpr size_t kHelloHeaderSize = sizeof(kHelloMagic) + 2;
+constexpr uint8_t kAck = 'A';
+constexpr uint8_t kNack = 'N';
+constexpr EventEngine::Duration kServerHelloTimeout = std::chrono::seconds(1);
+constexpr Duration kPlainServerMemory = Duration::Minutes(5);
+
+// Peers that did not answer a request with a hello, and until when to treat
+// them as servers that have not enabled shared memory.
+class PlainServers {
+ public:
+  static PlainServers& Get() {
+    static NoDestruct<PlainServers> plain_servers;
+    return *plain_servers;
+  }
+
+  void Add(absl::string_view peer) {
+    MutexLock lock(&mu_);
+    const Timestamp now = Timestamp::Now();
+    // Drop expired entries rather than growing without bound.
+    absl::erase_if(expiries_,
+                   [now](const auto& entry) { return entry.second <= now; });
+    expiries_[std::string(peer)] = now + kPlainServerMemory;
+  }
+
+  bool Contains(absl::string_view peer) {
+    MutexLock lock(&mu_);
+    auto it = expiries_.find(peer);
+    return it != expiries_.end() && it->second > Timestamp::Now();
+  }
+
+ private:
+  Mutex mu_;
+  absl::flat_hash_map<std::string, Timestamp> expiries_ ABSL_GUARDED_BY(mu_);
+};
+
+class ShmHandshaker : public Handshaker {
+ public:
+  explicit ShmHandshaker(bool is_client) : is_client_(is_client) {}
+  absl::string_view name() const override { return "shm"; }
+  void DoHandshake(
+      HandshakerArgs* args,
+      absl::AnyInvocable<void(absl::Status)> on_handshake_done) override;
+  void Shutdown(absl::Status error) override;
+
+ private:
+  bool done() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    return on_handshake_done_ == nullptr;
+  }
+  // Each read, write and timer holds a ref to the handshaker until its
+  // callback has run.
+  void StartReadLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void StartWriteLocked(std::string data) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Client: acts on what the server has sent so far.
+  void OnServerBytesLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Client: gives up on a server that has not answered with a hello.
+  void OnHelloTimeout();
+  void CancelHelloTimerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Client: fails the connection to a server that has not enabled shared
+  // memory, and skips the request on later connections to it.
+  void FailPlainServerLocked(absl::string_view reason)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Server: answers the client's request.
+  void SendHelloLocked(uint8_t client_version)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Server: acts on what the client has sent so far.
+  void OnClientBytesLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Finishes without shared memory, handing everything received so far to
+  // whatever runs on the connection next.
+  void FallBackLocked(absl::string_view reason)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void FinishLocked(absl::Status error) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void OnWriteDone(absl::Status error);
+  void OnReadDone(absl::Status error);
+  static void OnWriteDoneScheduler(void* arg, grpc_error_handle error);
+  static void OnReadDoneScheduler(void* arg, grpc_error_handle error);
+
+  const bool is_client_;
+  Mutex mu_;
+  HandshakerArgs* args_ = nullptr;
+  absl::AnyInvocable<void(absl::Status)> on_handshake_done_
+      ABSL_GUARDED_BY(mu_);
+  std::unique_ptr<ShmSegment> segment_ ABSL_GUARDED_BY(mu_);
+  SliceBuffer received_ ABSL_GUARDED_BY(mu_);
+  SliceBuffer write_buffer_ ABSL_GUARDED_BY(mu_);
+  // Client only.
+  bool reply_sent_ ABSL_GUARDED_BY(mu_) = false;
+  std::optional<EventEngine::TaskHandle> hello_timer_ ABSL_GUARDED_BY(mu_);
+  // Server only.
+  bool hello_sent_ ABSL_GUARDED_BY(mu_) = false;
+  grpc_closure on_write_done_scheduler_ ABSL_GUARDED_BY(mu_);
+  grpc_closure on_read_done_scheduler_ ABSL_GUARDED_BY(mu_);
+};
+
+void ShmHandshaker::FinishLocked(absl::Status error) {
+  if (error.ok() && args_->endpoint == nullptr) {
+    // Shut down after an endpoint operation succeeded but before its
+    // callback ran.
+    error = GRPC_ERROR_CREATE("Handshaker shutdown");
+  }
+  if (error.ok() && segment_ != nullptr) {
+    auto control =
+        grpc_take_wrapped_event_engine_endpoint(args_->endpoint.release());
+    args_->endpoint.reset(grpc_event_engine_endpoint_create(CreateShmEndpoint(
+        std::move(segment_), is_client_, std::move(control),
+        args_->args.GetObjectRef<EventEngine>())));
+  } else {
+    if (!error.ok()) {
+      LOG_EVERY_N_SEC(ERROR, 60) << "Shared memory handshake failed: " << error;
+    }
+    segment_.reset();
+  }
+  InvokeOnHandshakeDone(args_, std::move(on_handshake_done_), std::move(error));
+  on_handshake_done_ = nullptr;
+}
+
+void ShmHandshaker::FallBackLocked(absl::string_view reason) {
+  GRPC_TRACE_LOG(handshaker, INFO)
+      << "Shared memory handshake falling back to the socket: " << reason;
+  segment_.reset();
+  args_->read_buffer.TakeAndAppend(received_);
+  FinishLocked(absl::OkStatus());
+}
+
+void ShmHandshaker::StartReadLocked() {
+  Ref().release();
+  grpc_endpoint_read(
+      args_->endpoint.get(), args_->read_buffer.c_slice_buffer(),
+      GRPC_CLOSURE_INIT(&on_read_done_scheduler_,
+                        &ShmHandshaker::OnReadDoneScheduler, this,
+                        grpc_schedule_on_exec_ctx),
+      /*urgent=*/true, /*min_progress_size=*/1);
+}
+
+void ShmHandshaker::StartWriteLocked(std::string data) {
+  Ref().release();
+  write_buffer_.Append(Slice::FromCopiedString(data));
+  grpc_endpoint_write(
+      args_->endpoint.get(), write_buffer_.c_slice_buffer(),
+      GRPC_CLOSURE_INIT(&on_write_done_scheduler_,
+                        &ShmHandshaker::OnWriteDoneScheduler, this,
+                        grpc_schedule_on_exec_ctx),
+      EventEngine::Endpoint::WriteArgs());
+}
+
+void ShmHandshaker::CancelHelloTimerLocked() {
+  if (hello_timer_.has_value() && args_->event_engine->Cancel(*hello_timer_)) {
+    // Our caller holds a ref too, so this is not the last one.
+    Unref();
+  }
+  hello_timer_.reset();
+}
+
+void ShmHandshaker::FailPlainServerLocked(absl::string_view reason) {
+  CancelHelloTimerLocked();
+  PlainServers::Get().Add(grpc_endpoint_get_peer(args_->endpoint.get()));
+  // Fails the outstanding read, if any.
+  args_->endpoint.reset();
+  FinishLocked(absl::UnavailableError(absl::StrCat(
+      "server has not enabled the shared memory transport: ", reason)));
+}
+
+void ShmHandshaker::OnHelloTimeout() {
+  {
+    MutexLock lock(&mu_);
+    hello_timer_.reset();
+    if (!done() && args_->endpoint != nullptr) {
+      FailPlainServerLocked("no hello");
+    }
+  }
+  Unref();
+}
+
+void ShmHandshaker::OnServerBytesLocked() {
+  // Anything but a hello is the server's own protocol: it has not enabled
+  // shared memory, and has taken our request for the start of ours.
+  const size_t magic_length =
+      std::min(received_.Length(), sizeof(kHelloMagic));
+  char magic[sizeof(kHelloMagic)];
+  received_.CopyFirstNBytesIntoBuffer(magic_length, magic);
+  if (memcmp(magic, kHelloMagic, magic_length) != 0) {
+    FailPlainServerLocked("unexpected bytes");
+    return;
+  }
+  if (received_.Length() < kHelloHeaderSize) {
+    StartReadLocked();
+    return;
+  }
+  uint8_t header[kHelloHeaderSize];
+  received_.CopyFirstNBytesIntoBuffer(kHelloHeaderSize, header);
+  const uint8_t version = header[sizeof(kHelloMagic)];
+  const size_t name_length = header[sizeof(kHelloMagic) + 1];
+  if (received_.Length() < kHelloHeaderSize + name_length) {
+    StartReadLocked();
+    return;
+  }
+  received_.MoveFirstNBytesIntoBuffer(kHelloHeaderSize, header);
+  CancelHelloTimerLocked();
+  if (name_length == 0) {
+    FallBackLocked("server could not set up a shared memory segment");
+    return;
+  }
+  std::string name(name_length, '\0');
+  received_.MoveFirstNBytesIntoBuffer(name_length, &name[0]);
+  absl::Status status;
+  if (version != kProtocolVersion) {
+    status = absl::UnimplementedError(
+        absl::StrCat("unsupported protocol version ", version));
+  } else {
+    auto segment = ShmSegment::Open(name);
+    if (segment.ok()) {
+      segment_ = std::move(*segment);
+      // Both sides have it mapped once we acknowledge, so the name is no
+      // longer needed.
+      segment_->Unlink();
+    } else {
+      status = segment.status();
+    }
+  }
+  if (!status.ok()) {
+    GRPC_TRACE_LOG(handshaker, INFO)
+        << "Declining shared memory segment " << name << ": " << status;
+  }
+  reply_sent_ = true;
+  StartWriteLocked(std::string(1, segment_ != nullptr ? kAck : kNack));
+}
+
+void ShmHandshaker::SendHelloLocked(uint8_t client_version) {
+  hello_sent_ = true;
+  std::string name;
+  if (client_version < kProtocolVersion) {
+    // Tell the client to carry on over the socket.
+    GRPC_TRACE_LOG(handshaker, INFO)
+        << "Declining shared memory for client protocol version "
+        << client_version;
+  } else {
+    auto segment = ShmSegment::Create(
+        args_->args.GetInt(GRPC_ARG_SHARED_MEMORY_RING_SIZE)
+            .value_or(ShmSegment::kDefaultRingSize));
+    if (segment.ok()) {
+      segment_ = std::move(*segment);
+      name = segment_->name();
+    } else {
+      LOG_EVERY_N_SEC(ERROR, 60)
+          << "Could not create shared memory segment: " << segment.status();
+    }
+  }
+  StartWriteLocked(absl::StrCat(
+      absl::string_view(kHelloMagic, sizeof(kHelloMagic)),
+      std::string(1, kProtocolVersion),
+      std::string(1, static_cast<char>(name.size())), name));
+}
+
+void ShmHandshaker::OnClientBytesLocked() {
+  if (!hello_sent_) {
+    // Anything but a request is the client's own protocol: it has not
+    // enabled shared memory.
+    const size_t magic_length =
+        std::min(received_.Length(), sizeof(kHelloMagic));
+    char magic[sizeof(kHelloMagic)];
+    received_.CopyFirstNBytesIntoBuffer(magic_length, magic);
+    if (memcmp(magic, kHelloMagic, magic_length) != 0) {
+      FallBackLocked("client did not request a shared memory segment");
+      return;
+    }
+    if (received_.Length() < kRequestSize) {
+      StartReadLocked();
+      return;
+    }
+    uint8_t request[kRequestSize];
+    received_.MoveFirstNBytesIntoBuffer(kRequestSize, request);
+    SendHelloLocked(request[sizeof(kHelloMagic)]);
+  }
+  if (received_.Length() == 0) {
+    StartReadLocked();
+    return;
+  }
+  if (segment_ == nullptr) {
+    // We declined, so the client has carried on with its own protocol.
+    FallBackLocked("no shared memory segment to offer");
+    return;
+  }
+  uint8_t reply;
+  received_.MoveFirstNBytesIntoBuffer(1, &reply);
+  if (reply == kAck) {
+    // Anything after the acknowledgement is a doorbell, and the new endpoint
+    // checks the rings when it starts anyway.
+    received_.Clear();
+    segment_->Unlink();
+    FinishLocked(absl::OkStatus());
+    return;
+  }
+  if (reply == kNack) {
+    FallBackLocked("client could not map the shared memory segment");
+    return;
+  }
+  FinishLocked(absl::UnavailableError(
+      "peer did not acknowledge the shared memory segment"));
+}
+
+// These callbacks can be invoked inline while already holding onto the mutex.
+// To avoid deadlocks, hop onto the EventEngine.
+void ShmHandshaker::OnWriteDoneScheduler(void* arg, grpc_error_handle error) {
+  auto* handshaker = static_cast<ShmHandshaker*>(arg);
+  handshaker->args_->event_engine->Run(
+      [handshaker, error = std::move(error)]() mutable {
+        ExecCtx exec_ctx;
+        handshaker->OnWriteDone(std::move(error));
+      });
+}
+
+void ShmHandshaker::OnReadDoneScheduler(void* arg, grpc_error_handle error) {
+  auto* handshaker = static_cast<ShmHandshaker*>(arg);
+  handshaker->args_->event_engine->Run(
+      [handshaker, error = std::move(error)]() mutable {
+        ExecCtx exec_ctx;
+        handshaker->OnReadDone(std::move(error));
+      });
+}
+
+void ShmHandshaker::OnWriteDone(absl::Status error) {
+  {
+    MutexLock lock(&mu_);
+    if (done()) {
+      // Finished while the write was in flight.
+    } else if (!error.ok() || args_->endpoint == nullptr) {
+      FinishLocked(std::move(error));
+    } else if (is_client_ && reply_sent_) {
+      // The client is done once its reply is out.
+      if (segment_ != nullptr) {
+        FinishLocked(absl::OkStatus());
+      } else {
+        FallBackLocked("could not map the server's shared memory segment");
+      }
+    }
+    // Otherwise a read is already outstanding for the peer's next message.
+  }
+  Unref();
+}
+
+void ShmHandshaker::OnReadDone(absl::Status error) {
+  {
+    MutexLock lock(&mu_);
+    if (done()) {
+      // Finished while the read was in flight.
+    } else if (args_->endpoint == nullptr) {
+      FinishLocked(std::move(error));
+    } else if (!error.ok()) {
+      if (is_client_ && !reply_sent_) {
+        FailPlainServerLocked(error.ToString());
+      } else {
+        FinishLocked(std::move(error));
+      }
+    } else {
+      received_.TakeAndAppend(args_->read_buffer);
+      if (is_client_) {
+        OnServerBytesLocked();
+      } else {
+        OnClientBytesLocked();
+      }
+    }
+  }
+  Unref();
+}
+
+void ShmHandshaker::Shutdown(absl::Status /*error*/) {
+  bool timer_cancelled = false;
+  {
+    MutexLock lock(&mu_);
+    if (done()) return;
+    if (hello_timer_.has_value() &&
+        args_->event_engine->Cancel(*hello_timer_)) {
+      hello_timer_.reset();
+      timer_cancelled = true;
+    }
+    // Fails the outstanding read, which finishes the handshake.
+    args_->endpoint.reset();
+  }
+  if (timer_cancelled) Unref();
+}
+
+void ShmHandshaker::DoHandshake(
+    HandshakerArgs* args,
+    absl::AnyInvocable<void(absl::Status)> on_handshake_done) {
+  // Only same-host peers can share memory.
+  if (!absl::StartsWith(grpc_endpoint_get_peer(args->endpoint.get()),
+                        "unix")) {
+    InvokeOnHandshakeDone(args, std::move(on_handshake_done), absl::OkStatus());
+    return;
+  }
+  MutexLock lock(&mu_);
+  args_ = args;
+  on_handshake_done_ = std::move(on_handshake_done);
+  received_.TakeAndAppend(args->read_buffer);
+  if (!grpc_event_engine::experimental::grpc_is_event_engine_endpoint(
+          args->endpoint.get())) {
+    FallBackLocked("shared memory transport requires an EventEngine endpoint");
+    return;
+  }
+  if (!is_client_) {
+    OnClientBytesLocked();
+    return;
+  }
+  if (PlainServers::Get().Contains(
+          grpc_endpoint_get_peer(args->endpoint.get()))) {
+    FallBackLocked("server has not enabled shared memory");
+    return;
+  }
+  StartWriteLocked(
+      absl::StrCat(absl::string_view(kHelloMagic, sizeof(kHelloMagic)),
+                   std::string(1, kProtocolVersion)));
+  StartReadLocked();
+  Ref().release();
+  hello_timer_ = args->event_engine->RunAfter(kServerHelloTimeout, [this]() {
+    ExecCtx exec_ctx;
+    OnHelloTimeout();
+  });
+}
+
+class ShmHandshakerFactory : public HandshakerFactory {
+ public:
+  explicit ShmHandshakerFactory(bool is_client) : is_client_(is_client) {}
+
+  void AddHandshakers(const ChannelArgs& args,
+                      grpc_pollset_set* /*interested_parties*/,
+                      HandshakeManager* handshake_mgr) override {
+    if (!args.GetBool(GRPC_ARG_SHARED_MEMORY_TRANSPORT).value_or(false)) {
+      return;
+    }
+    handshake_mgr->Add(MakeRefCounted<ShmHandshaker>(is_client_));
+  }
+
+  HandshakerPriority Priority() override {
+    // After the connection is established and before security handshakes, so
+    // that TLS, if any, runs over the shared memory endpoint.
+    return HandshakerPriority::kReadAheadSecurityHandshakers;
+  }
+
+ private:
+  const bool is_client_;
+};
+
+}  // namespace
+
+void RegisterShmHandshaker(CoreConfiguration::Builder* builder) {
+  builder->handshaker_registry()->RegisterHandshakerFactory(
+      HANDSHAKER_CLIENT, std::make_unique<ShmHandshakerFactory>(true));
+  builder->handshaker_registry()->RegisterHandshakerFactory(
+      HANDSHAKER_SERVER, std::make_unique<ShmHandshakerFactory>(false));
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,38 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_HANDSHAKER_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_HANDSHAKER_H
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/config/core_configuration.h"
+
+namespace grpc_core {
+
+// Registers the handshakers that move Unix domain socket connections onto
+// shared memory rings when GRPC_ARG_SHARED_MEMORY_TRANSPORT is set.  The
+// client asks for a segment; the server creates it and sends its name; the
+// client maps it and acknowledges, after which both sides replace the
+// connection's endpoint with one backed by the rings.  Whatever transport runs
+// on the connection (chttp2 or chaotic_good) is unaware of the switch.  If
+// either side cannot set up the segment, or the client has not enabled shared
+// memory, the connection carries on over the socket.  A client whose server
+// has not enabled it fails its first connection after at most a second, and
+// then connects to that server over the socket.
+void RegisterShmHandshaker(CoreConfiguration::Builder* builder);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_HANDSHAKER_H
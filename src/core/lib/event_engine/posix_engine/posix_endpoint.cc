@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
@@ -35,10 +36,12 @@
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
+#include "src/core/channelz/property_list.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
 #include "src/core/lib/event_engine/posix_engine/posix_interface.h"
+#include "src/core/lib/event_engine/posix_engine/telemetry.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
@@ -51,6 +54,7 @@
 #include "src/core/util/status_helper.h"
 #include "src/core/util/strerror.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/time.h"
 
 #ifdef GRPC_POSIX_SOCKET_TCP
 #ifdef GRPC_LINUX_ERRQUEUE
@@ -611,6 +615,7 @@ void PosixEndpointImpl::HandleRead(absl::Status status) {
 bool PosixEndpointImpl::Read(absl::AnyInvocable<void(absl::Status)> on_read,
                              SliceBuffer* buffer,
                              EventEngine::Endpoint::ReadArgs args) {
+  MaybeSampleTcpInfo();
   grpc_core::ReleasableMutexLock lock(&read_mu_);
   GRPC_TRACE_LOG(event_engine_endpoint, INFO)
       << "Endpoint[" << this << "]: Read";
@@ -857,6 +862,88 @@ void PosixEndpointImpl::HandleError(absl::Status status) {
   handle_->NotifyOnError(on_error_);
 }
 
+void PosixEndpointImpl::MaybeSampleTcpInfo() {
+  if (tcp_info_sample_interval_ == grpc_core::Duration::Zero()) return;
+  const grpc_core::Timestamp now = grpc_core::Timestamp::Now();
+  grpc_core::Timestamp next =
+      next_tcp_info_sample_.load(std::memory_order_relaxed);
+  if (now < next || !next_tcp_info_sample_.compare_exchange_strong(
+                        next, now + tcp_info_sample_interval_,
+                        std::memory_order_relaxed)) {
+    return;
+  }
+  tcp_info info;
+  if (!GetSocketTcpInfo(&info, &poller_->posix_interface(),
+                        handle_->WrappedFd())
+           .ok()) {
+    return;
+  }
+  auto* storage = tcp_info_storage_.get();
+  storage->Increment(TcpInfoDomain::kRtt, info.tcpi_rtt);
+  storage->Increment(TcpInfoDomain::kRttVariance, info.tcpi_rttvar);
+  storage->Increment(TcpInfoDomain::kCongestionWindow, info.tcpi_snd_cwnd);
+  if (info.length > offsetof(tcp_info, tcpi_min_rtt)) {
+    storage->Increment(TcpInfoDomain::kMinRtt, info.tcpi_min_rtt);
+  }
+  if (info.length > offsetof(tcp_info, tcpi_delivery_rate)) {
+    storage->Increment(TcpInfoDomain::kDeliveryRate, info.tcpi_delivery_rate);
+  }
+  TcpInfoCounters counters;
+  counters.time = now;
+  counters.total_retrans = info.tcpi_total_retrans;
+  if (info.length > offsetof(tcp_info, tcpi_sndbuf_limited)) {
+    counters.has_busy_time = true;
+    counters.busy_time_us = info.tcpi_busy_time;
+    counters.rwnd_limited_us = info.tcpi_rwnd_limited;
+    counters.sndbuf_limited_us = info.tcpi_sndbuf_limited;
+  }
+  TcpInfoDeltas deltas;
+  {
+    grpc_core::MutexLock lock(&tcp_info_mu_);
+    deltas = ComputeTcpInfoDeltas(last_tcp_info_, counters);
+    last_tcp_info_ = counters;
+  }
+  storage->Increment(TcpInfoDomain::kRetransmits, deltas.retransmits);
+  if (deltas.busy_percent.has_value()) {
+    storage->Increment(TcpInfoDomain::kBusy, *deltas.busy_percent);
+  }
+  if (deltas.rwnd_limited_percent.has_value()) {
+    storage->Increment(TcpInfoDomain::kRwndLimited,
+                       *deltas.rwnd_limited_percent);
+  }
+  if (deltas.sndbuf_limited_percent.has_value()) {
+    storage->Increment(TcpInfoDomain::kSndbufLimited,
+                       *deltas.sndbuf_limited_percent);
+  }
+}
+
+void PosixEndpointImpl::AddChannelzData(grpc_core::channelz::DataSink& sink) {
+  tcp_info info;
+  if (!GetSocketTcpInfo(&info, &poller_->posix_interface(),
+                        handle_->WrappedFd())
+           .ok()) {
+    return;
+  }
+  grpc_core::channelz::PropertyList properties;
+  properties.Set("rtt_us", info.tcpi_rtt)
+      .Set("rtt_variance_us", info.tcpi_rttvar)
+      .Set("congestion_window", info.tcpi_snd_cwnd)
+      .Set("total_retransmits", info.tcpi_total_retrans);
+  if (info.length > offsetof(tcp_info, tcpi_min_rtt)) {
+    properties.Set("min_rtt_us", info.tcpi_min_rtt)
+        .Set("notsent_bytes", info.tcpi_notsent_bytes);
+  }
+  if (info.length > offsetof(tcp_info, tcpi_delivery_rate)) {
+    properties.Set("delivery_rate_bytes_per_sec", info.tcpi_delivery_rate);
+  }
+  if (info.length > offsetof(tcp_info, tcpi_sndbuf_limited)) {
+    properties.Set("busy_time_us", info.tcpi_busy_time)
+        .Set("rwnd_limited_us", info.tcpi_rwnd_limited)
+        .Set("sndbuf_limited_us", info.tcpi_sndbuf_limited);
+  }
+  sink.AddData("tcp_info", std::move(properties));
+}
+
 bool PosixEndpointImpl::WriteWithTimestamps(struct msghdr* msg,
                                             size_t sending_length,
                                             PosixErrorOr<int64_t>* sent_length,
@@ -918,6 +1005,11 @@ void PosixEndpointImpl::HandleError(absl::Status /*status*/) {
 
 void PosixEndpointImpl::ZerocopyDisableAndWaitForRemaining() {}
 
+void PosixEndpointImpl::MaybeSampleTcpInfo() {}
+
+void PosixEndpointImpl::AddChannelzData(
+    grpc_core::channelz::DataSink& /*sink*/) {}
+
 bool PosixEndpointImpl::WriteWithTimestamps(
     struct msghdr* /*msg*/, size_t /*sending_length*/,
     PosixErrorOr<int64_t>* /*sent_length*/, int* /*saved_errno*/,
@@ -1197,6 +1289,7 @@ bool PosixEndpointImpl::Write(
 
   GRPC_TRACE_LOG(event_engine_endpoint, INFO)
       << "Endpoint[" << this << "]: Write " << data->Length() << " bytes";
+  MaybeSampleTcpInfo();
 
   if (data->Length() == 0) {
     GRPC_TRACE_LOG(event_engine_endpoint, INFO)
@@ -1338,6 +1431,13 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
               << ",ulimit hard memlock value = " << GetUlimitHardMemLock();
     }
   }
+  tcp_info_sample_interval_ =
+      grpc_core::Duration::Milliseconds(options.tcp_info_sample_interval_ms);
+  if (tcp_info_sample_interval_ != grpc_core::Duration::Zero()) {
+    tcp_info_storage_ = TcpInfoDomain::GetStorage();
+    grpc_core::MutexLock lock(&tcp_info_mu_);
+    last_tcp_info_.time = grpc_core::Timestamp::Now();
+  }
 #endif  // GRPC_LINUX_ERRQUEUE
   tcp_zerocopy_send_ctx_ = std::make_unique<TcpZerocopySendCtx>(
       zerocopy_enabled, options.tcp_tx_zerocopy_max_simultaneous_sends,
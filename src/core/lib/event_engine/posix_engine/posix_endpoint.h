@@ -35,10 +35,14 @@
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "src/core/channelz/channelz.h"
+#include "src/core/lib/event_engine/extensions/channelz.h"
 #include "src/core/lib/event_engine/posix.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
+#include "src/core/lib/event_engine/posix_engine/telemetry.h"
 #include "src/core/lib/event_engine/posix_engine/traced_buffer_list.h"
 #include "src/core/lib/iomgr/port.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
@@ -46,6 +50,7 @@
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/sync.h"
+#include "src/core/util/time.h"
 
 #ifdef GRPC_POSIX_SOCKET_TCP
 
@@ -488,6 +493,9 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
 
   bool CanTrackErrors() const { return poller_->CanTrackErrors(); }
 
+  // Reports a fresh TCP_INFO sample for the socket, where supported.
+  void AddChannelzData(grpc_core::channelz::DataSink& sink);
+
   void MaybeShutdown(
       absl::Status why,
       absl::AnyInvocable<void(absl::StatusOr<int> release_fd)> on_release_fd);
@@ -518,6 +526,9 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
                            PosixErrorOr<int64_t>* sent_length, int* saved_errno,
                            int additional_flags);
   absl::Status TcpAnnotateError(absl::Status src_error) const;
+  // Records a TCP_INFO sample if the sampling interval has passed since the
+  // last one.
+  void MaybeSampleTcpInfo();
 #ifdef GRPC_LINUX_ERRQUEUE
   bool ProcessErrors();
   // Reads a cmsg to process zerocopy control messages.
@@ -580,6 +591,19 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
 #endif  // GRPC_LINUX_ERRQUEUE
   // Cache whether we can set timestamping options
   bool ts_capable_ = true;
+#ifdef GRPC_LINUX_ERRQUEUE
+  // Zero if TCP_INFO sampling is disabled.
+  grpc_core::Duration tcp_info_sample_interval_;
+  // Claimed by whichever read or write first finds it has passed, so that
+  // concurrent reads and writes don't both take the sample.
+  std::atomic<grpc_core::Timestamp> next_tcp_info_sample_{
+      grpc_core::Timestamp::ProcessEpoch()};
+  grpc_core::InstrumentStorageRefPtr<TcpInfoDomain> tcp_info_storage_;
+  // Cumulative counters from the previous sample, to record the change in
+  // each since.
+  grpc_core::Mutex tcp_info_mu_;
+  TcpInfoCounters last_tcp_info_ ABSL_GUARDED_BY(tcp_info_mu_);
+#endif  // GRPC_LINUX_ERRQUEUE
   // Set to 1 if we do not want to be notified on errors anymore.
   std::atomic<bool> stop_error_notification_{false};
   std::unique_ptr<TcpZerocopySendCtx> tcp_zerocopy_send_ctx_;
@@ -594,7 +618,8 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   std::shared_ptr<grpc_event_engine::experimental::EventEngine> engine_;
 };
 
-class PosixEndpoint : public PosixEndpointWithFdSupport {
+class PosixEndpoint : public PosixEndpointWithFdSupport,
+                      public ChannelzExtension {
  public:
   PosixEndpoint(
       EventHandle* handle, PosixEngineClosure* on_shutdown,
@@ -634,9 +659,21 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
 
   bool CanTrackErrors() override { return impl_->CanTrackErrors(); }
 
+  void* QueryExtension(absl::string_view id) override {
+    if (id == ChannelzExtension::EndpointExtensionName()) {
+      return static_cast<ChannelzExtension*>(this);
+    }
+    return PosixEndpointWithFdSupport::QueryExtension(id);
+  }
+
+  void AddData(grpc_core::channelz::DataSink& sink) override {
+    impl_->AddChannelzData(sink);
+  }
+
   void Shutdown(absl::AnyInvocable<void(absl::StatusOr<int> release_fd)>
                     on_release_fd) override {
     if (!shutdown_.exchange(true, std::memory_order_acq_rel)) {
+      ShutdownChannelzExtension();
       impl_->MaybeShutdown(absl::FailedPreconditionError("Endpoint closing"),
                            std::move(on_release_fd));
     }
@@ -644,6 +681,7 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
 
   ~PosixEndpoint() override {
     if (!shutdown_.exchange(true, std::memory_order_acq_rel)) {
+      ShutdownChannelzExtension();
       impl_->MaybeShutdown(absl::FailedPreconditionError("Endpoint closing"),
                            nullptr);
     }
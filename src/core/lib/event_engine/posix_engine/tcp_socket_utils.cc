@@ -105,6 +105,8 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
                    config.GetInt(GRPC_ARG_EXPAND_WILDCARD_ADDRS)) != 0);
   options.dscp = AdjustValue(PosixTcpOptions::kDscpNotSet, 0, 63,
                              config.GetInt(GRPC_ARG_DSCP));
+  options.tcp_info_sample_interval_ms = AdjustValue(
+      0, 0, INT_MAX, config.GetInt(GRPC_ARG_TCP_INFO_SAMPLE_INTERVAL_MS));
   options.allow_reuse_port = IsSocketReusePortSupported();
   auto allow_reuse_port_value = config.GetInt(GRPC_ARG_ALLOW_REUSEPORT);
   if (allow_reuse_port_value.has_value()) {
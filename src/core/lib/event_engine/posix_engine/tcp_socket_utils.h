@@ -66,6 +66,7 @@ struct PosixTcpOptions {
   bool expand_wildcard_addrs = false;
   bool allow_reuse_port = false;
   int dscp = kDscpNotSet;
+  int tcp_info_sample_interval_ms = 0;
   grpc_core::RefCountedPtr<grpc_core::ResourceQuota> resource_quota;
   struct grpc_socket_mutator* socket_mutator = nullptr;
   grpc_event_engine::experimental::MemoryAllocatorFactory*
@@ -137,6 +138,7 @@ struct PosixTcpOptions {
     expand_wildcard_addrs = other.expand_wildcard_addrs;
     allow_reuse_port = other.allow_reuse_port;
     dscp = other.dscp;
+    tcp_info_sample_interval_ms = other.tcp_info_sample_interval_ms;
   }
 };
 
@@ -0,0 +1,135 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TELEMETRY_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TELEMETRY_H
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <optional>
+
+#include "src/core/telemetry/histogram.h"
+#include "src/core/telemetry/instrument.h"
+#include "src/core/util/time.h"
+
+namespace grpc_event_engine::experimental {
+
+// Connection health as reported by the kernel's TCP_INFO, sampled by posix
+// endpoints every GRPC_ARG_TCP_INFO_SAMPLE_INTERVAL_MS.  Each sample of
+// each connection records one value into each histogram.
+class TcpInfoDomain final : public grpc_core::InstrumentDomain<TcpInfoDomain> {
+ public:
+  using Backend = grpc_core::HighContentionBackend;
+  static constexpr auto kLabels = Labels();
+
+  static constexpr int64_t kMaxRttUs = 10 * 1000 * 1000;
+  static constexpr size_t kBuckets = 32;
+
+  static inline const auto kRtt =
+      RegisterHistogram<grpc_core::ExponentialHistogramShape>(
+          "grpc.tcp.rtt", "EXPERIMENTAL.  Smoothed round trip time", "us",
+          kMaxRttUs, kBuckets);
+  static inline const auto kRttVariance =
+      RegisterHistogram<grpc_core::ExponentialHistogramShape>(
+          "grpc.tcp.rtt_variance",
+          "EXPERIMENTAL.  Mean deviation of the round trip time", "us",
+          kMaxRttUs, kBuckets);
+  static inline const auto kMinRtt =
+      RegisterHistogram<grpc_core::ExponentialHistogramShape>(
+          "grpc.tcp.min_rtt",
+          "EXPERIMENTAL.  Minimum round trip time seen on the connection",
+          "us", kMaxRttUs, kBuckets);
+  static inline const auto kCongestionWindow =
+      RegisterHistogram<grpc_core::ExponentialHistogramShape>(
+          "grpc.tcp.congestion_window",
+          "EXPERIMENTAL.  Sender congestion window", "segments", 1 << 20,
+          kBuckets);
+  static inline const auto kRetransmits =
+      RegisterHistogram<grpc_core::ExponentialHistogramShape>(
+          "grpc.tcp.retransmits",
+          "EXPERIMENTAL.  Segments retransmitted since the previous sample",
+          "segments", 1 << 20, kBuckets);
+  static inline const auto kDeliveryRate =
+      RegisterHistogram<grpc_core::ExponentialHistogramShape>(
+          "grpc.tcp.delivery_rate",
+          "EXPERIMENTAL.  Most recent goodput measured by the kernel",
+          "bytes/s", int64_t{1} << 40, kBuckets);
+  // The limited histograms hold percentages of the time the connection was
+  // busy sending since the previous sample, and aren't recorded for samples
+  // with no busy time.
+  static inline const auto kBusy =
+      RegisterHistogram<grpc_core::ExponentialHistogramShape>(
+          "grpc.tcp.busy",
+          "EXPERIMENTAL.  Percentage of the time since the previous sample "
+          "spent with unacknowledged data outstanding",
+          "percent", 100, 100);
+  static inline const auto kRwndLimited =
+      RegisterHistogram<grpc_core::ExponentialHistogramShape>(
+          "grpc.tcp.rwnd_limited",
+          "EXPERIMENTAL.  Percentage of busy time since the previous sample "
+          "that sending was limited by the peer's receive window",
+          "percent", 100, 100);
+  static inline const auto kSndbufLimited =
+      RegisterHistogram<grpc_core::ExponentialHistogramShape>(
+          "grpc.tcp.sndbuf_limited",
+          "EXPERIMENTAL.  Percentage of busy time since the previous sample "
+          "that sending was limited by the local send buffer",
+          "percent", 100, 100);
+};
+
+// Cumulative TCP_INFO counters of a connection at one sample.
+struct TcpInfoCounters {
+  grpc_core::Timestamp time;
+  uint32_t total_retrans = 0;
+  // False on kernels that don't report busy and limited times.
+  bool has_busy_time = false;
+  uint64_t busy_time_us = 0;
+  uint64_t rwnd_limited_us = 0;
+  uint64_t sndbuf_limited_us = 0;
+};
+
+// What TcpInfoDomain records for the change between two samples.  Percentages
+// are unset when the time they are a share of is zero.
+struct TcpInfoDeltas {
+  uint32_t retransmits = 0;
+  std::optional<uint64_t> busy_percent;
+  std::optional<uint64_t> rwnd_limited_percent;
+  std::optional<uint64_t> sndbuf_limited_percent;
+};
+
+inline TcpInfoDeltas ComputeTcpInfoDeltas(const TcpInfoCounters& last,
+                                          const TcpInfoCounters& now) {
+  TcpInfoDeltas deltas;
+  // Unsigned differences stay right across counter wraparound.
+  deltas.retransmits = now.total_retrans - last.total_retrans;
+  if (!now.has_busy_time) return deltas;
+  const uint64_t busy_us = now.busy_time_us - last.busy_time_us;
+  const int64_t elapsed_us = (now.time - last.time).millis() * 1000;
+  if (elapsed_us > 0) {
+    deltas.busy_percent = std::min<uint64_t>(
+        100, busy_us * 100 / static_cast<uint64_t>(elapsed_us));
+  }
+  if (busy_us > 0) {
+    deltas.rwnd_limited_percent = std::min<uint64_t>(
+        100, (now.rwnd_limited_us - last.rwnd_limited_us) * 100 / busy_us);
+    deltas.sndbuf_limited_percent = std::min<uint64_t>(
+        100, (now.sndbuf_limited_us - last.sndbuf_limited_us) * 100 / busy_us);
+  }
+  return deltas;
+}
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TELEMETRY_H
@@ -21,6 +21,7 @@
 #include <grpc/support/thd_id.h>
 #include <inttypes.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
@@ -165,6 +166,25 @@ void DumpSignalHandler(int /* sig */) {
 }  // namespace
 
 thread_local WorkQueue* g_local_queue = nullptr;
+// The blocked thread count of the pool the current thread belongs to, or
+// nullptr if it is not a pool thread or is already in a ScopedBlockingRegion.
+thread_local std::atomic<size_t>* g_blocked_thread_count = nullptr;
+
+// -------- ScopedBlockingRegion --------
+
+ScopedBlockingRegion::ScopedBlockingRegion()
+    : blocked_thread_count_(std::exchange(g_blocked_thread_count, nullptr)) {
+  if (blocked_thread_count_ != nullptr) {
+    blocked_thread_count_->fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+ScopedBlockingRegion::~ScopedBlockingRegion() {
+  if (blocked_thread_count_ != nullptr) {
+    blocked_thread_count_->fetch_sub(1, std::memory_order_relaxed);
+    g_blocked_thread_count = blocked_thread_count_;
+  }
+}
 
 // -------- WorkStealingThreadPool --------
 
@@ -446,13 +466,22 @@ bool WorkStealingThreadPool::WorkStealingThreadPoolImpl::Lifeguard::
     // Idle threads will eventually wake up for an attempt at work stealing.
     return false;
   }
+  // Threads in a ScopedBlockingRegion can't pick up new work. Replace them
+  // without throttling, as long as fewer than reserve_threads threads are
+  // left to run closures.
+  const size_t blocked_thread_count = std::min(
+      pool_->blocked_thread_count()->load(std::memory_order_relaxed),
+      living_thread_count);
+  const bool replacing_blocked_threads =
+      living_thread_count - blocked_thread_count < pool_->reserve_threads();
   // No new threads if in the throttled state.
   // However, all workers are busy, so the Lifeguard should be more
   // vigilant about checking whether a new thread must be started.
-  if (grpc_core::Timestamp::Now() -
-          grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
-              pool_->last_started_thread_) <
-      kTimeBetweenThrottledThreadStarts) {
+  if (!replacing_blocked_threads &&
+      grpc_core::Timestamp::Now() -
+              grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+                  pool_->last_started_thread_) <
+          kTimeBetweenThrottledThreadStarts) {
     backoff_.Reset();
     return false;
   }
@@ -462,7 +491,8 @@ bool WorkStealingThreadPool::WorkStealingThreadPoolImpl::Lifeguard::
   // start a thread.
   GRPC_TRACE_LOG(event_engine, INFO)
       << "Starting new ThreadPool thread due to backlog (total threads: "
-      << living_thread_count + 1;
+      << living_thread_count + 1 << ", blocked: " << blocked_thread_count
+      << ")";
   pool_->StartThread();
   // Tell the lifeguard to monitor the pool more closely.
   backoff_.Reset();
@@ -492,6 +522,7 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
     pool_->TrackThread(gpr_thd_currentid());
   }
   g_local_queue = new BasicWorkQueue(pool_.get());
+  g_blocked_thread_count = pool_->blocked_thread_count();
   pool_->theft_registry()->Enroll(g_local_queue);
   ThreadLocal::SetIsEventEngineThread(true);
   while (Step()) {
@@ -513,6 +544,7 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
   GRPC_CHECK(g_local_queue->Empty());
   pool_->theft_registry()->Unenroll(g_local_queue);
   delete g_local_queue;
+  g_blocked_thread_count = nullptr;
   if (g_log_verbose_failures) {
     pool_->UntrackThread(gpr_thd_currentid());
   }
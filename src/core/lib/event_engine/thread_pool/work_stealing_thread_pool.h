@@ -41,6 +41,25 @@
 
 namespace grpc_event_engine::experimental {
 
+// Marks the current thread as blocked for the lifetime of the object, for
+// closures that may block for a long time, such as synchronous server
+// handlers. While some of a WorkStealingThreadPool's threads are blocked, the
+// pool starts replacement threads without throttling so that at least its
+// reserve number of threads remain available for other work.
+// Has no effect on threads that don't belong to a WorkStealingThreadPool, and
+// when nested.
+class ScopedBlockingRegion {
+ public:
+  ScopedBlockingRegion();
+  ~ScopedBlockingRegion();
+
+  ScopedBlockingRegion(const ScopedBlockingRegion&) = delete;
+  ScopedBlockingRegion& operator=(const ScopedBlockingRegion&) = delete;
+
+ private:
+  std::atomic<size_t>* const blocked_thread_count_;
+};
+
 class WorkStealingThreadPool final : public ThreadPool {
  public:
   explicit WorkStealingThreadPool(size_t reserve_threads);
@@ -140,6 +159,9 @@ class WorkStealingThreadPool final : public ThreadPool {
     size_t reserve_threads() { return reserve_threads_; }
     BusyThreadCount* busy_thread_count() { return &busy_thread_count_; }
     LivingThreadCount* living_thread_count() { return &living_thread_count_; }
+    std::atomic<size_t>* blocked_thread_count() {
+      return &blocked_thread_count_;
+    }
     TheftRegistry* theft_registry() { return &theft_registry_; }
     WorkQueue* queue() { return &queue_; }
     WorkSignal* work_signal() { return &work_signal_; }
@@ -175,6 +197,8 @@ class WorkStealingThreadPool final : public ThreadPool {
     const size_t reserve_threads_;
     BusyThreadCount busy_thread_count_;
     LivingThreadCount living_thread_count_;
+    // Number of threads in a ScopedBlockingRegion.
+    std::atomic<size_t> blocked_thread_count_{0};
     TheftRegistry theft_registry_;
     BasicWorkQueue queue_;
     // Track shutdown and fork bits separately.
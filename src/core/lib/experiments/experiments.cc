@@ -38,6 +38,10 @@ const char* const additional_constraints_chaotic_good_framing_layer = "{}";
 const char* const description_chttp2_bound_write_size =
     "Fix a bug where chttp2 can generate very large writes";
 const char* const additional_constraints_chttp2_bound_write_size = "{}";
+const char* const description_container_resource_tracker =
+    "Install a cgroup v2 ResourceTracker at init, so that the memory quota "
+    "treats the container's working set as memory pressure.";
+const char* const additional_constraints_container_resource_tracker = "{}";
 const char* const description_error_flatten =
     "Flatten errors to ordinary absl::Status form.";
 const char* const additional_constraints_error_flatten = "{}";
@@ -226,6 +230,9 @@ const ExperimentMetadata g_experiment_metadata[] = {
      false},
     {"chttp2_bound_write_size", description_chttp2_bound_write_size,
      additional_constraints_chttp2_bound_write_size, nullptr, 0, false, true},
+    {"container_resource_tracker", description_container_resource_tracker,
+     additional_constraints_container_resource_tracker, nullptr, 0, false,
+     true},
     {"error_flatten", description_error_flatten,
      additional_constraints_error_flatten, nullptr, 0, false, false},
     {"event_engine_client", description_event_engine_client,
@@ -370,6 +377,10 @@ const char* const additional_constraints_chaotic_good_framing_layer = "{}";
 const char* const description_chttp2_bound_write_size =
     "Fix a bug where chttp2 can generate very large writes";
 const char* const additional_constraints_chttp2_bound_write_size = "{}";
+const char* const description_container_resource_tracker =
+    "Install a cgroup v2 ResourceTracker at init, so that the memory quota "
+    "treats the container's working set as memory pressure.";
+const char* const additional_constraints_container_resource_tracker = "{}";
 const char* const description_error_flatten =
     "Flatten errors to ordinary absl::Status form.";
 const char* const additional_constraints_error_flatten = "{}";
@@ -558,6 +569,9 @@ const ExperimentMetadata g_experiment_metadata[] = {
      false},
     {"chttp2_bound_write_size", description_chttp2_bound_write_size,
      additional_constraints_chttp2_bound_write_size, nullptr, 0, false, true},
+    {"container_resource_tracker", description_container_resource_tracker,
+     additional_constraints_container_resource_tracker, nullptr, 0, false,
+     true},
     {"error_flatten", description_error_flatten,
      additional_constraints_error_flatten, nullptr, 0, false, false},
     {"event_engine_client", description_event_engine_client,
@@ -702,6 +716,10 @@ const char* const additional_constraints_chaotic_good_framing_layer = "{}";
 const char* const description_chttp2_bound_write_size =
     "Fix a bug where chttp2 can generate very large writes";
 const char* const additional_constraints_chttp2_bound_write_size = "{}";
+const char* const description_container_resource_tracker =
+    "Install a cgroup v2 ResourceTracker at init, so that the memory quota "
+    "treats the container's working set as memory pressure.";
+const char* const additional_constraints_container_resource_tracker = "{}";
 const char* const description_error_flatten =
     "Flatten errors to ordinary absl::Status form.";
 const char* const additional_constraints_error_flatten = "{}";
@@ -890,6 +908,9 @@ const ExperimentMetadata g_experiment_metadata[] = {
      false},
     {"chttp2_bound_write_size", description_chttp2_bound_write_size,
      additional_constraints_chttp2_bound_write_size, nullptr, 0, false, true},
+    {"container_resource_tracker", description_container_resource_tracker,
+     additional_constraints_container_resource_tracker, nullptr, 0, false,
+     true},
     {"error_flatten", description_error_flatten,
      additional_constraints_error_flatten, nullptr, 0, false, false},
     {"event_engine_client", description_event_engine_client,
@@ -27,6 +27,7 @@
 #include "src/core/lib/event_engine/event_engine_context.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/promise/activity.h"
+#include "src/core/telemetry/call_cpu_account.h"
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/json/json_writer.h"
 #include "src/core/util/latent_see.h"
@@ -377,6 +378,10 @@ void Party::RunPartyAndUnref(uint64_t prev_state) {
 #if !TARGET_OS_IPHONE
   ScopedTimeCache time_cache;
 #endif
+  // Charge polling to the call this party belongs to, if it's being
+  // accounted.  One meter spans every pass of the loop below, so the thread
+  // CPU clock is read twice per run however many passes it takes.
+  CallCpuMeter cpu_meter(arena_.get());
   for (;;) {
     uint64_t keep_allocated_mask = kAllocatedMask;
     // For each wakeup bit...
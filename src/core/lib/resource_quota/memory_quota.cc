@@ -140,7 +140,7 @@ double ContainerMemoryPressure() {
   if (tracker == nullptr) {
     return 0.0;
   }
-  auto value = tracker->GetMetricValue("memory");
+  auto value = tracker->GetMetricValue(ResourceTracker::kMemoryMetric);
   if (!value.ok()) {
     LOG(WARNING) << "Failed to get 'memory' metric from ResourceTracker: "
                  << value.status();
@@ -0,0 +1,280 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/resource_tracker/cgroup_resource_tracker.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
+#include "src/core/lib/experiments/experiments.h"
+
+#ifdef GPR_LINUX
+#include <unistd.h>
+#endif
+
+namespace grpc_core {
+
+namespace {
+
+std::optional<std::string> ReadFile(const std::string& path) {
+  FILE* fp = fopen(path.c_str(), "r");
+  if (fp == nullptr) return std::nullopt;
+  std::string contents;
+  char buf[512];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) contents.append(buf, n);
+  fclose(fp);
+  return contents;
+}
+
+// Reads a file holding a single unsigned integer.  "max" (no limit) is
+// returned as nullopt, as are read and parse failures.
+std::optional<uint64_t> ReadUint64(const std::string& path) {
+  auto contents = ReadFile(path);
+  if (!contents.has_value()) return std::nullopt;
+  uint64_t value;
+  if (!absl::SimpleAtoi(absl::StripAsciiWhitespace(*contents), &value)) {
+    return std::nullopt;
+  }
+  return value;
+}
+
+// Returns the value of key in a flat keyed file such as cpu.stat, where each
+// line is "<key> <value>".
+std::optional<uint64_t> FindKeyedValue(absl::string_view contents,
+                                       absl::string_view key) {
+  for (absl::string_view line : absl::StrSplit(contents, '\n')) {
+    std::pair<absl::string_view, absl::string_view> kv =
+        absl::StrSplit(line, absl::MaxSplits(' ', 1));
+    uint64_t value;
+    if (kv.first == key && absl::SimpleAtoi(kv.second, &value)) return value;
+  }
+  return std::nullopt;
+}
+
+// Returns "some avg10" from a PSI file, as a fraction of time stalled.  The
+// file looks like:
+//   some avg10=1.23 avg60=0.50 avg300=0.10 total=123456
+//   full avg10=0.00 avg60=0.00 avg300=0.00 total=0
+std::optional<double> ParsePressureSomeAvg10(absl::string_view contents) {
+  for (absl::string_view line : absl::StrSplit(contents, '\n')) {
+    if (!absl::ConsumePrefix(&line, "some ")) continue;
+    for (absl::string_view field : absl::StrSplit(line, ' ')) {
+      double value;
+      if (absl::ConsumePrefix(&field, "avg10=") &&
+          absl::SimpleAtod(field, &value)) {
+        return value / 100;
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+// Returns the process's cgroup v2 path from /proc/self/cgroup, whose v2
+// entry is "0::<path>".
+std::optional<std::string> ParseCgroupPath(absl::string_view contents) {
+  for (absl::string_view line : absl::StrSplit(contents, '\n')) {
+    if (absl::ConsumePrefix(&line, "0::")) return std::string(line);
+  }
+  return std::nullopt;
+}
+
+double PhysicalMemoryBytes() {
+#ifdef GPR_LINUX
+  const long pages = sysconf(_SC_PHYS_PAGES);
+  const long page_size = sysconf(_SC_PAGESIZE);
+  if (pages > 0 && page_size > 0) {
+    return static_cast<double>(pages) * static_cast<double>(page_size);
+  }
+#endif
+  return 0;
+}
+
+}  // namespace
+
+std::unique_ptr<CgroupResourceTracker> CgroupResourceTracker::Create(
+    Options options) {
+  auto proc_self_cgroup = ReadFile(options.proc_self_cgroup);
+  if (!proc_self_cgroup.has_value()) return nullptr;
+  auto cgroup_path = ParseCgroupPath(*proc_self_cgroup);
+  if (!cgroup_path.has_value()) return nullptr;
+  std::string cgroup_dir =
+      absl::StrCat(absl::StripSuffix(options.cgroup_root, "/"),
+                   absl::StripSuffix(*cgroup_path, "/"));
+  // The root cgroup has no memory accounting files, and neither does a
+  // cgroup v1 hierarchy.
+  if (!ReadUint64(absl::StrCat(cgroup_dir, "/memory.current")).has_value()) {
+    return nullptr;
+  }
+  return std::unique_ptr<CgroupResourceTracker>(new CgroupResourceTracker(
+      std::move(cgroup_dir), options.sample_interval));
+}
+
+CgroupResourceTracker::CgroupResourceTracker(std::string cgroup_dir,
+                                             Duration sample_interval)
+    : cgroup_dir_(std::move(cgroup_dir)), sample_interval_(sample_interval) {
+  MutexLock lock(&mu_);
+  SampleLocked();
+}
+
+std::vector<std::string> CgroupResourceTracker::GetMetrics() const {
+  MaybeSample();
+  std::vector<std::string> metrics;
+  if (memory_.load(std::memory_order_relaxed) >= 0) {
+    metrics.push_back(kMemoryMetric);
+  }
+  if (cpu_.load(std::memory_order_relaxed) >= 0) {
+    metrics.push_back(kCpuMetric);
+  }
+  if (memory_pressure_.load(std::memory_order_relaxed) >= 0) {
+    metrics.push_back(kMemoryPressureMetric);
+  }
+  if (cpu_pressure_.load(std::memory_order_relaxed) >= 0) {
+    metrics.push_back(kCpuPressureMetric);
+  }
+  return metrics;
+}
+
+absl::StatusOr<double> CgroupResourceTracker::GetMetricValue(
+    const std::string& metric_name) const {
+  MaybeSample();
+  double value = -1;
+  if (metric_name == kMemoryMetric) {
+    value = memory_.load(std::memory_order_relaxed);
+  } else if (metric_name == kCpuMetric) {
+    value = cpu_.load(std::memory_order_relaxed);
+  } else if (metric_name == kMemoryPressureMetric) {
+    value = memory_pressure_.load(std::memory_order_relaxed);
+  } else if (metric_name == kCpuPressureMetric) {
+    value = cpu_pressure_.load(std::memory_order_relaxed);
+  }
+  if (value < 0) {
+    return absl::NotFoundError(
+        absl::StrCat("cgroup metric not available: ", metric_name));
+  }
+  return value;
+}
+
+void CgroupResourceTracker::MaybeSample() const {
+  if (Timestamp::Now() < next_sample_.load(std::memory_order_relaxed)) return;
+  // If another thread is already sampling, use the current values.
+  if (!mu_.TryLock()) return;
+  if (Timestamp::Now() >= next_sample_.load(std::memory_order_relaxed)) {
+    SampleLocked();
+  }
+  mu_.Unlock();
+}
+
+double CgroupResourceTracker::CpuLimitLocked() const {
+  // cpu.max is "<quota> <period>", where quota may be "max".
+  auto cpu_max = ReadFile(absl::StrCat(cgroup_dir_, "/cpu.max"));
+  if (cpu_max.has_value()) {
+    std::vector<absl::string_view> fields = absl::StrSplit(
+        absl::StripAsciiWhitespace(*cpu_max), ' ', absl::SkipEmpty());
+    double quota;
+    double period;
+    if (fields.size() == 2 && absl::SimpleAtod(fields[0], &quota) &&
+        absl::SimpleAtod(fields[1], &period) && quota > 0 && period > 0) {
+      return quota / period;
+    }
+  }
+  return gpr_cpu_num_cores();
+}
+
+void CgroupResourceTracker::SampleLocked() const {
+  const Timestamp now = Timestamp::Now();
+  // Memory.
+  auto memory_current =
+      ReadUint64(absl::StrCat(cgroup_dir_, "/memory.current"));
+  if (memory_current.has_value()) {
+    // memory.current includes page cache the kernel can reclaim at no cost,
+    // so a container that has only read files would look full.  Count the
+    // working set instead, as the kubelet does.
+    uint64_t working_set = *memory_current;
+    auto memory_stat = ReadFile(absl::StrCat(cgroup_dir_, "/memory.stat"));
+    if (memory_stat.has_value()) {
+      auto inactive_file = FindKeyedValue(*memory_stat, "inactive_file");
+      if (inactive_file.has_value()) {
+        working_set -= std::min(working_set, *inactive_file);
+      }
+    }
+    double limit = PhysicalMemoryBytes();
+    auto memory_max = ReadUint64(absl::StrCat(cgroup_dir_, "/memory.max"));
+    if (memory_max.has_value()) limit = *memory_max;
+    if (limit > 0) {
+      memory_.store(std::min(1.0, working_set / limit),
+                    std::memory_order_relaxed);
+    }
+  }
+  // CPU: usage since the previous sample, relative to the limit.
+  auto cpu_stat = ReadFile(absl::StrCat(cgroup_dir_, "/cpu.stat"));
+  std::optional<uint64_t> cpu_usage_usec;
+  if (cpu_stat.has_value()) {
+    cpu_usage_usec = FindKeyedValue(*cpu_stat, "usage_usec");
+  }
+  if (cpu_usage_usec.has_value() && last_cpu_usage_usec_.has_value() &&
+      *cpu_usage_usec >= *last_cpu_usage_usec_ && now > last_sample_time_) {
+    const double cpu_seconds =
+        static_cast<double>(*cpu_usage_usec - *last_cpu_usage_usec_) / 1e6;
+    const double wall_seconds = (now - last_sample_time_).seconds();
+    cpu_.store(cpu_seconds / (wall_seconds * CpuLimitLocked()),
+               std::memory_order_relaxed);
+  }
+  last_cpu_usage_usec_ = cpu_usage_usec;
+  // Pressure stall information.
+  auto memory_pressure =
+      ReadFile(absl::StrCat(cgroup_dir_, "/memory.pressure"));
+  if (memory_pressure.has_value()) {
+    auto value = ParsePressureSomeAvg10(*memory_pressure);
+    if (value.has_value()) {
+      memory_pressure_.store(*value, std::memory_order_relaxed);
+    }
+  }
+  auto cpu_pressure = ReadFile(absl::StrCat(cgroup_dir_, "/cpu.pressure"));
+  if (cpu_pressure.has_value()) {
+    auto value = ParsePressureSomeAvg10(*cpu_pressure);
+    if (value.has_value()) {
+      cpu_pressure_.store(*value, std::memory_order_relaxed);
+    }
+  }
+  last_sample_time_ = now;
+  next_sample_.store(now + sample_interval_, std::memory_order_relaxed);
+}
+
+void MaybeRegisterCgroupResourceTracker() {
+#ifdef GPR_LINUX
+  if (!IsContainerResourceTrackerEnabled()) return;
+  if (ResourceTracker::Get() != nullptr) return;
+  auto tracker =
+      CgroupResourceTracker::Create(CgroupResourceTracker::Options());
+  if (tracker == nullptr) return;
+  VLOG(2) << "Using cgroup v2 resource tracker";
+  // Lives for the rest of the process, like any tracker set by the
+  // application.
+  ResourceTracker::Set(tracker.release());
+#endif
+}
+
+}  // namespace grpc_core
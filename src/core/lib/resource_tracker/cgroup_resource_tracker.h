@@ -0,0 +1,102 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_RESOURCE_TRACKER_CGROUP_RESOURCE_TRACKER_H
+#define GRPC_SRC_CORE_LIB_RESOURCE_TRACKER_CGROUP_RESOURCE_TRACKER_H
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/statusor.h"
+#include "src/core/lib/resource_tracker/resource_tracker.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+
+// ResourceTracker for the Linux cgroup v2 the process runs in.
+//
+// Provides:
+// - kMemoryMetric: the working set (memory.current less the inactive_file
+//   page cache from memory.stat) as a fraction of memory.max (or of
+//   physical memory if the cgroup has no memory limit).
+// - kCpuMetric: CPU time from cpu.stat used over the last sample interval,
+//   as a fraction of the CPU limit from cpu.max (or of all cores if the
+//   cgroup has no CPU limit).  Available from the second sample on.
+// - kMemoryPressureMetric, kCpuPressureMetric: the "some avg10" pressure
+//   stall information from memory.pressure and cpu.pressure, as a
+//   fraction.  Only available if the kernel has PSI enabled.
+//
+// The cgroup files are read at most once per sample interval, by whichever
+// caller first finds the values stale; all other reads are lock free.
+class CgroupResourceTracker final : public ResourceTracker {
+ public:
+  static constexpr char kMemoryPressureMetric[] = "memory_pressure";
+  static constexpr char kCpuPressureMetric[] = "cpu_pressure";
+
+  struct Options {
+    // Mount point of the cgroup v2 hierarchy.
+    std::string cgroup_root = "/sys/fs/cgroup";
+    // File naming the process's cgroup relative to cgroup_root.
+    std::string proc_self_cgroup = "/proc/self/cgroup";
+    Duration sample_interval = Duration::Seconds(1);
+  };
+
+  // Returns nullptr if the process is not in a cgroup v2 hierarchy that
+  // accounts for memory.
+  static std::unique_ptr<CgroupResourceTracker> Create(Options options);
+
+  std::vector<std::string> GetMetrics() const override;
+  absl::StatusOr<double> GetMetricValue(
+      const std::string& metric_name) const override;
+
+ private:
+  CgroupResourceTracker(std::string cgroup_dir, Duration sample_interval);
+
+  // Samples the cgroup files if the last sample is older than
+  // sample_interval_.
+  void MaybeSample() const;
+  void SampleLocked() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  double CpuLimitLocked() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  const std::string cgroup_dir_;
+  const Duration sample_interval_;
+
+  // Latest sampled values, or negative if unavailable.
+  mutable std::atomic<double> memory_{-1};
+  mutable std::atomic<double> cpu_{-1};
+  mutable std::atomic<double> memory_pressure_{-1};
+  mutable std::atomic<double> cpu_pressure_{-1};
+  mutable std::atomic<Timestamp> next_sample_{Timestamp::InfPast()};
+
+  mutable Mutex mu_;
+  mutable Timestamp last_sample_time_ ABSL_GUARDED_BY(mu_);
+  mutable std::optional<uint64_t> last_cpu_usage_usec_ ABSL_GUARDED_BY(mu_);
+};
+
+// Installs a CgroupResourceTracker as the process's ResourceTracker if the
+// container_resource_tracker experiment is enabled, unless one is already set
+// or the process doesn't run in a cgroup v2 hierarchy.
+void MaybeRegisterCgroupResourceTracker();
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_RESOURCE_TRACKER_CGROUP_RESOURCE_TRACKER_H
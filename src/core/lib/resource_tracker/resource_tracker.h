@@ -27,6 +27,12 @@ namespace grpc_core {
 // Interface for tracking and retrieving resource usage metrics.
 class ResourceTracker {
  public:
+  // Well known metric names.
+  // Fraction of the container's memory limit in use, in [0, 1].
+  static constexpr char kMemoryMetric[] = "memory";
+  // Fraction of the container's CPU limit recently used.
+  static constexpr char kCpuMetric[] = "cpu";
+
   virtual ~ResourceTracker() = default;
 
   static ResourceTracker* Get();
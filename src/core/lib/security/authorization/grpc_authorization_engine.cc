@@ -18,8 +18,13 @@
 
 #include <algorithm>
 #include <map>
+#include <optional>
+#include <string>
 #include <utility>
+#include <vector>
 
+#include "absl/container/inlined_vector.h"
+#include "absl/strings/string_view.h"
 #include "src/core/lib/security/authorization/audit_logging.h"
 #include "src/core/lib/security/authorization/authorization_engine.h"
 #include "src/core/util/grpc_check.h"
@@ -42,6 +47,94 @@ bool ShouldLog(const Decision& decision,
           condition == Rbac::AuditCondition::kOnDeny);
 }
 
+// The request paths that a rule can possibly match. std::nullopt is used for
+// rules that may match any path.
+struct PathSet {
+  std::vector<std::string> exact;
+  std::vector<std::string> prefixes;
+
+  size_t size() const { return exact.size() + prefixes.size(); }
+};
+
+std::optional<PathSet> PathSetForPathMatcher(const StringMatcher& matcher) {
+  if (!matcher.case_sensitive()) return std::nullopt;
+  switch (matcher.type()) {
+    case StringMatcher::Type::kExact:
+      return PathSet{{matcher.string_matcher()}, {}};
+    case StringMatcher::Type::kPrefix:
+      return PathSet{{}, {matcher.string_matcher()}};
+    default:
+      return std::nullopt;
+  }
+}
+
+std::optional<PathSet> PathSetForRule(const Rbac::Permission& permission);
+std::optional<PathSet> PathSetForRule(const Rbac::Principal& principal);
+
+// A conjunction can only match paths that all of its operands match, so any
+// constrained operand bounds it. Picks the narrowest one.
+std::optional<PathSet> NarrowestPathSet(std::optional<PathSet> a,
+                                        std::optional<PathSet> b) {
+  if (!a.has_value()) return b;
+  if (!b.has_value()) return a;
+  return a->size() <= b->size() ? std::move(a) : std::move(b);
+}
+
+template <typename Rule>
+std::optional<PathSet> PathSetForAnd(
+    const std::vector<std::unique_ptr<Rule>>& rules) {
+  std::optional<PathSet> result;
+  for (const auto& rule : rules) {
+    result = NarrowestPathSet(std::move(result), PathSetForRule(*rule));
+  }
+  return result;
+}
+
+// A disjunction is only constrained if every operand is.
+template <typename Rule>
+std::optional<PathSet> PathSetForOr(
+    const std::vector<std::unique_ptr<Rule>>& rules) {
+  PathSet result;
+  for (const auto& rule : rules) {
+    std::optional<PathSet> path_set = PathSetForRule(*rule);
+    if (!path_set.has_value()) return std::nullopt;
+    for (auto& path : path_set->exact) {
+      result.exact.push_back(std::move(path));
+    }
+    for (auto& prefix : path_set->prefixes) {
+      result.prefixes.push_back(std::move(prefix));
+    }
+  }
+  return result;
+}
+
+std::optional<PathSet> PathSetForRule(const Rbac::Permission& permission) {
+  switch (permission.type) {
+    case Rbac::Permission::RuleType::kAnd:
+      return PathSetForAnd(permission.permissions);
+    case Rbac::Permission::RuleType::kOr:
+      return PathSetForOr(permission.permissions);
+    case Rbac::Permission::RuleType::kPath:
+      return PathSetForPathMatcher(permission.string_matcher);
+    default:
+      return std::nullopt;
+  }
+}
+
+std::optional<PathSet> PathSetForRule(const Rbac::Principal& principal) {
+  switch (principal.type) {
+    case Rbac::Principal::RuleType::kAnd:
+      return PathSetForAnd(principal.principals);
+    case Rbac::Principal::RuleType::kOr:
+      return PathSetForOr(principal.principals);
+    case Rbac::Principal::RuleType::kPath:
+      if (!principal.string_matcher.has_value()) return std::nullopt;
+      return PathSetForPathMatcher(*principal.string_matcher);
+    default:
+      return std::nullopt;
+  }
+}
+
 }  // namespace
 
 GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac policy)
@@ -49,12 +142,41 @@ GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac policy)
       action_(policy.action),
       audit_condition_(policy.audit_condition) {
   for (auto& sub_policy : policy.policies) {
+    const size_t index = policies_.size();
+    std::optional<PathSet> path_set =
+        NarrowestPathSet(PathSetForRule(sub_policy.second.permissions),
+                         PathSetForRule(sub_policy.second.principals));
+    if (!path_set.has_value()) {
+      path_index_.unindexed.push_back(index);
+    } else {
+      for (auto& path : path_set->exact) {
+        auto& indexes = path_index_.exact[std::move(path)];
+        if (indexes.empty() || indexes.back() != index) {
+          indexes.push_back(index);
+        }
+      }
+      for (auto& prefix : path_set->prefixes) {
+        auto& indexes = path_index_.prefix[prefix];
+        if (indexes.empty()) {
+          path_index_.prefix_lengths.push_back(prefix.size());
+        }
+        if (indexes.empty() || indexes.back() != index) {
+          indexes.push_back(index);
+        }
+      }
+    }
     Policy policy;
     policy.name = sub_policy.first;
     policy.matcher = std::make_unique<PolicyAuthorizationMatcher>(
         std::move(sub_policy.second));
     policies_.push_back(std::move(policy));
   }
+  std::sort(path_index_.prefix_lengths.begin(),
+            path_index_.prefix_lengths.end());
+  path_index_.prefix_lengths.erase(
+      std::unique(path_index_.prefix_lengths.begin(),
+                  path_index_.prefix_lengths.end()),
+      path_index_.prefix_lengths.end());
   for (auto& logger_config : policy.logger_configs) {
     auto logger =
         AuditLoggerRegistry::CreateAuditLogger(std::move(logger_config));
@@ -68,6 +190,7 @@ GrpcAuthorizationEngine::GrpcAuthorizationEngine(
     : name_(std::move(other.name_)),
       action_(other.action_),
       policies_(std::move(other.policies_)),
+      path_index_(std::move(other.path_index_)),
       audit_condition_(other.audit_condition_),
       audit_loggers_(std::move(other.audit_loggers_)) {}
 
@@ -76,6 +199,7 @@ GrpcAuthorizationEngine& GrpcAuthorizationEngine::operator=(
   name_ = std::move(other.name_);
   action_ = other.action_;
   policies_ = std::move(other.policies_);
+  path_index_ = std::move(other.path_index_);
   audit_condition_ = other.audit_condition_;
   audit_loggers_ = std::move(other.audit_loggers_);
   return *this;
@@ -85,11 +209,43 @@ AuthorizationEngine::Decision GrpcAuthorizationEngine::Evaluate(
     const EvaluateArgs& args) const {
   Decision decision;
   bool matches = false;
-  for (const auto& policy : policies_) {
-    if (policy.matcher->Matches(args)) {
-      matches = true;
-      decision.matching_policy_name = policy.name;
-      break;
+  if (path_index_.unindexed.size() == policies_.size()) {
+    for (const auto& policy : policies_) {
+      if (policy.matcher->Matches(args)) {
+        matches = true;
+        decision.matching_policy_name = policy.name;
+        break;
+      }
+    }
+  } else {
+    // Collect the policies that can match this path, then evaluate them in
+    // their original order so the first match is the same as for a linear
+    // scan over all policies.
+    absl::string_view path = args.GetPath();
+    absl::InlinedVector<size_t, 16> candidates(path_index_.unindexed.begin(),
+                                               path_index_.unindexed.end());
+    auto add_candidates = [&candidates](const std::vector<size_t>& indexes) {
+      candidates.insert(candidates.end(), indexes.begin(), indexes.end());
+    };
+    auto exact_it = path_index_.exact.find(path);
+    if (exact_it != path_index_.exact.end()) add_candidates(exact_it->second);
+    for (size_t length : path_index_.prefix_lengths) {
+      if (length > path.size()) break;
+      auto prefix_it = path_index_.prefix.find(path.substr(0, length));
+      if (prefix_it != path_index_.prefix.end()) {
+        add_candidates(prefix_it->second);
+      }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                     candidates.end());
+    for (size_t index : candidates) {
+      const Policy& policy = policies_[index];
+      if (policy.matcher->Matches(args)) {
+        matches = true;
+        decision.matching_policy_name = policy.name;
+        break;
+      }
     }
   }
   decision.type = (matches == (action_ == Rbac::Action::kAllow))
@@ -23,6 +23,7 @@
 #include <string>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "src/core/lib/security/authorization/authorization_engine.h"
 #include "src/core/lib/security/authorization/evaluate_args.h"
 #include "src/core/lib/security/authorization/matchers.h"
@@ -62,6 +63,11 @@ class GrpcAuthorizationEngine : public AuthorizationEngine {
     return audit_loggers_;
   }
 
+  // Required only for testing purpose.
+  size_t num_path_indexed_policies() const {
+    return policies_.size() - path_index_.unindexed.size();
+  }
+
   // Evaluates incoming request against RBAC policy and makes a decision to
   // whether allow/deny this request.
   Decision Evaluate(const EvaluateArgs& args) const override;
@@ -72,9 +78,24 @@ class GrpcAuthorizationEngine : public AuthorizationEngine {
     std::unique_ptr<AuthorizationMatcher> matcher;
   };
 
+  // Index from request path to the policies that can possibly match it.
+  // Policies whose rules only match a known set of exact paths or path
+  // prefixes are evaluated only for requests on those paths; all others are
+  // in `unindexed` and are evaluated for every request. All lists hold
+  // indexes into policies_ in ascending order, so that evaluating the
+  // candidates in index order yields the same first match as a linear scan.
+  struct PathIndex {
+    absl::flat_hash_map<std::string, std::vector<size_t>> exact;
+    absl::flat_hash_map<std::string, std::vector<size_t>> prefix;
+    // Distinct lengths of the keys in `prefix`, in ascending order.
+    std::vector<size_t> prefix_lengths;
+    std::vector<size_t> unindexed;
+  };
+
   std::string name_;
   Rbac::Action action_;
   std::vector<Policy> policies_;
+  PathIndex path_index_;
   Rbac::AuditCondition audit_condition_;
   std::vector<std::unique_ptr<AuditLogger>> audit_loggers_;
 };
@@ -91,6 +91,10 @@ class PublishToAppEncoder {
     Append(GrpcRetryPushbackMsMetadata::key(), count.millis());
   }
 
+  void Encode(GrpcStreamWeightMetadata, uint32_t weight) {
+    Append(GrpcStreamWeightMetadata::key(), weight);
+  }
+
   void Encode(LbTokenMetadata, const Slice& slice) {
     Append(LbTokenMetadata::key(), slice);
   }
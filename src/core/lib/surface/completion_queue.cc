@@ -61,6 +61,12 @@ namespace {
 thread_local grpc_cq_completion* g_cached_event;
 thread_local grpc_completion_queue* g_cached_cq;
 
+// Number of GRPC_CQ_FUNCTOR_RUN_INLINE functors waiting for this thread's
+// ExecCtx to flush. Past GRPC_CQ_MAX_PENDING_INLINE_FUNCTORS, functors are
+// offloaded to the EventEngine so that one thread doesn't take on a whole
+// burst of calls.
+thread_local size_t g_pending_inline_functors;
+
 struct plucker {
   grpc_pollset_worker** worker;
   void* tag;
@@ -273,6 +279,9 @@ struct cq_vtable {
                  void* done_arg, grpc_cq_completion* storage, bool internal);
   grpc_event (*next)(grpc_completion_queue* cq, gpr_timespec deadline,
                      void* reserved);
+  size_t (*next_batch)(grpc_completion_queue* cq, grpc_event* events,
+                       size_t max_events, gpr_timespec deadline,
+                       void* reserved);
   grpc_event (*pluck)(grpc_completion_queue* cq, void* tag,
                       gpr_timespec deadline, void* reserved);
 };
@@ -466,6 +475,10 @@ static void cq_end_op_for_callback(
 static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
                           void* reserved);
 
+static size_t cq_next_batch(grpc_completion_queue* cq, grpc_event* events,
+                            size_t max_events, gpr_timespec deadline,
+                            void* reserved);
+
 static grpc_event cq_pluck(grpc_completion_queue* cq, void* tag,
                            gpr_timespec deadline, void* reserved);
 
@@ -485,15 +498,15 @@ static const cq_vtable g_cq_vtable[] = {
     // GRPC_CQ_NEXT
     {GRPC_CQ_NEXT, sizeof(cq_next_data), cq_init_next, cq_shutdown_next,
      cq_destroy_next, cq_begin_op_for_next, cq_end_op_for_next, cq_next,
-     nullptr},
+     cq_next_batch, nullptr},
     // GRPC_CQ_PLUCK
     {GRPC_CQ_PLUCK, sizeof(cq_pluck_data), cq_init_pluck, cq_shutdown_pluck,
      cq_destroy_pluck, cq_begin_op_for_pluck, cq_end_op_for_pluck, nullptr,
-     cq_pluck},
+     nullptr, cq_pluck},
     // GRPC_CQ_CALLBACK
     {GRPC_CQ_CALLBACK, sizeof(cq_callback_data), cq_init_callback,
      cq_shutdown_callback, cq_destroy_callback, cq_begin_op_for_callback,
-     cq_end_op_for_callback, nullptr, nullptr},
+     cq_end_op_for_callback, nullptr, nullptr, nullptr},
 };
 
 #define DATA_FROM_CQ(cq) ((void*)((cq) + 1))
@@ -908,6 +921,18 @@ static void cq_end_op_for_callback(
   }
 
   auto* functor = static_cast<grpc_completion_queue_functor*>(tag);
+  if (functor->inlineable == GRPC_CQ_FUNCTOR_RUN_INLINE &&
+      g_pending_inline_functors < GRPC_CQ_MAX_PENDING_INLINE_FUNCTORS) {
+    ++g_pending_inline_functors;
+    grpc_core::ExecCtx::Run(
+        DEBUG_LOCATION,
+        grpc_core::NewClosure([functor](grpc_error_handle error) {
+          --g_pending_inline_functors;
+          (*functor->functor_run)(functor, error.ok());
+        }),
+        error);
+    return;
+  }
   cqd->event_engine->Run(
       [engine = cqd->event_engine, functor, ok = error.ok()]() {
         grpc_core::ExecCtx exec_ctx;
@@ -984,18 +1009,24 @@ static void dump_pending_tags(grpc_completion_queue* cq) {
 static void dump_pending_tags(grpc_completion_queue* /*cq*/) {}
 #endif
 
-static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
-                          void* reserved) {
-  grpc_event ret;
-  cq_next_data* cqd = static_cast<cq_next_data*> DATA_FROM_CQ(cq);
+// Fills in \a event from the completion \a c and releases its storage.
+static void cq_pop_completion(grpc_cq_completion* c, grpc_event* event) {
+  event->type = GRPC_OP_COMPLETE;
+  event->success = c->next & 1u;
+  event->tag = c->tag;
+  c->done(c->done_arg, c);
+}
 
-  GRPC_TRACE_LOG(api, INFO)
-      << "grpc_completion_queue_next(cq=" << cq
-      << ", deadline=gpr_timespec { tv_sec: " << deadline.tv_sec
-      << ", tv_nsec: " << deadline.tv_nsec
-      << ", clock_type: " << (int)deadline.clock_type
-      << " }, reserved=" << reserved << ")";
-  GRPC_CHECK(!reserved);
+// Blocks until at least one event is available (or the queue is shut down
+// or the deadline passes), then drains up to \a max_events completions that
+// are already queued without polling again. Returns the number of entries
+// written to \a events; a GRPC_QUEUE_TIMEOUT or GRPC_QUEUE_SHUTDOWN event is
+// always returned on its own.
+static size_t cq_next_internal(grpc_completion_queue* cq, grpc_event* events,
+                               size_t max_events, gpr_timespec deadline) {
+  GRPC_CHECK_GT(max_events, 0u);
+  size_t num_events = 0;
+  cq_next_data* cqd = static_cast<cq_next_data*> DATA_FROM_CQ(cq);
 
   dump_pending_tags(cq);
 
@@ -1017,20 +1048,14 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
     if (is_finished_arg.stolen_completion != nullptr) {
       grpc_cq_completion* c = is_finished_arg.stolen_completion;
       is_finished_arg.stolen_completion = nullptr;
-      ret.type = GRPC_OP_COMPLETE;
-      ret.success = c->next & 1u;
-      ret.tag = c->tag;
-      c->done(c->done_arg, c);
+      cq_pop_completion(c, &events[num_events++]);
       break;
     }
 
     grpc_cq_completion* c = cqd->queue.Pop();
 
     if (c != nullptr) {
-      ret.type = GRPC_OP_COMPLETE;
-      ret.success = c->next & 1u;
-      ret.tag = c->tag;
-      c->done(c->done_arg, c);
+      cq_pop_completion(c, &events[num_events++]);
       break;
     } else {
       // If c == NULL it means either the queue is empty OR in an transient
@@ -1056,15 +1081,17 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
         continue;
       }
 
-      ret.type = GRPC_QUEUE_SHUTDOWN;
-      ret.success = 0;
+      events[0].type = GRPC_QUEUE_SHUTDOWN;
+      events[0].success = 0;
+      num_events = 1;
       break;
     }
 
     if (!is_finished_arg.first_loop &&
         grpc_core::Timestamp::Now() >= deadline_millis) {
-      ret.type = GRPC_QUEUE_TIMEOUT;
-      ret.success = 0;
+      events[0].type = GRPC_QUEUE_TIMEOUT;
+      events[0].success = 0;
+      num_events = 1;
       dump_pending_tags(cq);
       break;
     }
@@ -1080,17 +1107,27 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
       LOG(ERROR) << "Completion queue next failed: "
                  << grpc_core::StatusToString(err);
       if (err == absl::CancelledError()) {
-        ret.type = GRPC_QUEUE_SHUTDOWN;
+        events[0].type = GRPC_QUEUE_SHUTDOWN;
       } else {
-        ret.type = GRPC_QUEUE_TIMEOUT;
+        events[0].type = GRPC_QUEUE_TIMEOUT;
       }
-      ret.success = 0;
+      events[0].success = 0;
+      num_events = 1;
       dump_pending_tags(cq);
       break;
     }
     is_finished_arg.first_loop = false;
   }
 
+  // Drain whatever else is already queued, without going back to the poller.
+  if (events[0].type == GRPC_OP_COMPLETE) {
+    while (num_events < max_events) {
+      grpc_cq_completion* c = cqd->queue.Pop();
+      if (c == nullptr) break;
+      cq_pop_completion(c, &events[num_events++]);
+    }
+  }
+
   if (cqd->queue.num_items() > 0 &&
       cqd->pending_events.load(std::memory_order_acquire) > 0) {
     gpr_mu_lock(cq->mu);
@@ -1098,14 +1135,46 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
     gpr_mu_unlock(cq->mu);
   }
 
-  GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, &ret);
+  for (size_t i = 0; i < num_events; ++i) {
+    GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, &events[i]);
+  }
   GRPC_CQ_INTERNAL_UNREF(cq, "next");
 
   GRPC_CHECK_EQ(is_finished_arg.stolen_completion, nullptr);
 
+  return num_events;
+}
+
+static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
+                          void* reserved) {
+  GRPC_TRACE_LOG(api, INFO)
+      << "grpc_completion_queue_next(cq=" << cq
+      << ", deadline=gpr_timespec { tv_sec: " << deadline.tv_sec
+      << ", tv_nsec: " << deadline.tv_nsec
+      << ", clock_type: " << (int)deadline.clock_type
+      << " }, reserved=" << reserved << ")";
+  GRPC_CHECK(!reserved);
+
+  grpc_event ret;
+  cq_next_internal(cq, &ret, 1, deadline);
   return ret;
 }
 
+static size_t cq_next_batch(grpc_completion_queue* cq, grpc_event* events,
+                            size_t max_events, gpr_timespec deadline,
+                            void* reserved) {
+  GRPC_TRACE_LOG(api, INFO)
+      << "grpc_completion_queue_next_batch(cq=" << cq
+      << ", events=" << events << ", max_events=" << max_events
+      << ", deadline=gpr_timespec { tv_sec: " << deadline.tv_sec
+      << ", tv_nsec: " << deadline.tv_nsec
+      << ", clock_type: " << (int)deadline.clock_type
+      << " }, reserved=" << reserved << ")";
+  GRPC_CHECK(!reserved);
+
+  return cq_next_internal(cq, events, max_events, deadline);
+}
+
 // Finishes the completion queue shutdown. This means that there are no more
 // completion events / tags expected from the completion queue
 // - Must be called under completion queue lock
@@ -1153,6 +1222,13 @@ grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
   return cq->vtable->next(cq, deadline, reserved);
 }
 
+size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                        grpc_event* events, size_t max_events,
+                                        gpr_timespec deadline,
+                                        void* reserved) {
+  return cq->vtable->next_batch(cq, events, max_events, deadline, reserved);
+}
+
 static int add_plucker(grpc_completion_queue* cq, void* tag,
                        grpc_pollset_worker** worker) {
   cq_pluck_data* cqd = static_cast<cq_pluck_data*> DATA_FROM_CQ(cq);
@@ -67,6 +67,16 @@ void grpc_cq_internal_unref(grpc_completion_queue* cq);
 // false if completion_queue has been shutdown.
 bool grpc_cq_begin_op(grpc_completion_queue* cq, void* tag);
 
+// Value of grpc_completion_queue_functor::inlineable asking a callback
+// completion queue to run the functor on the thread that ends its operation,
+// when that thread's ExecCtx is flushed, instead of on the EventEngine. A
+// thread only defers a bounded number of such functors at a time; beyond that
+// they are run on the EventEngine like any other.
+#define GRPC_CQ_FUNCTOR_RUN_INLINE 2
+
+// Most GRPC_CQ_FUNCTOR_RUN_INLINE functors a thread defers at a time.
+#define GRPC_CQ_MAX_PENDING_INLINE_FUNCTORS 16
+
 // Queue a GRPC_OP_COMPLETED operation; tag must correspond to the tag passed to
 // grpc_cq_begin_op
 void grpc_cq_end_op(grpc_completion_queue* cq, void* tag,
@@ -60,6 +60,7 @@
 #include "src/core/lib/transport/error_utils.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/server/server_interface.h"
+#include "src/core/telemetry/call_cpu_account.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/core/telemetry/stats.h"
 #include "src/core/telemetry/stats_data.h"
@@ -736,6 +737,8 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
                                             void* notify_tag,
                                             bool is_notify_tag_closure) {
   GRPC_LATENT_SEE_SCOPE("FilterStackCall::StartBatch");
+  // The application holds a ref for the duration, so the arena outlives this.
+  CallCpuMeter cpu_meter(arena());
 
   size_t i;
   const grpc_op* op;
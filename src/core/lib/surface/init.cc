@@ -42,9 +42,12 @@
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/iomgr.h"
 #include "src/core/lib/iomgr/timer_manager.h"
+#include "src/core/lib/resource_tracker/cgroup_resource_tracker.h"
 #include "src/core/lib/security/authorization/grpc_server_authz_filter.h"
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "src/core/lib/surface/init_internally.h"
+#include "src/core/telemetry/call_cpu.h"
+#include "src/core/telemetry/call_latency.h"
 #include "src/core/util/fork.h"
 #include "src/core/util/sync.h"
 #include "src/core/util/thd.h"
@@ -102,6 +105,9 @@ static void do_basic_init(void) {
   grpc_fork_handlers_auto_register();
   grpc_tracer_init();
   grpc_client_channel_global_init_backup_polling();
+  grpc_core::MaybeRegisterCgroupResourceTracker();
+  grpc_core::MaybeRegisterCallLatencyStatsPlugin();
+  grpc_core::MaybeRegisterCallCpuStatsPlugin();
 }
 
 void grpc_init(void) {
@@ -0,0 +1,54 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_TRANSPORT_MESSAGE_BUFFER_ALLOCATOR_H
+#define GRPC_SRC_CORE_LIB_TRANSPORT_MESSAGE_BUFFER_ALLOCATOR_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include "absl/strings/string_view.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/useful.h"
+
+namespace grpc_core {
+
+// Supplies application-owned memory for received messages.  When one is set
+// in the channel args, a transport that knows a message's length before its
+// payload has arrived may assemble the payload directly into the returned
+// slice as frames are read, instead of holding on to its read buffers.  The
+// message is then delivered as that single slice, so the application can
+// consume it in place.
+class MessageBufferAllocator : public RefCounted<MessageBufferAllocator> {
+ public:
+  static absl::string_view ChannelArgName() {
+    return "grpc.internal.message_buffer_allocator";
+  }
+  static int ChannelArgsCompare(const MessageBufferAllocator* a,
+                                const MessageBufferAllocator* b) {
+    return QsortCompare(a, b);
+  }
+
+  // Returns a slice of exactly `length` bytes to receive the payload of a
+  // message on `method` (the request path), or an empty slice to have the
+  // transport use its own buffers.  Called from the transport's read path,
+  // so must not block.  `length` comes from the peer: transports must bound
+  // it (by the receive message size limit) before calling this.
+  virtual MutableSlice Allocate(absl::string_view method, size_t length) = 0;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_TRANSPORT_MESSAGE_BUFFER_ALLOCATOR_H
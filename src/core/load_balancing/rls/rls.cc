@@ -38,6 +38,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
 #include <list>
 #include <map>
@@ -251,6 +252,11 @@ class RlsLb final : public LoadBalancingPolicy {
       return picker_->Pick(args);
     }
 
+    RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker() const
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+      return picker_;
+    }
+
     // Updates for the child policy are handled in two phases:
     // 1. In StartUpdate(), we parse and validate the new child policy
     //    config and store the parsed config.
@@ -332,29 +338,15 @@ class RlsLb final : public LoadBalancingPolicy {
         ABSL_GUARDED_BY(&RlsLb::mu_);
   };
 
-  // A picker that uses the cache and the request map in the LB policy
-  // (synchronized via a mutex) to determine how to route requests.
-  class Picker final : public LoadBalancingPolicy::SubchannelPicker {
-   public:
-    explicit Picker(RefCountedPtr<RlsLb> lb_policy);
-
-    PickResult Pick(PickArgs args) override;
-
-   private:
-    PickResult PickFromDefaultTargetOrFail(const char* reason, PickArgs args,
-                                           absl::Status status)
-        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
-
-    RefCountedPtr<RlsLb> lb_policy_;
-    RefCountedPtr<RlsLbConfig> config_;
-    RefCountedPtr<ChildPolicyWrapper> default_child_policy_;
-  };
-
   // An LRU cache with adjustable size.
   class Cache final {
    public:
     using Iterator = std::list<RequestKey>::iterator;
 
+    struct EntrySnapshot;
+    using SnapshotMap =
+        std::unordered_map<RequestKey, EntrySnapshot, absl::Hash<RequestKey>>;
+
     class Entry final : public InternallyRefCounted<Entry> {
      public:
       Entry(RefCountedPtr<RlsLb> lb_policy, const RequestKey& key);
@@ -428,6 +420,25 @@ class RlsLb final : public LoadBalancingPolicy {
       // Moves entry to the end of the LRU list.
       void MarkUsed() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
 
+      // Records that a picker served a pick from a snapshot of this entry.
+      // Does not require the lock.  The mark is consumed by the cache when
+      // choosing entries to evict, which gives the entry another pass
+      // through the LRU list instead of evicting it.
+      void MarkUsedByPicker() {
+        // Avoid dirtying the cache line on every pick.
+        if (!used_by_picker_.load(std::memory_order_relaxed)) {
+          used_by_picker_.store(true, std::memory_order_relaxed);
+        }
+      }
+      bool TakeUsedByPicker() {
+        return used_by_picker_.exchange(false, std::memory_order_relaxed);
+      }
+
+      // Returns a snapshot of the entry for use by a picker, or nullopt if
+      // the entry does not currently have data usable for picks.
+      std::optional<EntrySnapshot> Snapshot(Timestamp now)
+          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+
       // Takes entries from child_policy_wrappers_ and appends them to the end
       // of \a child_policy_wrappers.
       void TakeChildPolicyWrappers(
@@ -482,6 +493,22 @@ class RlsLb final : public LoadBalancingPolicy {
 
       Timestamp min_expiration_time_ ABSL_GUARDED_BY(&RlsLb::mu_);
       Cache::Iterator lru_iterator_ ABSL_GUARDED_BY(&RlsLb::mu_);
+      std::atomic<bool> used_by_picker_{false};
+    };
+
+    // An immutable copy of the data needed to pick from a cache entry.
+    struct EntrySnapshot {
+      struct Target {
+        std::string target;
+        grpc_connectivity_state connectivity_state;
+        RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker;
+      };
+
+      RefCountedPtr<Entry> entry;
+      std::vector<Target> targets;
+      grpc_event_engine::experimental::Slice header_data;
+      Timestamp data_expiration_time;
+      Timestamp stale_time;
     };
 
     explicit Cache(RlsLb* lb_policy);
@@ -512,6 +539,9 @@ class RlsLb final : public LoadBalancingPolicy {
     // Resets backoff of all the cache entries.
     void ResetAllBackoff() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
 
+    // Returns snapshots of all entries that have data usable for picks.
+    SnapshotMap Snapshot() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+
     // Shutdown the cache; clean-up and orphan all the stored cache entries.
     GRPC_MUST_USE_RESULT std::vector<RefCountedPtr<ChildPolicyWrapper>>
     Shutdown() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
@@ -546,6 +576,34 @@ class RlsLb final : public LoadBalancingPolicy {
     std::optional<EventEngine::TaskHandle> cleanup_timer_handle_;
   };
 
+  // A picker that uses the cache and the request map in the LB policy
+  // (synchronized via a mutex) to determine how to route requests.
+  //
+  // Picks for keys whose cache entry had fresh, non-stale data when the
+  // picker was created are served from a snapshot of that entry without
+  // acquiring the mutex. Every change to a cache entry's data or to the
+  // state of its child policies results in a new picker, so the snapshot
+  // is at most one picker update behind the cache.
+  class Picker final : public LoadBalancingPolicy::SubchannelPicker {
+   public:
+    explicit Picker(RefCountedPtr<RlsLb> lb_policy);
+
+    PickResult Pick(PickArgs args) override;
+
+   private:
+    PickResult PickFromSnapshot(const Cache::EntrySnapshot& snapshot,
+                                PickArgs args);
+
+    PickResult PickFromDefaultTargetOrFail(const char* reason, PickArgs args,
+                                           absl::Status status)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+
+    RefCountedPtr<RlsLb> lb_policy_;
+    RefCountedPtr<RlsLbConfig> config_;
+    RefCountedPtr<ChildPolicyWrapper> default_child_policy_;
+    Cache::SnapshotMap cache_snapshot_;
+  };
+
   // Channel for communicating with the RLS server.
   // Contains throttling logic for RLS requests.
   class RlsChannel final : public InternallyRefCounted<RlsChannel> {
@@ -955,6 +1013,10 @@ RlsLb::Picker::Picker(RefCountedPtr<RlsLb> lb_policy)
     default_child_policy_ =
         lb_policy_->default_child_policy_->Ref(DEBUG_LOCATION, "Picker");
   }
+  MutexLock lock(&lb_policy_->mu_);
+  if (!lb_policy_->is_shutdown_) {
+    cache_snapshot_ = lb_policy_->cache_.Snapshot();
+  }
 }
 
 LoadBalancingPolicy::PickResult RlsLb::Picker::Pick(PickArgs args) {
@@ -967,6 +1029,18 @@ LoadBalancingPolicy::PickResult RlsLb::Picker::Pick(PickArgs args) {
       << "[rlslb " << lb_policy_.get() << "] picker=" << this
       << ": request keys: " << key.ToString();
   Timestamp now = Timestamp::Now();
+  // If the picker has a snapshot of a cache entry for this key whose data
+  // is neither expired nor stale, then no RLS request is needed and we can
+  // use it without acquiring the lock.
+  auto it = cache_snapshot_.find(key);
+  if (it != cache_snapshot_.end() &&
+      it->second.data_expiration_time >= now && it->second.stale_time >= now) {
+    GRPC_TRACE_LOG(rls_lb, INFO)
+        << "[rlslb " << lb_policy_.get() << "] picker=" << this
+        << ": using snapshot of cache entry " << it->second.entry.get();
+    it->second.entry->MarkUsedByPicker();
+    return PickFromSnapshot(it->second, args);
+  }
   MutexLock lock(&lb_policy_->mu_);
   if (lb_policy_->is_shutdown_) {
     return PickResult::Fail(
@@ -1021,6 +1095,38 @@ LoadBalancingPolicy::PickResult RlsLb::Picker::Pick(PickArgs args) {
   return PickResult::Queue();
 }
 
+LoadBalancingPolicy::PickResult RlsLb::Picker::PickFromSnapshot(
+    const Cache::EntrySnapshot& snapshot, PickArgs args) {
+  // Same logic as Cache::Entry::Pick(): skip targets before the last one
+  // that are in state TRANSIENT_FAILURE.
+  size_t i = 0;
+  for (; i < snapshot.targets.size() - 1; ++i) {
+    if (snapshot.targets[i].connectivity_state !=
+        GRPC_CHANNEL_TRANSIENT_FAILURE) {
+      break;
+    }
+  }
+  const Cache::EntrySnapshot::Target& target = snapshot.targets[i];
+  GRPC_TRACE_LOG(rls_lb, INFO)
+      << "[rlslb " << lb_policy_.get() << "] picker=" << this << ": target "
+      << target.target << " (" << i << " of " << snapshot.targets.size()
+      << ") in state " << ConnectivityStateName(target.connectivity_state)
+      << "; delegating";
+  auto pick_result = target.picker->Pick(args);
+  lb_policy_->MaybeExportPickCount(kMetricTargetPicks, target.target,
+                                   config_->lookup_service(), pick_result);
+  // Add header data.
+  if (!snapshot.header_data.empty()) {
+    auto* complete_pick =
+        std::get_if<PickResult::Complete>(&pick_result.result);
+    if (complete_pick != nullptr) {
+      complete_pick->metadata_mutations.Set(kRlsHeaderKey,
+                                            snapshot.header_data.Ref());
+    }
+  }
+  return pick_result;
+}
+
 LoadBalancingPolicy::PickResult RlsLb::Picker::PickFromDefaultTargetOrFail(
     const char* reason, PickArgs args, absl::Status status) {
   if (default_child_policy_ != nullptr) {
@@ -1207,6 +1313,27 @@ void RlsLb::Cache::Entry::MarkUsed() {
   lru_iterator_ = new_it;
 }
 
+std::optional<RlsLb::Cache::EntrySnapshot> RlsLb::Cache::Entry::Snapshot(
+    Timestamp now) {
+  if (data_expiration_time_ < now || child_policy_wrappers_.empty()) {
+    return std::nullopt;
+  }
+  EntrySnapshot snapshot;
+  snapshot.targets.reserve(child_policy_wrappers_.size());
+  for (const auto& child_policy_wrapper : child_policy_wrappers_) {
+    auto picker = child_policy_wrapper->picker();
+    if (picker == nullptr) return std::nullopt;
+    snapshot.targets.push_back({child_policy_wrapper->target(),
+                                child_policy_wrapper->connectivity_state(),
+                                std::move(picker)});
+  }
+  snapshot.entry = Ref(DEBUG_LOCATION, "Snapshot");
+  snapshot.header_data = header_data_.Ref();
+  snapshot.data_expiration_time = data_expiration_time_;
+  snapshot.stale_time = stale_time_;
+  return snapshot;
+}
+
 std::vector<RlsLb::ChildPolicyWrapper*>
 RlsLb::Cache::Entry::OnRlsResponseLocked(
     ResponseInfo response, std::unique_ptr<BackOff> backoff_state,
@@ -1351,6 +1478,16 @@ void RlsLb::Cache::ResetAllBackoff() {
   lb_policy_->UpdatePickerAsync();
 }
 
+RlsLb::Cache::SnapshotMap RlsLb::Cache::Snapshot() {
+  SnapshotMap snapshots;
+  const Timestamp now = Timestamp::Now();
+  for (auto& [key, entry] : map_) {
+    auto snapshot = entry->Snapshot(now);
+    if (snapshot.has_value()) snapshots.emplace(key, std::move(*snapshot));
+  }
+  return snapshots;
+}
+
 std::vector<RefCountedPtr<RlsLb::ChildPolicyWrapper>> RlsLb::Cache::Shutdown() {
   std::vector<RefCountedPtr<ChildPolicyWrapper>>
       child_policy_wrappers_to_delete;
@@ -1402,20 +1539,26 @@ void RlsLb::Cache::OnCleanupTimer() {
       << "[rlslb " << lb_policy_ << "] cache cleanup timer fired";
   std::vector<RefCountedPtr<ChildPolicyWrapper>>
       child_policy_wrappers_to_delete;
-  MutexLock lock(&lb_policy_->mu_);
-  if (!cleanup_timer_handle_.has_value()) return;
-  if (lb_policy_->is_shutdown_) return;
-  for (auto it = map_.begin(); it != map_.end();) {
-    auto& entry = it->second;
-    if (GPR_UNLIKELY(entry->ShouldRemove() && entry->CanEvict())) {
-      size_ -= entry->Size();
-      entry->TakeChildPolicyWrappers(&child_policy_wrappers_to_delete);
-      it = map_.erase(it);
-    } else {
-      ++it;
+  bool evicted = false;
+  {
+    MutexLock lock(&lb_policy_->mu_);
+    if (!cleanup_timer_handle_.has_value()) return;
+    if (lb_policy_->is_shutdown_) return;
+    for (auto it = map_.begin(); it != map_.end();) {
+      auto& entry = it->second;
+      if (GPR_UNLIKELY(entry->ShouldRemove() && entry->CanEvict())) {
+        size_ -= entry->Size();
+        entry->TakeChildPolicyWrappers(&child_policy_wrappers_to_delete);
+        it = map_.erase(it);
+        evicted = true;
+      } else {
+        ++it;
+      }
     }
+    StartCleanupTimer();
   }
-  StartCleanupTimer();
+  // The current picker's snapshot may still hold the evicted entries.
+  if (evicted) lb_policy_->UpdatePickerLocked();
 }
 
 size_t RlsLb::Cache::EntrySizeForKey(const RequestKey& key) {
@@ -1426,12 +1569,22 @@ size_t RlsLb::Cache::EntrySizeForKey(const RequestKey& key) {
 void RlsLb::Cache::MaybeShrinkSize(
     size_t bytes, std::vector<RefCountedPtr<ChildPolicyWrapper>>*
                       child_policy_wrappers_to_delete) {
+  // Picks served from a picker's snapshot don't update the LRU list, so
+  // entries that were used that way get moved to the back of the list
+  // instead of being evicted.  Each entry gets at most one such pass.
+  size_t entries_to_requeue = lru_list_.size();
+  bool evicted = false;
   while (size_ > bytes) {
     auto lru_it = lru_list_.begin();
     if (GPR_UNLIKELY(lru_it == lru_list_.end())) break;
     auto map_it = map_.find(*lru_it);
     GRPC_CHECK(map_it != map_.end());
     auto& entry = map_it->second;
+    if (entries_to_requeue > 0 && entry->TakeUsedByPicker()) {
+      --entries_to_requeue;
+      entry->MarkUsed();
+      continue;
+    }
     if (!entry->CanEvict()) break;
     GRPC_TRACE_LOG(rls_lb, INFO)
         << "[rlslb " << lb_policy_ << "] LRU eviction: removing entry "
@@ -1439,10 +1592,14 @@ void RlsLb::Cache::MaybeShrinkSize(
     size_ -= entry->Size();
     entry->TakeChildPolicyWrappers(child_policy_wrappers_to_delete);
     map_.erase(map_it);
+    evicted = true;
   }
   GRPC_TRACE_LOG(rls_lb, INFO)
       << "[rlslb " << lb_policy_
       << "] LRU pass complete: desired size=" << bytes << " size=" << size_;
+  // The current picker's snapshot may still hold the evicted entries.  The
+  // lock is held here, so the picker is replaced asynchronously.
+  if (evicted) lb_policy_->UpdatePickerAsync();
 }
 
 //
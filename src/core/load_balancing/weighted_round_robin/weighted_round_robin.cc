@@ -66,6 +66,7 @@
 #include "src/core/util/json/json_args.h"
 #include "src/core/util/json/json_object_loader.h"
 #include "src/core/util/orphanable.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/ref_counted.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/shared_bit_gen.h"
@@ -420,8 +421,17 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
   bool shutdown_ = false;
 
   // Accessed by picker.
-  std::atomic<uint32_t> scheduler_state_{
-      absl::Uniform<uint32_t>(SharedBitGen())};
+  // Sequence numbers for the scheduler are drawn from per-CPU shards, so that
+  // concurrent picks don't all increment the same counter.  Each shard is an
+  // independent, randomly seeded sequence.  The scheduler picks each endpoint
+  // in proportion to its weight over any sufficiently long run of sequence
+  // numbers, so the picks made from all shards together preserve the same
+  // proportions.
+  struct alignas(GPR_CACHELINE_SIZE) SchedulerState {
+    std::atomic<uint32_t> sequence{absl::Uniform<uint32_t>(SharedBitGen())};
+  };
+  PerCpu<SchedulerState> scheduler_state_{
+      PerCpuOptions().SetCpusPerShard(2).SetMaxShards(64)};
 };
 
 //
@@ -639,7 +649,10 @@ void WeightedRoundRobin::Picker::BuildSchedulerAndStartTimerLocked() {
       << "[WRR " << wrr_.get() << " picker " << this
       << "] new weights: " << absl::StrJoin(weights, " ");
   auto scheduler_or = StaticStrideScheduler::Make(
-      weights, [this]() { return wrr_->scheduler_state_.fetch_add(1); });
+      weights, [this]() {
+        return wrr_->scheduler_state_.this_cpu().sequence.fetch_add(
+            1, std::memory_order_relaxed);
+      });
   std::shared_ptr<StaticStrideScheduler> scheduler;
   if (scheduler_or.has_value()) {
     scheduler =
@@ -20,6 +20,7 @@
 #include <grpc/support/port_platform.h>
 
 #include "src/core/config/core_configuration.h"
+#include "src/core/ext/transport/shm/shm_handshaker.h"
 #include "src/core/handshaker/endpoint_info/endpoint_info_handshaker.h"
 #include "src/core/handshaker/http_connect/http_connect_handshaker.h"
 #include "src/core/handshaker/tcp_connect/tcp_connect_handshaker.h"
@@ -55,6 +56,8 @@ extern void RegisterResourceQuota(CoreConfiguration::Builder* builder);
 extern void FaultInjectionFilterRegister(CoreConfiguration::Builder* builder);
 extern void RegisterDnsResolver(CoreConfiguration::Builder* builder);
 extern void RegisterBackendMetricFilter(CoreConfiguration::Builder* builder);
+extern void RegisterAdaptiveConcurrencyFilter(
+    CoreConfiguration::Builder* builder);
 extern void RegisterSockaddrResolver(CoreConfiguration::Builder* builder);
 extern void RegisterFakeResolver(CoreConfiguration::Builder* builder);
 extern void RegisterPriorityLbPolicy(CoreConfiguration::Builder* builder);
@@ -99,6 +102,7 @@ void BuildCoreConfiguration(CoreConfiguration::Builder* builder) {
   // to the start of the handshaker list.
   RegisterEndpointInfoHandshaker(builder);
   RegisterHttpConnectHandshaker(builder);
+  RegisterShmHandshaker(builder);
   RegisterTCPConnectHandshaker(builder);
   RegisterChttp2Transport(builder);
 #ifndef GRPC_MINIMAL_LB_POLICY
@@ -134,6 +138,7 @@ void BuildCoreConfiguration(CoreConfiguration::Builder* builder) {
   // Run last so it gets a consistent location.
   // TODO(ctiller): Is this actually necessary?
   RegisterBackendMetricFilter(builder);
+  RegisterAdaptiveConcurrencyFilter(builder);
   RegisterSecurityFilters(builder);
   RegisterExtraFilters(builder);
   RegisterFusedFilters(builder);
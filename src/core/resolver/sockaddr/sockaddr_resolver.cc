@@ -14,6 +14,7 @@
 // limitations under the License.
 //
 
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/support/port_platform.h>
 
 #include <algorithm>
@@ -73,7 +74,8 @@ void SockaddrResolver::StartLocked() {
 
 bool ParseUri(const URI& uri,
               bool parse(const URI& uri, grpc_resolved_address* dst),
-              EndpointAddressesList* addresses) {
+              EndpointAddressesList* addresses,
+              const ChannelArgs& address_args = ChannelArgs()) {
   if (!uri.authority().empty()) {
     LOG(ERROR) << "authority-based URIs not supported by the " << uri.scheme()
                << " scheme";
@@ -94,16 +96,17 @@ bool ParseUri(const URI& uri,
       break;
     }
     if (addresses != nullptr) {
-      addresses->emplace_back(addr, ChannelArgs());
+      addresses->emplace_back(addr, address_args);
     }
   }
   return !errors_found;
 }
 
 OrphanablePtr<Resolver> CreateSockaddrResolver(
-    ResolverArgs args, bool parse(const URI& uri, grpc_resolved_address* dst)) {
+    ResolverArgs args, bool parse(const URI& uri, grpc_resolved_address* dst),
+    const ChannelArgs& address_args = ChannelArgs()) {
   EndpointAddressesList addresses;
-  if (!ParseUri(args.uri, parse, &addresses)) return nullptr;
+  if (!ParseUri(args.uri, parse, &addresses, address_args)) return nullptr;
   // Instantiate resolver.
   return MakeOrphanable<SockaddrResolver>(std::move(addresses),
                                           std::move(args));
@@ -161,6 +164,29 @@ class UnixAbstractResolverFactory final : public ResolverFactory {
     return CreateSockaddrResolver(std::move(args), grpc_parse_unix_abstract);
   }
 };
+
+// "shm:path" addresses the Unix domain socket at path, and asks for the
+// connection to be moved onto shared memory once it is established.
+bool ParseShmUri(const URI& uri, grpc_resolved_address* dst) {
+  auto unix_uri = URI::Create("unix", /*user_info=*/"", /*host_port=*/"",
+                              uri.path(), {}, "");
+  return unix_uri.ok() && grpc_parse_unix(*unix_uri, dst);
+}
+
+class ShmResolverFactory final : public ResolverFactory {
+ public:
+  absl::string_view scheme() const override { return "shm"; }
+
+  bool IsValidUri(const URI& uri) const override {
+    return ParseUri(uri, ParseShmUri, nullptr);
+  }
+
+  OrphanablePtr<Resolver> CreateResolver(ResolverArgs args) const override {
+    return CreateSockaddrResolver(
+        std::move(args), ParseShmUri,
+        ChannelArgs().Set(GRPC_ARG_SHARED_MEMORY_TRANSPORT, true));
+  }
+};
 #endif  // GRPC_HAVE_UNIX_SOCKET
 
 #ifdef GRPC_HAVE_VSOCK
@@ -191,6 +217,8 @@ void RegisterSockaddrResolver(CoreConfiguration::Builder* builder) {
       std::make_unique<UnixResolverFactory>());
   builder->resolver_registry()->RegisterResolverFactory(
       std::make_unique<UnixAbstractResolverFactory>());
+  builder->resolver_registry()->RegisterResolverFactory(
+      std::make_unique<ShmResolverFactory>());
 #endif
 #ifdef GRPC_HAVE_VSOCK
   builder->resolver_registry()->RegisterResolverFactory(
@@ -30,11 +30,12 @@
 
 #include <algorithm>
 #include <atomic>
+#include <deque>
 #include <list>
 #include <memory>
 #include <new>
 #include <optional>
-#include <queue>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -43,6 +44,7 @@
 #include "absl/container/flat_hash_map.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
 #include "src/core/call/interception_chain.h"
 #include "src/core/call/server_call.h"
 #include "src/core/channelz/channel_trace.h"
@@ -76,12 +78,16 @@
 #include "src/core/lib/surface/legacy_channel.h"
 #include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/lib/transport/error_utils.h"
+#include "src/core/telemetry/call_cpu.h"
+#include "src/core/telemetry/call_tracer.h"
 #include "src/core/telemetry/stats.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/debug_location.h"
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/mpscq.h"
+#include "src/core/util/mutex_profiler.h"
 #include "src/core/util/orphanable.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/shared_bit_gen.h"
 #include "src/core/util/status_helper.h"
 #include "src/core/util/useful.h"
@@ -445,9 +451,9 @@ class Server::RequestMatcherInterface {
   // RPC if possible or will place it in the pending queue otherwise. To enable
   // some measure of fairness between server CQs, the match is done starting at
   // the start_request_queue_index parameter in a cyclic order rather than
-  // always starting at 0.
+  // always starting at 0. deadline is the deadline of the incoming RPC.
   virtual ArenaPromise<absl::StatusOr<MatchResult>> MatchRequest(
-      size_t start_request_queue_index) = 0;
+      size_t start_request_queue_index, Timestamp deadline) = 0;
 
   // This function is invoked on an incoming RPC, represented by the calld
   // object. The RequestMatcher will try to match it against an
@@ -569,36 +575,82 @@ struct Server::RequestedCall {
   } data;
 };
 
+namespace {
+
+// Status message for calls failed because their deadline passed before the
+// application requested them.
+constexpr char kPendingCallDeadlineExceeded[] =
+    "Deadline exceeded before the call was requested";
+
+// Rows in the "mutex_contention" channelz table.
+constexpr size_t kMaxMutexContentionSites = 20;
+
+// Marks the point where a call is handed to the application, which separates
+// time spent queued in the server from time spent in the handler.
+void RecordCallPublished(Arena* arena) {
+  auto* call_tracer = arena->GetContext<CallTracer>();
+  if (call_tracer != nullptr) {
+    call_tracer->RecordAnnotation("Call published to application.");
+  }
+}
+
+}  // namespace
+
 // The RealRequestMatcher is an implementation of RequestMatcherInterface that
 // actually uses all the features of RequestMatcherInterface: expecting the
 // application to explicitly request RPCs and then matching those to incoming
 // RPCs, along with a slow path by which incoming RPCs are put on a locked
 // pending list if they aren't able to be matched to an application request.
+//
+// The slow path is sharded by request queue: an incoming RPC that finds no
+// request waiting is parked on the pending lists of its home shard (the
+// request queue of the CQ its connection is polled by), under that shard's
+// lock only.  A newly queued request is matched against its own shard's
+// pending RPCs first, and steals from the other shards only when its own
+// shard has none.
+//
+// Pending RPCs are matched in arrival order by default.  With
+// GRPC_ARG_SERVER_DEADLINE_ORDERED_PENDING_REQUESTS they are matched earliest
+// deadline first instead, and RPCs whose deadline has passed are failed with
+// DEADLINE_EXCEEDED rather than handed to the application, so that an
+// overloaded server doesn't spend its handlers on RPCs whose clients have
+// already given up.
 class Server::RealRequestMatcher : public RequestMatcherInterface {
  public:
   explicit RealRequestMatcher(Server* server)
-      : server_(server), requests_per_cq_(server->cqs_.size()) {}
+      : server_(server), requests_per_cq_(server->cqs_.size()) {
+    for (size_t i = 0; i < server->cqs_.size(); i++) {
+      shards_.emplace_back(server->deadline_ordered_pending_requests_,
+                           server->max_time_in_pending_queue_);
+    }
+  }
 
   ~RealRequestMatcher() override {
     for (LockedMultiProducerSingleConsumerQueue& queue : requests_per_cq_) {
       GRPC_CHECK_EQ(queue.Pop(), nullptr);
     }
-    GRPC_CHECK(pending_filter_stack_.empty());
-    GRPC_CHECK(pending_promises_.empty());
+    for (Shard& shard : shards_) {
+      MutexLock lock(&shard.mu);
+      GRPC_CHECK(shard.pending_filter_stack.empty());
+      GRPC_CHECK(shard.pending_promises.empty());
+    }
   }
 
   void ZombifyPending() override {
-    while (!pending_filter_stack_.empty()) {
-      pending_filter_stack_.front().calld->SetState(
-          CallData::CallState::ZOMBIED);
-      pending_filter_stack_.front().calld->KillZombie();
-      pending_filter_stack_.pop();
-    }
-    while (!pending_promises_.empty()) {
-      pending_promises_.front()->Finish(absl::InternalError("Server closed"));
-      pending_promises_.pop();
+    for (Shard& shard : shards_) {
+      MutexLock lock(&shard.mu);
+      while (!shard.pending_filter_stack.empty()) {
+        shard.pending_filter_stack.front()->SetState(
+            CallData::CallState::ZOMBIED);
+        shard.pending_filter_stack.front()->KillZombie();
+        shard.pending_filter_stack.pop();
+      }
+      while (!shard.pending_promises.empty()) {
+        PopPendingPromiseLocked(shard)->Finish(
+            absl::InternalError("Server closed"));
+      }
+      shard.zombified = true;
     }
-    zombified_ = true;
   }
 
   void KillRequests(grpc_error_handle error) override {
@@ -619,66 +671,22 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
                                       RequestedCall* call) override {
     if (requests_per_cq_[request_queue_index].Push(&call->mpscq_node)) {
       // this was the first queued request: we need to lock and start
-      // matching calls
-      struct NextPendingCall {
-        RequestedCall* rc = nullptr;
-        CallData* pending_filter_stack = nullptr;
-        PendingCallPromises pending_promise;
-      };
-      while (true) {
-        NextPendingCall pending_call;
-        {
-          MutexLock lock(&server_->mu_call_);
-          while (!pending_filter_stack_.empty() &&
-                 pending_filter_stack_.front().Age() >
-                     server_->max_time_in_pending_queue_) {
-            pending_filter_stack_.front().calld->SetState(
-                CallData::CallState::ZOMBIED);
-            pending_filter_stack_.front().calld->KillZombie();
-            pending_filter_stack_.pop();
-          }
-          if (!pending_promises_.empty()) {
-            pending_call.rc = reinterpret_cast<RequestedCall*>(
-                requests_per_cq_[request_queue_index].Pop());
-            if (pending_call.rc != nullptr) {
-              pending_call.pending_promise =
-                  std::move(pending_promises_.front());
-              pending_promises_.pop();
-            }
-          } else if (!pending_filter_stack_.empty()) {
-            pending_call.rc = reinterpret_cast<RequestedCall*>(
-                requests_per_cq_[request_queue_index].Pop());
-            if (pending_call.rc != nullptr) {
-              pending_call.pending_filter_stack =
-                  pending_filter_stack_.front().calld;
-              pending_filter_stack_.pop();
-            }
-          }
-        }
-        if (pending_call.rc == nullptr) break;
-        if (pending_call.pending_filter_stack != nullptr) {
-          if (!pending_call.pending_filter_stack->MaybeActivate()) {
-            // Zombied Call
-            pending_call.pending_filter_stack->KillZombie();
-            requests_per_cq_[request_queue_index].Push(
-                &pending_call.rc->mpscq_node);
-          } else {
-            pending_call.pending_filter_stack->Publish(request_queue_index,
-                                                       pending_call.rc);
-          }
-        } else {
-          if (!pending_call.pending_promise->Finish(
-                  server(), request_queue_index, pending_call.rc)) {
-            requests_per_cq_[request_queue_index].Push(
-                &pending_call.rc->mpscq_node);
-          }
-        }
+      // matching calls, starting with our own shard
+      for (size_t i = 0; i < shards_.size(); i++) {
+        Shard& shard = shards_[(request_queue_index + i) % shards_.size()];
+        if (!MatchPendingCalls(shard, request_queue_index)) break;
       }
     }
   }
 
   void MatchOrQueue(size_t start_request_queue_index,
                     CallData* calld) override {
+    start_request_queue_index %= requests_per_cq_.size();
+    if (DropForDeadline(calld->deadline())) {
+      calld->SetState(CallData::CallState::ZOMBIED);
+      calld->KillZombieDeadlineExceeded();
+      return;
+    }
     for (size_t i = 0; i < requests_per_cq_.size(); i++) {
       size_t cq_idx = (start_request_queue_index + i) % requests_per_cq_.size();
       RequestedCall* rc =
@@ -689,36 +697,36 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
         return;
       }
     }
-    // No cq to take the request found; queue it on the slow list.
-    // We need to ensure that all the queues are empty.  We do this under
-    // the server mu_call_ lock to ensure that if something is added to
-    // an empty request queue, it will block until the call is actually
-    // added to the pending list.
-    RequestedCall* rc = nullptr;
-    size_t cq_idx = 0;
-    size_t loop_count;
+    // No cq to take the request found; queue it on the slow list of our
+    // home shard.  We check the home request queue again under the shard
+    // lock, so that a request added to it will block until the call is
+    // actually added to the pending list and then find it there.
+    Shard& shard = shards_[start_request_queue_index];
+    RequestedCall* rc;
     {
-      MutexLock lock(&server_->mu_call_);
-      for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
-        cq_idx =
-            (start_request_queue_index + loop_count) % requests_per_cq_.size();
-        rc = reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].Pop());
-        if (rc != nullptr) {
-          break;
-        }
-      }
+      MutexLock lock(&shard.mu);
+      rc = reinterpret_cast<RequestedCall*>(
+          requests_per_cq_[start_request_queue_index].Pop());
       if (rc == nullptr) {
         calld->SetState(CallData::CallState::PENDING);
-        pending_filter_stack_.push(PendingCallFilterStack{calld});
-        return;
+        shard.pending_filter_stack.push(calld, calld->deadline());
       }
     }
+    if (rc == nullptr) {
+      StealRequestsForPendingCalls(start_request_queue_index);
+      return;
+    }
     calld->SetState(CallData::CallState::ACTIVATED);
-    calld->Publish(cq_idx, rc);
+    calld->Publish(start_request_queue_index, rc);
   }
 
   ArenaPromise<absl::StatusOr<MatchResult>> MatchRequest(
-      size_t start_request_queue_index) override {
+      size_t start_request_queue_index, Timestamp deadline) override {
+    start_request_queue_index %= requests_per_cq_.size();
+    if (DropForDeadline(deadline)) {
+      return Immediate(
+          absl::DeadlineExceededError(kPendingCallDeadlineExceeded));
+    }
     for (size_t i = 0; i < requests_per_cq_.size(); i++) {
       size_t cq_idx = (start_request_queue_index + i) % requests_per_cq_.size();
       RequestedCall* rc =
@@ -727,63 +735,51 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
         return Immediate(MatchResult(server(), cq_idx, rc));
       }
     }
-    // No cq to take the request found; queue it on the slow list.
-    // We need to ensure that all the queues are empty.  We do this under
-    // the server mu_call_ lock to ensure that if something is added to
-    // an empty request queue, it will block until the call is actually
-    // added to the pending list.
+    // No cq to take the request found; queue it on the slow list of our
+    // home shard (see MatchOrQueue).
+    Shard& shard = shards_[start_request_queue_index];
     RequestedCall* rc = nullptr;
-    size_t cq_idx = 0;
-    size_t loop_count;
+    std::shared_ptr<ActivityWaiter> w;
     {
       std::vector<std::shared_ptr<ActivityWaiter>> removed_pending;
-      MutexLock lock(&server_->mu_call_);
-      while (!pending_promises_.empty() &&
-             pending_promises_.front()->Age() >
-                 server_->max_time_in_pending_queue_) {
-        removed_pending.push_back(std::move(pending_promises_.front()));
-        pending_promises_.pop();
-      }
-      for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
-        cq_idx =
-            (start_request_queue_index + loop_count) % requests_per_cq_.size();
-        rc = reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].Pop());
-        if (rc != nullptr) break;
-      }
+      MutexLock lock(&shard.mu);
+      RemoveExpiredLocked(shard, removed_pending);
+      rc = reinterpret_cast<RequestedCall*>(
+          requests_per_cq_[start_request_queue_index].Pop());
       if (rc == nullptr) {
-        if (server_->pending_backlog_protector_.Reject(pending_promises_.size(),
-                                                       SharedBitGen())) {
+        if (server_->pending_backlog_protector_.Reject(
+                num_pending_promises_.load(std::memory_order_relaxed),
+                SharedBitGen())) {
           return Immediate(absl::ResourceExhaustedError(
               "Too many pending requests for this server"));
         }
-        if (zombified_) {
+        if (shard.zombified) {
           return Immediate(absl::InternalError("Server closed"));
         }
-        auto w = std::make_shared<ActivityWaiter>(
+        w = std::make_shared<ActivityWaiter>(
             GetContext<Activity>()->MakeOwningWaker());
-        pending_promises_.push(w);
-        return OnCancel(
-            [w]() -> Poll<absl::StatusOr<MatchResult>> {
-              std::unique_ptr<absl::StatusOr<MatchResult>> r(
-                  w->result.exchange(nullptr, std::memory_order_acq_rel));
-              if (r == nullptr) return Pending{};
-              return std::move(*r);
-            },
-            [w]() { w->Finish(absl::CancelledError()); });
+        shard.pending_promises.push(w, deadline);
+        num_pending_promises_.fetch_add(1, std::memory_order_relaxed);
       }
     }
-    return Immediate(MatchResult(server(), cq_idx, rc));
+    if (rc != nullptr) {
+      return Immediate(MatchResult(server(), start_request_queue_index, rc));
+    }
+    StealRequestsForPendingCalls(start_request_queue_index);
+    return OnCancel(
+        [w]() -> Poll<absl::StatusOr<MatchResult>> {
+          std::unique_ptr<absl::StatusOr<MatchResult>> r(
+              w->result.exchange(nullptr, std::memory_order_acq_rel));
+          if (r == nullptr) return Pending{};
+          return std::move(*r);
+        },
+        [w]() { w->Finish(absl::CancelledError()); });
   }
 
   Server* server() const final { return server_; }
 
  private:
   Server* const server_;
-  struct PendingCallFilterStack {
-    CallData* calld;
-    Timestamp created = Timestamp::Now();
-    Duration Age() { return Timestamp::Now() - created; }
-  };
   struct ActivityWaiter {
     using ResultType = absl::StatusOr<MatchResult>;
     explicit ActivityWaiter(Waker waker) : waker(std::move(waker)) {}
@@ -815,16 +811,217 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
       waker.WakeupAsync();
       return true;
     }
-    Duration Age() { return Timestamp::Now() - created; }
     Waker waker;
     std::atomic<ResultType*> result{nullptr};
-    const Timestamp created = Timestamp::Now();
   };
   using PendingCallPromises = std::shared_ptr<ActivityWaiter>;
-  std::queue<PendingCallFilterStack> pending_filter_stack_;
-  std::queue<PendingCallPromises> pending_promises_;
+  // Why a pending call should be removed without being matched.
+  enum class PendingExpiry {
+    kNone,
+    // Pending for longer than max_time_in_pending_queue_.
+    kMaxAge,
+    // Past its deadline (deadline ordered mode only).
+    kDeadline,
+  };
+  // A shard's pending calls of one kind.  Calls are matched in arrival order,
+  // or in deadline ordered mode by the time they expire: the earlier of their
+  // deadline and max_age after arrival, with ties in arrival order.  Either
+  // way the front call is the first to expire.
+  template <typename T>
+  class PendingQueue {
+   public:
+    PendingQueue(bool deadline_ordered, Duration max_age)
+        : deadline_ordered_(deadline_ordered), max_age_(max_age) {}
+
+    bool empty() const { return entries_.empty(); }
+    T& front() { return entries_.front().call; }
+
+    void push(T call, Timestamp deadline) {
+      Entry entry{std::move(call), deadline, Timestamp::Now() + max_age_,
+                  next_seq_++};
+      if (!deadline_ordered_) {
+        entries_.push_back(std::move(entry));
+        return;
+      }
+      entry.expiry = std::min(entry.expiry, deadline);
+      entries_.push_back(std::move(entry));
+      std::push_heap(entries_.begin(), entries_.end(), ExpiresLater);
+    }
+
+    void pop() {
+      if (!deadline_ordered_) {
+        entries_.pop_front();
+        return;
+      }
+      std::pop_heap(entries_.begin(), entries_.end(), ExpiresLater);
+      entries_.pop_back();
+    }
+
+    // Returns why the front call should be removed at time now, if at all.
+    PendingExpiry FrontExpiry(Timestamp now) const {
+      if (entries_.empty() || entries_.front().expiry >= now) {
+        return PendingExpiry::kNone;
+      }
+      if (deadline_ordered_ && entries_.front().deadline < now) {
+        return PendingExpiry::kDeadline;
+      }
+      return PendingExpiry::kMaxAge;
+    }
+
+   private:
+    struct Entry {
+      T call;
+      Timestamp deadline;
+      Timestamp expiry;
+      uint64_t seq;
+    };
+    // Heap order for deadline ordered mode: the front entry expires first.
+    static bool ExpiresLater(const Entry& a, const Entry& b) {
+      if (a.expiry != b.expiry) return a.expiry > b.expiry;
+      return a.seq > b.seq;
+    }
+
+    const bool deadline_ordered_;
+    const Duration max_age_;
+    std::deque<Entry> entries_;
+    uint64_t next_seq_ = 0;
+  };
+  // Calls parked while no request was available, homed on one request queue.
+  struct Shard {
+    Shard(bool deadline_ordered, Duration max_age)
+        : pending_filter_stack(deadline_ordered, max_age),
+          pending_promises(deadline_ordered, max_age) {}
+    Mutex mu;
+    PendingQueue<CallData*> pending_filter_stack ABSL_GUARDED_BY(mu);
+    PendingQueue<PendingCallPromises> pending_promises ABSL_GUARDED_BY(mu);
+    bool zombified ABSL_GUARDED_BY(mu) = false;
+  };
+  struct NextPendingCall {
+    RequestedCall* rc = nullptr;
+    CallData* pending_filter_stack = nullptr;
+    PendingCallPromises pending_promise;
+  };
+
+  PendingCallPromises PopPendingPromiseLocked(Shard& shard)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mu) {
+    PendingCallPromises pending_promise =
+        std::move(shard.pending_promises.front());
+    shard.pending_promises.pop();
+    num_pending_promises_.fetch_sub(1, std::memory_order_relaxed);
+    return pending_promise;
+  }
+
+  // In deadline ordered mode, returns true (and counts the drop) if a call
+  // with the given deadline should be failed rather than matched.
+  bool DropForDeadline(Timestamp deadline) const {
+    if (!server_->deadline_ordered_pending_requests_ ||
+        deadline >= Timestamp::Now()) {
+      return false;
+    }
+    global_stats().IncrementServerPendingCallsDeadlineExceeded();
+    return true;
+  }
+
+  // Removes calls that have expired from the front of shard's pending lists.
+  // Removed promises are moved to removed_pending, to be released once the
+  // shard lock is dropped.
+  void RemoveExpiredLocked(Shard& shard,
+                           std::vector<PendingCallPromises>& removed_pending)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mu) {
+    const Timestamp now = Timestamp::Now();
+    PendingExpiry expiry;
+    while ((expiry = shard.pending_filter_stack.FrontExpiry(now)) !=
+           PendingExpiry::kNone) {
+      CallData* calld = shard.pending_filter_stack.front();
+      shard.pending_filter_stack.pop();
+      calld->SetState(CallData::CallState::ZOMBIED);
+      if (expiry == PendingExpiry::kDeadline) {
+        global_stats().IncrementServerPendingCallsDeadlineExceeded();
+        calld->KillZombieDeadlineExceeded();
+      } else {
+        calld->KillZombie();
+      }
+    }
+    while ((expiry = shard.pending_promises.FrontExpiry(now)) !=
+           PendingExpiry::kNone) {
+      PendingCallPromises pending_promise = PopPendingPromiseLocked(shard);
+      if (expiry == PendingExpiry::kDeadline) {
+        global_stats().IncrementServerPendingCallsDeadlineExceeded();
+        pending_promise->Finish(
+            absl::DeadlineExceededError(kPendingCallDeadlineExceeded));
+      }
+      removed_pending.push_back(std::move(pending_promise));
+    }
+  }
+
+  // Matches calls pending on shard with requests from request_queue_index
+  // until either runs out.  Returns true if the shard ran out of calls
+  // (i.e. there may still be requests left to match elsewhere).
+  bool MatchPendingCalls(Shard& shard, size_t request_queue_index) {
+    while (true) {
+      NextPendingCall pending_call;
+      std::vector<PendingCallPromises> removed_pending;
+      {
+        MutexLock lock(&shard.mu);
+        RemoveExpiredLocked(shard, removed_pending);
+        if (!shard.pending_promises.empty()) {
+          pending_call.rc = reinterpret_cast<RequestedCall*>(
+              requests_per_cq_[request_queue_index].Pop());
+          if (pending_call.rc != nullptr) {
+            pending_call.pending_promise = PopPendingPromiseLocked(shard);
+          }
+        } else if (!shard.pending_filter_stack.empty()) {
+          pending_call.rc = reinterpret_cast<RequestedCall*>(
+              requests_per_cq_[request_queue_index].Pop());
+          if (pending_call.rc != nullptr) {
+            pending_call.pending_filter_stack =
+                shard.pending_filter_stack.front();
+            shard.pending_filter_stack.pop();
+          }
+        } else {
+          return true;
+        }
+      }
+      if (pending_call.rc == nullptr) return false;
+      if (pending_call.pending_filter_stack != nullptr) {
+        if (!pending_call.pending_filter_stack->MaybeActivate()) {
+          // Zombied Call
+          pending_call.pending_filter_stack->KillZombie();
+          requests_per_cq_[request_queue_index].Push(
+              &pending_call.rc->mpscq_node);
+        } else {
+          pending_call.pending_filter_stack->Publish(request_queue_index,
+                                                     pending_call.rc);
+        }
+      } else {
+        if (!pending_call.pending_promise->Finish(
+                server(), request_queue_index, pending_call.rc)) {
+          requests_per_cq_[request_queue_index].Push(
+              &pending_call.rc->mpscq_node);
+        }
+      }
+    }
+  }
+
+  // Called after parking a call on the shard for home_request_queue_index.
+  // A request queued on another CQ after we looked at it only scans the
+  // pending lists if it was the first one on its queue, so it may have
+  // missed the call we just parked; match any such requests here.
+  void StealRequestsForPendingCalls(size_t home_request_queue_index) {
+    Shard& shard = shards_[home_request_queue_index];
+    for (size_t i = 1; i < requests_per_cq_.size(); i++) {
+      size_t cq_idx =
+          (home_request_queue_index + i) % requests_per_cq_.size();
+      if (MatchPendingCalls(shard, cq_idx)) return;
+    }
+  }
+
   std::vector<LockedMultiProducerSingleConsumerQueue> requests_per_cq_;
-  bool zombified_ = false;
+  // A deque, since Shards can't be moved.
+  std::deque<Shard> shards_;
+  // Total number of pending promises across all shards, used for backlog
+  // protection.
+  std::atomic<size_t> num_pending_promises_{0};
 };
 
 // AllocatingRequestMatchers don't allow the application to request an RPC in
@@ -903,7 +1100,7 @@ class Server::AllocatingRequestMatcherBatch
   }
 
   ArenaPromise<absl::StatusOr<MatchResult>> MatchRequest(
-      size_t /*start_request_queue_index*/) override {
+      size_t /*start_request_queue_index*/, Timestamp /*deadline*/) override {
     BatchCallAllocation call_info = allocator_();
     GRPC_CHECK(server()->ValidateServerRequest(
                    cq(), static_cast<void*>(call_info.tag), nullptr, nullptr) ==
@@ -950,7 +1147,7 @@ class Server::AllocatingRequestMatcherRegistered
   }
 
   ArenaPromise<absl::StatusOr<MatchResult>> MatchRequest(
-      size_t /*start_request_queue_index*/) override {
+      size_t /*start_request_queue_index*/, Timestamp /*deadline*/) override {
     RegisteredCallAllocation call_info = allocator_();
     GRPC_CHECK(server()->ValidateServerRequest(
                    cq(), call_info.tag, call_info.optional_payload,
@@ -1134,8 +1331,13 @@ auto Server::MatchRequestAndMaybeReadFirstMessage(CallHandler call_handler,
             });
       },
       []() -> FirstMessageResult { return FirstMessageResult(std::nullopt); });
+  const Timestamp deadline =
+      md->get(GrpcTimeoutMetadata()).value_or(Timestamp::InfFuture());
   return TryJoin<absl::StatusOr>(
-      std::move(maybe_read_first_message), rm->MatchRequest(0),
+      std::move(maybe_read_first_message),
+      // Call v3 transports don't tell us which CQ polls them, so steer
+      // matching by the current cpu instead.
+      rm->MatchRequest(PerCpuShardingHelper().GetShardingBits(), deadline),
       [md = std::move(md)]() mutable {
         return ValueOrFailure<ClientMetadataHandle>(std::move(md));
       });
@@ -1160,6 +1362,7 @@ auto Server::MatchAndPublishCall(CallHandler call_handler) {
           RequestMatcherInterface::MatchResult& mr = std::get<1>(r);
           auto md = std::move(std::get<2>(r));
           auto* rc = mr.TakeCall();
+          RecordCallPublished(GetContext<Arena>());
           rc->Complete(std::move(std::get<0>(r)), *md);
           grpc_call* call =
               MakeServerCall(call_handler, std::move(md), this,
@@ -1180,6 +1383,7 @@ Server::MakeCallDestination(const ChannelArgs& args,
   // TODO(ctiller): find a way to avoid adding a server ref per call
   builder.AddOnClientInitialMetadata([self = Ref()](ClientMetadata& md) {
     self->SetRegisteredMethodOnMetadata(md);
+    MaybeAddServerCallCpuAccount(GetContext<Arena>(), md);
   });
   CoreConfiguration::Get().channel_init().AddToInterceptionChainBuilder(
       GRPC_SERVER_CHANNEL, builder);
@@ -1256,6 +1460,24 @@ void Server::AddData(channelz::DataSink sink) {
           .Set("connections_open", connections_open_)
           .Set("num_listener_states", listener_states_.size())
           .Set("listeners_destroyed", listeners_destroyed_));
+  // Process wide, but servers are where channelz tooling looks first.
+  if (MutexProfiler::Enabled()) {
+    channelz::PropertyTable sites;
+    for (const MutexProfiler::Site& site :
+         MutexProfiler::TopContendedSites(kMaxMutexContentionSites)) {
+      sites.AppendRow(
+          channelz::PropertyList()
+              .Set("site", site.file == nullptr
+                               ? std::string("other")
+                               : absl::StrCat(site.file, ":", site.line))
+              .Set("contentions", site.contentions)
+              .Set("total_wait_ns", site.total_wait_ns)
+              .Set("max_wait_ns", site.max_wait_ns)
+              .Set("hold_samples", site.hold_samples)
+              .Set("total_sampled_hold_ns", site.total_sampled_hold_ns));
+    }
+    sink.AddData("mutex_contention", std::move(sites));
+  }
 }
 
 void Server::AddListener(OrphanablePtr<ListenerInterface> listener) {
@@ -1928,6 +2150,7 @@ void Server::CallData::Start(grpc_call_element* elem) {
 }
 
 void Server::CallData::Publish(size_t cq_idx, RequestedCall* rc) {
+  RecordCallPublished(grpc_call_get_arena(call_));
   grpc_call_set_completion_queue(call_, rc->cq_bound_to_call);
   *rc->call = call_;
   cq_new_ = server_->cqs_[cq_idx];
@@ -1976,6 +2199,14 @@ void KillZombieClosure(void* call, grpc_error_handle /*error*/) {
   grpc_call_unref(static_cast<grpc_call*>(call));
 }
 
+void KillZombieDeadlineExceededClosure(void* call,
+                                       grpc_error_handle /*error*/) {
+  grpc_call_cancel_with_status(static_cast<grpc_call*>(call),
+                               GRPC_STATUS_DEADLINE_EXCEEDED,
+                               kPendingCallDeadlineExceeded, nullptr);
+  grpc_call_unref(static_cast<grpc_call*>(call));
+}
+
 }  // namespace
 
 void Server::CallData::KillZombie() {
@@ -1984,6 +2215,12 @@ void Server::CallData::KillZombie() {
   ExecCtx::Run(DEBUG_LOCATION, &kill_zombie_closure_, absl::OkStatus());
 }
 
+void Server::CallData::KillZombieDeadlineExceeded() {
+  GRPC_CLOSURE_INIT(&kill_zombie_closure_, KillZombieDeadlineExceededClosure,
+                    call_, grpc_schedule_on_exec_ctx);
+  ExecCtx::Run(DEBUG_LOCATION, &kill_zombie_closure_, absl::OkStatus());
+}
+
 // If this changes, change MakeCallPromise too.
 void Server::CallData::StartNewRpc(grpc_call_element* elem) {
   if (server_->ShutdownCalled()) {
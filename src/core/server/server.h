@@ -76,6 +76,12 @@
 #define GRPC_ARG_SERVER_MAX_PENDING_REQUESTS "grpc.server.max_pending_requests"
 #define GRPC_ARG_SERVER_MAX_PENDING_REQUESTS_HARD_LIMIT \
   "grpc.server.max_pending_requests_hard_limit"
+// If true, calls waiting for the application to request them are served
+// earliest deadline first instead of in arrival order, and calls whose
+// deadline has passed are failed with DEADLINE_EXCEEDED instead of being
+// handed to the application.  Defaults to false.
+#define GRPC_ARG_SERVER_DEADLINE_ORDERED_PENDING_REQUESTS \
+  "grpc.server.deadline_ordered_pending_requests"
 
 namespace grpc_core {
 
@@ -504,9 +510,13 @@ class Server : public ServerInterface,
     void Publish(size_t cq_idx, RequestedCall* rc);
 
     void KillZombie();
+    // Like KillZombie(), but first fails the call with DEADLINE_EXCEEDED.
+    void KillZombieDeadlineExceeded();
 
     void FailCallCreation();
 
+    Timestamp deadline() const { return deadline_; }
+
     // Filter vtable functions.
     static grpc_error_handle InitCallElement(
         grpc_call_element* elem, const grpc_call_element_args* args);
@@ -706,7 +716,7 @@ class Server : public ServerInterface,
   bool shutdown_published_ ABSL_GUARDED_BY(mu_global_) = false;
   std::vector<ShutdownTag> shutdown_tags_ ABSL_GUARDED_BY(mu_global_);
 
-  RandomEarlyDetection pending_backlog_protector_ ABSL_GUARDED_BY(mu_call_){
+  const RandomEarlyDetection pending_backlog_protector_{
       static_cast<uint64_t>(
           std::max(0, channel_args_.GetInt(GRPC_ARG_SERVER_MAX_PENDING_REQUESTS)
                           .value_or(1000))),
@@ -715,6 +725,9 @@ class Server : public ServerInterface,
           channel_args_.GetInt(GRPC_ARG_SERVER_MAX_PENDING_REQUESTS_HARD_LIMIT)
               .value_or(3000)))};
   const Duration max_time_in_pending_queue_;
+  const bool deadline_ordered_pending_requests_ =
+      channel_args_.GetBool(GRPC_ARG_SERVER_DEADLINE_ORDERED_PENDING_REQUESTS)
+          .value_or(false);
 
   std::list<ChannelData*> channels_;
   absl::flat_hash_set<OrphanablePtr<ServerTransport>> connections_
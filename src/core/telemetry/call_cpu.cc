@@ -0,0 +1,226 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/telemetry/call_cpu.h"
+
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
+#include "absl/types/span.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/config/config_vars.h"
+#include "src/core/lib/promise/context.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/telemetry/call_cpu_account.h"
+#include "src/core/telemetry/call_tracer.h"
+
+namespace grpc_core {
+
+namespace {
+
+using Storage = InstrumentStorageRefPtr<CallCpuDomain>;
+
+// Unregistered methods all share one label to bound cardinality.
+constexpr absl::string_view kOtherMethod = "other";
+
+// How many CallCpuStatsPlugins exist: call v3 calls are only accounted
+// while there is one.
+std::atomic<int> g_call_cpu_plugins{0};
+
+absl::string_view MethodLabel(absl::string_view path, bool registered) {
+  if (!registered) return kOtherMethod;
+  absl::ConsumePrefix(&path, "/");
+  return path;
+}
+
+Storage ClientCallStorage(const Slice& path, bool registered_method) {
+  return CallCpuDomain::GetStorage(
+      MethodLabel(path.as_string_view(), registered_method));
+}
+
+// Null if the metadata has no path.
+Storage ServerCallStorage(const grpc_metadata_batch& client_initial_metadata) {
+  const Slice* path = client_initial_metadata.get_pointer(HttpPathMetadata());
+  if (path == nullptr) return nullptr;
+  const bool registered =
+      client_initial_metadata.get(GrpcRegisteredMethod()).value_or(nullptr) !=
+      nullptr;
+  return CallCpuDomain::GetStorage(
+      MethodLabel(path->as_string_view(), registered));
+}
+
+// Records the call's total into CallCpuDomain when the arena is destroyed.
+// Server calls only learn their method once initial metadata arrives; calls
+// that fail before then aren't recorded.
+class RecordingCallCpuAccount final : public CallCpuAccount {
+ public:
+  RecordingCallCpuAccount(bool is_client, Storage storage)
+      : is_client_(is_client), storage_(std::move(storage)) {}
+
+  ~RecordingCallCpuAccount() override {
+    if (storage_ == nullptr) return;
+    const int64_t total_ns = cpu_ns();
+    if (is_client_) {
+      storage_->Add(CallCpuDomain::kClientCpuTime, total_ns);
+      storage_->Increment(CallCpuDomain::kClientCallCpuTime, total_ns / 1000);
+    } else {
+      storage_->Add(CallCpuDomain::kServerCpuTime, total_ns);
+      storage_->Increment(CallCpuDomain::kServerCallCpuTime, total_ns / 1000);
+    }
+  }
+
+  void set_storage(Storage storage) { storage_ = std::move(storage); }
+
+ private:
+  const bool is_client_;
+  Storage storage_;
+};
+
+// Only there to learn the method of server calls.
+class CallCpuServerCallTracer final : public ServerCallTracerInterface {
+ public:
+  explicit CallCpuServerCallTracer(RecordingCallCpuAccount* account)
+      : account_(account) {}
+
+  void RecordReceivedInitialMetadata(
+      grpc_metadata_batch* recv_initial_metadata) override {
+    auto storage = ServerCallStorage(*recv_initial_metadata);
+    if (storage != nullptr) account_->set_storage(std::move(storage));
+  }
+
+  void RecordSendInitialMetadata(grpc_metadata_batch*) override {}
+  void RecordSendTrailingMetadata(grpc_metadata_batch*) override {}
+  void RecordSendMessage(const Message&) override {}
+  void RecordSendCompressedMessage(const Message&) override {}
+  void RecordReceivedMessage(const Message&) override {}
+  void RecordReceivedDecompressedMessage(const Message&) override {}
+  void RecordReceivedTrailingMetadata(grpc_metadata_batch*) override {}
+  void RecordCancel(grpc_error_handle) override {}
+  void RecordEnd(const grpc_call_final_info*) override {}
+  void RecordIncomingBytes(
+      const CallTracerInterface::TransportByteSize&) override {}
+  void RecordOutgoingBytes(
+      const CallTracerInterface::TransportByteSize&) override {}
+  void RecordAnnotation(absl::string_view) override {}
+  void RecordAnnotation(
+      const CallTracerAnnotationInterface::Annotation&) override {}
+  std::shared_ptr<TcpCallTracer> StartNewTcpTrace() override { return nullptr; }
+  std::string TraceId() override { return ""; }
+  std::string SpanId() override { return ""; }
+  bool IsSampled() override { return false; }
+
+ private:
+  RecordingCallCpuAccount* const account_;
+};
+
+class CallCpuStatsPlugin final : public StatsPlugin {
+ public:
+  CallCpuStatsPlugin() {
+    g_call_cpu_plugins.fetch_add(1, std::memory_order_relaxed);
+  }
+  ~CallCpuStatsPlugin() override {
+    g_call_cpu_plugins.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  std::pair<bool, std::shared_ptr<ScopeConfig>> IsEnabledForChannel(
+      const experimental::StatsPluginChannelScope&) const override {
+    return {true, nullptr};
+  }
+  std::pair<bool, std::shared_ptr<ScopeConfig>> IsEnabledForServer(
+      const ChannelArgs&) const override {
+    return {true, nullptr};
+  }
+  std::shared_ptr<ScopeConfig> GetChannelScopeConfig(
+      const experimental::StatsPluginChannelScope&) const override {
+    return nullptr;
+  }
+  std::shared_ptr<ScopeConfig> GetServerScopeConfig(
+      const ChannelArgs&) const override {
+    return nullptr;
+  }
+
+  // Everything is recorded in CallCpuDomain rather than through the global
+  // instruments registry.
+  void AddCounter(GlobalInstrumentsRegistry::GlobalInstrumentHandle, uint64_t,
+                  absl::Span<const absl::string_view>,
+                  absl::Span<const absl::string_view>) override {}
+  void AddCounter(GlobalInstrumentsRegistry::GlobalInstrumentHandle, double,
+                  absl::Span<const absl::string_view>,
+                  absl::Span<const absl::string_view>) override {}
+  void RecordHistogram(GlobalInstrumentsRegistry::GlobalInstrumentHandle,
+                       uint64_t, absl::Span<const absl::string_view>,
+                       absl::Span<const absl::string_view>) override {}
+  void RecordHistogram(GlobalInstrumentsRegistry::GlobalInstrumentHandle,
+                       double, absl::Span<const absl::string_view>,
+                       absl::Span<const absl::string_view>) override {}
+  void AddCallback(RegisteredMetricCallback*) override {}
+  void RemoveCallback(RegisteredMetricCallback*) override {}
+  bool IsInstrumentEnabled(
+      GlobalInstrumentsRegistry::GlobalInstrumentHandle) const override {
+    return false;
+  }
+
+  // The client method is known up front, so no tracer is needed.
+  ClientCallTracerInterface* GetClientCallTracer(
+      const Slice& path, bool registered_method,
+      std::shared_ptr<ScopeConfig>) override {
+    auto* arena = GetContext<Arena>();
+    arena->SetContext<CallCpuAccount>(arena->New<RecordingCallCpuAccount>(
+        /*is_client=*/true, ClientCallStorage(path, registered_method)));
+    return nullptr;
+  }
+  ServerCallTracerInterface* GetServerCallTracer(
+      std::shared_ptr<ScopeConfig>) override {
+    auto* arena = GetContext<Arena>();
+    auto* account =
+        arena->New<RecordingCallCpuAccount>(/*is_client=*/false, nullptr);
+    arena->SetContext<CallCpuAccount>(account);
+    return arena->ManagedNew<CallCpuServerCallTracer>(account);
+  }
+};
+
+}  // namespace
+
+std::shared_ptr<StatsPlugin> MakeCallCpuStatsPlugin() {
+  return std::make_shared<CallCpuStatsPlugin>();
+}
+
+void MaybeAddClientCallCpuAccount(Arena* arena, const Slice& path,
+                                  bool registered_method) {
+  if (g_call_cpu_plugins.load(std::memory_order_relaxed) == 0) return;
+  arena->SetContext<CallCpuAccount>(arena->New<RecordingCallCpuAccount>(
+      /*is_client=*/true, ClientCallStorage(path, registered_method)));
+}
+
+void MaybeAddServerCallCpuAccount(
+    Arena* arena, const grpc_metadata_batch& client_initial_metadata) {
+  if (g_call_cpu_plugins.load(std::memory_order_relaxed) == 0) return;
+  arena->SetContext<CallCpuAccount>(arena->New<RecordingCallCpuAccount>(
+      /*is_client=*/false, ServerCallStorage(client_initial_metadata)));
+}
+
+void MaybeRegisterCallCpuStatsPlugin() {
+  if (!ConfigVars::Get().ExperimentalCallCpuAccounting()) return;
+  GlobalStatsPluginRegistry::RegisterStatsPlugin(MakeCallCpuStatsPlugin());
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,84 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_TELEMETRY_CALL_CPU_H
+#define GRPC_SRC_CORE_TELEMETRY_CALL_CPU_H
+
+#include <memory>
+
+#include "src/core/call/metadata_batch.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/telemetry/histogram.h"
+#include "src/core/telemetry/instrument.h"
+#include "src/core/telemetry/metrics.h"
+
+namespace grpc_core {
+
+// Thread CPU time gRPC itself spends on each call, per method: polling the
+// call's parties, processing the batches the application starts on it,
+// (de)compressing its messages, and chttp2's parsing and framing of its
+// streams.  Time spent in application code, and connection-wide work such as
+// TLS and socket reads and writes, is not counted.  See CallCpuMeter.
+class CallCpuDomain final : public InstrumentDomain<CallCpuDomain> {
+ public:
+  using Backend = HighContentionBackend;
+  static constexpr auto kLabels = Labels("grpc.method");
+
+  static constexpr int64_t kMaxCallCpuUs = 10 * 1000 * 1000;
+  static constexpr size_t kBuckets = 32;
+
+  static inline const auto kClientCpuTime =
+      RegisterCounter(
+          "grpc.client.call.cpu_time",
+          "EXPERIMENTAL.  Total CPU time gRPC spent on client calls", "ns");
+  static inline const auto kClientCallCpuTime =
+      RegisterHistogram<ExponentialHistogramShape>(
+          "grpc.client.call.cpu_time_per_call",
+          "EXPERIMENTAL.  CPU time gRPC spent on each client call", "us",
+          kMaxCallCpuUs, kBuckets);
+  static inline const auto kServerCpuTime =
+      RegisterCounter(
+          "grpc.server.call.cpu_time",
+          "EXPERIMENTAL.  Total CPU time gRPC spent on server calls", "ns");
+  static inline const auto kServerCallCpuTime =
+      RegisterHistogram<ExponentialHistogramShape>(
+          "grpc.server.call.cpu_time_per_call",
+          "EXPERIMENTAL.  CPU time gRPC spent on each server call", "us",
+          kMaxCallCpuUs, kBuckets);
+};
+
+// Returns a stats plugin that installs a CallCpuAccount on every call on
+// every channel and server, and records it into CallCpuDomain when the call
+// is destroyed.
+std::shared_ptr<StatsPlugin> MakeCallCpuStatsPlugin();
+
+// Call v3 calls get no stats plugin call tracers, so the plugin above never
+// sees them.  These install the same account on such calls' arenas while a
+// plugin made by MakeCallCpuStatsPlugin() exists, leaving every other stats
+// plugin out of it.  Servers call theirs once client initial metadata,
+// including GrpcRegisteredMethod, is known.
+void MaybeAddClientCallCpuAccount(Arena* arena, const Slice& path,
+                                  bool registered_method);
+void MaybeAddServerCallCpuAccount(
+    Arena* arena, const grpc_metadata_batch& client_initial_metadata);
+
+// Registers the plugin above globally if the
+// GRPC_EXPERIMENTAL_CALL_CPU_ACCOUNTING config var is set.  When it isn't,
+// calls are not metered.
+void MaybeRegisterCallCpuStatsPlugin();
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_TELEMETRY_CALL_CPU_H
@@ -0,0 +1,53 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/telemetry/call_cpu_account.h"
+
+#include <grpc/support/port_platform.h>
+
+#ifdef GPR_POSIX_TIME
+#include <time.h>
+#endif
+
+namespace grpc_core {
+
+thread_local bool CallCpuMeter::metering_ = false;
+
+int64_t CallCpuMeter::ThreadCpuNanos() {
+#if defined(GPR_POSIX_TIME) && defined(CLOCK_THREAD_CPUTIME_ID)
+  struct timespec ts;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) return 0;
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#else
+  return 0;
+#endif
+}
+
+void CallCpuMeter::Start(Arena* arena, CallCpuAccount* account) {
+  metering_ = true;
+  arena_ = arena->Ref();
+  account_ = account;
+  start_ns_ = ThreadCpuNanos();
+}
+
+void CallCpuMeter::StopSlow() {
+  const int64_t cpu_ns = ThreadCpuNanos() - start_ns_;
+  if (cpu_ns > 0) account_->Charge(cpu_ns);
+  account_ = nullptr;
+  metering_ = false;
+  // May destroy the account, which reports the call's total.
+  arena_.reset();
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,94 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_TELEMETRY_CALL_CPU_ACCOUNT_H
+#define GRPC_SRC_CORE_TELEMETRY_CALL_CPU_ACCOUNT_H
+
+#include <stdint.h>
+
+#include <atomic>
+
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/util/ref_counted_ptr.h"
+
+namespace grpc_core {
+
+// Thread CPU time gRPC has spent on a call's behalf, as measured by
+// CallCpuMeter.  Installed as an arena context by whoever wants the total;
+// the arena destroys it through its virtual destructor once the call is
+// done, which is where subclasses should report it.
+class CallCpuAccount {
+ public:
+  virtual ~CallCpuAccount() = default;
+
+  void Charge(int64_t cpu_ns) {
+    cpu_ns_.fetch_add(cpu_ns, std::memory_order_relaxed);
+  }
+  int64_t cpu_ns() const { return cpu_ns_.load(std::memory_order_relaxed); }
+
+ private:
+  std::atomic<int64_t> cpu_ns_{0};
+};
+
+template <>
+struct ArenaContextType<CallCpuAccount> {
+  static void Destroy(CallCpuAccount* account) { account->~CallCpuAccount(); }
+};
+
+// Measures the CPU time the current thread spends until Stop() (or
+// destruction), and charges it to the CallCpuAccount of `arena`.  Does
+// nothing if the arena has no account, so costs a single context lookup
+// unless accounting is enabled.  When metering, it holds a ref to the arena,
+// so the account outlives it even if the call finishes meanwhile.
+//
+// The thread CPU clock is not served by the vDSO, so each read is a syscall:
+// a meter reads it once as it starts and once as it stops, and should wrap a
+// whole unit of work rather than each step of it.
+//
+// Meters nest: only the outermost on a thread measures, so work done inline
+// for another call or party is charged to the call that started it.
+class CallCpuMeter {
+ public:
+  explicit CallCpuMeter(Arena* arena) {
+    if (arena == nullptr || metering_) return;
+    CallCpuAccount* account = arena->GetContext<CallCpuAccount>();
+    if (account != nullptr) Start(arena, account);
+  }
+  ~CallCpuMeter() { Stop(); }
+
+  CallCpuMeter(const CallCpuMeter&) = delete;
+  CallCpuMeter& operator=(const CallCpuMeter&) = delete;
+
+  // Charges the time measured so far.
+  void Stop() {
+    if (account_ != nullptr) StopSlow();
+  }
+
+  // Thread CPU time in nanoseconds, or zero where the platform can't tell.
+  static int64_t ThreadCpuNanos();
+
+ private:
+  void Start(Arena* arena, CallCpuAccount* account);
+  void StopSlow();
+
+  static thread_local bool metering_;
+
+  RefCountedPtr<Arena> arena_;
+  CallCpuAccount* account_ = nullptr;
+  int64_t start_ns_ = 0;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_TELEMETRY_CALL_CPU_ACCOUNT_H
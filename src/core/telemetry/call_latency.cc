@@ -0,0 +1,315 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/telemetry/call_latency.h"
+
+#include <grpc/event_engine/internal/write_event.h>
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "absl/types/span.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/config/config_vars.h"
+#include "src/core/lib/promise/context.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/surface/call.h"
+#include "src/core/telemetry/call_tracer.h"
+#include "src/core/telemetry/tcp_tracer.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+
+namespace {
+
+using Storage = InstrumentStorageRefPtr<CallLatencyDomain>;
+using grpc_event_engine::experimental::internal::WriteEvent;
+
+// Annotations recorded elsewhere in the stack that mark stage boundaries.
+// See client_channel_filter.cc, load_balanced_call_destination.cc and
+// server.cc.
+constexpr absl::string_view kLbPickCompleteAnnotation =
+    "Delayed LB pick complete.";
+constexpr absl::string_view kCallPublishedAnnotation =
+    "Call published to application.";
+
+// Unregistered methods all share one label to bound cardinality.
+constexpr absl::string_view kOtherMethod = "other";
+
+absl::string_view MethodLabel(absl::string_view path, bool registered) {
+  if (!registered) return kOtherMethod;
+  absl::ConsumePrefix(&path, "/");
+  return path;
+}
+
+template <typename Handle>
+void RecordElapsed(const Storage& storage, const Handle& handle,
+                   absl::Time start, absl::Time end) {
+  storage->Increment(handle, absl::ToInt64Microseconds(end - start));
+}
+
+// Tracer methods that none of the stages need.
+template <typename Base>
+class CallLatencyTracerBase : public Base {
+ public:
+  void RecordSendInitialMetadata(grpc_metadata_batch*) override {}
+  void RecordSendMessage(const Message&) override {}
+  void RecordSendCompressedMessage(const Message&) override {}
+  void RecordReceivedMessage(const Message&) override {}
+  void RecordReceivedDecompressedMessage(const Message&) override {}
+  void RecordCancel(grpc_error_handle) override {}
+  void RecordIncomingBytes(
+      const CallTracerInterface::TransportByteSize&) override {}
+  void RecordOutgoingBytes(
+      const CallTracerInterface::TransportByteSize&) override {}
+  void RecordAnnotation(
+      const CallTracerAnnotationInterface::Annotation&) override {}
+  std::string TraceId() override { return ""; }
+  std::string SpanId() override { return ""; }
+  bool IsSampled() override { return false; }
+};
+
+// Follows the first write of an attempt through the kernel.  Outlives the
+// attempt if the kernel reports after the call is done.
+class KernelSendTracer final : public TcpCallTracer {
+ public:
+  KernelSendTracer(Storage storage, absl::Time write_start)
+      : storage_(std::move(storage)), write_start_(write_start) {}
+
+  void RecordEvent(WriteEvent event, absl::Time time, size_t /*byte_offset*/,
+                   const std::vector<TcpEventMetric>& /*metrics*/) override {
+    MutexLock lock(&mu_);
+    switch (event) {
+      case WriteEvent::kSent:
+        if (sent_.has_value()) return;
+        sent_ = time;
+        RecordElapsed(storage_, CallLatencyDomain::kKernelSend, write_start_,
+                      time);
+        break;
+      case WriteEvent::kAcked:
+        if (acked_ || !sent_.has_value()) return;
+        acked_ = true;
+        RecordElapsed(storage_, CallLatencyDomain::kNetwork, *sent_, time);
+        break;
+      default:
+        break;
+    }
+  }
+
+ private:
+  const Storage storage_;
+  const absl::Time write_start_;
+  Mutex mu_;
+  std::optional<absl::Time> sent_ ABSL_GUARDED_BY(mu_);
+  bool acked_ ABSL_GUARDED_BY(mu_) = false;
+};
+
+class CallLatencyClientCallTracer final : public ClientCallTracerInterface {
+ public:
+  class AttemptTracer final
+      : public CallLatencyTracerBase<
+            ClientCallTracerInterface::CallAttemptTracer> {
+   public:
+    AttemptTracer(Storage storage, Arena* arena)
+        : storage_(std::move(storage)), arena_(arena), start_(absl::Now()) {}
+
+    // The transport only asks traced calls for TCP traces.
+    void RecordSendInitialMetadata(grpc_metadata_batch*) override {
+      Call* call = arena_->GetContext<Call>();
+      if (call != nullptr) call->set_traced(true);
+    }
+
+    void RecordAnnotation(absl::string_view annotation) override {
+      if (annotation != kLbPickCompleteAnnotation) return;
+      pick_complete_ = absl::Now();
+      RecordElapsed(storage_, CallLatencyDomain::kLbPick, start_,
+                    *pick_complete_);
+    }
+    using CallLatencyTracerBase::RecordAnnotation;
+
+    // Invoked by the transport each time it writes bytes of this attempt to
+    // its endpoint; only the first write is followed.
+    std::shared_ptr<TcpCallTracer> StartNewTcpTrace() override {
+      if (std::exchange(write_started_, true)) return nullptr;
+      const absl::Time now = absl::Now();
+      // A pick that didn't queue completed as the attempt started.
+      if (!pick_complete_.has_value()) {
+        pick_complete_ = start_;
+        RecordElapsed(storage_, CallLatencyDomain::kLbPick, start_, start_);
+      }
+      RecordElapsed(storage_, CallLatencyDomain::kTransportWriteQueue,
+                    *pick_complete_, now);
+      return std::make_shared<KernelSendTracer>(storage_, now);
+    }
+
+    void RecordSendTrailingMetadata(grpc_metadata_batch*) override {}
+    void RecordReceivedInitialMetadata(grpc_metadata_batch*) override {}
+    void RecordReceivedTrailingMetadata(
+        absl::Status, grpc_metadata_batch*,
+        const grpc_transport_stream_stats*) override {}
+    void RecordEnd() override {}
+    void SetOptionalLabel(OptionalLabelKey, RefCountedStringValue) override {}
+
+   private:
+    const Storage storage_;
+    Arena* const arena_;
+    const absl::Time start_;
+    std::optional<absl::Time> pick_complete_;
+    bool write_started_ = false;
+  };
+
+  CallLatencyClientCallTracer(Storage storage, Arena* arena)
+      : storage_(std::move(storage)), arena_(arena), start_(absl::Now()) {}
+
+  // The channel starts the first attempt once it has a resolver result.
+  AttemptTracer* StartNewAttempt(bool /*is_transparent_retry*/) override {
+    if (!std::exchange(attempt_started_, true)) {
+      RecordElapsed(storage_, CallLatencyDomain::kNameResolution, start_,
+                    absl::Now());
+    }
+    return arena_->ManagedNew<AttemptTracer>(storage_, arena_);
+  }
+
+  void RecordAnnotation(absl::string_view) override {}
+  void RecordAnnotation(const Annotation&) override {}
+  std::string TraceId() override { return ""; }
+  std::string SpanId() override { return ""; }
+  bool IsSampled() override { return false; }
+
+ private:
+  const Storage storage_;
+  Arena* const arena_;
+  const absl::Time start_;
+  bool attempt_started_ = false;
+};
+
+class CallLatencyServerCallTracer final
+    : public CallLatencyTracerBase<ServerCallTracerInterface> {
+ public:
+  CallLatencyServerCallTracer() : start_(absl::Now()) {}
+
+  void RecordReceivedInitialMetadata(
+      grpc_metadata_batch* recv_initial_metadata) override {
+    const Slice* path = recv_initial_metadata->get_pointer(HttpPathMetadata());
+    if (path == nullptr) return;
+    const bool registered =
+        recv_initial_metadata->get(GrpcRegisteredMethod()).value_or(nullptr) !=
+        nullptr;
+    storage_ = CallLatencyDomain::GetStorage(
+        MethodLabel(path->as_string_view(), registered));
+  }
+
+  void RecordAnnotation(absl::string_view annotation) override {
+    if (annotation != kCallPublishedAnnotation || storage_ == nullptr) return;
+    published_ = absl::Now();
+    RecordElapsed(storage_, CallLatencyDomain::kServerQueue, start_,
+                  *published_);
+  }
+  using CallLatencyTracerBase::RecordAnnotation;
+
+  void RecordSendTrailingMetadata(grpc_metadata_batch*) override {
+    if (!published_.has_value()) return;
+    RecordElapsed(storage_, CallLatencyDomain::kServerHandler, *published_,
+                  absl::Now());
+  }
+
+  std::shared_ptr<TcpCallTracer> StartNewTcpTrace() override { return nullptr; }
+  void RecordReceivedTrailingMetadata(grpc_metadata_batch*) override {}
+  void RecordEnd(const grpc_call_final_info*) override {}
+
+ private:
+  const absl::Time start_;
+  Storage storage_;
+  std::optional<absl::Time> published_;
+};
+
+class CallLatencyStatsPlugin final : public StatsPlugin {
+ public:
+  std::pair<bool, std::shared_ptr<ScopeConfig>> IsEnabledForChannel(
+      const experimental::StatsPluginChannelScope&) const override {
+    return {true, nullptr};
+  }
+  std::pair<bool, std::shared_ptr<ScopeConfig>> IsEnabledForServer(
+      const ChannelArgs&) const override {
+    return {true, nullptr};
+  }
+  std::shared_ptr<ScopeConfig> GetChannelScopeConfig(
+      const experimental::StatsPluginChannelScope&) const override {
+    return nullptr;
+  }
+  std::shared_ptr<ScopeConfig> GetServerScopeConfig(
+      const ChannelArgs&) const override {
+    return nullptr;
+  }
+
+  // Everything is recorded in CallLatencyDomain rather than through the
+  // global instruments registry.
+  void AddCounter(GlobalInstrumentsRegistry::GlobalInstrumentHandle, uint64_t,
+                  absl::Span<const absl::string_view>,
+                  absl::Span<const absl::string_view>) override {}
+  void AddCounter(GlobalInstrumentsRegistry::GlobalInstrumentHandle, double,
+                  absl::Span<const absl::string_view>,
+                  absl::Span<const absl::string_view>) override {}
+  void RecordHistogram(GlobalInstrumentsRegistry::GlobalInstrumentHandle,
+                       uint64_t, absl::Span<const absl::string_view>,
+                       absl::Span<const absl::string_view>) override {}
+  void RecordHistogram(GlobalInstrumentsRegistry::GlobalInstrumentHandle,
+                       double, absl::Span<const absl::string_view>,
+                       absl::Span<const absl::string_view>) override {}
+  void AddCallback(RegisteredMetricCallback*) override {}
+  void RemoveCallback(RegisteredMetricCallback*) override {}
+  bool IsInstrumentEnabled(
+      GlobalInstrumentsRegistry::GlobalInstrumentHandle) const override {
+    return false;
+  }
+
+  ClientCallTracerInterface* GetClientCallTracer(
+      const Slice& path, bool registered_method,
+      std::shared_ptr<ScopeConfig>) override {
+    auto* arena = GetContext<Arena>();
+    return arena->ManagedNew<CallLatencyClientCallTracer>(
+        CallLatencyDomain::GetStorage(
+            MethodLabel(path.as_string_view(), registered_method)),
+        arena);
+  }
+  ServerCallTracerInterface* GetServerCallTracer(
+      std::shared_ptr<ScopeConfig>) override {
+    return GetContext<Arena>()->ManagedNew<CallLatencyServerCallTracer>();
+  }
+};
+
+}  // namespace
+
+std::shared_ptr<StatsPlugin> MakeCallLatencyStatsPlugin() {
+  return std::make_shared<CallLatencyStatsPlugin>();
+}
+
+void MaybeRegisterCallLatencyStatsPlugin() {
+  if (!ConfigVars::Get().ExperimentalCallLatencyHistograms()) return;
+  GlobalStatsPluginRegistry::RegisterStatsPlugin(MakeCallLatencyStatsPlugin());
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,99 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_TELEMETRY_CALL_LATENCY_H
+#define GRPC_SRC_CORE_TELEMETRY_CALL_LATENCY_H
+
+#include <memory>
+
+#include "src/core/telemetry/histogram.h"
+#include "src/core/telemetry/instrument.h"
+#include "src/core/telemetry/metrics.h"
+
+namespace grpc_core {
+
+// Breaks the latency of each call down into the stages it spends time in,
+// per method.  Each histogram covers one stage, in microseconds:
+//
+//   client: name resolution -> LB pick (including waiting for a subchannel
+//           to connect) -> transport write queue -> kernel send -> network
+//   server: queued waiting for the application to request the call ->
+//           handler
+//
+// Stages whose end is never observed (for example the kernel stages on
+// transports without TCP timestamping) are not recorded for that call.
+class CallLatencyDomain final : public InstrumentDomain<CallLatencyDomain> {
+ public:
+  using Backend = HighContentionBackend;
+  static constexpr auto kLabels = Labels("grpc.method");
+
+  static constexpr int64_t kMaxLatencyUs = 60 * 1000 * 1000;
+  static constexpr size_t kBuckets = 32;
+
+  static inline const auto kNameResolution =
+      RegisterHistogram<ExponentialHistogramShape>(
+          "grpc.client.call.name_resolution_latency",
+          "EXPERIMENTAL.  Time from call start until the channel had a "
+          "resolver result to start the first attempt with",
+          "us", kMaxLatencyUs, kBuckets);
+  static inline const auto kLbPick =
+      RegisterHistogram<ExponentialHistogramShape>(
+          "grpc.client.attempt.lb_pick_latency",
+          "EXPERIMENTAL.  Time an attempt was queued waiting for an LB pick, "
+          "including waiting for a subchannel to connect",
+          "us", kMaxLatencyUs, kBuckets);
+  static inline const auto kTransportWriteQueue =
+      RegisterHistogram<ExponentialHistogramShape>(
+          "grpc.client.attempt.transport_write_queue_latency",
+          "EXPERIMENTAL.  Time from the LB pick until the transport first "
+          "wrote bytes of the attempt to its endpoint",
+          "us", kMaxLatencyUs, kBuckets);
+  static inline const auto kKernelSend =
+      RegisterHistogram<ExponentialHistogramShape>(
+          "grpc.client.attempt.kernel_send_latency",
+          "EXPERIMENTAL.  Time from the transport's first write of the "
+          "attempt until the kernel reported the bytes sent",
+          "us", kMaxLatencyUs, kBuckets);
+  static inline const auto kNetwork =
+      RegisterHistogram<ExponentialHistogramShape>(
+          "grpc.client.attempt.network_latency",
+          "EXPERIMENTAL.  Time from the kernel sending the attempt's first "
+          "bytes until the peer acknowledged them",
+          "us", kMaxLatencyUs, kBuckets);
+  static inline const auto kServerQueue =
+      RegisterHistogram<ExponentialHistogramShape>(
+          "grpc.server.call.queue_latency",
+          "EXPERIMENTAL.  Time from the server creating a call until it was "
+          "handed to the application",
+          "us", kMaxLatencyUs, kBuckets);
+  static inline const auto kServerHandler =
+      RegisterHistogram<ExponentialHistogramShape>(
+          "grpc.server.call.handler_latency",
+          "EXPERIMENTAL.  Time from the call being handed to the application "
+          "until it sent trailing metadata",
+          "us", kMaxLatencyUs, kBuckets);
+};
+
+// Returns a stats plugin that attaches call tracers recording into
+// CallLatencyDomain to every call on every channel and server.
+std::shared_ptr<StatsPlugin> MakeCallLatencyStatsPlugin();
+
+// Registers the plugin above globally if the
+// GRPC_EXPERIMENTAL_CALL_LATENCY_HISTOGRAMS config var is set.  When it
+// isn't, calls carry no extra tracers.
+void MaybeRegisterCallLatencyStatsPlugin();
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_TELEMETRY_CALL_LATENCY_H
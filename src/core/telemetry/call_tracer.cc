@@ -18,12 +18,15 @@
 
 #include "src/core/telemetry/call_tracer.h"
 
+#include <grpc/event_engine/internal/write_event.h>
 #include <grpc/support/port_platform.h>
+#include <stddef.h>
 
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "absl/time/time.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/telemetry/tcp_tracer.h"
 #include "src/core/util/grpc_check.h"
@@ -78,6 +81,42 @@ absl::string_view ServerCallTracerFactory::ChannelArgName() {
   return kServerCallTracerFactoryChannelArgName;
 }
 
+namespace {
+
+// Fans TCP events out to the TCP tracers of each delegated call tracer.
+class DelegatingTcpCallTracer final : public TcpCallTracer {
+ public:
+  explicit DelegatingTcpCallTracer(
+      std::vector<std::shared_ptr<TcpCallTracer>> tracers)
+      : tracers_(std::move(tracers)) {}
+
+  void RecordEvent(grpc_event_engine::experimental::internal::WriteEvent event,
+                   absl::Time time, size_t byte_offset,
+                   const std::vector<TcpEventMetric>& metrics) override {
+    for (auto& tracer : tracers_) {
+      tracer->RecordEvent(event, time, byte_offset, metrics);
+    }
+  }
+
+ private:
+  const std::vector<std::shared_ptr<TcpCallTracer>> tracers_;
+};
+
+template <typename Tracer>
+std::shared_ptr<TcpCallTracer> StartDelegatingTcpTrace(
+    const std::vector<Tracer*>& tracers) {
+  std::vector<std::shared_ptr<TcpCallTracer>> tcp_tracers;
+  for (auto* tracer : tracers) {
+    auto tcp_tracer = tracer->StartNewTcpTrace();
+    if (tcp_tracer != nullptr) tcp_tracers.push_back(std::move(tcp_tracer));
+  }
+  if (tcp_tracers.empty()) return nullptr;
+  if (tcp_tracers.size() == 1) return std::move(tcp_tracers[0]);
+  return std::make_shared<DelegatingTcpCallTracer>(std::move(tcp_tracers));
+}
+
+}  // namespace
+
 class DelegatingClientCallTracer : public ClientCallTracerInterface {
  public:
   class DelegatingClientCallAttemptTracer
@@ -170,7 +209,7 @@ class DelegatingClientCallTracer : public ClientCallTracerInterface {
       }
     }
     std::shared_ptr<TcpCallTracer> StartNewTcpTrace() override {
-      return nullptr;
+      return StartDelegatingTcpTrace(tracers_);
     }
     void SetOptionalLabel(OptionalLabelKey key,
                           RefCountedStringValue value) override {
@@ -321,7 +360,9 @@ class DelegatingServerCallTracer : public ServerCallTracerInterface {
       tracer->RecordAnnotation(annotation);
     }
   }
-  std::shared_ptr<TcpCallTracer> StartNewTcpTrace() override { return nullptr; }
+  std::shared_ptr<TcpCallTracer> StartNewTcpTrace() override {
+    return StartDelegatingTcpTrace(tracers_);
+  }
   std::string TraceId() override { return tracers_[0]->TraceId(); }
   std::string SpanId() override { return tracers_[0]->SpanId(); }
   bool IsSampled() override { return tracers_[0]->IsSampled(); }
@@ -15,13 +15,16 @@
 #ifndef GRPC_SRC_CORE_TELEMETRY_HISTOGRAM_H
 #define GRPC_SRC_CORE_TELEMETRY_HISTOGRAM_H
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <optional>
 #include <vector>
 
 #include "absl/log/log.h"
+#include "absl/numeric/bits.h"
 #include "absl/strings/str_join.h"
 #include "absl/types/span.h"
 #include "src/core/util/grpc_check.h"
@@ -200,6 +203,146 @@ class ExponentialHistogramShape {
   size_t buckets_;
 };
 
+// HDR-style log-linear bucket layout.
+//
+// Values below 2^precision_bits each get their own bucket, and every power of
+// two above that is split into 2^precision_bits equal width buckets.  Every
+// bucket is therefore at most 2^-precision_bits of its lower bound wide (7
+// bits keeps the error of any percentile read from the histogram under 1%),
+// and finding a value's bucket takes a few bit operations rather than a table
+// lookup.
+//
+// Values from `max` up share the last bucket.  `max` only truncates the
+// layout, so histograms recorded with the same precision merge losslessly by
+// adding counts bucket by bucket, up to the smaller max.
+//
+// Every bucket is a counter slot in each storage, so prefer this shape with a
+// HighContentionBackend domain: records then land in a per-cpu shard with no
+// cross-cpu cache traffic.  Storage is dense, so that costs 8 bytes per bucket
+// per cpu per label set whether or not the bucket is ever touched: max 1e9 at
+// 7 bits is about 3000 buckets, or 24KiB per cpu for each label set.  Layouts
+// are capped at kMaxBuckets to keep that bounded; lower the precision or the
+// max to fit.
+class LogLinearHistogramShape {
+ public:
+  // The finest precision ExponentialHistogramData can carry.
+  static constexpr int kMaxPrecisionBits = 20;
+  // The most buckets a layout may have: 256KiB per cpu per label set.
+  static constexpr size_t kMaxBuckets = 32768;
+
+  LogLinearHistogramShape(int64_t max, int precision_bits)
+      : precision_bits_(precision_bits) {
+    GRPC_CHECK_GT(max, 0);
+    GRPC_CHECK_GE(precision_bits, 0);
+    GRPC_CHECK_LE(precision_bits, kMaxPrecisionBits);
+    buckets_ = UnclampedBucketFor(max) + 1;
+    GRPC_CHECK_LE(buckets_, kMaxBuckets);
+    bounds_.reserve(buckets_);
+    for (size_t i = 1; i <= buckets_; ++i) bounds_.push_back(LowerBound(i));
+  }
+
+  LogLinearHistogramShape(const LogLinearHistogramShape&) = delete;
+  LogLinearHistogramShape& operator=(const LogLinearHistogramShape&) = delete;
+  LogLinearHistogramShape(LogLinearHistogramShape&&) = default;
+  LogLinearHistogramShape& operator=(LogLinearHistogramShape&&) = default;
+
+  size_t buckets() const { return buckets_; }
+  size_t BucketFor(int64_t value) const {
+    if (value <= 0) return 0;
+    return std::min(UnclampedBucketFor(value), buckets_ - 1);
+  }
+
+  // Smallest value that lands in `bucket`, saturating at INT64_MAX.
+  int64_t LowerBound(size_t bucket) const {
+    const size_t linear_buckets = size_t{1} << precision_bits_;
+    if (bucket < linear_buckets) return bucket;
+    const size_t shift = (bucket >> precision_bits_) - 1;
+    const uint64_t mantissa =
+        (bucket & (linear_buckets - 1)) + linear_buckets;
+    constexpr uint64_t kMax = std::numeric_limits<int64_t>::max();
+    if (shift >= 63 || mantissa > (kMax >> shift)) return kMax;
+    return static_cast<int64_t>(mantissa << shift);
+  }
+
+  int precision_bits() const { return precision_bits_; }
+  HistogramBuckets bounds() const { return bounds_; }
+
+ private:
+  size_t UnclampedBucketFor(int64_t value) const {
+    const uint64_t v = value;
+    const int magnitude = absl::bit_width(v) - 1;
+    if (magnitude < precision_bits_) return v;
+    const int shift = magnitude - precision_bits_;
+    return (static_cast<size_t>(shift) << precision_bits_) + (v >> shift);
+  }
+
+  int precision_bits_;
+  size_t buckets_;
+  std::vector<int64_t> bounds_;
+};
+
+// A histogram in the OpenTelemetry exponential histogram data model, with
+// only positive buckets: bucket_counts[i] counts values in
+// (base^(offset + i), base^(offset + i + 1)], where base = 2^(2^-scale).
+// Empty buckets before the first and after the last populated one are left
+// out.
+struct ExponentialHistogramData {
+  int32_t scale = 0;
+  uint64_t zero_count = 0;
+  int32_t offset = 0;
+  std::vector<uint64_t> bucket_counts;
+};
+
+// Index of the exponential histogram bucket at `scale` that holds `value`,
+// which must be positive.
+inline int32_t ExponentialHistogramIndex(int64_t value, int32_t scale) {
+  GRPC_DCHECK_GT(value, 0);
+  const uint64_t v = value;
+  const int32_t exponent = absl::bit_width(v) - 1;
+  const bool power_of_two = (v & (v - 1)) == 0;
+  // Powers of two are upper bounds of their buckets.
+  if (scale <= 0) return (exponent - (power_of_two ? 1 : 0)) >> -scale;
+  if (power_of_two) return (exponent << scale) - 1;
+  return static_cast<int32_t>(
+             std::ceil(std::log2(static_cast<double>(value)) *
+                       std::ldexp(1.0, scale))) -
+         1;
+}
+
+// Converts `counts`, recorded into buckets with upper bounds `bounds`, to an
+// exponential histogram at `scale`.  Each bucket's count moves to the
+// exponential bucket holding its midpoint: exponential buckets exclude their
+// lower bound, so a power of two that starts a bucket would place the whole
+// bucket one exponential bucket too low.  At scale == precision_bits() the
+// exponential buckets are narrower than the LogLinearHistogramShape ones, so
+// this keeps its relative precision.  Buckets starting at zero count as
+// zero_count.
+// Nothing exports instrument registry histograms to OpenTelemetry yet; this
+// is the conversion such an exporter's MetricsSink::Histogram() should use.
+inline ExponentialHistogramData ToExponentialHistogram(
+    HistogramBuckets bounds, absl::Span<const uint64_t> counts,
+    int32_t scale) {
+  GRPC_CHECK_EQ(bounds.size(), counts.size());
+  ExponentialHistogramData out;
+  out.scale = scale;
+  for (size_t i = 0; i < counts.size(); ++i) {
+    if (counts[i] == 0) continue;
+    const int64_t lower_bound = i == 0 ? 0 : bounds[i - 1];
+    if (lower_bound <= 0) {
+      out.zero_count += counts[i];
+      continue;
+    }
+    // Bounds ascend, so indices never decrease.
+    const int64_t midpoint = lower_bound + (bounds[i] - lower_bound) / 2;
+    const int32_t index = ExponentialHistogramIndex(midpoint, scale);
+    if (out.bucket_counts.empty()) out.offset = index;
+    const size_t slot = index - out.offset;
+    if (slot >= out.bucket_counts.size()) out.bucket_counts.resize(slot + 1);
+    out.bucket_counts[slot] += counts[i];
+  }
+  return out;
+}
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_TELEMETRY_HISTOGRAM_H
@@ -527,6 +527,10 @@ class LowContentionBackend final {
     counters_[index].fetch_add(1, std::memory_order_relaxed);
   }
 
+  void Add(size_t index, uint64_t value) {
+    counters_[index].fetch_add(value, std::memory_order_relaxed);
+  }
+
   uint64_t Sum(size_t index);
 
  private:
@@ -545,6 +549,10 @@ class HighContentionBackend final {
     counters_.this_cpu()[index].fetch_add(1, std::memory_order_relaxed);
   }
 
+  void Add(size_t index, uint64_t value) {
+    counters_.this_cpu()[index].fetch_add(value, std::memory_order_relaxed);
+  }
+
   uint64_t Sum(size_t index);
 
  private:
@@ -713,6 +721,13 @@ class InstrumentDomainImpl final : public QueryableDomain {
       backend_.Increment(handle.offset_);
     }
 
+    // Adds `value` to the counter specified by `handle` for this storages
+    // labels.
+    void Add(CounterHandle handle, uint64_t value) {
+      DCHECK_EQ(handle.instrument_domain_, domain());
+      backend_.Add(handle.offset_, value);
+    }
+
     template <typename Shape>
     void Increment(const HistogramHandle<Shape>& handle, int64_t value) {
       DCHECK_EQ(handle.instrument_domain_, domain());
@@ -391,6 +391,7 @@ const absl::string_view
         "client_subchannels_created",
         "server_channels_created",
         "insecure_connections_created",
+        "server_pending_calls_deadline_exceeded",
         "syscall_write",
         "syscall_read",
         "tcp_read_alloc_8k",
@@ -421,6 +422,8 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of client subchannels created",
     "Number of server channels created",
     "Number of insecure connections created",
+    "Number of server calls failed with DEADLINE_EXCEEDED while waiting for "
+    "the application to request them",
     "Number of write syscalls (or equivalent - eg sendmsg) made by this "
     "process",
     "Number of read syscalls (or equivalent - eg recvmsg) made by this process",
@@ -513,6 +516,7 @@ GlobalStats::GlobalStats()
       client_subchannels_created{0},
       server_channels_created{0},
       insecure_connections_created{0},
+      server_pending_calls_deadline_exceeded{0},
       syscall_write{0},
       syscall_read{0},
       tcp_read_alloc_8k{0},
@@ -634,6 +638,9 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.server_channels_created.load(std::memory_order_relaxed);
     result->insecure_connections_created +=
         data.insecure_connections_created.load(std::memory_order_relaxed);
+    result->server_pending_calls_deadline_exceeded +=
+        data.server_pending_calls_deadline_exceeded.load(
+            std::memory_order_relaxed);
     result->syscall_write += data.syscall_write.load(std::memory_order_relaxed);
     result->syscall_read += data.syscall_read.load(std::memory_order_relaxed);
     result->tcp_read_alloc_8k +=
@@ -731,6 +738,9 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       server_channels_created - other.server_channels_created;
   result->insecure_connections_created =
       insecure_connections_created - other.insecure_connections_created;
+  result->server_pending_calls_deadline_exceeded =
+      server_pending_calls_deadline_exceeded -
+      other.server_pending_calls_deadline_exceeded;
   result->syscall_write = syscall_write - other.syscall_write;
   result->syscall_read = syscall_read - other.syscall_read;
   result->tcp_read_alloc_8k = tcp_read_alloc_8k - other.tcp_read_alloc_8k;
@@ -277,6 +277,7 @@ struct GlobalStats {
     kClientSubchannelsCreated,
     kServerChannelsCreated,
     kInsecureConnectionsCreated,
+    kServerPendingCallsDeadlineExceeded,
     kSyscallWrite,
     kSyscallRead,
     kTcpReadAlloc8k,
@@ -344,6 +345,7 @@ struct GlobalStats {
       uint64_t client_subchannels_created;
       uint64_t server_channels_created;
       uint64_t insecure_connections_created;
+      uint64_t server_pending_calls_deadline_exceeded;
       uint64_t syscall_write;
       uint64_t syscall_read;
       uint64_t tcp_read_alloc_8k;
@@ -424,6 +426,10 @@ class GlobalStatsCollector {
     data_.this_cpu().insecure_connections_created.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementServerPendingCallsDeadlineExceeded() {
+    data_.this_cpu().server_pending_calls_deadline_exceeded.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementSyscallWrite() {
     data_.this_cpu().syscall_write.fetch_add(1, std::memory_order_relaxed);
   }
@@ -582,6 +588,7 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> client_subchannels_created{0};
     std::atomic<uint64_t> server_channels_created{0};
     std::atomic<uint64_t> insecure_connections_created{0};
+    std::atomic<uint64_t> server_pending_calls_deadline_exceeded{0};
     std::atomic<uint64_t> syscall_write{0};
     std::atomic<uint64_t> syscall_read{0};
     std::atomic<uint64_t> tcp_read_alloc_8k{0};
@@ -14,10 +14,13 @@
 
 #include "src/core/util/latent_see.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "absl/log/log.h"
@@ -71,6 +74,124 @@ void JsonOutput::Span(absl::string_view name, int64_t tid,
 }
 
 void JsonOutput::Finish() { out_ << "\n]"; }
+
+namespace {
+
+// Protobuf wire format, for the few perfetto.protos messages written below.
+enum WireType { kVarint = 0, kFixed64 = 1, kLengthDelimited = 2 };
+
+void AppendVarint(std::string* out, uint64_t value) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+void AppendTag(std::string* out, int field, WireType wire_type) {
+  AppendVarint(out, (static_cast<uint64_t>(field) << 3) | wire_type);
+}
+
+void AppendVarintField(std::string* out, int field, uint64_t value) {
+  AppendTag(out, field, kVarint);
+  AppendVarint(out, value);
+}
+
+void AppendFixed64Field(std::string* out, int field, uint64_t value) {
+  AppendTag(out, field, kFixed64);
+  for (int i = 0; i < 8; ++i) {
+    out->push_back(static_cast<char>(value >> (8 * i)));
+  }
+}
+
+void AppendBytesField(std::string* out, int field, absl::string_view value) {
+  AppendTag(out, field, kLengthDelimited);
+  AppendVarint(out, value.size());
+  out->append(value.data(), value.size());
+}
+
+// Field numbers from perfetto/protos/perfetto/trace/.
+constexpr int kTracePacket = 1;               // Trace
+constexpr int kPacketTimestamp = 8;           // TracePacket
+constexpr int kPacketSequenceId = 10;         // TracePacket
+constexpr int kPacketTrackEvent = 11;         // TracePacket
+constexpr int kPacketSequenceFlags = 13;      // TracePacket
+constexpr int kPacketTrackDescriptor = 60;    // TracePacket
+constexpr int kTrackDescriptorUuid = 1;       // TrackDescriptor
+constexpr int kTrackDescriptorName = 2;       // TrackDescriptor
+constexpr int kEventType = 9;                 // TrackEvent
+constexpr int kEventTrackUuid = 11;           // TrackEvent
+constexpr int kEventName = 23;                // TrackEvent
+constexpr int kEventFlowIds = 47;             // TrackEvent
+constexpr int kEventTerminatingFlowIds = 48;  // TrackEvent
+
+// All packets are written on one sequence.
+constexpr uint64_t kSequenceId = 1;
+// TracePacket.SequenceFlags.SEQ_INCREMENTAL_STATE_CLEARED
+constexpr uint64_t kSequenceIncrementalStateCleared = 1;
+
+}  // namespace
+
+void PerfettoOutput::Mark(absl::string_view name, int64_t tid,
+                          int64_t timestamp) {
+  AddEvent(EventType::kInstant, name, tid, timestamp, 0, 0);
+}
+
+void PerfettoOutput::FlowBegin(absl::string_view name, int64_t tid,
+                               int64_t timestamp, int64_t flow_id) {
+  AddEvent(EventType::kInstant, name, tid, timestamp, flow_id, 0);
+}
+
+void PerfettoOutput::FlowEnd(absl::string_view name, int64_t tid,
+                             int64_t timestamp, int64_t flow_id) {
+  AddEvent(EventType::kInstant, name, tid, timestamp, 0, flow_id);
+}
+
+void PerfettoOutput::Span(absl::string_view name, int64_t tid,
+                          int64_t timestamp_begin, int64_t duration) {
+  AddEvent(EventType::kSliceBegin, name, tid, timestamp_begin, 0, 0);
+  AddEvent(EventType::kSliceEnd, "", tid, timestamp_begin + duration, 0, 0);
+}
+
+void PerfettoOutput::Finish() { out_.flush(); }
+
+void PerfettoOutput::AddEvent(EventType type, absl::string_view name,
+                              int64_t tid, int64_t timestamp, int64_t flow_id,
+                              int64_t terminating_flow_id) {
+  // Thread ids start at 1, so they double as track uuids.
+  if (tracks_.insert(tid).second) {
+    std::string track;
+    AppendVarintField(&track, kTrackDescriptorUuid, tid);
+    AppendBytesField(&track, kTrackDescriptorName,
+                     absl::StrCat("Thread ", tid));
+    AddPacket(0, kPacketTrackDescriptor, track);
+  }
+  std::string event;
+  AppendVarintField(&event, kEventType, static_cast<uint64_t>(type));
+  AppendVarintField(&event, kEventTrackUuid, tid);
+  if (!name.empty()) AppendBytesField(&event, kEventName, name);
+  if (flow_id != 0) AppendFixed64Field(&event, kEventFlowIds, flow_id);
+  if (terminating_flow_id != 0) {
+    AppendFixed64Field(&event, kEventTerminatingFlowIds, terminating_flow_id);
+  }
+  AddPacket(timestamp, kPacketTrackEvent, event);
+}
+
+void PerfettoOutput::AddPacket(int64_t timestamp, int field,
+                               const std::string& payload) {
+  std::string packet;
+  AppendVarintField(&packet, kPacketTimestamp, timestamp);
+  AppendVarintField(&packet, kPacketSequenceId, kSequenceId);
+  if (std::exchange(first_packet_, false)) {
+    AppendVarintField(&packet, kPacketSequenceFlags,
+                      kSequenceIncrementalStateCleared);
+  }
+  AppendBytesField(&packet, field, payload);
+  std::string framed;
+  AppendBytesField(&framed, kTracePacket, packet);
+  out_ << framed;
+}
+
 }  // namespace grpc_core::latent_see
 
 #ifndef GRPC_DISABLE_LATENT_SEE
@@ -80,14 +201,170 @@ namespace latent_see {
 
 namespace {
 const Duration kMaxBackoff = Duration::Milliseconds(300);
+
+// Decides which sink Appender::active_sink_ points at: a running collection
+// wins over the flight recorder.
+struct ActiveSinkState {
+  Mutex mu;
+  bool collecting ABSL_GUARDED_BY(mu) = false;
+  size_t flight_recorder_users ABSL_GUARDED_BY(mu) = 0;
+};
+
+ActiveSinkState& GetActiveSinkState() {
+  static ActiveSinkState* state = new ActiveSinkState;
+  return *state;
 }
 
+// Converts the recorded events into calls on `output`.
+void WriteEvents(const Sink::EventDump& events, Output* output) {
+  // Find the earliest timestamp
+  // We save a lot of bytes by subtracting that out
+  int64_t earliest_timestamp = std::numeric_limits<int64_t>::max();
+  for (const auto& bin : events) {
+    for (const auto& event : *bin) {
+      // Exclude negative timestamps as they're used for event type markers
+      if (event.timestamp_begin > 0) {
+        earliest_timestamp = std::min(
+            {earliest_timestamp, event.timestamp_begin, event.timestamp_end});
+      } else {
+        earliest_timestamp = std::min(earliest_timestamp, -event.timestamp_end);
+      }
+    }
+  }
+  // TODO(ctiller): Fuschia Trace Format backend
+  absl::flat_hash_map<gpr_thd_id, size_t> thread_id_map;
+  for (const auto& bin : events) {
+    size_t displayed_thread_id;
+    auto it = thread_id_map.find(bin->thd_id);
+    if (it == thread_id_map.end()) {
+      displayed_thread_id = thread_id_map.size() + 1;
+      thread_id_map[bin->thd_id] = displayed_thread_id;
+    } else {
+      displayed_thread_id = it->second;
+    }
+    for (const auto& event : *bin) {
+      if (event.timestamp_begin == event.timestamp_end) {
+        output->Mark(event.metadata->name, displayed_thread_id,
+                     event.timestamp_begin - earliest_timestamp);
+      } else if (event.timestamp_begin < 0 && event.timestamp_end > 0) {
+        output->FlowBegin(event.metadata->name, displayed_thread_id,
+                          event.timestamp_end - earliest_timestamp,
+                          -event.timestamp_begin);
+      } else if (event.timestamp_begin < 0) {
+        output->FlowEnd(event.metadata->name, displayed_thread_id,
+                        -event.timestamp_end - earliest_timestamp,
+                        -event.timestamp_begin);
+      } else {
+        output->Span(event.metadata->name, displayed_thread_id,
+                     event.timestamp_begin - earliest_timestamp,
+                     event.timestamp_end - event.timestamp_begin);
+      }
+    }
+  }
+  output->Finish();
+}
+
+}  // namespace
+
 void Appender::Enable(Sink* sink) {
+  auto& state = GetActiveSinkState();
+  MutexLock lock(&state.mu);
+  state.collecting = true;
   active_sink_.store(sink, std::memory_order_release);
 }
 
 void Appender::Disable() {
-  active_sink_.store(nullptr, std::memory_order_relaxed);
+  auto& state = GetActiveSinkState();
+  MutexLock lock(&state.mu);
+  state.collecting = false;
+  active_sink_.store(
+      state.flight_recorder_users > 0 ? FlightRecorder::sink_tag() : nullptr,
+      std::memory_order_release);
+}
+
+thread_local FlightRecorder::RingRef FlightRecorder::ring_;
+std::atomic<FlightRecorder::Ring*> FlightRecorder::rings_{nullptr};
+
+void FlightRecorder::Enable() {
+  auto& state = GetActiveSinkState();
+  MutexLock lock(&state.mu);
+  if (state.flight_recorder_users++ == 0 && !state.collecting) {
+    Appender::active_sink_.store(sink_tag(), std::memory_order_release);
+  }
+}
+
+void FlightRecorder::Disable() {
+  auto& state = GetActiveSinkState();
+  MutexLock lock(&state.mu);
+  CHECK_GT(state.flight_recorder_users, 0u);
+  if (--state.flight_recorder_users == 0 && !state.collecting) {
+    Appender::active_sink_.store(nullptr, std::memory_order_release);
+  }
+}
+
+FlightRecorder::RingRef::~RingRef() {
+  if (ring != nullptr) ring->in_use.store(false, std::memory_order_release);
+}
+
+FlightRecorder::Ring* FlightRecorder::AttachRing() {
+  Ring* ring = nullptr;
+  for (Ring* r = rings_.load(std::memory_order_acquire); r != nullptr;
+       r = r->next) {
+    bool in_use = false;
+    if (r->in_use.compare_exchange_strong(in_use, true,
+                                          std::memory_order_acquire)) {
+      ring = r;
+      break;
+    }
+  }
+  if (ring == nullptr) {
+    ring = new Ring;
+    ring->next = rings_.load(std::memory_order_relaxed);
+    while (!rings_.compare_exchange_weak(ring->next, ring,
+                                         std::memory_order_acq_rel)) {
+    }
+  }
+  ring->thd_id.store(gpr_thd_currentid(), std::memory_order_relaxed);
+  ring->first_index.store(ring->next_index.load(std::memory_order_relaxed),
+                          std::memory_order_release);
+  ring_.ring = ring;
+  return ring;
+}
+
+void FlightRecorder::Snapshot(Output* output) {
+  Sink::EventDump events;
+  for (Ring* ring = rings_.load(std::memory_order_acquire); ring != nullptr;
+       ring = ring->next) {
+    const uint64_t end = ring->next_index.load(std::memory_order_acquire);
+    const uint64_t begin =
+        std::max(ring->first_index.load(std::memory_order_acquire),
+                 end - std::min<uint64_t>(end, kEventsPerThread));
+    const gpr_thd_id thd_id = ring->thd_id.load(std::memory_order_relaxed);
+    std::unique_ptr<Bin> bin;
+    for (uint64_t index = begin; index != end; ++index) {
+      const Ring::Slot& slot = ring->slots[index % kEventsPerThread];
+      const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+      if (sequence != index + 1) continue;
+      const Metadata* metadata = slot.metadata.load(std::memory_order_relaxed);
+      const int64_t timestamp_begin =
+          slot.timestamp_begin.load(std::memory_order_relaxed);
+      const int64_t timestamp_end =
+          slot.timestamp_end.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.sequence.load(std::memory_order_relaxed) != sequence) continue;
+      if (bin == nullptr) {
+        bin = std::make_unique<Bin>();
+        bin->thd_id = thd_id;
+      }
+      if (bin->Append(metadata, timestamp_begin, timestamp_end)) {
+        events.emplace_back(std::move(bin));
+      }
+    }
+    if (bin != nullptr) events.emplace_back(std::move(bin));
+  }
+  LOG(INFO) << "Latent-see flight recorder snapshot: processing "
+            << events.size() << " bins";
+  WriteEvents(events, output);
 }
 
 Sink::Sink() : gatherer_("grpc_latent_see_gatherer", [this]() { Gather(); }) {
@@ -167,52 +444,7 @@ void Collect(Notification* n, absl::Duration timeout, size_t memory_limit,
   LOG(INFO) << "Latent-see collection stopped: processing " << events->size()
             << " bins";
 
-  // Next: find the earliest timestamp
-  // We save a lot of bytes by subtracting that out
-  int64_t earliest_timestamp = std::numeric_limits<int64_t>::max();
-  for (const auto& bin : *events) {
-    for (const auto& event : *bin) {
-      // Exclude negative timestamps as they're used for event type markers
-      if (event.timestamp_begin > 0) {
-        earliest_timestamp = std::min(
-            {earliest_timestamp, event.timestamp_begin, event.timestamp_end});
-      } else {
-        earliest_timestamp = std::min(earliest_timestamp, -event.timestamp_end);
-      }
-    }
-  }
-  std::string json = "[\n";
-  // TODO(ctiller): Fuschia Trace Format backend
-  absl::flat_hash_map<gpr_thd_id, size_t> thread_id_map;
-  for (const auto& bin : *events) {
-    size_t displayed_thread_id;
-    auto it = thread_id_map.find(bin->thd_id);
-    if (it == thread_id_map.end()) {
-      displayed_thread_id = thread_id_map.size() + 1;
-      thread_id_map[bin->thd_id] = displayed_thread_id;
-    } else {
-      displayed_thread_id = it->second;
-    }
-    for (const auto& event : *bin) {
-      if (event.timestamp_begin == event.timestamp_end) {
-        output->Mark(event.metadata->name, displayed_thread_id,
-                     event.timestamp_begin - earliest_timestamp);
-      } else if (event.timestamp_begin < 0 && event.timestamp_end > 0) {
-        output->FlowBegin(event.metadata->name, displayed_thread_id,
-                          event.timestamp_end - earliest_timestamp,
-                          -event.timestamp_begin);
-      } else if (event.timestamp_begin < 0) {
-        output->FlowEnd(event.metadata->name, displayed_thread_id,
-                        -event.timestamp_end - earliest_timestamp,
-                        -event.timestamp_begin);
-      } else {
-        output->Span(event.metadata->name, displayed_thread_id,
-                     event.timestamp_begin - earliest_timestamp,
-                     event.timestamp_end - event.timestamp_begin);
-      }
-    }
-  }
-  output->Finish();
+  WriteEvents(*events, output);
   LOG(INFO) << "Latent-see collection complete";
 }
 
@@ -23,9 +23,11 @@
 #include <cstdio>
 #include <cstdlib>
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
 #include "absl/strings/string_view.h"
 #include "absl/time/clock.h"
 #include "src/core/util/mpscq.h"
@@ -79,6 +81,37 @@ class JsonOutput final : public Output {
   const char* sep_ = "";
 };
 
+// Writes a binary Perfetto trace (a serialized perfetto.protos.Trace), which
+// ui.perfetto.dev and trace_processor load directly, and which is several
+// times smaller than the equivalent JSON.  Each thread becomes a track; spans
+// become slices, marks instant events, and flows link the events they begin
+// and end on.
+class PerfettoOutput final : public Output {
+ public:
+  explicit PerfettoOutput(std::ostream& out) : out_(out) {}
+
+  void Mark(absl::string_view name, int64_t tid, int64_t timestamp) override;
+  void FlowBegin(absl::string_view name, int64_t tid, int64_t timestamp,
+                 int64_t flow_id) override;
+  void FlowEnd(absl::string_view name, int64_t tid, int64_t timestamp,
+               int64_t flow_id) override;
+  void Span(absl::string_view name, int64_t tid, int64_t timestamp_begin,
+            int64_t duration) override;
+  void Finish() override;
+
+ private:
+  enum class EventType { kSliceBegin = 1, kSliceEnd = 2, kInstant = 3 };
+
+  void AddEvent(EventType type, absl::string_view name, int64_t tid,
+                int64_t timestamp, int64_t flow_id,
+                int64_t terminating_flow_id);
+  void AddPacket(int64_t timestamp, int field, const std::string& payload);
+
+  std::ostream& out_;
+  absl::flat_hash_set<int64_t> tracks_;
+  bool first_packet_ = true;
+};
+
 }  // namespace latent_see
 }  // namespace grpc_core
 
@@ -150,6 +183,91 @@ class Sink {
   size_t max_bins_ ABSL_GUARDED_BY(mu_);
 };
 
+// Always-on recording: while enabled, each thread writes its events into a
+// fixed-size ring, overwriting its oldest events, and Snapshot() reports
+// whatever the rings hold at that moment.  Unlike Collect() nothing is
+// allocated, queued or gathered per event, so the recorder can be left on in
+// production and a snapshot taken when something interesting happens (an
+// admin request, a slow RPC, ...).  bm_latent_see holds the per-event cost
+// to within a few nanoseconds of the disabled path.
+//
+// A running Collect() takes precedence: events go to the collection, and
+// the rings pick up again once it finishes.
+class FlightRecorder {
+ public:
+  static constexpr size_t kEventsPerThread = 1024;
+
+  // Enable() and Disable() calls nest; recording stops with the last
+  // Disable().
+  static void Enable();
+  static void Disable();
+
+  // Writes the events currently held by every thread's ring to `output`.
+  // Safe to call while the threads keep recording: events overwritten while
+  // being copied are dropped from the snapshot.
+  static void Snapshot(Output* output);
+
+ private:
+  friend class Appender;
+
+  struct Ring {
+    // A per-slot sequence lock: `sequence` is index + 1 of the event the
+    // slot holds, or 0 while it is being rewritten.
+    struct Slot {
+      std::atomic<uint64_t> sequence{0};
+      std::atomic<const Metadata*> metadata{nullptr};
+      std::atomic<int64_t> timestamp_begin{0};
+      std::atomic<int64_t> timestamp_end{0};
+    };
+
+    // Only the owning thread appends.
+    void Append(const Metadata* metadata, int64_t timestamp_begin,
+                int64_t timestamp_end) {
+      const uint64_t index = next_index.load(std::memory_order_relaxed);
+      Slot& slot = slots[index % kEventsPerThread];
+      slot.sequence.store(0, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      slot.metadata.store(metadata, std::memory_order_relaxed);
+      slot.timestamp_begin.store(timestamp_begin, std::memory_order_relaxed);
+      slot.timestamp_end.store(timestamp_end, std::memory_order_relaxed);
+      slot.sequence.store(index + 1, std::memory_order_release);
+      next_index.store(index + 1, std::memory_order_release);
+    }
+
+    std::atomic<uint64_t> next_index{0};
+    // Events before first_index belong to a thread that has since exited.
+    std::atomic<uint64_t> first_index{0};
+    std::atomic<gpr_thd_id> thd_id{0};
+    std::atomic<bool> in_use{true};
+    Ring* next = nullptr;
+    std::array<Slot, kEventsPerThread> slots;
+  };
+
+  // Hands the calling thread's ring back for reuse when the thread exits.
+  struct RingRef {
+    ~RingRef();
+    Ring* ring = nullptr;
+  };
+
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION static void Append(
+      const Metadata* metadata, int64_t timestamp_begin,
+      int64_t timestamp_end) {
+    Ring* ring = ring_.ring;
+    if (GPR_UNLIKELY(ring == nullptr)) ring = AttachRing();
+    ring->Append(metadata, timestamp_begin, timestamp_end);
+  }
+  static Ring* AttachRing();
+
+  // Installed in place of a Sink while only the flight recorder is on; it
+  // is compared against, never dereferenced.
+  static Sink* sink_tag() { return reinterpret_cast<Sink*>(&sink_tag_); }
+
+  static inline char sink_tag_ = 0;
+  static thread_local RingRef ring_;
+  // Every ring ever created; rings are reused but never freed.
+  static std::atomic<Ring*> rings_;
+};
+
 class Appender {
  public:
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION Appender()
@@ -166,6 +284,10 @@ class Appender {
               int64_t timestamp_end) {
     DCHECK(Enabled());
     DCHECK_NE(metadata, nullptr);
+    if (sink_ == FlightRecorder::sink_tag()) {
+      FlightRecorder::Append(metadata, timestamp_begin, timestamp_end);
+      return;
+    }
     if (GPR_UNLIKELY(bin_ == nullptr)) bin_ = std::make_unique<Bin>();
     if (GPR_UNLIKELY(bin_->Append(metadata, timestamp_begin, timestamp_end))) {
       sink_->Append(std::move(bin_));
@@ -173,11 +295,13 @@ class Appender {
   }
 
   void Flush() {
+    if (sink_ == FlightRecorder::sink_tag()) return;
     if (GPR_UNLIKELY(bin_ != nullptr)) sink_->Append(std::move(bin_));
   }
 
  private:
   friend void Collect(Notification*, absl::Duration, size_t, Output*);
+  friend class FlightRecorder;
 
   static void Enable(Sink* sink);
   static void Disable();
@@ -362,6 +486,13 @@ struct Scope {
 inline void Collect(Notification*, absl::Duration, size_t, Output* output) {
   output->Finish();
 }
+
+class FlightRecorder {
+ public:
+  static void Enable() {}
+  static void Disable() {}
+  static void Snapshot(Output* output) { output->Finish(); }
+};
 }  // namespace latent_see
 }  // namespace grpc_core
 #define GRPC_LATENT_SEE_METADATA(name) nullptr
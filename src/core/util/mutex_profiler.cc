@@ -0,0 +1,271 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/mutex_profiler.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <vector>
+
+#ifdef GRPC_MUTEX_PROFILING
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <string>
+#include <utility>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/hash/hash.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "src/core/util/debug_location.h"
+#include "src/core/util/latent_see.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/sync.h"
+#endif
+
+namespace grpc_core {
+
+#ifdef GRPC_MUTEX_PROFILING
+
+namespace {
+
+// Index counting the sites that didn't fit in the registry.
+constexpr size_t kOverflowSite = MutexProfiler::kMaxSites;
+
+// Maps acquisition sites to indices into the stats tables.  Slots are
+// claimed with a CAS on first report and never released, so lookups are
+// lock free.  Sites are keyed by file pointer; the same line reached from
+// several translation units (a lock in a header) may take several slots,
+// which TopContendedSites() merges.
+class SiteRegistry {
+ public:
+  size_t Find(const SourceLocation& site) {
+    const size_t start =
+        absl::HashOf(site.file(), site.line()) % MutexProfiler::kMaxSites;
+    for (size_t i = 0; i < MutexProfiler::kMaxSites; ++i) {
+      const size_t index = (start + i) % MutexProfiler::kMaxSites;
+      Slot& slot = slots_[index];
+      int state = slot.state.load(std::memory_order_acquire);
+      if (state == kEmpty &&
+          slot.state.compare_exchange_strong(state, kClaiming,
+                                             std::memory_order_acquire)) {
+        slot.file = site.file();
+        slot.line = site.line();
+        slot.name = absl::StrCat("mutex wait ", site.file(), ":", site.line());
+#ifndef GRPC_DISABLE_LATENT_SEE
+        slot.metadata = {slot.file, slot.line, slot.name};
+#endif
+        slot.state.store(kReady, std::memory_order_release);
+        return index;
+      }
+      // Another thread is filling this slot in; it will be done shortly.
+      while (state == kClaiming) {
+        state = slot.state.load(std::memory_order_acquire);
+      }
+      if (slot.file == site.file() && slot.line == site.line()) return index;
+    }
+    return kOverflowSite;
+  }
+
+  // Null file for unclaimed slots and the overflow index.
+  std::pair<const char*, int> Get(size_t index) const {
+    if (index == kOverflowSite ||
+        slots_[index].state.load(std::memory_order_acquire) != kReady) {
+      return {nullptr, 0};
+    }
+    return {slots_[index].file, slots_[index].line};
+  }
+
+#ifndef GRPC_DISABLE_LATENT_SEE
+  const latent_see::Metadata* Metadata(size_t index) const {
+    if (index == kOverflowSite) return &overflow_metadata_;
+    return &slots_[index].metadata;
+  }
+#endif
+
+ private:
+  enum : int { kEmpty, kClaiming, kReady };
+
+  struct Slot {
+    std::atomic<int> state{kEmpty};
+    // Written once while claiming.
+    const char* file = nullptr;
+    int line = 0;
+    std::string name;
+#ifndef GRPC_DISABLE_LATENT_SEE
+    latent_see::Metadata metadata;
+#endif
+  };
+
+  std::array<Slot, MutexProfiler::kMaxSites> slots_;
+#ifndef GRPC_DISABLE_LATENT_SEE
+  const latent_see::Metadata overflow_metadata_{__FILE__, __LINE__,
+                                                "mutex wait (other)"};
+#endif
+};
+
+struct SiteStats {
+  std::atomic<uint64_t> contentions{0};
+  std::atomic<int64_t> total_wait_ns{0};
+  std::atomic<int64_t> max_wait_ns{0};
+  std::atomic<uint64_t> hold_samples{0};
+  std::atomic<int64_t> total_sampled_hold_ns{0};
+};
+
+struct Shard {
+  std::array<SiteStats, MutexProfiler::kMaxSites + 1> sites;
+};
+
+// Set while a thread is recording, so that locks taken by the recording
+// itself (latent-see flushing a full bin to its sink) aren't recorded.
+thread_local bool g_recording = false;
+
+class Profiler final : public mutex_profiling::Profiler {
+ public:
+  void Contended(const SourceLocation& site, int64_t start_ns,
+                 int64_t wait_ns) override {
+    if (g_recording) return;
+    g_recording = true;
+    const size_t index = registry_.Find(site);
+    SiteStats& stats = shards_.this_cpu().sites[index];
+    stats.contentions.fetch_add(1, std::memory_order_relaxed);
+    stats.total_wait_ns.fetch_add(wait_ns, std::memory_order_relaxed);
+    int64_t max_wait = stats.max_wait_ns.load(std::memory_order_relaxed);
+    while (wait_ns > max_wait &&
+           !stats.max_wait_ns.compare_exchange_weak(
+               max_wait, wait_ns, std::memory_order_relaxed)) {
+    }
+#ifndef GRPC_DISABLE_LATENT_SEE
+    latent_see::Appender appender;
+    if (GPR_UNLIKELY(appender.Enabled())) {
+      appender.Append(registry_.Metadata(index), start_ns, start_ns + wait_ns);
+    }
+#endif
+    g_recording = false;
+  }
+
+  void Held(const SourceLocation& site, int64_t hold_ns) override {
+    if (g_recording) return;
+    g_recording = true;
+    SiteStats& stats = shards_.this_cpu().sites[registry_.Find(site)];
+    stats.hold_samples.fetch_add(1, std::memory_order_relaxed);
+    stats.total_sampled_hold_ns.fetch_add(hold_ns, std::memory_order_relaxed);
+    g_recording = false;
+  }
+
+  std::vector<MutexProfiler::Site> TopContendedSites(size_t max_sites) {
+    absl::flat_hash_map<std::pair<absl::string_view, int>, MutexProfiler::Site>
+        merged;
+    for (size_t index = 0; index <= MutexProfiler::kMaxSites; ++index) {
+      const auto [file, line] = registry_.Get(index);
+      if (file == nullptr && index != kOverflowSite) continue;
+      MutexProfiler::Site& site =
+          merged
+              .try_emplace(std::pair(file == nullptr ? "" : file, line),
+                           MutexProfiler::Site{file, line, 0, 0, 0, 0, 0})
+              .first->second;
+      for (const Shard& shard : shards_) {
+        const SiteStats& stats = shard.sites[index];
+        site.contentions += stats.contentions.load(std::memory_order_relaxed);
+        site.total_wait_ns +=
+            stats.total_wait_ns.load(std::memory_order_relaxed);
+        site.max_wait_ns =
+            std::max(site.max_wait_ns,
+                     stats.max_wait_ns.load(std::memory_order_relaxed));
+        site.hold_samples += stats.hold_samples.load(std::memory_order_relaxed);
+        site.total_sampled_hold_ns +=
+            stats.total_sampled_hold_ns.load(std::memory_order_relaxed);
+      }
+    }
+    std::vector<MutexProfiler::Site> sites;
+    for (auto& [key, site] : merged) {
+      if (site.contentions != 0) sites.push_back(site);
+    }
+    std::sort(sites.begin(), sites.end(), [](const auto& a, const auto& b) {
+      return a.total_wait_ns > b.total_wait_ns;
+    });
+    if (sites.size() > max_sites) sites.resize(max_sites);
+    return sites;
+  }
+
+  void Reset() {
+    for (Shard& shard : shards_) {
+      for (SiteStats& stats : shard.sites) {
+        stats.contentions.store(0, std::memory_order_relaxed);
+        stats.total_wait_ns.store(0, std::memory_order_relaxed);
+        stats.max_wait_ns.store(0, std::memory_order_relaxed);
+        stats.hold_samples.store(0, std::memory_order_relaxed);
+        stats.total_sampled_hold_ns.store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+
+ private:
+  SiteRegistry registry_;
+  PerCpu<Shard> shards_{PerCpuOptions().SetMaxShards(16)};
+};
+
+Profiler* GetProfiler() {
+  static NoDestruct<Profiler> profiler;
+  return profiler.get();
+}
+
+std::atomic<int> g_enable_count{0};
+
+}  // namespace
+
+bool MutexProfiler::Supported() { return true; }
+
+void MutexProfiler::Enable() {
+  if (g_enable_count.fetch_add(1, std::memory_order_acq_rel) == 0) {
+    mutex_profiling::g_profiler.store(GetProfiler(), std::memory_order_release);
+  }
+}
+
+void MutexProfiler::Disable() {
+  if (g_enable_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    mutex_profiling::g_profiler.store(nullptr, std::memory_order_release);
+  }
+}
+
+bool MutexProfiler::Enabled() {
+  return mutex_profiling::g_profiler.load(std::memory_order_acquire) !=
+         nullptr;
+}
+
+std::vector<MutexProfiler::Site> MutexProfiler::TopContendedSites(
+    size_t max_sites) {
+  return GetProfiler()->TopContendedSites(max_sites);
+}
+
+void MutexProfiler::Reset() { GetProfiler()->Reset(); }
+
+#else  // !GRPC_MUTEX_PROFILING
+
+bool MutexProfiler::Supported() { return false; }
+void MutexProfiler::Enable() {}
+void MutexProfiler::Disable() {}
+bool MutexProfiler::Enabled() { return false; }
+
+std::vector<MutexProfiler::Site> MutexProfiler::TopContendedSites(size_t) {
+  return {};
+}
+
+void MutexProfiler::Reset() {}
+
+#endif  // GRPC_MUTEX_PROFILING
+
+}  // namespace grpc_core
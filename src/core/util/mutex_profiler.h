@@ -0,0 +1,74 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_UTIL_MUTEX_PROFILER_H
+#define GRPC_SRC_CORE_UTIL_MUTEX_PROFILER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+namespace grpc_core {
+
+// Lock contention profiler for grpc_core::Mutex.
+//
+// Attributes time spent waiting for, and holding, mutexes to the source line
+// of the MutexLock or ReleasableMutexLock that acquired them.  Every
+// contended acquisition is recorded, along with one in every 64 hold times
+// per thread.  Statistics go to per-cpu tables of atomic counters, so
+// recording never takes a lock; while latent-see is collecting, each
+// contended wait is also logged there as a span named after its site.
+//
+// Requires building with --define=GRPC_MUTEX_PROFILING=1; in other builds
+// Supported() returns false and Enable() does nothing.
+class MutexProfiler {
+ public:
+  struct Site {
+    const char* file;
+    int line;
+    // Acquisitions that found the lock held, and their total and longest
+    // wait.
+    uint64_t contentions;
+    int64_t total_wait_ns;
+    int64_t max_wait_ns;
+    // Sampled hold times.  Includes time spent waiting on a CondVar while
+    // the lock is nominally held.
+    uint64_t hold_samples;
+    int64_t total_sampled_hold_ns;
+  };
+
+  // Distinct acquisition sites tracked; any beyond this are counted
+  // together under a site with a null file.
+  static constexpr size_t kMaxSites = 512;
+
+  static bool Supported();
+
+  // Enable() and Disable() calls nest; profiling stops with the last
+  // Disable().  Statistics are kept across Disable() until Reset().
+  static void Enable();
+  static void Disable();
+  static bool Enabled();
+
+  // Returns up to `max_sites` sites with contended acquisitions, most total
+  // wait first.
+  static std::vector<Site> TopContendedSites(size_t max_sites);
+
+  // Clears all statistics.  Counts racing with Reset() may be kept or lost.
+  static void Reset();
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_UTIL_MUTEX_PROFILER_H
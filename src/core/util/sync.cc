@@ -24,6 +24,7 @@
 #include <grpc/support/sync.h>
 
 #include "absl/log/check.h"
+#include "src/core/util/sync.h"
 
 // Number of mutexes to allocate for events, to avoid lock contention.
 // Should be a prime.
@@ -121,3 +122,23 @@ intptr_t gpr_stats_read(const gpr_stats_counter* c) {
   // don't need acquire-load, but we have no no-barrier load yet
   return gpr_atm_acq_load(&c->value);
 }
+
+#ifdef GRPC_MUTEX_PROFILING
+namespace grpc_core {
+namespace mutex_profiling {
+
+std::atomic<Profiler*> g_profiler{nullptr};
+
+bool ShouldSampleHold() {
+  static thread_local uint32_t countdown = 0;
+  if (countdown != 0) {
+    --countdown;
+    return false;
+  }
+  countdown = kHoldSampleInterval - 1;
+  return true;
+}
+
+}  // namespace mutex_profiling
+}  // namespace grpc_core
+#endif  // GRPC_MUTEX_PROFILING
@@ -30,6 +30,15 @@
 #include "src/core/util/time_util.h"
 #endif
 
+#ifdef GRPC_MUTEX_PROFILING
+#include <stdint.h>
+
+#include <atomic>
+
+#include "absl/time/clock.h"
+#include "src/core/util/debug_location.h"
+#endif
+
 // The core library is not accessible in C++ codegen headers, and vice versa.
 // Thus, we need to have duplicate headers with similar functionality.
 // Make sure any change to this file is also reflected in
@@ -44,8 +53,10 @@ namespace grpc_core {
 #ifdef GPR_ABSEIL_SYNC
 
 using Mutex = absl::Mutex;
+#ifndef GRPC_MUTEX_PROFILING
 using MutexLock = absl::MutexLock;
 using ReleasableMutexLock = absl::ReleasableMutexLock;
+#endif
 using CondVar = absl::CondVar;
 
 // Returns the underlying gpr_mu from Mutex. This should be used only when
@@ -84,6 +95,7 @@ class ABSL_LOCKABLE Mutex {
 // TODO(veblush): Remove this after C-core no longer uses gpr_mu.
 inline gpr_mu* GetUnderlyingGprMu(Mutex* mutex) { return &mutex->mu_; }
 
+#ifndef GRPC_MUTEX_PROFILING
 class ABSL_SCOPED_LOCKABLE MutexLock {
  public:
   explicit MutexLock(Mutex* mu) ABSL_EXCLUSIVE_LOCK_FUNCTION(mu) : mu_(mu) {
@@ -121,6 +133,7 @@ class ABSL_SCOPED_LOCKABLE ReleasableMutexLock {
   Mutex* const mu_;
   bool released_ = false;
 };
+#endif  // !GRPC_MUTEX_PROFILING
 
 class CondVar {
  public:
@@ -147,6 +160,118 @@ class CondVar {
 
 #endif  // GPR_ABSEIL_SYNC
 
+#ifdef GRPC_MUTEX_PROFILING
+// Built with --define=GRPC_MUTEX_PROFILING=1, MutexLock and
+// ReleasableMutexLock record the source line they were constructed at, and
+// report how long they waited for and held the lock to a profiler installed
+// at runtime (see src/core/util/mutex_profiler.h).  With no profiler installed
+// each acquisition costs one extra atomic load.
+namespace mutex_profiling {
+
+class Profiler {
+ public:
+  virtual ~Profiler() = default;
+  // An acquisition at `site` found the lock held and waited `wait_ns` for it.
+  // `start_ns` is when the wait began.
+  virtual void Contended(const SourceLocation& site, int64_t start_ns,
+                         int64_t wait_ns) = 0;
+  // A sampled acquisition at `site` held the lock for `hold_ns`.
+  virtual void Held(const SourceLocation& site, int64_t hold_ns) = 0;
+};
+
+// Installed profiler, or null.  Profilers are never destroyed once
+// installed, since locks may still be reporting to one after it is removed.
+extern std::atomic<Profiler*> g_profiler;
+
+// Returns true for one in every kHoldSampleInterval calls on each thread.
+bool ShouldSampleHold();
+inline constexpr uint32_t kHoldSampleInterval = 64;
+
+class LockTimer {
+ public:
+  void Lock(Mutex* mu, const SourceLocation& site)
+      ABSL_EXCLUSIVE_LOCK_FUNCTION(mu) ABSL_NO_THREAD_SAFETY_ANALYSIS {
+    profiler_ = g_profiler.load(std::memory_order_acquire);
+    if (GPR_LIKELY(profiler_ == nullptr)) {
+      mu->Lock();
+      return;
+    }
+    site_ = site;
+    if (!mu->TryLock()) {
+      const int64_t start = absl::GetCurrentTimeNanos();
+      mu->Lock();
+      profiler_->Contended(site_, start, absl::GetCurrentTimeNanos() - start);
+    }
+    if (ShouldSampleHold()) {
+      acquired_ns_ = absl::GetCurrentTimeNanos();
+    } else {
+      profiler_ = nullptr;
+    }
+  }
+
+  void Unlock(Mutex* mu) ABSL_UNLOCK_FUNCTION(mu)
+      ABSL_NO_THREAD_SAFETY_ANALYSIS {
+    if (GPR_LIKELY(profiler_ == nullptr)) {
+      mu->Unlock();
+      return;
+    }
+    const int64_t hold_ns = absl::GetCurrentTimeNanos() - acquired_ns_;
+    mu->Unlock();
+    profiler_->Held(site_, hold_ns);
+  }
+
+ private:
+  Profiler* profiler_;
+  SourceLocation site_;
+  int64_t acquired_ns_;
+};
+
+}  // namespace mutex_profiling
+
+class ABSL_SCOPED_LOCKABLE MutexLock {
+ public:
+  explicit MutexLock(Mutex* mu, SourceLocation site = {})
+      ABSL_EXCLUSIVE_LOCK_FUNCTION(mu)
+      : mu_(mu) {
+    timer_.Lock(mu_, site);
+  }
+  ~MutexLock() ABSL_UNLOCK_FUNCTION() { timer_.Unlock(mu_); }
+
+  MutexLock(const MutexLock&) = delete;
+  MutexLock& operator=(const MutexLock&) = delete;
+
+ private:
+  Mutex* const mu_;
+  mutex_profiling::LockTimer timer_;
+};
+
+class ABSL_SCOPED_LOCKABLE ReleasableMutexLock {
+ public:
+  explicit ReleasableMutexLock(Mutex* mu, SourceLocation site = {})
+      ABSL_EXCLUSIVE_LOCK_FUNCTION(mu)
+      : mu_(mu) {
+    timer_.Lock(mu_, site);
+  }
+  ~ReleasableMutexLock() ABSL_UNLOCK_FUNCTION() {
+    if (!released_) timer_.Unlock(mu_);
+  }
+
+  ReleasableMutexLock(const ReleasableMutexLock&) = delete;
+  ReleasableMutexLock& operator=(const ReleasableMutexLock&) = delete;
+
+  void Release() ABSL_UNLOCK_FUNCTION() {
+    DCHECK(!released_);
+    released_ = true;
+    timer_.Unlock(mu_);
+  }
+
+ private:
+  Mutex* const mu_;
+  mutex_profiling::LockTimer timer_;
+  bool released_ = false;
+};
+#endif  // GRPC_MUTEX_PROFILING
+
 // Deprecated. Prefer MutexLock
 class MutexLockForGprMu {
  public:
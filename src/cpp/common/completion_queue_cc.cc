@@ -26,6 +26,7 @@
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/container/inlined_vector.h"
 #include "absl/log/log.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/util/crash.h"
@@ -163,6 +164,43 @@ CompletionQueue::NextStatus CompletionQueue::AsyncNextInternal(
   }
 }
 
+CompletionQueue::NextStatus CompletionQueue::AsyncNextBatchInternal(
+    void** tags, bool* oks, size_t max_events, size_t* num_events,
+    gpr_timespec deadline) {
+  GRPC_CHECK_GT(max_events, 0u);
+  absl::InlinedVector<grpc_event, 32> events(max_events);
+  for (;;) {
+    size_t n = grpc_completion_queue_next_batch(cq_, events.data(), max_events,
+                                                deadline, nullptr);
+    switch (events[0].type) {
+      case GRPC_QUEUE_TIMEOUT:
+        return TIMEOUT;
+      case GRPC_QUEUE_SHUTDOWN:
+        return SHUTDOWN;
+      case GRPC_OP_COMPLETE:
+        break;
+    }
+    // Internal tags may swallow their events; only report the ones that
+    // surface to the application, and go back for more if none did.
+    size_t got = 0;
+    for (size_t i = 0; i < n; ++i) {
+      auto core_cq_tag =
+          static_cast<grpc::internal::CompletionQueueTag*>(events[i].tag);
+      void* tag = core_cq_tag;
+      bool ok = events[i].success != 0;
+      if (core_cq_tag->FinalizeResult(&tag, &ok)) {
+        tags[got] = tag;
+        oks[got] = ok;
+        ++got;
+      }
+    }
+    if (got > 0) {
+      *num_events = got;
+      return GOT_EVENT;
+    }
+  }
+}
+
 CompletionQueue::CompletionQueueTLSCache::CompletionQueueTLSCache(
     CompletionQueue* cq)
     : cq_(cq), flushed_(false) {
@@ -25,6 +25,7 @@
 #include <optional>
 #include <utility>
 
+#include "absl/container/inlined_vector.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/span.h"
 #include "opentelemetry/common/attribute_value.h"
@@ -155,6 +156,60 @@ class OpenTelemetryPluginImpl::KeyValueIterable
   const OpenTelemetryPluginImpl* otel_plugin_;
 };
 
+// Walks another KeyValueIterable once, on first use, and replays the result.
+// Used when a set of attributes is recorded to several instruments, since
+// walking a KeyValueIterable above runs the labels injectors again, and the
+// SDK walks the attributes of every measurement.  Not thread safe.  The
+// source and its attributes must outlive this object.
+//
+// Attribute sets are not interned per (channel, method): the method, target
+// and status values already point into the call's path, the channel's scope
+// config and a static table, and the injected and optional labels can differ
+// from call to call.  The SDK also copies the attributes of each measurement
+// into its own map, so an interned set would not save that work.
+class ResolvedKeyValueIterable final
+    : public opentelemetry::common::KeyValueIterable {
+ public:
+  explicit ResolvedKeyValueIterable(
+      const opentelemetry::common::KeyValueIterable& source)
+      : source_(source) {}
+
+  bool ForEachKeyValue(opentelemetry::nostd::function_ref<
+                       bool(opentelemetry::nostd::string_view,
+                            opentelemetry::common::AttributeValue)>
+                           callback) const noexcept override {
+    for (const auto& [key, value] : Resolve()) {
+      if (!callback(key, value)) return false;
+    }
+    return true;
+  }
+
+  size_t size() const noexcept override { return Resolve().size(); }
+
+ private:
+  using Attributes = absl::InlinedVector<
+      std::pair<opentelemetry::nostd::string_view,
+                opentelemetry::common::AttributeValue>,
+      8>;
+
+  const Attributes& Resolve() const {
+    if (!resolved_) {
+      resolved_ = true;
+      source_.ForEachKeyValue(
+          [this](opentelemetry::nostd::string_view key,
+                 opentelemetry::common::AttributeValue value) {
+            attributes_.emplace_back(key, value);
+            return true;
+          });
+    }
+    return attributes_;
+  }
+
+  const opentelemetry::common::KeyValueIterable& source_;
+  mutable bool resolved_ = false;
+  mutable Attributes attributes_;
+};
+
 }  // namespace internal
 }  // namespace grpc
 
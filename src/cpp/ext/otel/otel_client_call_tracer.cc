@@ -97,6 +97,9 @@ class OpenTelemetryPluginImpl::ClientCallTracerInterface::CallAttemptTracer<
   void RecordEvent(grpc_event_engine::experimental::internal::WriteEvent type,
                    absl::Time time, size_t byte_offset,
                    const std::vector<TcpEventMetric>& metrics) override {
+    // Formatting the annotation costs more than the rest of the event; skip
+    // it when the span would drop it anyway.
+    if (!call_attempt_tracer_->span_->IsRecording()) return;
     call_attempt_tracer_->RecordAnnotation(
         absl::StrCat(
             "TCP: ", grpc_event_engine::experimental::WriteEventToString(type),
@@ -286,10 +289,13 @@ void OpenTelemetryPluginImpl::ClientCallTracerInterface::
            {OpenTelemetryStatusKey(),
             grpc_status_code_to_string(
                 static_cast<grpc_status_code>(status.code()))}}};
-  KeyValueIterable labels(
+  KeyValueIterable unresolved_labels(
       injected_labels_from_plugin_options_, additional_labels,
       &parent_->scope_config_->active_plugin_options_view(), optional_labels_,
       /*is_client=*/true, parent_->otel_plugin_);
+  // The same attributes go to up to three instruments, so run the labels
+  // injectors once.
+  ResolvedKeyValueIterable labels(unresolved_labels);
   if (parent_->otel_plugin_->client_.attempt.duration != nullptr) {
     parent_->otel_plugin_->client_.attempt.duration->Record(
         absl::ToDoubleSeconds(absl::Now() - start_time_), labels,
@@ -425,7 +431,8 @@ OpenTelemetryPluginImpl::ClientCallTracerInterface::ClientCallTracerInterface(
       arena_(arena),
       registered_method_(registered_method),
       otel_plugin_(otel_plugin),
-      scope_config_(std::move(scope_config)) {
+      scope_config_(std::move(scope_config)),
+      method_for_stats_(ComputeMethodForStats()) {
   if (otel_plugin_->tracer_ != nullptr) {
     opentelemetry::trace::StartSpanOptions options;
     // Get the parent span from the parent call if available, otherwise fall
@@ -520,7 +527,8 @@ OpenTelemetryPluginImpl::ClientCallTracerInterface::StartNewAttempt(
 }
 
 absl::string_view
-OpenTelemetryPluginImpl::ClientCallTracerInterface::MethodForStats() const {
+OpenTelemetryPluginImpl::ClientCallTracerInterface::ComputeMethodForStats()
+    const {
   absl::string_view method = absl::StripPrefix(path_.as_string_view(), "/");
   if (registered_method_ ||
       (otel_plugin_->generic_method_attribute_filter() != nullptr &&
@@ -150,7 +150,8 @@ class OpenTelemetryPluginImpl::ClientCallTracerInterface
   void RecordAnnotation(const Annotation& /*annotation*/) override;
 
  private:
-  absl::string_view MethodForStats() const;
+  absl::string_view MethodForStats() const { return method_for_stats_; }
+  absl::string_view ComputeMethodForStats() const;
 
   // Client method.
   grpc_core::Slice path_;
@@ -158,6 +159,10 @@ class OpenTelemetryPluginImpl::ClientCallTracerInterface
   const bool registered_method_;
   OpenTelemetryPluginImpl* otel_plugin_;
   std::shared_ptr<OpenTelemetryPluginImpl::ClientScopeConfig> scope_config_;
+  // Computed once per call, since the generic method attribute filter is
+  // application code of unknown cost and every attempt records the method.
+  // Points into path_.
+  const absl::string_view method_for_stats_;
   // TODO(ctiller@): When refactoring the tracer code, consider the possibility
   // of removing this mutex. More discussion in
   // https://github.com/grpc/grpc/pull/39195/files#r2191231973.
@@ -79,6 +79,9 @@ class OpenTelemetryPluginImpl::ServerCallTracerInterface::TcpCallTracer
   void RecordEvent(grpc_event_engine::experimental::internal::WriteEvent type,
                    absl::Time time, size_t byte_offset,
                    const std::vector<TcpEventMetric>& metrics) override {
+    // Formatting the annotation costs more than the rest of the event; skip
+    // it when the span would drop it anyway.
+    if (!server_call_tracer_->span_->IsRecording()) return;
     server_call_tracer_->RecordAnnotation(
         absl::StrCat(
             "TCP: ", grpc_event_engine::experimental::WriteEventToString(type),
@@ -127,6 +130,7 @@ void OpenTelemetryPluginImpl::ServerCallTracerInterface::
   registered_method_ =
       recv_initial_metadata->get(grpc_core::GrpcRegisteredMethod())
           .value_or(nullptr) != nullptr;
+  method_for_stats_ = ComputeMethodForStats();
   std::array<std::pair<absl::string_view, absl::string_view>, 1>
       additional_labels = {{{OpenTelemetryMethodKey(), MethodForStats()}}};
   if (otel_plugin_->server_.call.started != nullptr) {
@@ -260,10 +264,13 @@ void OpenTelemetryPluginImpl::ServerCallTracerInterface::RecordEnd(
            {OpenTelemetryStatusKey(),
             grpc_status_code_to_string(final_info->final_status)}}};
   // Currently we do not have any optional labels on the server side.
-  KeyValueIterable labels(
+  KeyValueIterable unresolved_labels(
       injected_labels_from_plugin_options_, additional_labels,
       /*active_plugin_options_view=*/nullptr, /*optional_labels=*/{},
       /*is_client=*/false, otel_plugin_);
+  // The same attributes go to up to three instruments, so run the labels
+  // injectors once.
+  ResolvedKeyValueIterable labels(unresolved_labels);
   if (otel_plugin_->server_.call.duration != nullptr) {
     otel_plugin_->server_.call.duration->Record(
         absl::ToDoubleSeconds(elapsed_time_), labels,
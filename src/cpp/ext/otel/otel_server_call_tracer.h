@@ -98,7 +98,9 @@ class OpenTelemetryPluginImpl::ServerCallTracerInterface
  private:
   class TcpCallTracer;
 
-  absl::string_view MethodForStats() const {
+  absl::string_view MethodForStats() const { return method_for_stats_; }
+
+  absl::string_view ComputeMethodForStats() const {
     absl::string_view method = absl::StripPrefix(path_.as_string_view(), "/");
     if (registered_method_ ||
         (otel_plugin_->generic_method_attribute_filter() != nullptr &&
@@ -111,7 +113,10 @@ class OpenTelemetryPluginImpl::ServerCallTracerInterface
   absl::Time start_time_;
   absl::Duration elapsed_time_;
   grpc_core::Slice path_;
-  bool registered_method_;
+  bool registered_method_ = false;
+  // Set with path_, since the generic method attribute filter is application
+  // code of unknown cost.  Points into path_.
+  absl::string_view method_for_stats_ = "other";
   std::vector<std::unique_ptr<LabelsIterable>>
       injected_labels_from_plugin_options_;
   OpenTelemetryPluginImpl* const otel_plugin_;
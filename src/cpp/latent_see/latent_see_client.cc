@@ -20,16 +20,10 @@
 
 namespace grpc {
 
-Status FetchLatentSee(channelz::v2::LatentSee::Stub* stub, double sample_time,
-                      grpc_core::latent_see::Output* output) {
-  channelz::v2::GetTraceRequest request;
-  request.set_sample_time(sample_time);
-  ClientContext context;
-  context.set_deadline(
-      std::chrono::system_clock::now() +
-      std::chrono::duration_cast<std::chrono::system_clock::duration>(
-          sample_time * std::chrono::seconds(1) + std::chrono::seconds(30)));
-  auto reader = stub->GetTrace(&context, request);
+namespace {
+
+Status ReadTrace(ClientReader<channelz::v2::LatentSeeTrace>* reader,
+                 grpc_core::latent_see::Output* output) {
   channelz::v2::LatentSeeTrace trace;
   while (reader->Read(&trace)) {
     switch (trace.kind_case()) {
@@ -56,4 +50,30 @@ Status FetchLatentSee(channelz::v2::LatentSee::Stub* stub, double sample_time,
   return reader->Finish();
 }
 
+}  // namespace
+
+Status FetchLatentSee(channelz::v2::LatentSee::Stub* stub, double sample_time,
+                      grpc_core::latent_see::Output* output) {
+  channelz::v2::GetTraceRequest request;
+  request.set_sample_time(sample_time);
+  ClientContext context;
+  context.set_deadline(
+      std::chrono::system_clock::now() +
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(
+          sample_time * std::chrono::seconds(1) + std::chrono::seconds(30)));
+  return ReadTrace(stub->GetTrace(&context, request).get(), output);
+}
+
+Status FetchLatentSeeFlightRecording(channelz::v2::LatentSee::Stub* stub,
+                                     grpc_core::latent_see::Output* output) {
+  ClientContext context;
+  context.set_deadline(std::chrono::system_clock::now() +
+                       std::chrono::seconds(30));
+  return ReadTrace(
+      stub->GetFlightRecording(&context,
+                               channelz::v2::GetFlightRecordingRequest())
+          .get(),
+      output);
+}
+
 }  // namespace grpc
@@ -22,6 +22,11 @@ namespace grpc {
 
 Status FetchLatentSee(channelz::v2::LatentSee::Stub* stub, double sample_time,
                       grpc_core::latent_see::Output* output);
+
+// Fetches the server's flight recorder contents.  Pass a
+// grpc_core::latent_see::PerfettoOutput to get a Perfetto trace.
+Status FetchLatentSeeFlightRecording(channelz::v2::LatentSee::Stub* stub,
+                                     grpc_core::latent_see::Output* output);
 }
 
 #endif  // GRPC_SRC_CPP_LATENT_SEE_LATENT_SEE_CLIENT_H
@@ -68,6 +68,17 @@ class StreamingOutput final : public grpc_core::latent_see::Output {
 
 }  // namespace
 
+LatentSeeService::LatentSeeService(const Options& options)
+    : options_(options) {
+  if (options_.flight_recorder) grpc_core::latent_see::FlightRecorder::Enable();
+}
+
+LatentSeeService::~LatentSeeService() {
+  if (options_.flight_recorder) {
+    grpc_core::latent_see::FlightRecorder::Disable();
+  }
+}
+
 Status LatentSeeService::GetTrace(
     ServerContext*, const channelz::v2::GetTraceRequest* request,
     ServerWriter<channelz::v2::LatentSeeTrace>* response) {
@@ -79,4 +90,16 @@ Status LatentSeeService::GetTrace(
   return Status::OK;
 }
 
+Status LatentSeeService::GetFlightRecording(
+    ServerContext*, const channelz::v2::GetFlightRecordingRequest*,
+    ServerWriter<channelz::v2::LatentSeeTrace>* response) {
+  if (!options_.flight_recorder) {
+    return Status(StatusCode::FAILED_PRECONDITION,
+                  "latent-see flight recorder is not enabled");
+  }
+  StreamingOutput output(response);
+  grpc_core::latent_see::FlightRecorder::Snapshot(&output);
+  return Status::OK;
+}
+
 }  // namespace grpc
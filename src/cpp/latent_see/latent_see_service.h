@@ -24,6 +24,9 @@ class LatentSeeService final : public channelz::v2::LatentSee::Service {
   struct Options {
     double max_query_time = 1.0;
     size_t max_memory = 1024 * 1024;
+    // Keep the latent-see flight recorder on for the lifetime of the
+    // service, so that GetFlightRecording can report recent events.
+    bool flight_recorder = false;
 
     Options& set_max_query_time(double max_query_time) {
       this->max_query_time = max_query_time;
@@ -33,13 +36,21 @@ class LatentSeeService final : public channelz::v2::LatentSee::Service {
       this->max_memory = max_memory;
       return *this;
     }
+    Options& set_flight_recorder(bool flight_recorder) {
+      this->flight_recorder = flight_recorder;
+      return *this;
+    }
   };
 
-  explicit LatentSeeService(const Options& options) : options_(options) {}
+  explicit LatentSeeService(const Options& options);
+  ~LatentSeeService() override;
 
   Status GetTrace(
       ServerContext*, const channelz::v2::GetTraceRequest* request,
       ServerWriter<channelz::v2::LatentSeeTrace>* response) override;
+  Status GetFlightRecording(
+      ServerContext*, const channelz::v2::GetFlightRecordingRequest* request,
+      ServerWriter<channelz::v2::LatentSeeTrace>* response) override;
 
  private:
   Options options_;
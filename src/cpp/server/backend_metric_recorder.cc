@@ -28,6 +28,7 @@
 
 #include "absl/log/log.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/resource_tracker/resource_tracker.h"
 #include "src/core/load_balancing/backend_metric_data.h"
 
 using grpc_core::BackendMetricData;
@@ -196,6 +197,13 @@ void ServerMetricRecorder::ClearNamedUtilization(string_ref name) {
   });
 }
 
+void ServerMetricRecorder::SetContainerUtilizationFallback(bool enabled) {
+  container_utilization_fallback_.store(enabled, std::memory_order_relaxed);
+  GRPC_TRACE_LOG(backend_metric, INFO)
+      << "[" << this << "] Container utilization fallback "
+      << (enabled ? "enabled." : "disabled.");
+}
+
 grpc_core::BackendMetricData ServerMetricRecorder::GetMetrics() const {
   auto result = GetMetricsIfChanged();
   return result->data;
@@ -365,6 +373,11 @@ BackendMetricData BackendMetricState::GetBackendMetricData() {
       data.named_metrics[r.first] = r.second;
     }
   }
+  if (server_metric_recorder_ != nullptr &&
+      server_metric_recorder_->container_utilization_fallback_.load(
+          std::memory_order_relaxed)) {
+    FillUtilizationFromResourceTracker(&data);
+  }
   GRPC_TRACE_LOG(backend_metric, INFO)
       << "[" << this
       << "] Backend metric data returned: cpu:" << data.cpu_utilization
@@ -375,4 +388,26 @@ BackendMetricData BackendMetricState::GetBackendMetricData() {
   return data;
 }
 
+bool FillUtilizationFromResourceTracker(BackendMetricData* data) {
+  grpc_core::ResourceTracker* tracker = grpc_core::ResourceTracker::Get();
+  if (tracker == nullptr) return false;
+  bool filled = false;
+  if (!IsUtilizationWithSoftLimitsValid(data->cpu_utilization)) {
+    auto cpu = tracker->GetMetricValue(grpc_core::ResourceTracker::kCpuMetric);
+    if (cpu.ok() && IsUtilizationWithSoftLimitsValid(*cpu)) {
+      data->cpu_utilization = *cpu;
+      filled = true;
+    }
+  }
+  if (!IsUtilizationValid(data->mem_utilization)) {
+    auto mem =
+        tracker->GetMetricValue(grpc_core::ResourceTracker::kMemoryMetric);
+    if (mem.ok() && IsUtilizationValid(*mem)) {
+      data->mem_utilization = *mem;
+      filled = true;
+    }
+  }
+  return filled;
+}
+
 }  // namespace grpc
@@ -82,6 +82,12 @@ class BackendMetricState : public grpc_core::BackendMetricProvider,
   std::map<absl::string_view, double> named_metrics_ ABSL_GUARDED_BY(mu_);
 };
 
+// Fills in the CPU and memory utilization the application has not set in
+// \a data from the process's ResourceTracker, if one is installed.  Returns
+// true if any value was filled in.  Only used for recorders that enabled
+// ServerMetricRecorder::SetContainerUtilizationFallback().
+bool FillUtilizationFromResourceTracker(grpc_core::BackendMetricData* data);
+
 }  // namespace grpc
 
 #endif  // GRPC_SRC_CPP_SERVER_BACKEND_METRIC_RECORDER_H
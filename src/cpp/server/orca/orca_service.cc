@@ -189,9 +189,15 @@ Slice OrcaService::GetOrCreateSerializedResponse() {
   grpc::internal::MutexLock lock(&mu_);
   std::shared_ptr<const ServerMetricRecorder::BackendMetricDataState> result =
       server_metric_recorder_->GetMetricsIfChanged();
-  if (!response_slice_seq_.has_value() ||
+  // Utilization taken from the ResourceTracker changes without bumping the
+  // sequence number, so a response that includes it is never reused.
+  grpc_core::BackendMetricData data = result->data;
+  const bool from_tracker =
+      server_metric_recorder_->container_utilization_fallback_.load(
+          std::memory_order_relaxed) &&
+      FillUtilizationFromResourceTracker(&data);
+  if (from_tracker || !response_slice_seq_.has_value() ||
       *response_slice_seq_ != result->sequence_number) {
-    const auto& data = result->data;
     upb::Arena arena;
     xds_data_orca_v3_OrcaLoadReport* response =
         xds_data_orca_v3_OrcaLoadReport_new(arena.ptr());
@@ -223,7 +229,11 @@ Slice OrcaService::GetOrCreateSerializedResponse() {
     char* buf = xds_data_orca_v3_OrcaLoadReport_serialize(response, arena.ptr(),
                                                           &buf_length);
     response_slice_.emplace(buf, buf_length);
-    response_slice_seq_ = result->sequence_number;
+    if (from_tracker) {
+      response_slice_seq_.reset();
+    } else {
+      response_slice_seq_ = result->sequence_number;
+    }
   }
   return Slice(*response_slice_);
 }
@@ -21,6 +21,7 @@
 #include <grpc/impl/compression_types.h>
 #include <grpc/support/port_platform.h>
 #include <grpc/support/sync.h>
+#include <grpc/slice.h>
 #include <grpc/support/workaround_list.h>
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/impl/server_builder_option.h>
@@ -39,15 +40,23 @@
 #include <string.h>
 
 #include <algorithm>
+#include <chrono>
+#include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "absl/log/log.h"
+#include "absl/strings/string_view.h"
 #include "src/core/ext/transport/chttp2/server/chttp2_server.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/transport/message_buffer_allocator.h"
 #include "src/core/server/server.h"
 #include "src/core/util/grpc_check.h"
+#include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/string.h"
 #include "src/core/util/useful.h"
 #include "src/cpp/server/external_connection_acceptor_impl.h"
@@ -55,6 +64,46 @@
 namespace grpc {
 namespace {
 
+// Routes the transport's requests for message buffers to the allocator
+// registered for the call's method.
+class MethodMessageBufferAllocator final
+    : public grpc_core::MessageBufferAllocator {
+ public:
+  using AllocatorMap =
+      std::map<std::string,
+               std::shared_ptr<experimental::MessageBufferAllocator>,
+               std::less<>>;
+
+  explicit MethodMessageBufferAllocator(AllocatorMap allocators)
+      : allocators_(std::move(allocators)) {}
+
+  grpc_core::MutableSlice Allocate(absl::string_view method,
+                                   size_t length) override {
+    auto it = allocators_.find(method);
+    if (it == allocators_.end()) return grpc_core::MutableSlice();
+    void* buffer = it->second->Allocate(length);
+    if (buffer == nullptr) return grpc_core::MutableSlice();
+    return grpc_core::MutableSlice(grpc_slice_new_with_user_data(
+        buffer, length, ReleaseBuffer,
+        new Buffer{it->second, buffer, length}));
+  }
+
+ private:
+  struct Buffer {
+    std::shared_ptr<experimental::MessageBufferAllocator> allocator;
+    void* data;
+    size_t length;
+  };
+
+  static void ReleaseBuffer(void* arg) {
+    auto* buffer = static_cast<Buffer*>(arg);
+    buffer->allocator->Release(buffer->data, buffer->length);
+    delete buffer;
+  }
+
+  const AllocatorMap allocators_;
+};
+
 // A PIMPL wrapper class that owns the only ref to the passive listener
 // implementation. This is returned to the application.
 class PassiveListenerOwner final
@@ -77,6 +126,19 @@ class PassiveListenerOwner final
   std::shared_ptr<PassiveListener> listener_;
 };
 
+bool SyncHandlersOnEventEngine(const ChannelArguments& args) {
+  grpc_channel_args channel_args;
+  args.SetChannelArgs(&channel_args);
+  for (size_t i = 0; i < channel_args.num_args; i++) {
+    if (0 == strcmp(channel_args.args[i].key,
+                    GRPC_ARG_SERVER_SYNC_HANDLERS_ON_EVENT_ENGINE) &&
+        channel_args.args[i].type == GRPC_ARG_INTEGER) {
+      return channel_args.args[i].value.integer != 0;
+    }
+  }
+  return false;
+}
+
 }  // namespace
 
 static std::vector<std::unique_ptr<ServerBuilderPlugin> (*)()>*
@@ -190,6 +252,19 @@ void ServerBuilder::experimental_type::EnableCallMetricRecording(
   builder_->server_metric_recorder_ = server_metric_recorder;
 }
 
+void ServerBuilder::experimental_type::EnableInlineCallbackHandler(
+    const std::string& method_name, std::chrono::nanoseconds budget) {
+  GRPC_CHECK_GT(budget.count(), 0);
+  builder_->inline_callback_handlers_[method_name] = budget;
+}
+
+void ServerBuilder::experimental_type::SetMessageBufferAllocator(
+    const std::string& method_name,
+    std::shared_ptr<experimental::MessageBufferAllocator> allocator) {
+  GRPC_CHECK(allocator != nullptr);
+  builder_->message_buffer_allocators_[method_name] = std::move(allocator);
+}
+
 ServerBuilder& ServerBuilder::SetOption(
     std::unique_ptr<ServerBuilderOption> option) {
   options_.push_back(std::move(option));
@@ -311,6 +386,16 @@ ChannelArguments ServerBuilder::BuildChannelArgs() {
                               authorization_provider_->c_provider(),
                               grpc_authorization_policy_provider_arg_vtable());
   }
+  if (!message_buffer_allocators_.empty()) {
+    grpc_core::RefCountedPtr<grpc_core::MessageBufferAllocator> allocator =
+        grpc_core::MakeRefCounted<MethodMessageBufferAllocator>(
+            message_buffer_allocators_);
+    args.SetPointerWithVtable(
+        std::string(grpc_core::MessageBufferAllocator::ChannelArgName()),
+        allocator.get(),
+        grpc_core::ChannelArgTypeTraits<
+            grpc_core::MessageBufferAllocator>::VTable());
+  }
   return args;
 }
 
@@ -369,9 +454,15 @@ std::unique_ptr<grpc::Server> ServerBuilder::BuildAndStart() {
     has_frequently_polled_cqs = true;
   }
 
+  // Sync methods whose handlers run on the EventEngine are matched on the
+  // callback CQ, and need no sync server CQs or threads of their own.
+  const bool sync_handlers_on_event_engine =
+      has_sync_methods && SyncHandlersOnEventEngine(args);
+  if (sync_handlers_on_event_engine) has_frequently_polled_cqs = true;
+
   const bool is_hybrid_server = has_sync_methods && has_frequently_polled_cqs;
 
-  if (has_sync_methods) {
+  if (has_sync_methods && !sync_handlers_on_event_engine) {
     grpc_cq_polling_type polling_type =
         is_hybrid_server ? GRPC_CQ_NON_POLLING : GRPC_CQ_DEFAULT_POLLING;
 
@@ -385,7 +476,9 @@ std::unique_ptr<grpc::Server> ServerBuilder::BuildAndStart() {
   // TODO(vjpai): Add a section here for plugins once they can support callback
   // methods
 
-  if (has_sync_methods) {
+  if (sync_handlers_on_event_engine) {
+    VLOG(2) << "Synchronous server running handlers on the EventEngine.";
+  } else if (has_sync_methods) {
     // This is a Sync server
     VLOG(2) << "Synchronous server. Num CQs: " << sync_server_settings_.num_cqs
             << ", Min pollers: " << sync_server_settings_.min_pollers
@@ -415,7 +508,8 @@ std::unique_ptr<grpc::Server> ServerBuilder::BuildAndStart() {
     has_frequently_polled_cqs = true;
   }
 
-  if (has_callback_methods || callback_generic_service_ != nullptr) {
+  if (has_callback_methods || sync_handlers_on_event_engine ||
+      callback_generic_service_ != nullptr) {
     auto* cq = server->CallbackCQ();
     grpc_server_register_completion_queue(server->server_, cq->cq(), nullptr);
   }
@@ -460,6 +554,30 @@ std::unique_ptr<grpc::Server> ServerBuilder::BuildAndStart() {
 
   server->RegisterContextAllocator(std::move(context_allocator_));
 
+  for (const auto& [method_name, budget] : inline_callback_handlers_) {
+    bool found = false;
+    for (const auto& value : services_) {
+      for (const auto& method : value->service->methods_) {
+        if (method == nullptr || method_name != method->name()) continue;
+        if (method->api_type() !=
+                internal::RpcServiceMethod::ApiType::CALL_BACK &&
+            method->api_type() !=
+                internal::RpcServiceMethod::ApiType::RAW_CALL_BACK) {
+          LOG(ERROR) << "Inline handler requested for " << method_name
+                     << ", which is not a callback method.";
+          return nullptr;
+        }
+        method->SetInlineHandlerBudget(budget);
+        found = true;
+      }
+    }
+    if (!found) {
+      LOG(ERROR) << "Inline handler requested for unknown method "
+                 << method_name;
+      return nullptr;
+    }
+  }
+
   for (const auto& value : services_) {
     if (!server->RegisterService(value->host.get(), value->service)) {
       return nullptr;
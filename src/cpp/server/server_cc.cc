@@ -54,9 +54,11 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstdlib>
 #include <memory>
 #include <new>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -66,9 +68,12 @@
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "src/core/ext/transport/inproc/inproc_transport.h"
+#include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/iomgr.h"
 #include "src/core/lib/resource_quota/api.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/resource_quota/thread_quota.h"
 #include "src/core/lib/surface/completion_queue.h"
 #include "src/core/server/server.h"
 #include "src/core/util/grpc_check.h"
@@ -423,6 +428,14 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
     return true;
   }
 
+  // Has the arrival of the call reported as a functor on the server's
+  // callback CQ rather than on a sync server CQ, so that the request runs on
+  // an EventEngine thread.
+  void RunOnEventEngine(grpc_core::Server::RegisteredCallAllocation* data) {
+    event_engine_tag_.emplace(this);
+    data->tag = static_cast<void*>(&*event_engine_tag_);
+  }
+
   void Run(const std::shared_ptr<GlobalCallbacks>& global_callbacks,
            bool resources) {
     ctx_.Init(deadline_, &request_metadata_);
@@ -472,6 +485,9 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
   }
 
   void ContinueRunAfterInterception() {
+    // The handler and the wait for the call to complete may block for long.
+    // Let the EventEngine's thread pool grow meanwhile if this runs on it.
+    grpc_event_engine::experimental::ScopedBlockingRegion blocking_region;
     ctx_->ctx.BeginCompletionOp(&*wrapped_call_, nullptr, nullptr);
     if (grpc_core::IsServerGlobalCallbacksOwnershipEnabled()) {
       g_raw_callbacks->PreSynchronousRequest(&ctx_->ctx);
@@ -502,6 +518,7 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
     wrapped_call_.Destroy();
     ctx_.Destroy();
 
+    if (reserved_thread_quota_ != nullptr) reserved_thread_quota_->Release(1);
     delete this;
   }
 
@@ -513,6 +530,37 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
   }
 
  private:
+  class EventEngineTag : public grpc_completion_queue_functor {
+   public:
+    explicit EventEngineTag(SyncRequest* req) : req_(req) {
+      functor_run = &EventEngineTag::StaticRun;
+      // The handler may block, so it must not run on the thread completing
+      // the request.
+      inlineable = false;
+    }
+
+   private:
+    static void StaticRun(grpc_completion_queue_functor* cb, int ok) {
+      SyncRequest* req = static_cast<EventEngineTag*>(cb)->req_;
+      void* ignored = req;
+      bool status = static_cast<bool>(ok);
+      if (!req->FinalizeResult(&ignored, &status)) return;
+      // Each running handler holds a thread of the server's thread quota, as
+      // a ThreadManager thread would, until the request is done.  Without
+      // one, the request fails with RESOURCE_EXHAUSTED.
+      bool resources = true;
+      grpc_resource_quota* rq = req->server_->sync_handler_resource_quota_;
+      if (rq != nullptr) {
+        auto thread_quota = grpc_core::ResourceQuota::FromC(rq)->thread_quota();
+        resources = thread_quota->Reserve(1);
+        if (resources) req->reserved_thread_quota_ = std::move(thread_quota);
+      }
+      req->Run(req->server_->global_callbacks_, resources);
+    }
+
+    SyncRequest* const req_;
+  };
+
   SyncRequest(Server* server, grpc::internal::RpcServiceMethod* method)
       : server_(server),
         method_(method),
@@ -546,6 +594,9 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
   bool resources_;
   void* deserialized_request_ = nullptr;
   grpc::internal::InterceptorBatchMethodsImpl interceptor_methods_;
+  std::optional<EventEngineTag> event_engine_tag_;
+  // The thread quota this request holds a thread of while it runs, if any.
+  grpc_core::ThreadQuotaPtr reserved_thread_quota_;
 
   // ServerContextWrapper allows ManualConstructor while using a private
   // constructor of ServerContext via this friend class.
@@ -588,6 +639,9 @@ class Server::CallbackRequest final
     CommonSetup(server, data);
     data->deadline = &deadline_;
     data->optional_payload = has_request_payload_ ? &request_payload_ : nullptr;
+    if (method->ShouldRunHandlerInline()) {
+      tag_.inlineable = GRPC_CQ_FUNCTOR_RUN_INLINE;
+    }
   }
 
   // For generic services, method is nullptr since these services don't have
@@ -722,12 +776,23 @@ class Server::CallbackRequest final
       }
     }
     void ContinueRunAfterInterception() {
-      auto* handler = (req_->method_ != nullptr)
-                          ? req_->method_->handler()
+      grpc::internal::RpcServiceMethod* method = req_->method_;
+      auto* handler = (method != nullptr)
+                          ? method->handler()
                           : req_->server_->generic_handler_.get();
+      // Time the handler of inline-enabled methods, whether or not this run
+      // is inline, so that a method that got too slow to run inline can
+      // come back once it is fast again. req_ may be gone by the time the
+      // handler returns.
+      const bool timed = method != nullptr && method->inline_handler_enabled();
+      const auto start = timed ? std::chrono::steady_clock::now()
+                               : std::chrono::steady_clock::time_point();
       handler->RunHandler(grpc::internal::MethodHandler::HandlerParameter(
           call_, req_->ctx_, req_->request_, req_->request_status_,
           req_->handler_data_, [this] { delete req_; }));
+      if (timed) {
+        method->RecordHandlerRunTime(std::chrono::steady_clock::now() - start);
+      }
     }
   };
 
@@ -980,6 +1045,16 @@ Server::Server(
                     GRPC_ARG_SERVER_CALL_METRIC_RECORDING)) {
       call_metric_recording_enabled_ = channel_args.args[i].value.integer;
     }
+    if (0 == strcmp(channel_args.args[i].key,
+                    GRPC_ARG_SERVER_SYNC_HANDLERS_ON_EVENT_ENGINE)) {
+      sync_handlers_on_event_engine_ = channel_args.args[i].value.integer != 0;
+    }
+  }
+  if (sync_handlers_on_event_engine_ && server_rq != nullptr) {
+    // Handlers running on the EventEngine take the place of ThreadManager
+    // threads, so they are held to the same limit.
+    sync_handler_resource_quota_ = server_rq;
+    grpc_resource_quota_ref(sync_handler_resource_quota_);
   }
   server_ = grpc_server_create(&channel_args, nullptr);
   grpc_server_set_config_fetcher(server_, server_config_fetcher);
@@ -1014,6 +1089,9 @@ Server::~Server() {
   // server has been destroyed.
   health_check_service_.reset();
   grpc_server_destroy(server_);
+  if (sync_handler_resource_quota_ != nullptr) {
+    grpc_resource_quota_unref(sync_handler_resource_quota_);
+  }
 }
 
 void Server::SetGlobalCallbacks(GlobalCallbacks* callbacks) {
@@ -1090,6 +1168,22 @@ bool Server::RegisterService(const std::string* addr, grpc::Service* service) {
 
     if (method->handler() == nullptr) {  // Async method without handler
       method->set_server_tag(method_registration_tag);
+    } else if (method->api_type() ==
+                   grpc::internal::RpcServiceMethod::ApiType::SYNC &&
+               sync_handlers_on_event_engine_) {
+      // Requests are matched on the callback CQ like those of callback
+      // methods, but the handler itself runs as a sync request.
+      has_callback_methods_ = true;
+      grpc::internal::RpcServiceMethod* method_value = method.get();
+      grpc::CompletionQueue* cq = CallbackCQ();
+      grpc_server_register_completion_queue(server_, cq->cq(), nullptr);
+      grpc_core::Server::FromC(server_)->SetRegisteredMethodAllocator(
+          cq->cq(), method_registration_tag, [this, method_value] {
+            grpc_core::Server::RegisteredCallAllocation result;
+            (new SyncRequest(this, method_value, &result))
+                ->RunOnEventEngine(&result);
+            return result;
+          });
     } else if (method->api_type() ==
                grpc::internal::RpcServiceMethod::ApiType::SYNC) {
       for (const auto& value : sync_req_mgrs_) {
@@ -1254,9 +1348,11 @@ void Server::Start(grpc::ServerCompletionQueue** cqs, size_t num_cqs) {
   }
 
   // If this server has any support for synchronous methods (has any sync
-  // server CQs), make sure that we have a ResourceExhausted handler
-  // to deal with the case of thread exhaustion
-  if (sync_server_cqs_ != nullptr && !sync_server_cqs_->empty()) {
+  // server CQs, or a thread quota for handlers on the EventEngine), make sure
+  // that we have a ResourceExhausted handler to deal with the case of thread
+  // exhaustion
+  if ((sync_server_cqs_ != nullptr && !sync_server_cqs_->empty()) ||
+      sync_handler_resource_quota_ != nullptr) {
     resource_exhausted_handler_ =
         std::make_unique<grpc::internal::ResourceExhaustedHandler>(
             kServerThreadpoolExhausted);
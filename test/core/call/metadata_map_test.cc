@@ -25,6 +25,7 @@
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
 #include "gtest/gtest.h"
 #include "src/core/call/metadata_batch.h"
 #include "src/core/lib/resource_quota/arena.h"
@@ -146,6 +147,19 @@ TEST(MetadataMapTest, NonTraitKeyWithMultipleValues) {
   EXPECT_EQ(map.GetStringValue(kKey, &buffer), "value1,value2");
 }
 
+TEST(MetadataMapTest, MalformedStreamWeightIsDefault) {
+  for (absl::string_view value : {"64", "abc", "0", "257", "-1"}) {
+    grpc_metadata_batch map;
+    bool parse_error = false;
+    map.Append("grpc-stream-weight", Slice::FromCopiedString(value),
+               [&](absl::string_view, const Slice&) { parse_error = true; });
+    EXPECT_EQ(map.get(GrpcStreamWeightMetadata()),
+              parse_error ? GrpcStreamWeightMetadata::kDefaultWeight : 64u)
+        << value;
+    EXPECT_EQ(parse_error, value != "64") << value;
+  }
+}
+
 TEST(DebugStringBuilderTest, OneAddAfterRedaction) {
   metadata_detail::DebugStringBuilder b;
   b.AddAfterRedaction(ContentTypeMetadata::key(), "AddValue01");
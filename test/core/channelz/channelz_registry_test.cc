@@ -235,6 +235,126 @@ TEST_P(ChannelzRegistryTest, ServerWithChildren) {
   sockets.clear();
 }
 
+TEST_P(ChannelzRegistryTest, TypedQueriesSkipOtherTypes) {
+  std::vector<RefCountedPtr<BaseNode>> nodes;
+  for (int i = 0; i < 50; ++i) {
+    nodes.push_back(MakeRefCounted<ChannelNode>("x", 1, false));
+    for (int j = 0; j < 10; ++j) {
+      nodes.push_back(MakeRefCounted<SocketNode>("x", "y", "z", nullptr));
+    }
+  }
+  auto [channels, end] = ChannelzRegistry::GetTopChannels(0);
+  EXPECT_TRUE(end);
+  EXPECT_EQ(channels.size(), 50u);
+  std::vector<WeakRefCountedPtr<BaseNode>> sockets;
+  intptr_t start = 0;
+  while (true) {
+    auto [page, end] = ChannelzRegistry::GetNodesOfType(
+        start, BaseNode::EntityType::kSocket, 64);
+    for (auto& node : page) {
+      EXPECT_EQ(node->type(), BaseNode::EntityType::kSocket);
+      if (!sockets.empty()) EXPECT_GT(node->uuid(), sockets.back()->uuid());
+      sockets.push_back(std::move(node));
+    }
+    if (end) break;
+    start = sockets.back()->uuid() + 1;
+  }
+  EXPECT_EQ(sockets.size(), 500u);
+}
+
+TEST_P(ChannelzRegistryTest, ChangesReportAddedAndRemovedNodes) {
+  auto changes = ChannelzRegistry::GetChanges(BaseNode::EntityType::kSocket,
+                                              {}, 100);
+  EXPECT_TRUE(changes.added.empty());
+  EXPECT_TRUE(changes.end);
+  EXPECT_TRUE(changes.complete);
+  auto channel = MakeRefCounted<ChannelNode>("x", 1, false);
+  std::vector<RefCountedPtr<BaseNode>> sockets;
+  for (int i = 0; i < 10; ++i) {
+    sockets.push_back(MakeRefCounted<SocketNode>("x", "y", "z", nullptr));
+  }
+  // Collect the new sockets a page at a time.
+  std::vector<intptr_t> added;
+  do {
+    changes = ChannelzRegistry::GetChanges(BaseNode::EntityType::kSocket,
+                                           changes.next, 3);
+    EXPECT_TRUE(changes.complete);
+    EXPECT_LE(changes.added.size(), 3u);
+    for (const auto& node : changes.added) {
+      EXPECT_EQ(node->type(), BaseNode::EntityType::kSocket);
+      added.push_back(node->uuid());
+    }
+  } while (!changes.end);
+  EXPECT_EQ(added.size(), sockets.size());
+  changes.added.clear();
+  // Nothing changed since.
+  changes = ChannelzRegistry::GetChanges(BaseNode::EntityType::kSocket,
+                                         changes.next, 100);
+  EXPECT_TRUE(changes.added.empty());
+  EXPECT_TRUE(changes.removed.empty());
+  std::vector<intptr_t> dropped;
+  for (int i = 0; i < 5; ++i) {
+    dropped.push_back(sockets.back()->uuid());
+    sockets.pop_back();
+  }
+  channel.reset();
+  changes = ChannelzRegistry::GetChanges(BaseNode::EntityType::kSocket,
+                                         changes.next, 100);
+  EXPECT_TRUE(changes.added.empty());
+  EXPECT_TRUE(changes.complete);
+  // With orphan tracking, dropped nodes stay in the registry until evicted.
+  for (intptr_t uuid : changes.removed) {
+    EXPECT_NE(std::find(dropped.begin(), dropped.end(), uuid), dropped.end());
+  }
+  if (GetParam() == 0) {
+    std::sort(dropped.begin(), dropped.end());
+    std::sort(changes.removed.begin(), changes.removed.end());
+    EXPECT_EQ(changes.removed, dropped);
+  }
+}
+
+TEST_P(ChannelzRegistryTest, ChangesResyncAfterRemovalLogOverflows) {
+  if (GetParam() != 0) {
+    GTEST_SKIP() << "Orphaned nodes stay in the registry until evicted, so "
+                    "we can't predict when their removals are logged.";
+  }
+  // More removals than the registry's log keeps.
+  constexpr int kRemovals = 16384 + 1;
+  auto changes = ChannelzRegistry::GetChanges(BaseNode::EntityType::kSocket,
+                                              {}, 100);
+  EXPECT_TRUE(changes.complete);
+  auto survivor = MakeRefCounted<SocketNode>("x", "y", "z", nullptr);
+  std::vector<RefCountedPtr<BaseNode>> sockets;
+  for (int i = 0; i < kRemovals; ++i) {
+    sockets.push_back(MakeRefCounted<SocketNode>("x", "y", "z", nullptr));
+  }
+  do {
+    changes = ChannelzRegistry::GetChanges(BaseNode::EntityType::kSocket,
+                                           changes.next, 4096);
+    EXPECT_TRUE(changes.complete);
+  } while (!changes.end);
+  changes.added.clear();
+  sockets.clear();
+  changes = ChannelzRegistry::GetChanges(BaseNode::EntityType::kSocket,
+                                         changes.next, 100);
+  EXPECT_FALSE(changes.complete);
+  // Starting over from a default constructed cursor is complete, and
+  // returns only what is still registered.
+  changes =
+      ChannelzRegistry::GetChanges(BaseNode::EntityType::kSocket, {}, 100);
+  EXPECT_TRUE(changes.complete);
+  EXPECT_TRUE(changes.end);
+  EXPECT_TRUE(changes.removed.empty());
+  ASSERT_EQ(changes.added.size(), 1u);
+  EXPECT_EQ(changes.added[0]->uuid(), survivor->uuid());
+  // Scrapes continue incrementally from there.
+  changes = ChannelzRegistry::GetChanges(BaseNode::EntityType::kSocket,
+                                         changes.next, 100);
+  EXPECT_TRUE(changes.complete);
+  EXPECT_TRUE(changes.added.empty());
+  EXPECT_TRUE(changes.removed.empty());
+}
+
 }  // namespace testing
 }  // namespace channelz
 }  // namespace grpc_core
@@ -241,6 +241,75 @@ TEST_F(ClientChannelParserTest, InvalidWaitForReady) {
       << service_config.status();
 }
 
+TEST_F(ClientChannelParserTest, ValidStreamWeight) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"TestServ\", \"method\": \"TestMethod\" }\n"
+      "    ],\n"
+      "    \"streamWeight\": 64\n"
+      "  } ]\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  const auto* vector_ptr =
+      (*service_config)
+          ->GetMethodParsedConfigVector(
+              grpc_slice_from_static_string("/TestServ/TestMethod"));
+  ASSERT_NE(vector_ptr, nullptr);
+  auto parsed_config = ((*vector_ptr)[parser_index_]).get();
+  EXPECT_EQ(
+      (static_cast<internal::ClientChannelMethodParsedConfig*>(parsed_config))
+          ->stream_weight(),
+      64u);
+}
+
+TEST_F(ClientChannelParserTest, InvalidStreamWeight) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"service\", \"method\": \"method\" }\n"
+      "    ],\n"
+      "    \"streamWeight\": \"high\"\n"
+      "  } ]\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  EXPECT_EQ(service_config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(service_config.status().message(),
+            "errors validating service config: ["
+            "field:methodConfig[0].streamWeight error:"
+            "failed to parse non-negative number]")
+      << service_config.status();
+}
+
+TEST_F(ClientChannelParserTest, StreamWeightOutOfRange) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"service\", \"method\": \"method\" }\n"
+      "    ],\n"
+      "    \"streamWeight\": 0\n"
+      "  }, {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"service\", \"method\": \"other\" }\n"
+      "    ],\n"
+      "    \"streamWeight\": 257\n"
+      "  } ]\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  EXPECT_EQ(service_config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(service_config.status().message(),
+            "errors validating service config: ["
+            "field:methodConfig[0].streamWeight error:"
+            "must be in the range [1, 256]; "
+            "field:methodConfig[1].streamWeight error:"
+            "must be in the range [1, 256]]")
+      << service_config.status();
+}
+
 TEST_F(ClientChannelParserTest, ValidHealthCheck) {
   const char* test_json =
       "{\n"
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
 
 #include <atomic>
 #include <memory>
@@ -41,6 +42,10 @@ class ConnectedSubchannelTest : public YodelTest {
   using YodelTest::YodelTest;
 
   RefCountedPtr<ConnectedSubchannel> InitChannel(const ChannelArgs& args) {
+    return PickConnectedSubchannel(InitSubchannel(args));
+  }
+
+  RefCountedPtr<Subchannel> InitSubchannel(const ChannelArgs& args) {
     grpc_resolved_address addr;
     CHECK(grpc_parse_uri(URI::Parse(kTestAddress).value(), &addr));
     auto subchannel = Subchannel::Create(MakeOrphanable<TestConnector>(this),
@@ -49,14 +54,35 @@ class ConnectedSubchannelTest : public YodelTest {
       ExecCtx exec_ctx;
       subchannel->RequestConnection();
     }
+    return subchannel;
+  }
+
+  // Ticks until the subchannel hands out a connection other than \a other.
+  RefCountedPtr<ConnectedSubchannel> PickConnectedSubchannel(
+      RefCountedPtr<Subchannel> subchannel,
+      ConnectedSubchannel* other = nullptr) {
     return TickUntil<RefCountedPtr<ConnectedSubchannel>>(
-        [subchannel]() -> Poll<RefCountedPtr<ConnectedSubchannel>> {
+        [subchannel, other]() -> Poll<RefCountedPtr<ConnectedSubchannel>> {
+          ExecCtx exec_ctx;
           auto connected_subchannel = subchannel->connected_subchannel();
-          if (connected_subchannel != nullptr) return connected_subchannel;
+          if (connected_subchannel != nullptr &&
+              connected_subchannel.get() != other) {
+            return connected_subchannel;
+          }
           return Pending();
         });
   }
 
+  CallHandler StartCallOn(RefCountedPtr<ConnectedSubchannel> channel) {
+    auto call = MakeCall(MakeClientInitialMetadata());
+    SpawnTestSeq(call.handler, "start-call",
+                 [channel, handler = call.handler]() mutable {
+                   channel->unstarted_call_destination()->StartCall(
+                       std::move(handler));
+                 });
+    return TickUntilCallStarted();
+  }
+
   ClientMetadataHandle MakeClientInitialMetadata() {
     auto client_initial_metadata =
         Arena::MakePooledForOverwrite<ClientMetadata>();
@@ -174,4 +200,41 @@ CONNECTED_SUBCHANNEL_CHANNEL_TEST(StartCall) {
   WaitForAllPendingWork();
 }
 
+CONNECTED_SUBCHANNEL_CHANNEL_TEST(SingleConnectionByDefault) {
+  auto subchannel = InitSubchannel(
+      ChannelArgs().Set(GRPC_ARG_SUBCHANNEL_MAX_STREAMS_PER_CONNECTION, 1));
+  auto channel = PickConnectedSubchannel(subchannel);
+  auto handler = StartCallOn(channel);
+  EXPECT_EQ(channel->active_calls(), 1u);
+  // The connection is at its stream limit, but without
+  // GRPC_ARG_MAX_CONNECTIONS_PER_SUBCHANNEL no other one is opened.
+  EXPECT_EQ(subchannel->connected_subchannel(), channel);
+  WaitForAllPendingWork();
+  EXPECT_EQ(subchannel->connected_subchannel(), channel);
+}
+
+CONNECTED_SUBCHANNEL_CHANNEL_TEST(OpensExtraConnectionAtStreamLimit) {
+  auto subchannel = InitSubchannel(
+      ChannelArgs()
+          .Set(GRPC_ARG_MAX_CONNECTIONS_PER_SUBCHANNEL, 2)
+          .Set(GRPC_ARG_SUBCHANNEL_MAX_STREAMS_PER_CONNECTION, 1));
+  auto channel1 = PickConnectedSubchannel(subchannel);
+  auto handler1 = StartCallOn(channel1);
+  EXPECT_EQ(channel1->active_calls(), 1u);
+  // The first connection is full, so a second one is opened and used.
+  auto channel2 = PickConnectedSubchannel(subchannel, channel1.get());
+  auto handler2 = StartCallOn(channel2);
+  EXPECT_EQ(channel1->active_calls(), 1u);
+  EXPECT_EQ(channel2->active_calls(), 1u);
+  // Both connections are full and the limit is reached, so the subchannel
+  // keeps handing out the existing ones.
+  RefCountedPtr<ConnectedSubchannel> channel3;
+  {
+    ExecCtx exec_ctx;
+    channel3 = subchannel->connected_subchannel();
+  }
+  EXPECT_TRUE(channel3 == channel1 || channel3 == channel2);
+  WaitForAllPendingWork();
+}
+
 }  // namespace grpc_core
@@ -384,6 +384,83 @@ FUZZ_TEST(MyTestSuite, NeverExceedMaxBackoff)
     .WithDomains(AnyRetryMethodConfig(), VectorOf(AnyServerMetadata()),
                  AnyServerThrottleData());
 
+// Domain including valid hedging configurations that treat particular status
+// codes as non-fatal
+auto HedgingMethodConfigWithNonFatalStatusCodes(
+    std::vector<grpc_status_code> non_fatal_status_codes) {
+  return fuzztest::Map(
+      [non_fatal_status_codes](uint32_t max_attempts, uint32_t hedging_delay) {
+        StatusCodeSet status_codes;
+        for (grpc_status_code code : non_fatal_status_codes) {
+          status_codes.Add(code);
+        }
+        return std::move(*internal::RetryMethodConfig::MakeHedgingPolicy(
+            max_attempts, Duration::Milliseconds(hedging_delay),
+            status_codes));
+      },
+      InRange(2, 5), InRange(0, 100000));
+}
+
+void FatalStatusNeverHedges(
+    internal::RetryMethodConfig policy, ServerMetadataHandle md, bool committed,
+    RefCountedPtr<internal::RetryThrottler> throttle_data) {
+  HedgingState hedging_state(&policy, throttle_data);
+  EXPECT_EQ(hedging_state.OnAttemptFailed(*md, committed, FuzzerDebugTag),
+            std::nullopt);
+}
+FUZZ_TEST(MyTestSuite, FatalStatusNeverHedges)
+    .WithDomains(
+        HedgingMethodConfigWithNonFatalStatusCodes({GRPC_STATUS_UNAVAILABLE}),
+        ServerMetadataWithStatus(AnyStatusExcept(GRPC_STATUS_UNAVAILABLE)),
+        Arbitrary<bool>(), AnyServerThrottleData());
+
+void CommittedHedgingNeverContinues(
+    internal::RetryMethodConfig policy, ServerMetadataHandle md,
+    RefCountedPtr<internal::RetryThrottler> throttle_data) {
+  HedgingState hedging_state(&policy, throttle_data);
+  EXPECT_EQ(hedging_state.OnAttemptFailed(*md, true, FuzzerDebugTag),
+            std::nullopt);
+}
+FUZZ_TEST(MyTestSuite, CommittedHedgingNeverContinues)
+    .WithDomains(
+        HedgingMethodConfigWithNonFatalStatusCodes({GRPC_STATUS_UNAVAILABLE}),
+        AnyServerMetadata(), AnyServerThrottleData());
+
+void HedgingNeverExceedsMaxAttempts(
+    internal::RetryMethodConfig policy, std::vector<ServerMetadataHandle> mds,
+    RefCountedPtr<internal::RetryThrottler> throttle_data) {
+  HedgingState hedging_state(&policy, throttle_data);
+  // Start as many attempts as the policy allows up front, then again after
+  // each failure.
+  while (hedging_state.CanStartAttempt()) hedging_state.RecordAttemptStarted();
+  for (const auto& md : mds) {
+    std::ignore = hedging_state.OnAttemptFailed(*md, false, FuzzerDebugTag);
+    if (hedging_state.CanStartAttempt()) hedging_state.RecordAttemptStarted();
+  }
+  EXPECT_LE(hedging_state.num_attempts_started(), policy.max_attempts());
+}
+FUZZ_TEST(MyTestSuite, HedgingNeverExceedsMaxAttempts)
+    .WithDomains(HedgingMethodConfigWithNonFatalStatusCodes(
+                     {GRPC_STATUS_UNAVAILABLE, GRPC_STATUS_ABORTED}),
+                 VectorOf(AnyServerMetadata()).WithMaxSize(7),
+                 AnyServerThrottleData());
+
+void NegativePushbackStopsHedging(
+    internal::RetryMethodConfig policy, ServerMetadataHandle md,
+    RefCountedPtr<internal::RetryThrottler> throttle_data) {
+  HedgingState hedging_state(&policy, throttle_data);
+  const auto delay = hedging_state.OnAttemptFailed(*md, false, FuzzerDebugTag);
+  if (delay.has_value()) {
+    EXPECT_EQ(*delay, Duration::Zero());
+    EXPECT_FALSE(hedging_state.CanStartAttempt());
+  }
+}
+FUZZ_TEST(MyTestSuite, NegativePushbackStopsHedging)
+    .WithDomains(HedgingMethodConfigWithNonFatalStatusCodes(
+                     {GRPC_STATUS_UNAVAILABLE, GRPC_STATUS_ABORTED}),
+                 ServerMetadataWithPushback(NegativeDuration()),
+                 AnyServerThrottleData());
+
 }  // namespace
 }  // namespace retry_detail
 }  // namespace grpc_core
@@ -63,6 +63,32 @@ TEST(RetryThrottler, Basic) {
   EXPECT_TRUE(throttler->RecordFailure());
 }
 
+TEST(RetryThrottler, IsThrottled) {
+  // Max token count is 4, so threshold for retrying is 2.
+  // Token count starts at 4.
+  // Each failure decrements by 1.  Each success increments by 1.
+  auto old_throttler = RetryThrottler::Create(4000, 1000, nullptr);
+  EXPECT_FALSE(old_throttler->IsThrottled());
+  // Failure: token_count=3.  Above threshold.
+  EXPECT_TRUE(old_throttler->RecordFailure());
+  EXPECT_FALSE(old_throttler->IsThrottled());
+  // Failure: token_count=2.  At threshold.
+  EXPECT_FALSE(old_throttler->RecordFailure());
+  EXPECT_TRUE(old_throttler->IsThrottled());
+  // Checking does not consume tokens.
+  EXPECT_TRUE(old_throttler->IsThrottled());
+  EXPECT_EQ(old_throttler->milli_tokens(), 2000);
+  // Replace with a throttler whose threshold is 1.5 tokens.
+  // Token count starts at 1.5 (ratio inherited from old_throttler).
+  auto throttler = RetryThrottler::Create(3000, 1000, old_throttler);
+  EXPECT_NE(old_throttler, throttler);
+  EXPECT_EQ(throttler->milli_tokens(), 1500);
+  // Success: token_count=2.5.  The old throttler sees the new state.
+  throttler->RecordSuccess();
+  EXPECT_FALSE(old_throttler->IsThrottled());
+  EXPECT_FALSE(throttler->IsThrottled());
+}
+
 TEST(RetryThrottler, Replacement) {
   // Create throttler.
   // Max token count is 4, so threshold for retrying is 2.
@@ -133,6 +133,7 @@ _TESTS = [
     "filtered_metadata",
     "graceful_server_shutdown",
     "grpc_authz",
+    "hedging",
     "high_initial_seqno",
     "hpack_size",
     "http2_stats",
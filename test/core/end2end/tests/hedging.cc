@@ -0,0 +1,195 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/status.h>
+
+#include <optional>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/experiments/experiments.h"
+#include "src/core/util/time.h"
+#include "test/core/end2end/end2end_tests.h"
+
+namespace grpc_core {
+namespace {
+
+// Hedging is only implemented by the call v3 retry interceptor.
+#define SKIP_IF_HEDGING_UNSUPPORTED()                                    \
+  if (!IsRetryInCallv3Enabled() ||                                       \
+      !(test_config()->feature_mask & FEATURE_MASK_IS_CALL_V3)) {        \
+    GTEST_SKIP() << "hedging requires the call v3 retry interceptor";    \
+  }
+
+ChannelArgs HedgingClientArgs(absl::string_view hedging_policy) {
+  return ChannelArgs()
+      .Set(GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING, 1)
+      .Set(GRPC_ARG_SERVICE_CONFIG,
+           absl::StrCat("{\n"
+                        "  \"methodConfig\": [ {\n"
+                        "    \"name\": [\n"
+                        "      { \"service\": \"service\", \"method\": "
+                        "\"method\" }\n"
+                        "    ],\n"
+                        "    \"hedgingPolicy\": ",
+                        hedging_policy,
+                        "\n"
+                        "  } ]\n"
+                        "}"));
+}
+
+// Tests that a hedged attempt is sent when the first one is slow.
+// - 2 attempts allowed, 1 second apart
+// - the server never answers the first attempt
+// - the second attempt succeeds, and the first one is cancelled
+CORE_END2END_TEST(RetryTests, HedgingSendsSecondAttemptAfterDelay) {
+  SKIP_IF_HEDGING_UNSUPPORTED();
+  InitServer(DefaultServerArgs());
+  InitClient(HedgingClientArgs(
+      "{ \"maxAttempts\": 2, \"hedgingDelay\": \"1s\" }"));
+  auto c =
+      NewClientCall("/service/method").Timeout(Duration::Minutes(1)).Create();
+  IncomingMessage server_message;
+  IncomingMetadata server_initial_metadata;
+  IncomingStatusOnClient server_status;
+  c.NewBatch(1)
+      .SendInitialMetadata({})
+      .SendMessage("foo")
+      .RecvMessage(server_message)
+      .SendCloseFromClient()
+      .RecvInitialMetadata(server_initial_metadata)
+      .RecvStatusOnClient(server_status);
+  auto s1 = RequestCall(101);
+  Expect(101, true);
+  Step();
+  const auto first_attempt_time = Timestamp::Now();
+  EXPECT_EQ(s1.GetInitialMetadata("grpc-previous-rpc-attempts"),
+            std::nullopt);
+  IncomingCloseOnServer client_close1;
+  s1.NewBatch(102).RecvCloseOnServer(client_close1);
+  // The server sits on the first attempt, so a second one is hedged.
+  auto s2 = RequestCall(201);
+  Expect(201, true);
+  Step(Duration::Seconds(20));
+  const auto hedging_delay = Timestamp::Now() - first_attempt_time;
+  // Configured hedging delay was 1 second.  To avoid flakiness, we allow
+  // some fudge factor here.
+  EXPECT_GE(hedging_delay, Duration::Milliseconds(800));
+  EXPECT_EQ(s2.GetInitialMetadata("grpc-previous-rpc-attempts"), "1");
+  IncomingMessage client_message;
+  s2.NewBatch(202).RecvMessage(client_message);
+  Expect(202, true);
+  Step();
+  EXPECT_EQ(client_message.payload(), "foo");
+  IncomingCloseOnServer client_close2;
+  s2.NewBatch(203)
+      .SendInitialMetadata({})
+      .SendMessage("bar")
+      .SendStatusFromServer(GRPC_STATUS_OK, "xyz", {})
+      .RecvCloseOnServer(client_close2);
+  Expect(203, true);
+  Expect(102, true);
+  Expect(1, true);
+  Step();
+  EXPECT_EQ(server_status.status(), GRPC_STATUS_OK);
+  EXPECT_EQ(server_message.payload(), "bar");
+  EXPECT_EQ(s2.method(), "/service/method");
+  EXPECT_FALSE(client_close2.was_cancelled());
+  // The losing attempt was cancelled once the second one committed.
+  EXPECT_TRUE(client_close1.was_cancelled());
+}
+
+// Tests that a non-fatal status starts the next hedged attempt immediately
+// rather than waiting for the hedging delay.
+CORE_END2END_TEST(RetryTests, HedgingNonFatalStatusStartsNextAttempt) {
+  SKIP_IF_HEDGING_UNSUPPORTED();
+  InitServer(DefaultServerArgs());
+  InitClient(HedgingClientArgs(
+      "{ \"maxAttempts\": 3, \"hedgingDelay\": \"60s\","
+      " \"nonFatalStatusCodes\": [ \"UNAVAILABLE\" ] }"));
+  auto c =
+      NewClientCall("/service/method").Timeout(Duration::Minutes(1)).Create();
+  IncomingMetadata server_initial_metadata;
+  IncomingStatusOnClient server_status;
+  c.NewBatch(1)
+      .SendInitialMetadata({})
+      .SendCloseFromClient()
+      .RecvInitialMetadata(server_initial_metadata)
+      .RecvStatusOnClient(server_status);
+  auto s1 = RequestCall(101);
+  Expect(101, true);
+  Step();
+  IncomingCloseOnServer client_close1;
+  s1.NewBatch(102)
+      .SendStatusFromServer(GRPC_STATUS_UNAVAILABLE, "message1", {})
+      .RecvCloseOnServer(client_close1);
+  Expect(102, true);
+  Step();
+  // Well before the 60 second hedging delay.
+  auto s2 = RequestCall(201);
+  Expect(201, true);
+  Step(Duration::Seconds(20));
+  EXPECT_EQ(s2.GetInitialMetadata("grpc-previous-rpc-attempts"), "1");
+  IncomingCloseOnServer client_close2;
+  s2.NewBatch(202)
+      .SendInitialMetadata({})
+      .SendStatusFromServer(GRPC_STATUS_OK, "message2", {})
+      .RecvCloseOnServer(client_close2);
+  Expect(202, true);
+  Expect(1, true);
+  Step();
+  EXPECT_EQ(server_status.status(), GRPC_STATUS_OK);
+  EXPECT_FALSE(client_close2.was_cancelled());
+}
+
+// Tests that a fatal status is returned to the application without
+// starting another hedged attempt.
+CORE_END2END_TEST(RetryTests, HedgingFatalStatusCommits) {
+  SKIP_IF_HEDGING_UNSUPPORTED();
+  InitServer(DefaultServerArgs());
+  InitClient(HedgingClientArgs(
+      "{ \"maxAttempts\": 3, \"hedgingDelay\": \"60s\","
+      " \"nonFatalStatusCodes\": [ \"UNAVAILABLE\" ] }"));
+  auto c =
+      NewClientCall("/service/method").Timeout(Duration::Minutes(1)).Create();
+  IncomingMetadata server_initial_metadata;
+  IncomingStatusOnClient server_status;
+  c.NewBatch(1)
+      .SendInitialMetadata({})
+      .SendCloseFromClient()
+      .RecvInitialMetadata(server_initial_metadata)
+      .RecvStatusOnClient(server_status);
+  auto s = RequestCall(101);
+  Expect(101, true);
+  Step();
+  IncomingCloseOnServer client_close;
+  s.NewBatch(102)
+      .SendStatusFromServer(GRPC_STATUS_ABORTED, "xyz", {})
+      .RecvCloseOnServer(client_close);
+  Expect(102, true);
+  Expect(1, true);
+  Step();
+  EXPECT_EQ(server_status.status(), GRPC_STATUS_ABORTED);
+  EXPECT_EQ(server_status.message(), "xyz");
+}
+
+}  // namespace
+}  // namespace grpc_core
@@ -20,9 +20,13 @@
 #include <memory>
 
 #include "absl/log/log.h"
+#include "absl/strings/string_view.h"
 #include "gtest/gtest.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/slice/slice.h"
+#include "src/core/server/server.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/time.h"
 #include "test/core/end2end/end2end_tests.h"
 
@@ -169,5 +173,91 @@ CORE_END2END_TEST(CoreDeadlineSingleHopTests,
   }
 }
 
+CORE_END2END_TEST(CoreDeadlineTests,
+                  TimeoutBeforeRequestCallWithDeadlineOrderedPendingRequests) {
+  InitServer(DefaultServerArgs().Set(
+      GRPC_ARG_SERVER_DEADLINE_ORDERED_PENDING_REQUESTS, true));
+  auto c = NewClientCall("/foo").Timeout(Duration::Seconds(1)).Create();
+  IncomingStatusOnClient server_status;
+  IncomingMetadata server_initial_metadata;
+  c.NewBatch(1)
+      .SendInitialMetadata({})
+      .SendCloseFromClient()
+      .RecvInitialMetadata(server_initial_metadata)
+      .RecvStatusOnClient(server_status);
+  Expect(1, true);
+  Step();
+  EXPECT_EQ(server_status.status(), GRPC_STATUS_DEADLINE_EXCEEDED);
+  // The call's deadline has passed, so the server must drop it rather than
+  // match it to the request; the request only completes on shutdown.
+  auto s = RequestCall(2);
+  ShutdownServerAndNotify(3);
+  Expect(2, false);
+  Expect(3, true);
+  Step();
+}
+
+CORE_END2END_TEST(CoreDeadlineSingleHopTests,
+                  DeadlineOrderedPendingRequestsMatchEarliestDeadlineFirst) {
+  InitServer(DefaultServerArgs().Set(
+      GRPC_ARG_SERVER_DEADLINE_ORDERED_PENDING_REQUESTS, true));
+  auto before = global_stats().Collect();
+  // Calls reach the server's pending list in the order they are started: the
+  // call with the latest deadline first, so that arrival order would match it
+  // first.
+  auto late = NewClientCall("/late").Timeout(Duration::Minutes(2)).Create();
+  IncomingStatusOnClient late_status;
+  IncomingMetadata late_initial_metadata;
+  late.NewBatch(1)
+      .SendInitialMetadata({})
+      .SendCloseFromClient()
+      .RecvInitialMetadata(late_initial_metadata)
+      .RecvStatusOnClient(late_status);
+  auto early = NewClientCall("/early").Timeout(Duration::Minutes(1)).Create();
+  IncomingStatusOnClient early_status;
+  IncomingMetadata early_initial_metadata;
+  early.NewBatch(2)
+      .SendInitialMetadata({})
+      .SendCloseFromClient()
+      .RecvInitialMetadata(early_initial_metadata)
+      .RecvStatusOnClient(early_status);
+  auto expired =
+      NewClientCall("/expired").Timeout(Duration::Seconds(1)).Create();
+  IncomingStatusOnClient expired_status;
+  IncomingMetadata expired_initial_metadata;
+  expired.NewBatch(3)
+      .SendInitialMetadata({})
+      .SendCloseFromClient()
+      .RecvInitialMetadata(expired_initial_metadata)
+      .RecvStatusOnClient(expired_status);
+  // Waiting for the last call's deadline gives all three calls time to reach
+  // the server and wait in its pending list.
+  Expect(3, true);
+  Step();
+  EXPECT_EQ(expired_status.status(), GRPC_STATUS_DEADLINE_EXCEEDED);
+  // The expired call is dropped, and the others are matched earliest
+  // deadline first.
+  for (absl::string_view method : {"/early", "/late"}) {
+    auto s = RequestCall(101);
+    Expect(101, true);
+    Step();
+    EXPECT_EQ(s.method(), method);
+    IncomingCloseOnServer client_close;
+    s.NewBatch(102)
+        .SendInitialMetadata({})
+        .SendStatusFromServer(GRPC_STATUS_UNIMPLEMENTED, "xyz", {})
+        .RecvCloseOnServer(client_close);
+    Expect(102, true);
+    Expect(method == "/early" ? 2 : 1, true);
+    Step();
+  }
+  EXPECT_EQ(early_status.status(), GRPC_STATUS_UNIMPLEMENTED);
+  EXPECT_EQ(late_status.status(), GRPC_STATUS_UNIMPLEMENTED);
+  auto after = global_stats().Collect();
+  EXPECT_EQ(after->server_pending_calls_deadline_exceeded -
+                before->server_pending_calls_deadline_exceeded,
+            1);
+}
+
 }  // namespace
 }  // namespace grpc_core
@@ -19,12 +19,14 @@
 #include <grpc/impl/channel_arg_names.h>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <list>
 #include <memory>
 #include <string>
 #include <thread>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "absl/log/log.h"
@@ -32,27 +34,37 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_split.h"
 #include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "absl/types/span.h"
 #include "gtest/gtest.h"
+#include "src/core/channelz/channelz.h"
 #include "src/core/config/config_vars.h"
 #include "src/core/handshaker/security/secure_endpoint.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/event_engine/extensions/channelz.h"
 #include "src/core/lib/event_engine/poller.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller_posix_default.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
+#include "src/core/lib/event_engine/posix_engine/telemetry.h"
+#include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/event_engine_shims/endpoint.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/telemetry/instrument.h"
 #include "src/core/tsi/fake_transport_security.h"
 #include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/util/dual_ref_counted.h"
 #include "src/core/util/grpc_check.h"
+#include "src/core/util/json/json.h"
 #include "src/core/util/notification.h"
 #include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/time.h"
 #include "src/core/util/wait_for_single_owner.h"
 #include "test/core/event_engine/event_engine_test_utils.h"
 #include "test/core/event_engine/posix/posix_engine_test_utils.h"
@@ -81,7 +93,8 @@ struct Connection {
 std::list<Connection> CreateConnectedEndpoints(
     PosixEventPoller& poller, bool is_zero_copy_enabled, int num_connections,
     std::shared_ptr<EventEngine> posix_ee,
-    std::shared_ptr<EventEngine> oracle_ee) {
+    std::shared_ptr<EventEngine> oracle_ee,
+    int tcp_info_sample_interval_ms = 0) {
   std::list<Connection> connections;
   auto memory_quota = std::make_unique<grpc_core::MemoryQuota>(
       grpc_core::MakeRefCounted<grpc_core::channelz::ResourceQuotaNode>("bar"));
@@ -107,6 +120,10 @@ std::list<Connection> CreateConnectedEndpoints(
     args = args.Set(GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD,
                     kMinMessageSize);
   }
+  if (tcp_info_sample_interval_ms != 0) {
+    args = args.Set(GRPC_ARG_TCP_INFO_SAMPLE_INTERVAL_MS,
+                    tcp_info_sample_interval_ms);
+  }
   ChannelArgsEndpointConfig config(args);
   auto listener = oracle_ee->CreateListener(
       std::move(accept_cb),
@@ -337,6 +354,143 @@ TEST_P(PosixEndpointTest, MultipleIPv6ConnectionsToOneOracleListenerTest) {
   worker->Wait();
 }
 
+#ifdef GRPC_LINUX_ERRQUEUE
+TEST_P(PosixEndpointTest, TcpInfoIsSampledAndExportedToChannelz) {
+  if (PosixPoller() == nullptr) {
+    return;
+  }
+  static std::atomic<int> rtt_samples{0};
+  static bool hook_registered = false;
+  if (!std::exchange(hook_registered, true)) {
+    grpc_core::RegisterHistogramCollectionHook(
+        [](const grpc_core::InstrumentMetadata::Description* instrument,
+           absl::Span<const std::string>, int64_t) {
+          if (instrument->domain == TcpInfoDomain::Domain() &&
+              instrument->name == "grpc.tcp.rtt") {
+            rtt_samples.fetch_add(1, std::memory_order_relaxed);
+          }
+        });
+  }
+  rtt_samples.store(0, std::memory_order_relaxed);
+  Worker* worker = new Worker(GetPosixEE(), PosixPoller());
+  worker->Start();
+  {
+    auto connections = CreateConnectedEndpoints(
+        *PosixPoller(), GetParam(), 1, GetPosixEE(), GetOracleEE(),
+        /*tcp_info_sample_interval_ms=*/1);
+    auto client_endpoint = std::move(connections.front().client_endpoint);
+    auto server_endpoint = std::move(connections.front().server_endpoint);
+    connections.clear();
+    EXPECT_NE(QueryExtension<ChannelzExtension>(client_endpoint.get()),
+              nullptr);
+    for (int i = 0; i < 10; i++) {
+      ASSERT_TRUE(SendValidatePayload(GetNextSendMessage(),
+                                      client_endpoint.get(),
+                                      server_endpoint.get())
+                      .ok());
+      ASSERT_TRUE(SendValidatePayload(GetNextSendMessage(),
+                                      server_endpoint.get(),
+                                      client_endpoint.get())
+                      .ok());
+      absl::SleepFor(absl::Milliseconds(2));
+    }
+    auto impl = std::make_shared<grpc_core::channelz::DataSinkImplementation>();
+    {
+      grpc_core::channelz::DataSink sink(
+          impl,
+          std::make_shared<grpc_core::channelz::DataSinkCompletionNotification>(
+              [] {}));
+      QueryExtension<ChannelzExtension>(client_endpoint.get())->AddData(sink);
+    }
+    grpc_core::Json::Object data = impl->Finalize(/*timed_out=*/false);
+    auto tcp_info = data.find("tcp_info");
+    ASSERT_NE(tcp_info, data.end());
+    ASSERT_EQ(tcp_info->second.type(), grpc_core::Json::Type::kObject);
+    const grpc_core::Json::Object& properties = tcp_info->second.object();
+    for (absl::string_view key : {"rtt_us", "rtt_variance_us",
+                                  "congestion_window", "total_retransmits"}) {
+      EXPECT_NE(properties.find(std::string(key)), properties.end()) << key;
+    }
+  }
+  worker->Wait();
+  EXPECT_GT(rtt_samples.load(std::memory_order_relaxed), 0);
+}
+#endif  // GRPC_LINUX_ERRQUEUE
+
+namespace {
+
+TcpInfoCounters TcpInfoSample(int64_t time_ms, uint32_t total_retrans) {
+  TcpInfoCounters counters;
+  counters.time =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(time_ms);
+  counters.total_retrans = total_retrans;
+  return counters;
+}
+
+}  // namespace
+
+TEST(TcpInfoDeltasTest, RetransmitsAreTheChangeSinceLastSample) {
+  EXPECT_EQ(
+      ComputeTcpInfoDeltas(TcpInfoSample(0, 5), TcpInfoSample(10, 12))
+          .retransmits,
+      7u);
+  // The kernel counter is 32 bits and may wrap.
+  EXPECT_EQ(ComputeTcpInfoDeltas(TcpInfoSample(0, 0xfffffffe),
+                                 TcpInfoSample(10, 1))
+                .retransmits,
+            3u);
+}
+
+TEST(TcpInfoDeltasTest, BusyAndLimitedTimesArePercentages) {
+  TcpInfoCounters last = TcpInfoSample(0, 0);
+  last.has_busy_time = true;
+  last.busy_time_us = 1000;
+  last.rwnd_limited_us = 100;
+  last.sndbuf_limited_us = 200;
+  TcpInfoCounters now = TcpInfoSample(10, 0);
+  now.has_busy_time = true;
+  now.busy_time_us = 6000;
+  now.rwnd_limited_us = 2600;
+  now.sndbuf_limited_us = 1200;
+  // 5000us busy out of 10ms, 2500us and 1000us of that limited.
+  TcpInfoDeltas deltas = ComputeTcpInfoDeltas(last, now);
+  EXPECT_EQ(deltas.busy_percent, 50);
+  EXPECT_EQ(deltas.rwnd_limited_percent, 50);
+  EXPECT_EQ(deltas.sndbuf_limited_percent, 20);
+}
+
+TEST(TcpInfoDeltasTest, BusyPercentIsCapped) {
+  TcpInfoCounters last = TcpInfoSample(0, 0);
+  last.has_busy_time = true;
+  TcpInfoCounters now = TcpInfoSample(10, 0);
+  now.has_busy_time = true;
+  // Busy time is counted at a finer granularity than the sample times.
+  now.busy_time_us = 10900;
+  EXPECT_EQ(ComputeTcpInfoDeltas(last, now).busy_percent, 100);
+}
+
+TEST(TcpInfoDeltasTest, IdleConnectionHasNoLimitedPercentages) {
+  TcpInfoCounters last = TcpInfoSample(0, 0);
+  last.has_busy_time = true;
+  TcpInfoCounters now = TcpInfoSample(10, 0);
+  now.has_busy_time = true;
+  TcpInfoDeltas deltas = ComputeTcpInfoDeltas(last, now);
+  EXPECT_EQ(deltas.busy_percent, 0);
+  EXPECT_FALSE(deltas.rwnd_limited_percent.has_value());
+  EXPECT_FALSE(deltas.sndbuf_limited_percent.has_value());
+}
+
+TEST(TcpInfoDeltasTest, OnlyRetransmitsWithoutBusyTime) {
+  TcpInfoCounters last = TcpInfoSample(0, 1);
+  TcpInfoCounters now = TcpInfoSample(10, 2);
+  now.busy_time_us = 5000;
+  TcpInfoDeltas deltas = ComputeTcpInfoDeltas(last, now);
+  EXPECT_EQ(deltas.retransmits, 1u);
+  EXPECT_FALSE(deltas.busy_percent.has_value());
+  EXPECT_FALSE(deltas.rwnd_limited_percent.has_value());
+  EXPECT_FALSE(deltas.sndbuf_limited_percent.has_value());
+}
+
 // Test with zero copy enabled and disabled.
 INSTANTIATE_TEST_SUITE_P(PosixEndpoint, PosixEndpointTest,
                          ::testing::ValuesIn({false, true}), &TestScenarioName);
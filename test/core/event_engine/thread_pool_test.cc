@@ -248,6 +248,29 @@ TYPED_TEST(ThreadPoolTest, ScalesWhenBackloggedFromSingleThreadLocalQueue) {
   p.Quiesce();
 }
 
+TEST(WorkStealingThreadPoolTest, ReplacesBlockedThreadsWithoutThrottling) {
+  // A saturated pool otherwise starts at most one thread per second, which
+  // would take over 10 seconds here.
+  constexpr int pool_thread_count = 4;
+  constexpr int blocked_closure_count = 16;
+  WorkStealingThreadPool p(pool_thread_count);
+  grpc_core::Notification all_blocked;
+  grpc_core::Notification unblock;
+  std::atomic<int> blocked{0};
+  for (int i = 0; i < blocked_closure_count; i++) {
+    p.Run([&]() {
+      ScopedBlockingRegion blocking_region;
+      if (blocked.fetch_add(1) + 1 == blocked_closure_count) {
+        all_blocked.Notify();
+      }
+      unblock.WaitForNotification();
+    });
+  }
+  EXPECT_TRUE(all_blocked.WaitForNotificationWithTimeout(absl::Seconds(8)));
+  unblock.Notify();
+  p.Quiesce();
+}
+
 TYPED_TEST(ThreadPoolTest, QuiesceRaceStressTest) {
   constexpr int cycle_count = 333;
   constexpr int thread_count = 8;
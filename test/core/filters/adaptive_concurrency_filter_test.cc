@@ -0,0 +1,164 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_filter.h"
+
+#include <grpc/impl/channel_arg_names.h>
+
+#include <memory>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/util/time.h"
+#include "test/core/filters/filter_test.h"
+#include "test/core/test_util/fake_stats_plugin.h"
+
+using ::testing::_;
+using ::testing::AllOf;
+using ::testing::Optional;
+
+namespace grpc_core {
+namespace {
+
+constexpr absl::string_view kPriorityKey = "x-priority";
+
+const absl::Status kRejected =
+    absl::ResourceExhaustedError("Adaptive concurrency limit exceeded");
+
+class AdaptiveConcurrencyFilterTest
+    : public FilterTest<AdaptiveConcurrencyFilter> {
+ protected:
+  AdaptiveConcurrencyFilterTest() {
+    GlobalStatsPluginRegistryTestPeer::ResetGlobalStatsPluginRegistry();
+    stats_plugin_ = FakeStatsPluginBuilder()
+                        .UseDisabledByDefaultMetrics(true)
+                        .BuildAndRegister();
+  }
+
+  ~AdaptiveConcurrencyFilterTest() override {
+    GlobalStatsPluginRegistryTestPeer::ResetGlobalStatsPluginRegistry();
+  }
+
+  // Channel args for a limit of \a initial_limit, with priorities read from
+  // kPriorityKey.
+  static ChannelArgs TestChannelArgs(int initial_limit) {
+    return ChannelArgs()
+        .Set(GRPC_ARG_ENABLE_ADAPTIVE_CONCURRENCY_LIMIT, true)
+        .Set(GRPC_ARG_ADAPTIVE_CONCURRENCY_MIN_LIMIT, 1)
+        .Set(GRPC_ARG_ADAPTIVE_CONCURRENCY_INITIAL_LIMIT, initial_limit)
+        .Set(GRPC_ARG_ADAPTIVE_CONCURRENCY_PRIORITY_METADATA_KEY, kPriorityKey);
+  }
+
+  std::shared_ptr<FakeStatsPlugin> stats_plugin_;
+};
+
+TEST_F(AdaptiveConcurrencyFilterTest, RejectsCallsOverTheLimit) {
+  auto channel = MakeChannel(TestChannelArgs(1)).value();
+  Call admitted(channel);
+  EXPECT_EVENT(Started(&admitted, _));
+  admitted.Start(admitted.NewClientMetadata({{":path", "/foo/bar"}}));
+  Step();
+  // The filter test doesn't finalize calls, so the first stays in flight.
+  Call rejected(channel);
+  EXPECT_EVENT(Finished(&rejected, HasMetadataResult(kRejected)));
+  rejected.Start(rejected.NewClientMetadata({{":path", "/foo/bar"}}));
+  Step();
+}
+
+TEST_F(AdaptiveConcurrencyFilterTest, RejectionCarriesRecentLatencyAsPushback) {
+  auto limits = MakeRefCounted<AdaptiveConcurrencyLimits>(TestChannelArgs(1));
+  // Unregistered methods share a single limiter; teach it the latency calls
+  // have been seeing.
+  absl::string_view label;
+  AdaptiveConcurrencyLimiter* limiter =
+      limits->GetLimiter(nullptr, "/foo/bar", &label);
+  EXPECT_EQ(label, "other");
+  ASSERT_TRUE(
+      limiter->TryAcquire(AdaptiveConcurrencyLimiter::Priority::kCritical));
+  limiter->OnSample(Duration::Milliseconds(250));
+  ASSERT_TRUE(
+      limiter->TryAcquire(AdaptiveConcurrencyLimiter::Priority::kCritical));
+  auto channel = MakeChannel(TestChannelArgs(1).SetObject(limits)).value();
+  Call call(channel);
+  EXPECT_EVENT(Finished(
+      &call, AllOf(HasMetadataResult(kRejected),
+                   HasMetadataKeyValue("grpc-retry-pushback-ms", "250"))));
+  call.Start(call.NewClientMetadata(
+      {{":path", "/foo/bar"}, {kPriorityKey, "critical"}}));
+  Step();
+}
+
+TEST_F(AdaptiveConcurrencyFilterTest, ShedsSheddableCallsBeforeCritical) {
+  // Sheddable calls get half of the limit of two.
+  auto channel = MakeChannel(TestChannelArgs(2)).value();
+  Call sheddable(channel);
+  EXPECT_EVENT(Started(&sheddable, _));
+  sheddable.Start(sheddable.NewClientMetadata(
+      {{":path", "/foo/bar"}, {kPriorityKey, "sheddable"}}));
+  Step();
+  Call shed(channel);
+  EXPECT_EVENT(Finished(&shed, HasMetadataResult(kRejected)));
+  shed.Start(shed.NewClientMetadata(
+      {{":path", "/foo/bar"}, {kPriorityKey, "sheddable"}}));
+  Step();
+  Call critical(channel);
+  EXPECT_EVENT(Started(&critical, _));
+  critical.Start(critical.NewClientMetadata(
+      {{":path", "/foo/bar"}, {kPriorityKey, "critical"}}));
+  Step();
+}
+
+TEST_F(AdaptiveConcurrencyFilterTest, ReportsMetrics) {
+  auto rejected_calls =
+      GlobalInstrumentsRegistryTestPeer::FindUInt64CounterHandleByName(
+          "grpc.server.adaptive_concurrency.rejected_calls");
+  auto limit =
+      GlobalInstrumentsRegistryTestPeer::FindCallbackInt64GaugeHandleByName(
+          "grpc.server.adaptive_concurrency.limit");
+  auto in_flight_calls =
+      GlobalInstrumentsRegistryTestPeer::FindCallbackInt64GaugeHandleByName(
+          "grpc.server.adaptive_concurrency.in_flight_calls");
+  ASSERT_TRUE(rejected_calls.has_value());
+  ASSERT_TRUE(limit.has_value());
+  ASSERT_TRUE(in_flight_calls.has_value());
+  auto channel = MakeChannel(TestChannelArgs(1)).value();
+  Call admitted(channel);
+  EXPECT_EVENT(Started(&admitted, _));
+  admitted.Start(admitted.NewClientMetadata({{":path", "/foo/bar"}}));
+  Step();
+  Call rejected(channel);
+  EXPECT_EVENT(Finished(&rejected, HasMetadataResult(kRejected)));
+  rejected.Start(rejected.NewClientMetadata(
+      {{":path", "/foo/bar"}, {kPriorityKey, "sheddable"}}));
+  Step();
+  EXPECT_THAT(stats_plugin_->GetUInt64CounterValue(
+                  *rejected_calls, {"other", "sheddable"}, {}),
+              Optional(1));
+  stats_plugin_->TriggerCallbacks();
+  EXPECT_THAT(stats_plugin_->GetInt64CallbackGaugeValue(*limit, {"other"}, {}),
+              Optional(1));
+  EXPECT_THAT(stats_plugin_->GetInt64CallbackGaugeValue(*in_flight_calls,
+                                                        {"other"}, {}),
+              Optional(1));
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,159 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_limiter.h"
+
+#include <stdint.h>
+
+#include "gtest/gtest.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+namespace {
+
+using Priority = AdaptiveConcurrencyLimiter::Priority;
+
+AdaptiveConcurrencyLimiter::Options TestOptions(uint32_t initial_limit) {
+  AdaptiveConcurrencyLimiter::Options options;
+  options.initial_limit = initial_limit;
+  options.min_limit = 1;
+  options.max_limit = 1000;
+  return options;
+}
+
+// Runs \a rounds of: fill the limiter with critical calls, then complete
+// them all with \a latency.
+void RunSaturated(AdaptiveConcurrencyLimiter& limiter, Duration latency,
+                  int rounds) {
+  for (int i = 0; i < rounds; ++i) {
+    uint32_t admitted = 0;
+    while (limiter.TryAcquire(Priority::kCritical)) ++admitted;
+    for (uint32_t j = 0; j < admitted; ++j) limiter.OnSample(latency);
+  }
+}
+
+TEST(AdaptiveConcurrencyLimiterTest, AdmitsUpToLimit) {
+  AdaptiveConcurrencyLimiter limiter(TestOptions(10));
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_TRUE(limiter.TryAcquire(Priority::kCritical)) << i;
+  }
+  EXPECT_FALSE(limiter.TryAcquire(Priority::kCritical));
+  EXPECT_EQ(limiter.in_flight(), 10u);
+  limiter.OnDropped(/*overloaded=*/false);
+  EXPECT_EQ(limiter.limit(), 10u);
+  EXPECT_TRUE(limiter.TryAcquire(Priority::kCritical));
+}
+
+TEST(AdaptiveConcurrencyLimiterTest, LowerPrioritiesAreShedFirst) {
+  AdaptiveConcurrencyLimiter limiter(TestOptions(10));
+  // Sheddable calls only get half of the limit.
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(limiter.TryAcquire(Priority::kSheddable)) << i;
+  }
+  EXPECT_FALSE(limiter.TryAcquire(Priority::kSheddable));
+  // Default calls get 90%.
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(limiter.TryAcquire(Priority::kDefault)) << i;
+  }
+  EXPECT_FALSE(limiter.TryAcquire(Priority::kDefault));
+  // Critical calls can use the rest.
+  EXPECT_TRUE(limiter.TryAcquire(Priority::kCritical));
+  EXPECT_FALSE(limiter.TryAcquire(Priority::kCritical));
+}
+
+TEST(AdaptiveConcurrencyLimiterTest, ParsePriority) {
+  EXPECT_EQ(AdaptiveConcurrencyLimiter::ParsePriority("critical"),
+            Priority::kCritical);
+  EXPECT_EQ(AdaptiveConcurrencyLimiter::ParsePriority("Sheddable"),
+            Priority::kSheddable);
+  EXPECT_EQ(AdaptiveConcurrencyLimiter::ParsePriority("default"),
+            Priority::kDefault);
+  EXPECT_EQ(AdaptiveConcurrencyLimiter::ParsePriority("bogus"),
+            Priority::kDefault);
+}
+
+TEST(AdaptiveConcurrencyLimiterTest, GrowsWhileLatencyIsFlat) {
+  AdaptiveConcurrencyLimiter limiter(TestOptions(10));
+  RunSaturated(limiter, Duration::Milliseconds(10), 20);
+  EXPECT_GT(limiter.limit(), 10u);
+  EXPECT_EQ(limiter.no_load_latency(), Duration::Milliseconds(10));
+}
+
+TEST(AdaptiveConcurrencyLimiterTest, ShrinksWhenLatencyRises) {
+  AdaptiveConcurrencyLimiter limiter(TestOptions(100));
+  RunSaturated(limiter, Duration::Milliseconds(10), 1);
+  const uint32_t limit = limiter.limit();
+  // Latency well past the tolerance: the gradient bottoms out at 0.5.
+  RunSaturated(limiter, Duration::Milliseconds(100), 5);
+  EXPECT_LT(limiter.limit(), limit);
+  EXPECT_EQ(limiter.no_load_latency(), Duration::Milliseconds(10));
+  EXPECT_GT(limiter.recent_latency(), Duration::Milliseconds(10));
+}
+
+TEST(AdaptiveConcurrencyLimiterTest, DoesNotGrowWhenUnderused) {
+  AdaptiveConcurrencyLimiter limiter(TestOptions(100));
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(limiter.TryAcquire(Priority::kDefault));
+    limiter.OnSample(Duration::Milliseconds(10));
+  }
+  EXPECT_EQ(limiter.limit(), 100u);
+}
+
+TEST(AdaptiveConcurrencyLimiterTest, OverloadDropsShrinkLimit) {
+  AdaptiveConcurrencyLimiter limiter(TestOptions(100));
+  ASSERT_TRUE(limiter.TryAcquire(Priority::kDefault));
+  limiter.OnDropped(/*overloaded=*/true);
+  EXPECT_EQ(limiter.limit(), 90u);
+  EXPECT_EQ(limiter.in_flight(), 0u);
+}
+
+TEST(AdaptiveConcurrencyLimiterTest, LimitStaysWithinBounds) {
+  AdaptiveConcurrencyLimiter::Options options;
+  options.initial_limit = 10;
+  options.min_limit = 5;
+  options.max_limit = 20;
+  AdaptiveConcurrencyLimiter limiter(options);
+  RunSaturated(limiter, Duration::Milliseconds(1), 100);
+  EXPECT_EQ(limiter.limit(), 20u);
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_TRUE(limiter.TryAcquire(Priority::kCritical));
+    limiter.OnDropped(/*overloaded=*/true);
+  }
+  EXPECT_EQ(limiter.limit(), 5u);
+}
+
+TEST(AdaptiveConcurrencyLimiterTest, NoLoadLatencyFollowsSlowerWorkload) {
+  AdaptiveConcurrencyLimiter limiter(TestOptions(10));
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(limiter.TryAcquire(Priority::kCritical));
+    limiter.OnSample(Duration::Milliseconds(1));
+  }
+  EXPECT_EQ(limiter.no_load_latency(), Duration::Milliseconds(1));
+  // After two full windows without a fast sample, the old minimum is
+  // forgotten.
+  for (uint64_t i = 0; i < 2 * AdaptiveConcurrencyLimiter::kWindowSamples;
+       ++i) {
+    ASSERT_TRUE(limiter.TryAcquire(Priority::kCritical));
+    limiter.OnSample(Duration::Milliseconds(5));
+  }
+  EXPECT_EQ(limiter.no_load_latency(), Duration::Milliseconds(5));
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
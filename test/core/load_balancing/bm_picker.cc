@@ -13,11 +13,20 @@
 // limitations under the License.
 
 #include <benchmark/benchmark.h>
+#include <grpc/credentials.h>
 #include <grpc/grpc.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
 
 #include <memory>
+#include <string>
+#include <variant>
 
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "src/core/client_channel/subchannel_interface_internal.h"
 #include "src/core/config/core_configuration.h"
 #include "src/core/lib/address_utils/parse_address.h"
@@ -28,6 +37,9 @@
 #include "src/core/load_balancing/lb_policy.h"
 #include "src/core/util/json/json_reader.h"
 #include "test/core/test_util/build.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_lb_policies.h"
+#include "test/cpp/end2end/rls_server.h"
 
 namespace grpc_core {
 namespace {
@@ -166,9 +178,11 @@ class BenchmarkHelper : public std::enable_shared_from_this<BenchmarkHelper> {
       LOG(FATAL) << "unimplemented";
     }
 
+    // Used by the RLS policy for its channel to the lookup service.
     RefCountedPtr<grpc_channel_credentials> GetUnsafeChannelCredentials()
         override {
-      LOG(FATAL) << "unimplemented";
+      return RefCountedPtr<grpc_channel_credentials>(
+          grpc_insecure_credentials_create());
     }
 
     grpc_event_engine::experimental::EventEngine* GetEventEngine() override {
@@ -241,6 +255,83 @@ PICKER_BENCHMARK(
     weighted_round_robin,
     "[{\"weighted_round_robin\":{\"enableOobLoadReport\":false}}]");
 
+// An RLS policy whose lookup service sends every request for /foo/bar to a
+// single fixed_address_lb child.
+class RlsBenchmarkHelper {
+ public:
+  RlsBenchmarkHelper()
+      : port_(grpc_pick_unused_port_or_die()),
+        config_(absl::StrCat(
+            "[{\"rls_experimental\":{"
+            "  \"routeLookupConfig\":{"
+            "    \"lookupService\":\"localhost:",
+            port_,
+            "\","
+            "    \"grpcKeybuilders\":[{"
+            "      \"names\":[{\"service\":\"foo\",\"method\":\"bar\"}]"
+            "    }],"
+            "    \"cacheSizeBytes\":1048576"
+            "  },"
+            "  \"childPolicy\":[{\"fixed_address_lb\":{}}],"
+            "  \"childPolicyConfigTargetFieldName\":\"address\""
+            "}}]")) {
+    service_.SetResponse(grpc::testing::BuildRlsRequest({}),
+                         grpc::testing::BuildRlsResponse({"ipv4:127.0.0.1:1"}));
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort(absl::StrCat("localhost:", port_),
+                             grpc::InsecureServerCredentials());
+    builder.RegisterService(&service_);
+    server_ = builder.BuildAndStart();
+    CHECK(server_ != nullptr);
+    helper_ = std::make_unique<BenchmarkHelper>("rls_experimental", config_);
+    helper_->UpdateLbPolicy(1);
+  }
+
+  // Returns a picker that serves /foo/bar from its cache snapshot, once the
+  // lookup has completed and the child is ready.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> GetCacheHitPicker() {
+    for (int i = 0; i < 10000; ++i) {
+      auto result = helper_->GetPicker()->Pick(LoadBalancingPolicy::PickArgs{
+          "/foo/bar",
+          nullptr,
+          nullptr,
+      });
+      if (std::holds_alternative<LoadBalancingPolicy::PickResult::Complete>(
+              result.result)) {
+        // Let any remaining child state updates produce their pickers.
+        absl::SleepFor(absl::Milliseconds(100));
+        return helper_->GetPicker();
+      }
+      absl::SleepFor(absl::Milliseconds(1));
+    }
+    LOG(FATAL) << "RLS picker never completed a pick";
+  }
+
+ private:
+  const int port_;
+  const std::string config_;
+  grpc::testing::RlsServiceImpl service_;
+  std::unique_ptr<grpc::Server> server_;
+  std::unique_ptr<BenchmarkHelper> helper_;
+};
+
+// Picks from a fresh RLS cache entry on several threads at once, which used
+// to serialize on the policy's mutex.
+void BM_RlsCacheHitPick(benchmark::State& state) {
+  static auto* picker = []() {
+    static auto* helper = new RlsBenchmarkHelper();
+    return helper->GetCacheHitPicker().release();
+  }();
+  for (auto _ : state) {
+    picker->Pick(LoadBalancingPolicy::PickArgs{
+        "/foo/bar",
+        nullptr,
+        nullptr,
+    });
+  }
+}
+BENCHMARK(BM_RlsCacheHitPick)->ThreadRange(1, 32)->UseRealTime();
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -252,6 +343,8 @@ void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
 
 int main(int argc, char** argv) {
   ::benchmark::Initialize(&argc, argv);
+  grpc_core::CoreConfiguration::RegisterEphemeralBuilder(
+      grpc_core::RegisterFixedAddressLoadBalancingPolicy);
   grpc_init();
   benchmark::RunTheBenchmarksNamespaced();
   grpc_shutdown();
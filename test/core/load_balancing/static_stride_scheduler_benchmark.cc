@@ -15,19 +15,23 @@
 //
 
 #include <benchmark/benchmark.h>
+#include <grpc/support/port_platform.h>
 
 #include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <optional>
+#include <utility>
 #include <vector>
 
 #include "absl/algorithm/container.h"
+#include "absl/functional/any_invocable.h"
 #include "absl/random/random.h"
 #include "absl/types/span.h"
 #include "src/core/load_balancing/weighted_round_robin/static_stride_scheduler.h"
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/no_destruct.h"
+#include "src/core/util/per_cpu.h"
 
 namespace grpc_core {
 namespace {
@@ -84,6 +88,50 @@ BENCHMARK(BM_StaticStrideSchedulerPickAtomic)
     ->RangeMultiplier(kRangeMultiplier)
     ->Range(kNumWeightsLow, kNumWeightsHigh);
 
+// Sequence sources shared by all threads of the multi-threaded benchmarks.
+std::atomic<uint32_t> g_shared_sequence{0};
+
+struct alignas(GPR_CACHELINE_SIZE) SequenceShard {
+  std::atomic<uint32_t> sequence{0};
+};
+
+PerCpu<SequenceShard>& PerCpuSequence() {
+  static NoDestruct<PerCpu<SequenceShard>> sequence(
+      PerCpuOptions().SetCpusPerShard(2).SetMaxShards(64));
+  return *sequence;
+}
+
+StaticStrideScheduler MakeScheduler(
+    absl::AnyInvocable<uint32_t()> next_sequence_func) {
+  std::optional<StaticStrideScheduler> scheduler = StaticStrideScheduler::Make(
+      absl::MakeSpan(Weights()).subspan(0, kNumWeightsLow * kRangeMultiplier),
+      std::move(next_sequence_func));
+  GRPC_CHECK(scheduler.has_value());
+  return std::move(*scheduler);
+}
+
+void BM_StaticStrideSchedulerPickSharedAtomic(benchmark::State& state) {
+  static const NoDestruct<StaticStrideScheduler> scheduler(MakeScheduler([] {
+    return g_shared_sequence.fetch_add(1, std::memory_order_relaxed);
+  }));
+  for (auto s : state) {
+    benchmark::DoNotOptimize(scheduler->Pick());
+  }
+}
+BENCHMARK(BM_StaticStrideSchedulerPickSharedAtomic)->ThreadRange(1, 64);
+
+void BM_StaticStrideSchedulerPickPerCpu(benchmark::State& state) {
+  static const NoDestruct<StaticStrideScheduler> scheduler(
+      MakeScheduler([] {
+        return PerCpuSequence().this_cpu().sequence.fetch_add(
+            1, std::memory_order_relaxed);
+      }));
+  for (auto s : state) {
+    benchmark::DoNotOptimize(scheduler->Pick());
+  }
+}
+BENCHMARK(BM_StaticStrideSchedulerPickPerCpu)->ThreadRange(1, 64);
+
 void BM_StaticStrideSchedulerMake(benchmark::State& state) {
   uint32_t sequence = 0;
   for (auto s : state) {
@@ -119,9 +119,14 @@ TEST(SockaddrResolverTest, MainTest) {
       grpc_core::CoreConfiguration::Get()
           .resolver_registry()
           .LookupResolverFactory("unix-abstract");
+  grpc_core::ResolverFactory* shm = grpc_core::CoreConfiguration::Get()
+                                        .resolver_registry()
+                                        .LookupResolverFactory("shm");
 
   test_succeeds(uds, "unix:///tmp/sockaddr_resolver_test");
   test_succeeds(uds_abstract, "unix-abstract:sockaddr_resolver_test");
+  test_succeeds(shm, "shm:///tmp/sockaddr_resolver_test");
+  test_succeeds(shm, "shm:/tmp/sockaddr_resolver_test");
 #endif  // GRPC_HAVE_UNIX_SOCKET
 }
 
@@ -0,0 +1,190 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/resource_tracker/cgroup_resource_tracker.h"
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/experiments/experiments.h"
+#include "src/core/util/time.h"
+
+namespace grpc_core {
+namespace {
+
+using ::testing::DoubleNear;
+using ::testing::UnorderedElementsAre;
+
+// Fake cgroup v2 tree: <root>/proc_self_cgroup names the cgroup
+// "/test.slice", whose files live in <root>/sys/test.slice.
+class CgroupResourceTrackerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    root_ = std::filesystem::path(::testing::TempDir()) /
+            absl::StrCat("cgroup_resource_tracker_test_",
+                         ::testing::UnitTest::GetInstance()
+                             ->current_test_info()
+                             ->name());
+    std::filesystem::remove_all(root_);
+    std::filesystem::create_directories(root_ / "sys" / "test.slice");
+    WriteFile(root_ / "proc_self_cgroup", "0::/test.slice\n");
+    time_cache_.TestOnlySetNow(Timestamp::FromMillisecondsAfterProcessEpoch(
+        1000000));
+  }
+
+  void TearDown() override { std::filesystem::remove_all(root_); }
+
+  static void WriteFile(const std::filesystem::path& path,
+                        absl::string_view contents) {
+    std::ofstream(path) << contents;
+  }
+
+  void WriteCgroupFile(absl::string_view name, absl::string_view contents) {
+    WriteFile(root_ / "sys" / "test.slice" / std::string(name), contents);
+  }
+
+  std::unique_ptr<CgroupResourceTracker> Create() {
+    CgroupResourceTracker::Options options;
+    options.cgroup_root = (root_ / "sys").string();
+    options.proc_self_cgroup = (root_ / "proc_self_cgroup").string();
+    options.sample_interval = Duration::Seconds(1);
+    return CgroupResourceTracker::Create(options);
+  }
+
+  void AdvanceTime(Duration duration) {
+    time_cache_.TestOnlySetNow(time_cache_.Now() + duration);
+  }
+
+  static double GetValue(const CgroupResourceTracker& tracker,
+                         const std::string& metric) {
+    absl::StatusOr<double> value = tracker.GetMetricValue(metric);
+    EXPECT_TRUE(value.ok()) << metric << ": " << value.status();
+    return value.value_or(-1);
+  }
+
+  std::filesystem::path root_;
+  ScopedTimeCache time_cache_;
+};
+
+TEST_F(CgroupResourceTrackerTest, NoCgroupV2Entry) {
+  WriteFile(root_ / "proc_self_cgroup", "1:memory:/test.slice\n");
+  WriteCgroupFile("memory.current", "100\n");
+  EXPECT_EQ(Create(), nullptr);
+}
+
+TEST_F(CgroupResourceTrackerTest, NoMemoryAccounting) {
+  EXPECT_EQ(Create(), nullptr);
+}
+
+TEST_F(CgroupResourceTrackerTest, MemoryRelativeToLimit) {
+  WriteCgroupFile("memory.current", "256\n");
+  WriteCgroupFile("memory.max", "1024\n");
+  auto tracker = Create();
+  ASSERT_NE(tracker, nullptr);
+  EXPECT_THAT(tracker->GetMetrics(),
+              UnorderedElementsAre(ResourceTracker::kMemoryMetric));
+  EXPECT_DOUBLE_EQ(GetValue(*tracker, ResourceTracker::kMemoryMetric), 0.25);
+  // Values are only re-read once the sample interval has passed.
+  WriteCgroupFile("memory.current", "512\n");
+  EXPECT_DOUBLE_EQ(GetValue(*tracker, ResourceTracker::kMemoryMetric), 0.25);
+  AdvanceTime(Duration::Seconds(1));
+  EXPECT_DOUBLE_EQ(GetValue(*tracker, ResourceTracker::kMemoryMetric), 0.5);
+}
+
+TEST_F(CgroupResourceTrackerTest, MemoryExcludesInactivePageCache) {
+  WriteCgroupFile("memory.current", "900\n");
+  WriteCgroupFile("memory.max", "1000\n");
+  WriteCgroupFile("memory.stat",
+                  "anon 100\nfile 800\nactive_file 100\n"
+                  "inactive_file 700\n");
+  auto tracker = Create();
+  ASSERT_NE(tracker, nullptr);
+  EXPECT_THAT(GetValue(*tracker, ResourceTracker::kMemoryMetric),
+              DoubleNear(0.2, 1e-9));
+}
+
+#ifdef GPR_LINUX
+TEST_F(CgroupResourceTrackerTest, NotRegisteredUnlessExperimentEnabled) {
+  ASSERT_FALSE(IsContainerResourceTrackerEnabled());
+  MaybeRegisterCgroupResourceTracker();
+  EXPECT_EQ(ResourceTracker::Get(), nullptr);
+}
+
+TEST_F(CgroupResourceTrackerTest, MemoryWithoutLimit) {
+  WriteCgroupFile("memory.current", "4096\n");
+  WriteCgroupFile("memory.max", "max\n");
+  auto tracker = Create();
+  ASSERT_NE(tracker, nullptr);
+  // Relative to physical memory, which is certainly more than 4 KiB.
+  const double memory = GetValue(*tracker, ResourceTracker::kMemoryMetric);
+  EXPECT_GT(memory, 0);
+  EXPECT_LT(memory, 1);
+}
+#endif  // GPR_LINUX
+
+TEST_F(CgroupResourceTrackerTest, CpuRelativeToQuota) {
+  WriteCgroupFile("memory.current", "0\n");
+  WriteCgroupFile("memory.max", "1024\n");
+  WriteCgroupFile("cpu.max", "200000 100000\n");
+  WriteCgroupFile("cpu.stat",
+                  "usage_usec 1000000\nuser_usec 600000\n"
+                  "system_usec 400000\n");
+  auto tracker = Create();
+  ASSERT_NE(tracker, nullptr);
+  // CPU needs two samples.
+  EXPECT_FALSE(tracker->GetMetricValue(ResourceTracker::kCpuMetric).ok());
+  // One CPU second over two wall seconds, with a limit of two CPUs.
+  WriteCgroupFile("cpu.stat", "usage_usec 2000000\n");
+  AdvanceTime(Duration::Seconds(2));
+  EXPECT_THAT(GetValue(*tracker, ResourceTracker::kCpuMetric),
+              DoubleNear(0.25, 1e-9));
+  EXPECT_THAT(tracker->GetMetrics(),
+              UnorderedElementsAre(ResourceTracker::kMemoryMetric,
+                                   ResourceTracker::kCpuMetric));
+}
+
+TEST_F(CgroupResourceTrackerTest, Pressure) {
+  WriteCgroupFile("memory.current", "0\n");
+  WriteCgroupFile("memory.max", "1024\n");
+  WriteCgroupFile("memory.pressure",
+                  "some avg10=12.50 avg60=3.00 avg300=1.00 total=1234\n"
+                  "full avg10=5.00 avg60=1.00 avg300=0.50 total=567\n");
+  WriteCgroupFile("cpu.pressure",
+                  "some avg10=50.00 avg60=40.00 avg300=30.00 total=9999\n");
+  auto tracker = Create();
+  ASSERT_NE(tracker, nullptr);
+  EXPECT_THAT(
+      GetValue(*tracker, CgroupResourceTracker::kMemoryPressureMetric),
+      DoubleNear(0.125, 1e-9));
+  EXPECT_THAT(GetValue(*tracker, CgroupResourceTracker::kCpuPressureMetric),
+              DoubleNear(0.5, 1e-9));
+}
+
+TEST_F(CgroupResourceTrackerTest, UnknownMetric) {
+  WriteCgroupFile("memory.current", "0\n");
+  WriteCgroupFile("memory.max", "1024\n");
+  auto tracker = Create();
+  ASSERT_NE(tracker, nullptr);
+  EXPECT_FALSE(tracker->GetMetricValue("disk").ok());
+}
+
+}  // namespace
+}  // namespace grpc_core
@@ -0,0 +1,137 @@
+// Copyright 2026 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/str_format.h"
+#include "fuzztest/fuzztest.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/security/authorization/grpc_authorization_engine.h"
+#include "src/core/lib/security/authorization/matchers.h"
+#include "src/core/lib/security/authorization/rbac_policy.h"
+#include "src/core/util/matchers.h"
+#include "test/core/test_util/evaluate_args_test_util.h"
+
+using fuzztest::Arbitrary;
+using fuzztest::ElementOf;
+using fuzztest::InRange;
+using fuzztest::StringOf;
+using fuzztest::TupleOf;
+using fuzztest::VectorOf;
+
+namespace grpc_core {
+namespace {
+
+// A path rule is (matcher type, case sensitive, value).
+using PathRule = std::tuple<int, bool, std::string>;
+// A policy is a list of path rules that are combined with AND if the bool is
+// true and with OR otherwise. The int selects whether the rules are placed in
+// the permissions, the principals, or both.
+using PolicySpec = std::tuple<std::vector<PathRule>, bool, int>;
+
+StringMatcher MakeStringMatcher(const PathRule& rule) {
+  static constexpr StringMatcher::Type kTypes[] = {
+      StringMatcher::Type::kExact, StringMatcher::Type::kPrefix,
+      StringMatcher::Type::kSuffix, StringMatcher::Type::kContains};
+  return StringMatcher::Create(kTypes[std::get<0>(rule)], std::get<2>(rule),
+                               std::get<1>(rule))
+      .value();
+}
+
+Rbac::Permission MakePermission(const PolicySpec& spec) {
+  std::vector<std::unique_ptr<Rbac::Permission>> permissions;
+  for (const auto& rule : std::get<0>(spec)) {
+    permissions.push_back(std::make_unique<Rbac::Permission>(
+        Rbac::Permission::MakePathPermission(MakeStringMatcher(rule))));
+  }
+  return std::get<1>(spec)
+             ? Rbac::Permission::MakeAndPermission(std::move(permissions))
+             : Rbac::Permission::MakeOrPermission(std::move(permissions));
+}
+
+Rbac::Principal MakePrincipal(const PolicySpec& spec) {
+  std::vector<std::unique_ptr<Rbac::Principal>> principals;
+  for (const auto& rule : std::get<0>(spec)) {
+    principals.push_back(std::make_unique<Rbac::Principal>(
+        Rbac::Principal::MakePathPrincipal(MakeStringMatcher(rule))));
+  }
+  return std::get<1>(spec)
+             ? Rbac::Principal::MakeAndPrincipal(std::move(principals))
+             : Rbac::Principal::MakeOrPrincipal(std::move(principals));
+}
+
+std::map<std::string, Rbac::Policy> MakePolicies(
+    const std::vector<PolicySpec>& specs) {
+  std::map<std::string, Rbac::Policy> policies;
+  for (size_t i = 0; i < specs.size(); ++i) {
+    const PolicySpec& spec = specs[i];
+    const int placement = std::get<2>(spec);
+    policies[absl::StrFormat("policy%03d", i)] = Rbac::Policy(
+        placement != 1 ? MakePermission(spec)
+                       : Rbac::Permission::MakeAnyPermission(),
+        placement != 0 ? MakePrincipal(spec)
+                       : Rbac::Principal::MakeAnyPrincipal());
+  }
+  return policies;
+}
+
+void IndexedEvaluationMatchesLinearScan(std::vector<PolicySpec> specs,
+                                        bool allow, std::string path) {
+  GrpcAuthorizationEngine engine(
+      Rbac("authz", allow ? Rbac::Action::kAllow : Rbac::Action::kDeny,
+           MakePolicies(specs)));
+  EvaluateArgsTestUtil util;
+  util.AddPairToMetadata(":path", path.c_str());
+  EvaluateArgs args = util.MakeEvaluateArgs();
+  // Reference evaluation: check every policy in order.
+  std::string expected_policy_name;
+  for (auto& p : MakePolicies(specs)) {
+    PolicyAuthorizationMatcher matcher(std::move(p.second));
+    if (matcher.Matches(args)) {
+      expected_policy_name = p.first;
+      break;
+    }
+  }
+  AuthorizationEngine::Decision decision = engine.Evaluate(args);
+  EXPECT_EQ(decision.matching_policy_name, expected_policy_name);
+  EXPECT_EQ(decision.type, (expected_policy_name.empty() != allow)
+                               ? AuthorizationEngine::Decision::Type::kAllow
+                               : AuthorizationEngine::Decision::Type::kDeny);
+}
+
+// Paths from a small alphabet, so that exact and prefix rules collide often.
+auto AnyPath() { return StringOf(ElementOf({'/', 'a', 'b', '.', 'A'})); }
+
+auto AnyPathRule() {
+  return TupleOf(InRange(0, 3), Arbitrary<bool>(), AnyPath());
+}
+
+auto AnyPolicySpec() {
+  return TupleOf(VectorOf(AnyPathRule()).WithMaxSize(4), Arbitrary<bool>(),
+                 InRange(0, 2));
+}
+
+FUZZ_TEST(GrpcAuthorizationEngineFuzzTest, IndexedEvaluationMatchesLinearScan)
+    .WithDomains(VectorOf(AnyPolicySpec()).WithMaxSize(16), Arbitrary<bool>(),
+                 AnyPath());
+
+}  // namespace
+}  // namespace grpc_core
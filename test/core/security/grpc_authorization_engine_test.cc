@@ -19,11 +19,13 @@
 #include <grpc/support/port_platform.h>
 
 #include <memory>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "src/core/lib/security/authorization/audit_logging.h"
 #include "src/core/util/json/json.h"
+#include "src/core/util/matchers.h"
 #include "test/core/test_util/audit_logging_utils.h"
 #include "test/core/test_util/evaluate_args_test_util.h"
 
@@ -139,6 +141,84 @@ TEST_F(GrpcAuthorizationEngineTest, DenyEngineWithEmptyPolicies) {
   EXPECT_TRUE(decision.matching_policy_name.empty());
 }
 
+TEST_F(GrpcAuthorizationEngineTest, PathIndexedPoliciesMatchExactAndPrefix) {
+  std::map<std::string, Rbac::Policy> policies;
+  policies["policy1"] = Rbac::Policy(
+      Rbac::Permission::MakePathPermission(
+          StringMatcher::Create(StringMatcher::Type::kExact, "/foo.Bar/Other")
+              .value()),
+      Rbac::Principal::MakeAnyPrincipal());
+  policies["policy2"] = Rbac::Policy(
+      Rbac::Permission::MakePathPermission(
+          StringMatcher::Create(StringMatcher::Type::kPrefix, "/foo.Bar/")
+              .value()),
+      Rbac::Principal::MakeAnyPrincipal());
+  policies["policy3"] = Rbac::Policy(
+      Rbac::Permission::MakePathPermission(
+          StringMatcher::Create(StringMatcher::Type::kExact, kRpcMethod)
+              .value()),
+      Rbac::Principal::MakeAnyPrincipal());
+  Rbac rbac("authz", Rbac::Action::kAllow, std::move(policies));
+  GrpcAuthorizationEngine engine(std::move(rbac));
+  EXPECT_EQ(engine.num_path_indexed_policies(), 3);
+  AuthorizationEngine::Decision decision =
+      engine.Evaluate(evaluate_args_util_.MakeEvaluateArgs());
+  EXPECT_EQ(decision.type, AuthorizationEngine::Decision::Type::kAllow);
+  // policy3 also matches, but policy2 comes first.
+  EXPECT_EQ(decision.matching_policy_name, "policy2");
+}
+
+TEST_F(GrpcAuthorizationEngineTest, PathIndexedPolicyDoesNotMatchOtherPath) {
+  std::map<std::string, Rbac::Policy> policies;
+  policies["policy1"] = Rbac::Policy(
+      Rbac::Permission::MakeOrPermission(
+          []() {
+            std::vector<std::unique_ptr<Rbac::Permission>> permissions;
+            permissions.push_back(std::make_unique<Rbac::Permission>(
+                Rbac::Permission::MakePathPermission(
+                    StringMatcher::Create(StringMatcher::Type::kExact,
+                                          "/foo.Bar/Other")
+                        .value())));
+            permissions.push_back(std::make_unique<Rbac::Permission>(
+                Rbac::Permission::MakePathPermission(
+                    StringMatcher::Create(StringMatcher::Type::kPrefix,
+                                          "/foo.Baz/")
+                        .value())));
+            return permissions;
+          }()),
+      Rbac::Principal::MakeAnyPrincipal());
+  Rbac rbac("authz", Rbac::Action::kDeny, std::move(policies));
+  GrpcAuthorizationEngine engine(std::move(rbac));
+  EXPECT_EQ(engine.num_path_indexed_policies(), 1);
+  AuthorizationEngine::Decision decision =
+      engine.Evaluate(evaluate_args_util_.MakeEvaluateArgs());
+  EXPECT_EQ(decision.type, AuthorizationEngine::Decision::Type::kAllow);
+  EXPECT_TRUE(decision.matching_policy_name.empty());
+}
+
+TEST_F(GrpcAuthorizationEngineTest, UnindexedPolicyEvaluatedInOrder) {
+  std::map<std::string, Rbac::Policy> policies;
+  // Case-insensitive path matchers are not indexed.
+  policies["policy1"] = Rbac::Policy(
+      Rbac::Permission::MakePathPermission(
+          StringMatcher::Create(StringMatcher::Type::kExact, "/FOO.BAR/ECHO",
+                                /*case_sensitive=*/false)
+              .value()),
+      Rbac::Principal::MakeAnyPrincipal());
+  policies["policy2"] = Rbac::Policy(
+      Rbac::Permission::MakePathPermission(
+          StringMatcher::Create(StringMatcher::Type::kExact, kRpcMethod)
+              .value()),
+      Rbac::Principal::MakeAnyPrincipal());
+  Rbac rbac("authz", Rbac::Action::kAllow, std::move(policies));
+  GrpcAuthorizationEngine engine(std::move(rbac));
+  EXPECT_EQ(engine.num_path_indexed_policies(), 1);
+  AuthorizationEngine::Decision decision =
+      engine.Evaluate(evaluate_args_util_.MakeEvaluateArgs());
+  EXPECT_EQ(decision.type, AuthorizationEngine::Decision::Type::kAllow);
+  EXPECT_EQ(decision.matching_policy_name, "policy1");
+}
+
 TEST_F(GrpcAuthorizationEngineTest, AuditLoggerNoneNotInvokedOnAllowedRequest) {
   Rbac::Policy policy1(Rbac::Permission::MakeAnyPermission(),
                        Rbac::Principal::MakeAnyPrincipal());
@@ -175,6 +175,59 @@ TEST(GrpcCompletionQueueTest, TestCqEndOp) {
   }
 }
 
+TEST(GrpcCompletionQueueTest, TestCqNextBatch) {
+  grpc_event events[4];
+  grpc_completion_queue* cc;
+  grpc_cq_completion completions[3];
+  void* tags[3];
+  grpc_cq_polling_type polling_types[] = {
+      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING};
+  grpc_completion_queue_attributes attr = {};
+
+  LOG_TEST("test_cq_next_batch");
+
+  attr.version = 1;
+  attr.cq_completion_type = GRPC_CQ_NEXT;
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(polling_types); i++) {
+    grpc_core::ExecCtx exec_ctx;
+    attr.cq_polling_type = polling_types[i];
+    cc = grpc_completion_queue_create(
+        grpc_completion_queue_factory_lookup(&attr), &attr, nullptr);
+
+    for (size_t j = 0; j < GPR_ARRAY_SIZE(tags); j++) {
+      tags[j] = create_test_tag();
+      ASSERT_TRUE(grpc_cq_begin_op(cc, tags[j]));
+      grpc_cq_end_op(cc, tags[j], absl::OkStatus(), do_nothing_end_completion,
+                     nullptr, &completions[j]);
+    }
+
+    // The first call is capped by max_events, the second one drains the
+    // rest, and the third one times out on the empty queue.
+    ASSERT_EQ(grpc_completion_queue_next_batch(
+                  cc, events, 2, gpr_inf_past(GPR_CLOCK_REALTIME), nullptr),
+              2u);
+    ASSERT_EQ(grpc_completion_queue_next_batch(
+                  cc, &events[2], 2, gpr_inf_past(GPR_CLOCK_REALTIME), nullptr),
+              1u);
+    for (size_t j = 0; j < GPR_ARRAY_SIZE(tags); j++) {
+      ASSERT_EQ(events[j].type, GRPC_OP_COMPLETE);
+      ASSERT_EQ(events[j].tag, tags[j]);
+      ASSERT_TRUE(events[j].success);
+    }
+    ASSERT_EQ(grpc_completion_queue_next_batch(
+                  cc, events, 4, gpr_inf_past(GPR_CLOCK_REALTIME), nullptr),
+              1u);
+    ASSERT_EQ(events[0].type, GRPC_QUEUE_TIMEOUT);
+
+    grpc_completion_queue_shutdown(cc);
+    ASSERT_EQ(grpc_completion_queue_next_batch(
+                  cc, events, 4, gpr_inf_past(GPR_CLOCK_REALTIME), nullptr),
+              1u);
+    ASSERT_EQ(events[0].type, GRPC_QUEUE_SHUTDOWN);
+    grpc_completion_queue_destroy(cc);
+  }
+}
+
 TEST(GrpcCompletionQueueTest, TestCqTlsCacheFull) {
   grpc_event ev;
   grpc_completion_queue* cc;
@@ -56,6 +56,24 @@ void BM_BucketForLinearHistogram(benchmark::State& state) {
 }
 BENCHMARK(BM_BucketForLinearHistogram)->Range(2, 32768);
 
+void BM_BucketForLogLinearHistogram(benchmark::State& state) {
+  constexpr int64_t kMax = 1000000;
+  LogLinearHistogramShape shape(kMax, state.range(0));
+  std::vector<int64_t> values;
+  values.reserve(kMax);
+  auto gen = absl::BitGen();
+  for (int64_t i = 0; i < kMax; ++i) {
+    values.push_back(absl::Uniform<int64_t>(gen, 0, kMax));
+  }
+  int64_t i = 0;
+  for (auto _ : state) {
+    const int64_t n = values[i % kMax];
+    benchmark::DoNotOptimize(shape.BucketFor(n));
+    ++i;
+  }
+}
+BENCHMARK(BM_BucketForLogLinearHistogram)->DenseRange(1, 10, 3);
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -17,6 +17,7 @@
 #include <random>
 #include <thread>
 
+#include "src/core/telemetry/histogram.h"
 #include "src/core/telemetry/instrument.h"
 
 namespace grpc_core {
@@ -36,6 +37,12 @@ class HighContentionDomain : public InstrumentDomain<HighContentionDomain> {
   static constexpr auto kLabels = std::tuple();
   static inline const auto kCounter =
       RegisterCounter("high_contention", "Desc", "unit");
+  static inline const auto kExponentialHistogram =
+      RegisterHistogram<ExponentialHistogramShape>(
+          "high_contention_exponential", "Desc", "unit", 1000000, 32);
+  static inline const auto kLogLinearHistogram =
+      RegisterHistogram<LogLinearHistogramShape>(
+          "high_contention_log_linear", "Desc", "unit", 1000000, 3);
 };
 
 void BM_IncrementLowContentionInstrument(benchmark::State& state) {
@@ -54,6 +61,27 @@ void BM_IncrementHighContentionInstrument(benchmark::State& state) {
 }
 BENCHMARK(BM_IncrementHighContentionInstrument)->ThreadRange(1, 64);
 
+// Record cost of each histogram shape, including the collection hooks.
+template <typename Handle>
+void IncrementHistogram(benchmark::State& state, const Handle& histogram) {
+  auto storage = HighContentionDomain::GetStorage();
+  int64_t value = 1;
+  for (auto _ : state) {
+    storage->Increment(histogram, value);
+    value = value * 33 % 1000003;
+  }
+}
+
+void BM_IncrementExponentialHistogram(benchmark::State& state) {
+  IncrementHistogram(state, HighContentionDomain::kExponentialHistogram);
+}
+BENCHMARK(BM_IncrementExponentialHistogram)->ThreadRange(1, 64);
+
+void BM_IncrementLogLinearHistogram(benchmark::State& state) {
+  IncrementHistogram(state, HighContentionDomain::kLogLinearHistogram);
+}
+BENCHMARK(BM_IncrementLogLinearHistogram)->ThreadRange(1, 64);
+
 }  // namespace
 }  // namespace grpc_core
 
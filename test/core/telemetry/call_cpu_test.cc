@@ -0,0 +1,248 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/telemetry/call_cpu.h"
+
+#include <grpc/grpc.h>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "absl/types/span.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/lib/promise/context.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/telemetry/call_cpu_account.h"
+#include "src/core/telemetry/call_tracer.h"
+#include "src/core/util/sync.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::Pair;
+
+// Collects the values recorded into CallCpuDomain's histograms, keyed by
+// "<instrument> <method>".
+class RecordedCpuTimes {
+ public:
+  static RecordedCpuTimes& Get() {
+    static RecordedCpuTimes* recorded = new RecordedCpuTimes();
+    return *recorded;
+  }
+
+  std::map<std::string, std::vector<int64_t>> Take() {
+    MutexLock lock(&mu_);
+    return std::exchange(values_, {});
+  }
+
+ private:
+  RecordedCpuTimes() {
+    RegisterHistogramCollectionHook(
+        [this](const InstrumentMetadata::Description* instrument,
+               absl::Span<const std::string> labels, int64_t value) {
+          if (instrument->domain != CallCpuDomain::Domain()) return;
+          MutexLock lock(&mu_);
+          values_[absl::StrCat(instrument->name, " ", labels[0])].push_back(
+              value);
+        });
+  }
+
+  Mutex mu_;
+  std::map<std::string, std::vector<int64_t>> values_ ABSL_GUARDED_BY(mu_);
+};
+
+// Keeps the current thread busy for about `duration` of wall time.
+void Spin(absl::Duration duration) {
+  const absl::Time deadline = absl::Now() + duration;
+  while (absl::Now() < deadline) {
+  }
+}
+
+class CallCpuTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    if (CallCpuMeter::ThreadCpuNanos() == 0) {
+      GTEST_SKIP() << "Thread CPU time is not available on this platform";
+    }
+    RecordedCpuTimes::Get().Take();
+  }
+
+  RefCountedPtr<Arena> arena_ = SimpleArenaAllocator()->MakeArena();
+  std::shared_ptr<StatsPlugin> plugin_ = MakeCallCpuStatsPlugin();
+};
+
+TEST_F(CallCpuTest, ClientCallRecordsMeteredTimeWhenDestroyed) {
+  {
+    promise_detail::Context<Arena> arena_ctx(arena_.get());
+    EXPECT_EQ(plugin_->GetClientCallTracer(
+                  Slice::FromStaticString("/pkg.Service/Method"), true,
+                  nullptr),
+              nullptr);
+  }
+  ASSERT_NE(arena_->GetContext<CallCpuAccount>(), nullptr);
+  {
+    CallCpuMeter meter(arena_.get());
+    Spin(absl::Milliseconds(5));
+  }
+  // Time outside a meter isn't charged.
+  Spin(absl::Milliseconds(20));
+  EXPECT_GE(arena_->GetContext<CallCpuAccount>()->cpu_ns(), 1000000);
+  EXPECT_THAT(RecordedCpuTimes::Get().Take(), ::testing::IsEmpty());
+  arena_.reset();
+  EXPECT_THAT(
+      RecordedCpuTimes::Get().Take(),
+      ElementsAre(Pair("grpc.client.call.cpu_time_per_call pkg.Service/Method",
+                       ElementsAre(::testing::AllOf(::testing::Ge(1000),
+                                                    ::testing::Lt(20000))))));
+}
+
+TEST_F(CallCpuTest, NestedMetersChargeTheOutermostCall) {
+  auto inner_arena = SimpleArenaAllocator()->MakeArena();
+  for (Arena* arena : {arena_.get(), inner_arena.get()}) {
+    promise_detail::Context<Arena> arena_ctx(arena);
+    plugin_->GetClientCallTracer(Slice::FromStaticString("/pkg.Service/Method"),
+                                 false, nullptr);
+  }
+  {
+    CallCpuMeter outer(arena_.get());
+    CallCpuMeter inner(inner_arena.get());
+    Spin(absl::Milliseconds(5));
+  }
+  EXPECT_GE(arena_->GetContext<CallCpuAccount>()->cpu_ns(), 1000000);
+  EXPECT_EQ(inner_arena->GetContext<CallCpuAccount>()->cpu_ns(), 0);
+}
+
+TEST_F(CallCpuTest, ArenaWithoutAccountIsNotMetered) {
+  CallCpuMeter meter(arena_.get());
+  // A meter that didn't start doesn't block an inner one from measuring.
+  auto inner_arena = SimpleArenaAllocator()->MakeArena();
+  {
+    promise_detail::Context<Arena> arena_ctx(inner_arena.get());
+    plugin_->GetClientCallTracer(Slice::FromStaticString("/pkg.Service/Method"),
+                                 false, nullptr);
+  }
+  {
+    CallCpuMeter inner(inner_arena.get());
+    Spin(absl::Milliseconds(5));
+  }
+  EXPECT_GE(inner_arena->GetContext<CallCpuAccount>()->cpu_ns(), 1000000);
+}
+
+TEST_F(CallCpuTest, MeterKeepsTheCallAliveUntilItStops) {
+  {
+    promise_detail::Context<Arena> arena_ctx(arena_.get());
+    plugin_->GetClientCallTracer(Slice::FromStaticString("/pkg.Service/Method"),
+                                 true, nullptr);
+  }
+  {
+    CallCpuMeter meter(arena_.get());
+    // The call finishes while it's being metered.
+    arena_.reset();
+    Spin(absl::Milliseconds(5));
+    EXPECT_THAT(RecordedCpuTimes::Get().Take(), ::testing::IsEmpty());
+  }
+  EXPECT_THAT(
+      RecordedCpuTimes::Get().Take(),
+      ElementsAre(Pair("grpc.client.call.cpu_time_per_call pkg.Service/Method",
+                       ElementsAre(::testing::Ge(1000)))));
+}
+
+TEST_F(CallCpuTest, CallV3ClientCallIsAccountedWhilePluginExists) {
+  MaybeAddClientCallCpuAccount(
+      arena_.get(), Slice::FromStaticString("/pkg.Service/Method"), true);
+  ASSERT_NE(arena_->GetContext<CallCpuAccount>(), nullptr);
+  {
+    CallCpuMeter meter(arena_.get());
+    Spin(absl::Milliseconds(5));
+  }
+  arena_.reset();
+  EXPECT_THAT(
+      RecordedCpuTimes::Get().Take(),
+      ElementsAre(Pair("grpc.client.call.cpu_time_per_call pkg.Service/Method",
+                       ElementsAre(::testing::Ge(1000)))));
+  plugin_.reset();
+  auto arena = SimpleArenaAllocator()->MakeArena();
+  MaybeAddClientCallCpuAccount(
+      arena.get(), Slice::FromStaticString("/pkg.Service/Method"), true);
+  EXPECT_EQ(arena->GetContext<CallCpuAccount>(), nullptr);
+}
+
+TEST_F(CallCpuTest, CallV3ServerCallIsRecordedUnderItsMethod) {
+  grpc_metadata_batch initial_metadata;
+  initial_metadata.Set(HttpPathMetadata(),
+                       Slice::FromStaticString("/pkg.Service/Method"));
+  MaybeAddServerCallCpuAccount(arena_.get(), initial_metadata);
+  {
+    CallCpuMeter meter(arena_.get());
+    Spin(absl::Milliseconds(5));
+  }
+  arena_.reset();
+  // Unregistered methods share one label.
+  EXPECT_THAT(RecordedCpuTimes::Get().Take(),
+              ElementsAre(Pair("grpc.server.call.cpu_time_per_call other",
+                               ElementsAre(::testing::Ge(1000)))));
+}
+
+TEST_F(CallCpuTest, ServerCallIsRecordedUnderItsMethod) {
+  {
+    promise_detail::Context<Arena> arena_ctx(arena_.get());
+    auto* server_tracer = plugin_->GetServerCallTracer(nullptr);
+    ASSERT_NE(server_tracer, nullptr);
+    grpc_metadata_batch initial_metadata;
+    initial_metadata.Set(HttpPathMetadata(),
+                         Slice::FromStaticString("/pkg.Service/Method"));
+    initial_metadata.Set(GrpcRegisteredMethod(), reinterpret_cast<void*>(1));
+    server_tracer->RecordReceivedInitialMetadata(&initial_metadata);
+    CallCpuMeter meter(arena_.get());
+    Spin(absl::Milliseconds(5));
+  }
+  arena_.reset();
+  EXPECT_THAT(
+      RecordedCpuTimes::Get().Take(),
+      ElementsAre(Pair("grpc.server.call.cpu_time_per_call pkg.Service/Method",
+                       ElementsAre(::testing::Ge(1000)))));
+}
+
+TEST_F(CallCpuTest, ServerCallWithoutMethodRecordsNothing) {
+  {
+    promise_detail::Context<Arena> arena_ctx(arena_.get());
+    plugin_->GetServerCallTracer(nullptr);
+    CallCpuMeter meter(arena_.get());
+    Spin(absl::Milliseconds(1));
+  }
+  arena_.reset();
+  EXPECT_THAT(RecordedCpuTimes::Get().Take(), ::testing::IsEmpty());
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  auto r = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return r;
+}
@@ -0,0 +1,173 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/telemetry/call_latency.h"
+
+#include <grpc/event_engine/internal/write_event.h>
+#include <grpc/grpc.h>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "absl/types/span.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/lib/promise/context.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/telemetry/call_tracer.h"
+#include "src/core/util/sync.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using grpc_event_engine::experimental::internal::WriteEvent;
+using ::testing::ElementsAre;
+using ::testing::Pair;
+
+// Collects the values recorded into CallLatencyDomain, keyed by
+// "<instrument> <method>".
+class RecordedLatencies {
+ public:
+  static RecordedLatencies& Get() {
+    static RecordedLatencies* recorded = new RecordedLatencies();
+    return *recorded;
+  }
+
+  std::map<std::string, std::vector<int64_t>> Take() {
+    MutexLock lock(&mu_);
+    return std::exchange(values_, {});
+  }
+
+ private:
+  RecordedLatencies() {
+    RegisterHistogramCollectionHook(
+        [this](const InstrumentMetadata::Description* instrument,
+               absl::Span<const std::string> labels, int64_t value) {
+          if (instrument->domain != CallLatencyDomain::Domain()) return;
+          MutexLock lock(&mu_);
+          values_[absl::StrCat(instrument->name, " ", labels[0])].push_back(
+              value);
+        });
+  }
+
+  Mutex mu_;
+  std::map<std::string, std::vector<int64_t>> values_ ABSL_GUARDED_BY(mu_);
+};
+
+class CallLatencyTest : public ::testing::Test {
+ protected:
+  void SetUp() override { RecordedLatencies::Get().Take(); }
+
+  RefCountedPtr<Arena> arena_ = SimpleArenaAllocator()->MakeArena();
+  std::shared_ptr<StatsPlugin> plugin_ = MakeCallLatencyStatsPlugin();
+};
+
+TEST_F(CallLatencyTest, ClientStages) {
+  promise_detail::Context<Arena> arena_ctx(arena_.get());
+  auto* call_tracer = plugin_->GetClientCallTracer(
+      Slice::FromStaticString("/pkg.Service/Method"), true, nullptr);
+  auto* attempt_tracer = call_tracer->StartNewAttempt(false);
+  attempt_tracer->RecordAnnotation("Delayed LB pick complete.");
+  auto tcp_tracer = attempt_tracer->StartNewTcpTrace();
+  ASSERT_NE(tcp_tracer, nullptr);
+  // Only the first write of the attempt is followed.
+  EXPECT_EQ(attempt_tracer->StartNewTcpTrace(), nullptr);
+  const absl::Time sent = absl::Now() + absl::Milliseconds(1);
+  tcp_tracer->RecordEvent(WriteEvent::kSendMsg, absl::Now(), 0, {});
+  tcp_tracer->RecordEvent(WriteEvent::kSent, sent, 0, {});
+  tcp_tracer->RecordEvent(WriteEvent::kAcked, sent + absl::Microseconds(250),
+                          0, {});
+  attempt_tracer->RecordEnd();
+  auto recorded = RecordedLatencies::Get().Take();
+  EXPECT_THAT(
+      recorded,
+      ElementsAre(
+          Pair("grpc.client.attempt.kernel_send_latency pkg.Service/Method",
+               ElementsAre(::testing::Ge(1000))),
+          Pair("grpc.client.attempt.lb_pick_latency pkg.Service/Method",
+               ElementsAre(::testing::Ge(0))),
+          Pair("grpc.client.attempt.network_latency pkg.Service/Method",
+               ElementsAre(250)),
+          Pair("grpc.client.attempt.transport_write_queue_latency "
+               "pkg.Service/Method",
+               ElementsAre(::testing::Ge(0))),
+          Pair("grpc.client.call.name_resolution_latency pkg.Service/Method",
+               ElementsAre(::testing::Ge(0)))));
+}
+
+TEST_F(CallLatencyTest, RetriesResolveOnce) {
+  promise_detail::Context<Arena> arena_ctx(arena_.get());
+  auto* call_tracer = plugin_->GetClientCallTracer(
+      Slice::FromStaticString("/pkg.Service/Method"), false, nullptr);
+  call_tracer->StartNewAttempt(false)->RecordEnd();
+  call_tracer->StartNewAttempt(false)->RecordEnd();
+  auto recorded = RecordedLatencies::Get().Take();
+  EXPECT_THAT(recorded,
+              ElementsAre(Pair("grpc.client.call.name_resolution_latency other",
+                               ElementsAre(::testing::Ge(0)))));
+}
+
+TEST_F(CallLatencyTest, ServerStages) {
+  promise_detail::Context<Arena> arena_ctx(arena_.get());
+  auto* server_tracer = plugin_->GetServerCallTracer(nullptr);
+  grpc_metadata_batch initial_metadata;
+  initial_metadata.Set(HttpPathMetadata(),
+                       Slice::FromStaticString("/pkg.Service/Method"));
+  initial_metadata.Set(GrpcRegisteredMethod(), reinterpret_cast<void*>(1));
+  server_tracer->RecordReceivedInitialMetadata(&initial_metadata);
+  server_tracer->RecordAnnotation("Call published to application.");
+  grpc_metadata_batch trailing_metadata;
+  server_tracer->RecordSendTrailingMetadata(&trailing_metadata);
+  server_tracer->RecordEnd(nullptr);
+  auto recorded = RecordedLatencies::Get().Take();
+  EXPECT_THAT(
+      recorded,
+      ElementsAre(Pair("grpc.server.call.handler_latency pkg.Service/Method",
+                       ElementsAre(::testing::Ge(0))),
+                  Pair("grpc.server.call.queue_latency pkg.Service/Method",
+                       ElementsAre(::testing::Ge(0)))));
+}
+
+TEST_F(CallLatencyTest, UnpublishedServerCallRecordsNothing) {
+  promise_detail::Context<Arena> arena_ctx(arena_.get());
+  auto* server_tracer = plugin_->GetServerCallTracer(nullptr);
+  grpc_metadata_batch initial_metadata;
+  initial_metadata.Set(HttpPathMetadata(),
+                       Slice::FromStaticString("/pkg.Service/Method"));
+  server_tracer->RecordReceivedInitialMetadata(&initial_metadata);
+  grpc_metadata_batch trailing_metadata;
+  server_tracer->RecordSendTrailingMetadata(&trailing_metadata);
+  server_tracer->RecordEnd(nullptr);
+  EXPECT_THAT(RecordedLatencies::Get().Take(), ::testing::IsEmpty());
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  auto r = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return r;
+}
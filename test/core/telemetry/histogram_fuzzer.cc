@@ -12,6 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 #include "fuzztest/fuzztest.h"
 #include "gtest/gtest.h"
 #include "src/core/telemetry/histogram.h"
@@ -152,5 +157,106 @@ TEST(HistogramFuzzer, ExponentialHistogramBucketForIsCorrectRegression8) {
   ExponentialHistogramBucketForIsCorrect(389599954, 2, 2133);
 }
 
+void LogLinearHistogramBucketForIsCorrect(int64_t max, int precision_bits,
+                                          int64_t value) {
+  LogLinearHistogramShape shape(max, precision_bits);
+  for (size_t i = 1; i < shape.bounds().size(); ++i) {
+    ASSERT_GT(shape.bounds()[i], shape.bounds()[i - 1]);
+  }
+  ASSERT_GT(shape.bounds().back(), max);
+  size_t bucket = shape.BucketFor(value);
+  EXPECT_EQ(bucket, BucketInBoundsFor(shape.bounds(), value))
+      << "max: " << max << " precision_bits: " << precision_bits
+      << " value: " << value << "\n"
+      << " bounds: " << absl::StrJoin(shape.bounds(), ",");
+  if (value < 0 || value >= max) return;
+  // Within range, every bucket is at most 2^-precision_bits of its lower
+  // bound wide.
+  const int64_t lower = shape.LowerBound(bucket);
+  const int64_t upper = shape.bounds()[bucket];
+  EXPECT_LE(lower, value);
+  EXPECT_LT(value, upper);
+  EXPECT_LE(upper - lower, std::max<int64_t>(1, lower >> precision_bits));
+}
+FUZZ_TEST(HistogramFuzzer, LogLinearHistogramBucketForIsCorrect)
+    .WithDomains(fuzztest::InRange<int64_t>(1, 1000000000000),
+                 fuzztest::InRange(0, 10), fuzztest::Arbitrary<int64_t>());
+
+TEST(HistogramFuzzer, LogLinearHistogramSmallValuesAreExact) {
+  LogLinearHistogramShape shape(1000, 3);
+  for (size_t i = 0; i < 16; ++i) {
+    EXPECT_EQ(shape.BucketFor(i), i);
+  }
+  EXPECT_EQ(shape.BucketFor(16), 16u);
+  EXPECT_EQ(shape.BucketFor(17), 16u);
+  EXPECT_EQ(shape.BucketFor(18), 17u);
+  EXPECT_EQ(shape.BucketFor(1000000), shape.buckets() - 1);
+}
+
+TEST(HistogramFuzzer, LogLinearHistogramFullRange) {
+  LogLinearHistogramShape shape(std::numeric_limits<int64_t>::max(), 2);
+  EXPECT_EQ(shape.bounds().back(), std::numeric_limits<int64_t>::max());
+  EXPECT_EQ(shape.BucketFor(std::numeric_limits<int64_t>::max()),
+            shape.buckets() - 1);
+}
+
+TEST(HistogramFuzzer, ExponentialHistogramIndexMatchesOtelSpec) {
+  // Scale 0: buckets are (1, 2], (2, 4], (4, 8], ...
+  EXPECT_EQ(ExponentialHistogramIndex(1, 0), -1);
+  EXPECT_EQ(ExponentialHistogramIndex(2, 0), 0);
+  EXPECT_EQ(ExponentialHistogramIndex(3, 0), 1);
+  EXPECT_EQ(ExponentialHistogramIndex(4, 0), 1);
+  EXPECT_EQ(ExponentialHistogramIndex(5, 0), 2);
+  // Scale -1: buckets are (1, 4], (4, 16], ...
+  EXPECT_EQ(ExponentialHistogramIndex(4, -1), 0);
+  EXPECT_EQ(ExponentialHistogramIndex(5, -1), 1);
+  // Scale 1: buckets are (1, sqrt(2)], (sqrt(2), 2], (2, 2 * sqrt(2)], ...
+  EXPECT_EQ(ExponentialHistogramIndex(2, 1), 1);
+  EXPECT_EQ(ExponentialHistogramIndex(3, 1), 3);
+  EXPECT_EQ(ExponentialHistogramIndex(4, 1), 3);
+}
+
+TEST(HistogramFuzzer, LogLinearToExponentialHistogram) {
+  LogLinearHistogramShape shape(1000, 1);
+  std::vector<uint64_t> counts(shape.buckets());
+  for (int64_t value : {0, 0, 1, 6, 7, 100}) ++counts[shape.BucketFor(value)];
+  auto exponential = ToExponentialHistogram(shape.bounds(), counts, 1);
+  EXPECT_EQ(exponential.scale, 1);
+  EXPECT_EQ(exponential.zero_count, 2u);
+  // 1 is in bucket -1; 6 and 7 share the log-linear bucket [6, 8), which
+  // lands in (4 * sqrt(2), 8], bucket 5; 100 is in [96, 128), bucket 13.
+  EXPECT_EQ(exponential.offset, -1);
+  std::vector<uint64_t> expected(15);
+  expected[0] = 1;
+  expected[6] = 2;
+  expected[14] = 1;
+  EXPECT_EQ(exponential.bucket_counts, expected);
+}
+
+TEST(HistogramFuzzer, LogLinearToExponentialHistogramAtPowersOfTwo) {
+  for (int precision_bits : {1, 3, 7}) {
+    LogLinearHistogramShape shape(std::numeric_limits<int64_t>::max(),
+                                  precision_bits);
+    for (int k = 0; k < 63; ++k) {
+      const int64_t value = int64_t{1} << k;
+      const size_t bucket = shape.BucketFor(value);
+      std::vector<uint64_t> counts(shape.buckets());
+      counts[bucket] = 1;
+      auto exponential =
+          ToExponentialHistogram(shape.bounds(), counts, precision_bits);
+      ASSERT_EQ(exponential.bucket_counts.size(), 1u);
+      // A bucket holding only the power of two maps to the exponential
+      // bucket it ends; a wider one maps to the exponential bucket just
+      // above it, where every other value in it lies.
+      const int32_t expected =
+          shape.bounds()[bucket] - shape.LowerBound(bucket) == 1
+              ? ExponentialHistogramIndex(value, precision_bits)
+              : k << precision_bits;
+      EXPECT_EQ(exponential.offset, expected)
+          << "precision_bits: " << precision_bits << " value: " << value;
+    }
+  }
+}
+
 }  // namespace
 }  // namespace grpc_core
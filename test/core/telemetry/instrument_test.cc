@@ -15,10 +15,12 @@
 #include "src/core/telemetry/instrument.h"
 
 #include <thread>
+#include <vector>
 
 #include "absl/random/random.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "src/core/telemetry/histogram.h"
 
 namespace grpc_core {
 
@@ -30,6 +32,16 @@ using MetricsQueryTest = InstrumentTest;
 using InstrumentIndexDeathTest = InstrumentTest;
 using StorageReapingTest = InstrumentTest;
 
+class LogLinearDomain final : public InstrumentDomain<LogLinearDomain> {
+ public:
+  using Backend = HighContentionBackend;
+  static constexpr auto kLabels = Labels("grpc.method");
+
+  static inline const auto kHistogram =
+      RegisterHistogram<LogLinearHistogramShape>("log_linear_histogram",
+                                                 "Desc", "unit", 1000000, 3);
+};
+
 class MockMetricsSink : public MetricsSink {
  public:
   virtual ~MockMetricsSink() = default;
@@ -261,6 +273,29 @@ TEST_F(MetricsQueryTest, LowContentionHistogram) {
   testing::Mock::VerifyAndClearExpectations(&sink);
 }
 
+// Tests that log-linear histograms recorded under different labels merge
+// bucket by bucket when the labels are collapsed.
+TEST_F(MetricsQueryTest, LogLinearHistogramMerges) {
+  auto storage_foo = LogLinearDomain::GetStorage("foo");
+  auto storage_bar = LogLinearDomain::GetStorage("bar");
+  LogLinearHistogramShape shape(1000000, 3);
+  std::vector<uint64_t> expected(shape.buckets());
+  for (int64_t value : {0, 15, 17, 1000, 123456, 5000000}) {
+    storage_foo->Increment(LogLinearDomain::kHistogram, value);
+    storage_bar->Increment(LogLinearDomain::kHistogram, value * 3);
+    ++expected[shape.BucketFor(value)];
+    ++expected[shape.BucketFor(value * 3)];
+  }
+  testing::StrictMock<MockMetricsSink> sink;
+  EXPECT_CALL(sink, Histogram(absl::Span<const std::string>(),
+                              "log_linear_histogram", shape.bounds(),
+                              absl::MakeConstSpan(expected)));
+  MetricsQuery()
+      .OnlyMetrics({"log_linear_histogram"})
+      .CollapseLabels({"grpc.method"})
+      .Run(QueryableDomain::CreateCollectionScope(), sink);
+}
+
 // Tests gauge functionality (double, int, uint) in a low-contention domain.
 // Verifies that a GaugeProvider can register itself and provide correct values
 // during a query.
@@ -0,0 +1,161 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/ext/transport/chttp2/transport/stream_lists.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/transport/transport.h"
+#include "test/core/test_util/mock_endpoint.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr size_t kFrameSize = 16384;
+
+void DoNothing(void* /*arg*/, grpc_error_handle /*error*/) {}
+
+class WeightedFairQueuingTest : public ::testing::Test {
+ protected:
+  WeightedFairQueuingTest() {
+    auto engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+    auto mock_endpoint_controller =
+        grpc_event_engine::experimental::MockEndpointController::Create(engine);
+    mock_endpoint_controller->NoMoreReads();
+    t_ = reinterpret_cast<grpc_chttp2_transport*>(grpc_create_chttp2_transport(
+        ChannelArgs()
+            .SetObject(ResourceQuota::Default())
+            .SetObject(std::move(engine))
+            .Set(GRPC_ARG_HTTP2_WEIGHTED_FAIR_QUEUING, true),
+        OrphanablePtr<grpc_endpoint>(
+            mock_endpoint_controller->TakeCEndpoint()),
+        /*is_client=*/true));
+  }
+
+  ~WeightedFairQueuingTest() override {
+    for (grpc_chttp2_stream* s : streams_) {
+      grpc_chttp2_list_remove_writable_stream(t_, s);
+      s->write_closed = true;
+      s->read_closed = true;
+      delete s;
+    }
+    t_->Orphan();
+  }
+
+  // Creates a stream of the given weight that has data to send.
+  grpc_chttp2_stream* NewWritableStream(uint32_t weight) {
+    grpc_stream_refcount* refcount = &refcounts_.emplace_back();
+    GRPC_STREAM_REF_INIT(refcount, 1, DoNothing, nullptr, "test");
+    auto* s = new grpc_chttp2_stream(t_, refcount, nullptr, arena_.get());
+    s->id = static_cast<uint32_t>(2 * streams_.size() + 1);
+    grpc_chttp2_wfq_set_stream_weight(s, weight);
+    streams_.push_back(s);
+    EXPECT_TRUE(grpc_chttp2_list_add_writable_stream(t_, s));
+    return s;
+  }
+
+  // Runs write turns as writing.cc does under weighted fair queuing: the
+  // stream at the head of the writable list sends one frame, is charged for
+  // it and goes back into the list.
+  std::vector<grpc_chttp2_stream*> SendFrames(int turns) {
+    std::vector<grpc_chttp2_stream*> order;
+    for (int i = 0; i < turns; ++i) {
+      grpc_chttp2_stream* s;
+      if (!grpc_chttp2_list_pop_writable_stream(t_, &s)) break;
+      grpc_chttp2_wfq_charge_stream(s, kFrameSize);
+      order.push_back(s);
+      grpc_chttp2_list_add_writable_stream(t_, s);
+    }
+    return order;
+  }
+
+  static std::map<grpc_chttp2_stream*, size_t> BytesSent(
+      const std::vector<grpc_chttp2_stream*>& order) {
+    std::map<grpc_chttp2_stream*, size_t> bytes;
+    for (grpc_chttp2_stream* s : order) bytes[s] += kFrameSize;
+    return bytes;
+  }
+
+  ExecCtx exec_ctx_;
+  grpc_chttp2_transport* t_;
+  RefCountedPtr<Arena> arena_ = SimpleArenaAllocator()->MakeArena();
+  std::deque<grpc_stream_refcount> refcounts_;
+  std::vector<grpc_chttp2_stream*> streams_;
+};
+
+TEST_F(WeightedFairQueuingTest, StreamWeightIsClamped) {
+  grpc_chttp2_stream* s = NewWritableStream(GRPC_CHTTP2_DEFAULT_STREAM_WEIGHT);
+  EXPECT_EQ(s->weight, GRPC_CHTTP2_DEFAULT_STREAM_WEIGHT);
+  grpc_chttp2_wfq_set_stream_weight(s, 0);
+  EXPECT_EQ(s->weight, GRPC_CHTTP2_MIN_STREAM_WEIGHT);
+  grpc_chttp2_wfq_set_stream_weight(s, 1000);
+  EXPECT_EQ(s->weight, GRPC_CHTTP2_MAX_STREAM_WEIGHT);
+}
+
+TEST_F(WeightedFairQueuingTest, EqualWeightsTakeTurns) {
+  grpc_chttp2_stream* a = NewWritableStream(16);
+  grpc_chttp2_stream* b = NewWritableStream(16);
+  EXPECT_EQ(SendFrames(4), (std::vector<grpc_chttp2_stream*>{a, b, a, b}));
+}
+
+TEST_F(WeightedFairQueuingTest, BytesAreSharedInProportionToWeight) {
+  grpc_chttp2_stream* heavy = NewWritableStream(64);
+  grpc_chttp2_stream* light = NewWritableStream(16);
+  grpc_chttp2_stream* lightest = NewWritableStream(4);
+  auto bytes = BytesSent(SendFrames(2100));
+  // 64:16:4 is 1600:400:100 frames, give or take one frame per stream.
+  EXPECT_NEAR(bytes[heavy], 1600 * kFrameSize, kFrameSize);
+  EXPECT_NEAR(bytes[light], 400 * kFrameSize, kFrameSize);
+  EXPECT_NEAR(bytes[lightest], 100 * kFrameSize, kFrameSize);
+}
+
+TEST_F(WeightedFairQueuingTest, LateStreamStartsAtVirtualTime) {
+  grpc_chttp2_stream* bulk = NewWritableStream(16);
+  SendFrames(100);
+  // A stream that becomes writable later starts at the current virtual time,
+  // so it shares the connection from then on instead of sending a burst.
+  grpc_chttp2_stream* late = NewWritableStream(16);
+  auto bytes = BytesSent(SendFrames(20));
+  EXPECT_NEAR(bytes[bulk], 10 * kFrameSize, kFrameSize);
+  EXPECT_NEAR(bytes[late], 10 * kFrameSize, kFrameSize);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  auto ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -0,0 +1,225 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/shm/shm_endpoint.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice.h>
+#include <grpc/event_engine/slice_buffer.h>
+#include <grpc/grpc.h>
+#include <grpc/support/port_platform.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "gtest/gtest.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/util/notification.h"
+#include "test/core/test_util/passthrough_endpoint.h"
+#include "test/core/test_util/test_config.h"
+
+#ifdef GPR_LINUX
+
+namespace grpc_core {
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::GetDefaultEventEngine;
+using grpc_event_engine::experimental::PassthroughEndpoint;
+using grpc_event_engine::experimental::Slice;
+using grpc_event_engine::experimental::SliceBuffer;
+
+constexpr size_t kRingSize = 64 * 1024;
+
+class ShmEndpointTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    auto segment = ShmSegment::Create(kRingSize);
+    ASSERT_TRUE(segment.ok()) << segment.status();
+    ASSERT_EQ((*segment)->ring_size(), kRingSize);
+    auto client_segment = ShmSegment::Open((*segment)->name());
+    ASSERT_TRUE(client_segment.ok()) << client_segment.status();
+    // A mapping of our own, to play a misbehaving peer with.
+    auto peer_segment = ShmSegment::Open((*segment)->name());
+    ASSERT_TRUE(peer_segment.ok()) << peer_segment.status();
+    peer_segment_ = std::move(*peer_segment);
+    auto control = PassthroughEndpoint::MakePassthroughEndpoint(
+        1, 2, /*allow_inline_callbacks=*/false);
+    client_ = CreateShmEndpoint(std::move(*client_segment), /*is_client=*/true,
+                                std::move(control.client),
+                                GetDefaultEventEngine());
+    server_ = CreateShmEndpoint(std::move(*segment), /*is_client=*/false,
+                                std::move(control.server),
+                                GetDefaultEventEngine());
+  }
+
+  // Writes `data`, waiting for the write to complete.
+  static absl::Status Write(EventEngine::Endpoint* endpoint,
+                            const std::string& data) {
+    SliceBuffer buffer;
+    buffer.Append(Slice::FromCopiedString(data));
+    absl::Status status;
+    Notification done;
+    if (endpoint->Write(
+            [&](absl::Status s) {
+              status = std::move(s);
+              done.Notify();
+            },
+            &buffer, EventEngine::Endpoint::WriteArgs())) {
+      return absl::OkStatus();
+    }
+    done.WaitForNotification();
+    return status;
+  }
+
+  // Reads whatever is available, waiting if nothing is.
+  static absl::StatusOr<std::string> Read(EventEngine::Endpoint* endpoint) {
+    SliceBuffer buffer;
+    absl::Status status;
+    Notification done;
+    if (!endpoint->Read(
+            [&](absl::Status s) {
+              status = std::move(s);
+              done.Notify();
+            },
+            &buffer, EventEngine::Endpoint::ReadArgs())) {
+      done.WaitForNotification();
+      if (!status.ok()) return status;
+    }
+    return ToString(buffer);
+  }
+
+  static std::string ToString(SliceBuffer& buffer) {
+    std::string data(buffer.Length(), '\0');
+    buffer.MoveFirstNBytesIntoBuffer(data.size(), &data[0]);
+    return data;
+  }
+
+  static std::string Pattern(size_t size, char seed) {
+    std::string data(size, '\0');
+    for (size_t i = 0; i < size; ++i) data[i] = static_cast<char>(seed + i);
+    return data;
+  }
+
+  std::unique_ptr<ShmSegment> peer_segment_;
+  std::unique_ptr<EventEngine::Endpoint> client_;
+  std::unique_ptr<EventEngine::Endpoint> server_;
+};
+
+TEST_F(ShmEndpointTest, WrapsAroundTheRing) {
+  // Each round is more than half the ring, so the second and third wrap.
+  for (char seed : {'a', 'b', 'c'}) {
+    const std::string data = Pattern(40000, seed);
+    ASSERT_TRUE(Write(client_.get(), data).ok());
+    auto received = Read(server_.get());
+    ASSERT_TRUE(received.ok()) << received.status();
+    EXPECT_EQ(*received, data);
+  }
+}
+
+TEST_F(ShmEndpointTest, ParkedReadIsWokenByDoorbell) {
+  SliceBuffer buffer;
+  absl::Status status;
+  Notification done;
+  ASSERT_FALSE(server_->Read(
+      [&](absl::Status s) {
+        status = std::move(s);
+        done.Notify();
+      },
+      &buffer, EventEngine::Endpoint::ReadArgs()));
+  ASSERT_TRUE(Write(client_.get(), "hello").ok());
+  done.WaitForNotification();
+  ASSERT_TRUE(status.ok()) << status;
+  EXPECT_EQ(ToString(buffer), "hello");
+}
+
+TEST_F(ShmEndpointTest, ParkedWriteIsWokenByDoorbell) {
+  // Three times the ring, so the write parks until the reader drains it.
+  const std::string data = Pattern(3 * kRingSize, 'x');
+  SliceBuffer buffer;
+  buffer.Append(Slice::FromCopiedString(data));
+  absl::Status status;
+  Notification done;
+  ASSERT_FALSE(server_->Write(
+      [&](absl::Status s) {
+        status = std::move(s);
+        done.Notify();
+      },
+      &buffer, EventEngine::Endpoint::WriteArgs()));
+  std::string received;
+  while (received.size() < data.size()) {
+    auto chunk = Read(client_.get());
+    ASSERT_TRUE(chunk.ok()) << chunk.status();
+    received += *chunk;
+  }
+  done.WaitForNotification();
+  EXPECT_TRUE(status.ok()) << status;
+  EXPECT_EQ(received, data);
+}
+
+TEST_F(ShmEndpointTest, PeerCloseFailsReadsAfterRemainingData) {
+  ASSERT_TRUE(Write(client_.get(), "goodbye").ok());
+  client_.reset();
+  auto received = Read(server_.get());
+  ASSERT_TRUE(received.ok()) << received.status();
+  EXPECT_EQ(*received, "goodbye");
+  EXPECT_EQ(Read(server_.get()).status().code(),
+            absl::StatusCode::kUnavailable);
+}
+
+TEST_F(ShmEndpointTest, PeerCloseFailsParkedRead) {
+  SliceBuffer buffer;
+  absl::Status status;
+  Notification done;
+  ASSERT_FALSE(server_->Read(
+      [&](absl::Status s) {
+        status = std::move(s);
+        done.Notify();
+      },
+      &buffer, EventEngine::Endpoint::ReadArgs()));
+  client_.reset();
+  done.WaitForNotification();
+  EXPECT_EQ(status.code(), absl::StatusCode::kUnavailable);
+}
+
+TEST_F(ShmEndpointTest, CorruptedTailFailsWrite) {
+  // Claims to have consumed bytes the server never wrote.
+  peer_segment_->ring_header(1)->tail.store(1000);
+  EXPECT_EQ(Write(server_.get(), "data").code(), absl::StatusCode::kDataLoss);
+  // The endpoint stays failed.
+  EXPECT_EQ(Read(server_.get()).status().code(), absl::StatusCode::kDataLoss);
+}
+
+TEST_F(ShmEndpointTest, CorruptedHeadFailsRead) {
+  // Claims to have written more than the ring holds.
+  peer_segment_->ring_header(0)->head.store(4 * kRingSize);
+  EXPECT_EQ(Read(server_.get()).status().code(), absl::StatusCode::kDataLoss);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+#endif  // GPR_LINUX
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
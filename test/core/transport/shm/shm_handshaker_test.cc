@@ -0,0 +1,326 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/credentials.h>
+#include <grpc/grpc.h>
+#include <grpc/grpc_security.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+#include "src/core/ext/transport/shm/shm_endpoint.h"
+#include "test/core/test_util/test_config.h"
+
+#ifdef GPR_LINUX
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace grpc_core {
+namespace {
+
+constexpr absl::string_view kHttp2Preface = "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
+constexpr uint8_t kHttp2SettingsFrame = 4;
+
+std::string SocketPath() {
+  static std::atomic<int> counter{0};
+  return absl::StrCat("/tmp/shm_handshaker_test.", getpid(), ".",
+                      counter.fetch_add(1));
+}
+
+// Waits for `fd` to become readable, for up to 10 seconds.
+bool WaitReadable(int fd) {
+  pollfd p = {fd, POLLIN, 0};
+  return poll(&p, 1, 10000) == 1;
+}
+
+std::string ReadExactly(int fd, size_t n) {
+  std::string data;
+  while (data.size() < n && WaitReadable(fd)) {
+    char buf[256];
+    const ssize_t r = read(fd, buf, std::min(sizeof(buf), n - data.size()));
+    if (r <= 0) break;
+    data.append(buf, r);
+  }
+  return data;
+}
+
+void WriteAll(int fd, absl::string_view data) {
+  while (!data.empty()) {
+    const ssize_t w = write(fd, data.data(), data.size());
+    ASSERT_GT(w, 0);
+    data.remove_prefix(w);
+  }
+}
+
+sockaddr_un UnixAddress(const std::string& path) {
+  sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+  return addr;
+}
+
+std::string Request(uint8_t version) {
+  return absl::StrCat("GSHM", std::string(1, static_cast<char>(version)));
+}
+
+std::string Hello(uint8_t version, absl::string_view name) {
+  return absl::StrCat("GSHM", std::string(1, static_cast<char>(version)),
+                      std::string(1, static_cast<char>(name.size())), name);
+}
+
+class ShmHandshakerTest : public ::testing::Test {
+ protected:
+  ShmHandshakerTest()
+      : path_(SocketPath()),
+        cq_(grpc_completion_queue_create_for_next(nullptr)) {}
+
+  ~ShmHandshakerTest() override {
+    if (channel_ != nullptr) grpc_channel_destroy(channel_);
+    if (server_ != nullptr) {
+      grpc_server_shutdown_and_notify(server_, cq_, nullptr);
+      grpc_server_cancel_all_calls(server_);
+      Drain(nullptr);
+      grpc_server_destroy(server_);
+    }
+    if (fd_ >= 0) close(fd_);
+    grpc_completion_queue_shutdown(cq_);
+    while (grpc_completion_queue_next(cq_, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                      nullptr)
+               .type != GRPC_QUEUE_SHUTDOWN) {
+    }
+    grpc_completion_queue_destroy(cq_);
+    unlink(path_.c_str());
+  }
+
+  // Starts a server on path_, over "shm:" if `shm` and "unix:" otherwise.
+  void StartServer(bool shm) {
+    server_ = grpc_server_create(nullptr, nullptr);
+    grpc_server_register_completion_queue(server_, cq_, nullptr);
+    grpc_server_credentials* creds = grpc_insecure_server_credentials_create();
+    ASSERT_TRUE(grpc_server_add_http2_port(
+        server_, absl::StrCat(shm ? "shm:" : "unix:", path_).c_str(), creds));
+    grpc_server_credentials_release(creds);
+    grpc_server_start(server_);
+  }
+
+  // Creates a channel to path_ and starts it connecting.
+  void StartChannel(bool shm) {
+    grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+    channel_ = grpc_channel_create(
+        absl::StrCat(shm ? "shm:" : "unix:", path_).c_str(), creds, nullptr);
+    grpc_channel_credentials_release(creds);
+    grpc_channel_check_connectivity_state(channel_, /*try_to_connect=*/1);
+  }
+
+  bool WaitForReady() {
+    const gpr_timespec deadline = grpc_timeout_seconds_to_deadline(10);
+    while (true) {
+      grpc_connectivity_state state =
+          grpc_channel_check_connectivity_state(channel_, 1);
+      if (state == GRPC_CHANNEL_READY) return true;
+      grpc_channel_watch_connectivity_state(channel_, state, deadline, cq_,
+                                            this);
+      if (!Drain(this)) return false;
+    }
+  }
+
+  // Waits for `tag`, returning whether it succeeded.
+  bool Drain(void* tag) {
+    grpc_event ev = grpc_completion_queue_next(
+        cq_, grpc_timeout_seconds_to_deadline(10), nullptr);
+    EXPECT_EQ(ev.type, GRPC_OP_COMPLETE);
+    EXPECT_EQ(ev.tag, tag);
+    return ev.type == GRPC_OP_COMPLETE && ev.success;
+  }
+
+  // Plays a server listening on path_.
+  int Listen() {
+    const int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    EXPECT_GE(listener, 0);
+    sockaddr_un addr = UnixAddress(path_);
+    EXPECT_EQ(bind(listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)),
+              0);
+    EXPECT_EQ(listen(listener, 1), 0);
+    return listener;
+  }
+
+  // Accepts the channel's next connection to `listener`.
+  void Accept(int listener) {
+    if (fd_ >= 0) close(fd_);
+    ASSERT_TRUE(WaitReadable(listener));
+    fd_ = accept(listener, nullptr, nullptr);
+    ASSERT_GE(fd_, 0);
+  }
+
+  // Plays a server that accepts the channel's connection on path_ and reads
+  // its request for a segment.
+  void AcceptChannel() {
+    const int listener = Listen();
+    StartChannel(/*shm=*/true);
+    Accept(listener);
+    close(listener);
+    EXPECT_EQ(ReadExactly(fd_, 5), Request(1));
+  }
+
+  // Plays a client connecting to the server on path_.
+  void ConnectToServer() {
+    fd_ = socket(AF_UNIX, SOCK_STREAM, 0);
+    ASSERT_GE(fd_, 0);
+    sockaddr_un addr = UnixAddress(path_);
+    ASSERT_EQ(connect(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)),
+              0);
+  }
+
+  const std::string path_;
+  grpc_completion_queue* const cq_;
+  grpc_server* server_ = nullptr;
+  grpc_channel* channel_ = nullptr;
+  int fd_ = -1;
+};
+
+TEST_F(ShmHandshakerTest, BothSidesOptedIn) {
+  StartServer(/*shm=*/true);
+  StartChannel(/*shm=*/true);
+  EXPECT_TRUE(WaitForReady());
+}
+
+TEST_F(ShmHandshakerTest, ClientOnlyOptedInFallsBack) {
+  StartServer(/*shm=*/false);
+  StartChannel(/*shm=*/true);
+  EXPECT_TRUE(WaitForReady());
+}
+
+TEST_F(ShmHandshakerTest, ServerOnlyOptedInFallsBack) {
+  StartServer(/*shm=*/true);
+  StartChannel(/*shm=*/false);
+  EXPECT_TRUE(WaitForReady());
+}
+
+TEST_F(ShmHandshakerTest, ServerMovesToRingsOnAck) {
+  StartServer(/*shm=*/true);
+  ConnectToServer();
+  WriteAll(fd_, Request(1));
+  const std::string header = ReadExactly(fd_, 6);
+  ASSERT_EQ(header.size(), 6);
+  ASSERT_EQ(header.substr(0, 4), "GSHM");
+  EXPECT_EQ(header[4], 1);
+  const std::string name = ReadExactly(fd_, static_cast<uint8_t>(header[5]));
+  auto segment = ShmSegment::Open(name);
+  ASSERT_TRUE(segment.ok()) << segment.status();
+  WriteAll(fd_, "A");
+  // The server's SETTINGS arrive in the server to client ring, and nothing
+  // more on the socket.
+  ShmSegment::RingHeader* ring = (*segment)->ring_header(1);
+  for (int i = 0; i < 1000 && ring->head.load() == 0; ++i) usleep(10000);
+  EXPECT_GT(ring->head.load(), 0);
+  EXPECT_EQ((*segment)->ring_data(1)[3], kHttp2SettingsFrame);
+  pollfd p = {fd_, POLLIN, 0};
+  EXPECT_EQ(poll(&p, 1, 0), 0);
+}
+
+TEST_F(ShmHandshakerTest, ServerFallsBackOnNack) {
+  StartServer(/*shm=*/true);
+  ConnectToServer();
+  WriteAll(fd_, Request(1));
+  const std::string header = ReadExactly(fd_, 6);
+  ASSERT_EQ(header.size(), 6);
+  ASSERT_EQ(header.substr(0, 4), "GSHM");
+  ReadExactly(fd_, static_cast<uint8_t>(header[5]));
+  WriteAll(fd_, absl::StrCat("N", kHttp2Preface));
+  const std::string frame = ReadExactly(fd_, 9);
+  ASSERT_EQ(frame.size(), 9);
+  EXPECT_EQ(frame[3], kHttp2SettingsFrame);
+}
+
+TEST_F(ShmHandshakerTest, ServerFallsBackForPlainClient) {
+  StartServer(/*shm=*/true);
+  ConnectToServer();
+  WriteAll(fd_, kHttp2Preface);
+  const std::string frame = ReadExactly(fd_, 9);
+  ASSERT_EQ(frame.size(), 9);
+  EXPECT_NE(frame.substr(0, 4), "GSHM");
+  EXPECT_EQ(frame[3], kHttp2SettingsFrame);
+}
+
+TEST_F(ShmHandshakerTest, ServerDeclinesOldClientVersion) {
+  StartServer(/*shm=*/true);
+  ConnectToServer();
+  WriteAll(fd_, Request(0));
+  EXPECT_EQ(ReadExactly(fd_, 6), Hello(/*version=*/1, ""));
+  WriteAll(fd_, kHttp2Preface);
+  const std::string frame = ReadExactly(fd_, 9);
+  ASSERT_EQ(frame.size(), 9);
+  EXPECT_EQ(frame[3], kHttp2SettingsFrame);
+}
+
+TEST_F(ShmHandshakerTest, ClientDeclinesBadHello) {
+  AcceptChannel();
+  WriteAll(fd_, Hello(/*version=*/9, "/grpc-shm-test"));
+  EXPECT_EQ(ReadExactly(fd_, 1), "N");
+  EXPECT_EQ(ReadExactly(fd_, kHttp2Preface.size()), kHttp2Preface);
+}
+
+TEST_F(ShmHandshakerTest, ClientDeclinesSegmentItCannotOpen) {
+  AcceptChannel();
+  WriteAll(fd_, Hello(/*version=*/1, "/grpc-shm-doesnotexist"));
+  EXPECT_EQ(ReadExactly(fd_, 1), "N");
+  EXPECT_EQ(ReadExactly(fd_, kHttp2Preface.size()), kHttp2Preface);
+}
+
+TEST_F(ShmHandshakerTest, ClientFallsBackWhenServerDeclines) {
+  AcceptChannel();
+  WriteAll(fd_, Hello(/*version=*/1, ""));
+  EXPECT_EQ(ReadExactly(fd_, kHttp2Preface.size()), kHttp2Preface);
+}
+
+// A server that waits for the client to speak first, as chaotic_good does,
+// never answers the request.
+TEST_F(ShmHandshakerTest, ClientGivesUpOnQuietServerAndReconnectsOnSocket) {
+  const int listener = Listen();
+  StartChannel(/*shm=*/true);
+  Accept(listener);
+  EXPECT_EQ(ReadExactly(fd_, 5), Request(1));
+  // The client closes the connection once it stops waiting for a hello...
+  EXPECT_EQ(ReadExactly(fd_, 1), "");
+  // ...and its next connection skips the request.
+  Accept(listener);
+  close(listener);
+  EXPECT_EQ(ReadExactly(fd_, kHttp2Preface.size()), kHttp2Preface);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+#endif  // GPR_LINUX
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
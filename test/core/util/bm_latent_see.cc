@@ -42,6 +42,30 @@ static void BM_EmptyEnabledScoped(benchmark::State& state) {
 }
 BENCHMARK(BM_EmptyEnabledScoped)->MinWarmUpTime(0.5);
 
+// The flight recorder is meant to stay on in production: keep this within a
+// few nanoseconds of BM_EmptyDisabledScoped.
+static void BM_EmptyFlightRecorderScoped(benchmark::State& state) {
+  latent_see::FlightRecorder::Enable();
+  for (auto _ : state) {
+    GRPC_LATENT_SEE_ALWAYS_ON_SCOPE("EmptyScoped");
+  }
+  latent_see::FlightRecorder::Disable();
+}
+BENCHMARK(BM_EmptyFlightRecorderScoped)->ThreadRange(1, 8);
+
+static void BM_FlightRecorderSnapshot(benchmark::State& state) {
+  latent_see::FlightRecorder::Enable();
+  for (size_t i = 0; i < latent_see::FlightRecorder::kEventsPerThread; ++i) {
+    GRPC_LATENT_SEE_ALWAYS_ON_MARK("Mark");
+  }
+  for (auto _ : state) {
+    latent_see::DiscardOutput output;
+    latent_see::FlightRecorder::Snapshot(&output);
+  }
+  latent_see::FlightRecorder::Disable();
+}
+BENCHMARK(BM_FlightRecorderSnapshot);
+
 }  // namespace grpc_core
 
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
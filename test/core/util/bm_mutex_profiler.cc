@@ -0,0 +1,88 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Cost of MutexLock with the mutex profiler compiled out, compiled in but
+// disabled, and enabled.  Run once in a default build and once with
+// --define=GRPC_MUTEX_PROFILING=1 to compare.
+
+#include <benchmark/benchmark.h>
+
+#include "src/core/util/mutex_profiler.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+
+// Argument enables the profiler; builds without profiling support skip it.
+static void SetUpProfiler(benchmark::State& state) {
+  if (state.range(0) == 0) return;
+  if (!MutexProfiler::Supported()) {
+    state.SkipWithError("Requires --define=GRPC_MUTEX_PROFILING=1");
+    return;
+  }
+  MutexProfiler::Enable();
+}
+
+static void TearDownProfiler(benchmark::State& state) {
+  if (state.range(0) != 0 && MutexProfiler::Supported()) {
+    MutexProfiler::Disable();
+  }
+}
+
+// Each thread locks its own mutex, so every acquisition is uncontended.
+static void BM_UncontendedMutexLock(benchmark::State& state) {
+  SetUpProfiler(state);
+  Mutex mu;
+  int64_t counter = 0;
+  for (auto _ : state) {
+    MutexLock lock(&mu);
+    benchmark::DoNotOptimize(++counter);
+  }
+  TearDownProfiler(state);
+}
+BENCHMARK(BM_UncontendedMutexLock)
+    ->ArgName("profiler")
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(1, 8);
+
+// All threads share one mutex.
+static void BM_ContendedMutexLock(benchmark::State& state) {
+  static Mutex* mu = new Mutex();
+  static int64_t counter = 0;
+  if (state.thread_index() == 0) SetUpProfiler(state);
+  for (auto _ : state) {
+    MutexLock lock(mu);
+    benchmark::DoNotOptimize(++counter);
+  }
+  if (state.thread_index() == 0) TearDownProfiler(state);
+}
+BENCHMARK(BM_ContendedMutexLock)
+    ->ArgName("profiler")
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(2, 8);
+
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -14,6 +14,7 @@
 
 #include "src/core/util/latent_see.h"
 
+#include <algorithm>
 #include <iterator>
 #include <limits>
 #include <ostream>
@@ -218,5 +219,71 @@ TEST(LatentSeeTest, FlowWorksAppenderStartsLate) {
   ASSERT_EQ(elems.size(), 2);
 }
 
+Json::Array FlightRecorderSnapshotJson() {
+  std::ostringstream out;
+  {
+    latent_see::JsonOutput output(out);
+    latent_see::FlightRecorder::Snapshot(&output);
+  }
+  auto a = JsonParse(out.str());
+  CHECK_OK(a);
+  CHECK_EQ(a->type(), Json::Type::kArray);
+  return a->array();
+}
+
+size_t CountNamed(const Json::Array& elems, absl::string_view name) {
+  return std::count_if(elems.begin(), elems.end(), [name](const Json& elem) {
+    auto it = elem.object().find("name");
+    return it != elem.object().end() && it->second.string() == name;
+  });
+}
+
+TEST(LatentSeeTest, FlightRecorderWorks) {
+  latent_see::FlightRecorder::Enable();
+  std::thread([]() {
+    GRPC_LATENT_SEE_ALWAYS_ON_SCOPE("flight_recorder_scope");
+    GRPC_LATENT_SEE_ALWAYS_ON_MARK("flight_recorder_mark");
+  }).join();
+  auto elems = FlightRecorderSnapshotJson();
+  latent_see::FlightRecorder::Disable();
+  EXPECT_EQ(CountNamed(elems, "flight_recorder_scope"), 1);
+  EXPECT_EQ(CountNamed(elems, "flight_recorder_mark"), 1);
+}
+
+TEST(LatentSeeTest, FlightRecorderKeepsNewestEvents) {
+  latent_see::FlightRecorder::Enable();
+  std::thread([]() {
+    for (size_t i = 0; i < 3 * latent_see::FlightRecorder::kEventsPerThread;
+         ++i) {
+      GRPC_LATENT_SEE_ALWAYS_ON_MARK("flight_recorder_overwritten");
+    }
+  }).join();
+  auto elems = FlightRecorderSnapshotJson();
+  latent_see::FlightRecorder::Disable();
+  EXPECT_EQ(CountNamed(elems, "flight_recorder_overwritten"),
+            latent_see::FlightRecorder::kEventsPerThread);
+}
+
+TEST(LatentSeeTest, FlightRecorderOffRecordsNothing) {
+  std::thread([]() {
+    GRPC_LATENT_SEE_ALWAYS_ON_MARK("flight_recorder_off");
+  }).join();
+  EXPECT_EQ(CountNamed(FlightRecorderSnapshotJson(), "flight_recorder_off"),
+            0);
+}
+
+TEST(LatentSeeTest, PerfettoOutputWritesTracePackets) {
+  std::ostringstream out;
+  latent_see::PerfettoOutput output(out);
+  output.Span("perfetto_span", 1, 0, 1000);
+  output.Finish();
+  const std::string trace = out.str();
+  ASSERT_FALSE(trace.empty());
+  // Trace.packet is field 1, length delimited.
+  EXPECT_EQ(trace[0], '\x0a');
+  EXPECT_NE(trace.find("perfetto_span"), std::string::npos);
+  EXPECT_NE(trace.find("Thread 1"), std::string::npos);
+}
+
 }  // namespace
 }  // namespace grpc_core
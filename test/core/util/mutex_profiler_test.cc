@@ -0,0 +1,119 @@
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/util/mutex_profiler.h"
+
+#include <optional>
+#include <thread>
+
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/sync.h"
+
+namespace grpc_core {
+namespace {
+
+class MutexProfilerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    if (!MutexProfiler::Supported()) {
+      GTEST_SKIP() << "Requires --define=GRPC_MUTEX_PROFILING=1";
+    }
+    MutexProfiler::Reset();
+    MutexProfiler::Enable();
+  }
+
+  void TearDown() override {
+    if (MutexProfiler::Supported()) MutexProfiler::Disable();
+  }
+
+  // Holds `mu` on another thread while `lock` is called, so that `lock`
+  // waits about `hold` for it.
+  template <typename F>
+  static void Contend(Mutex* mu, absl::Duration hold, F lock) {
+    Notification locked;
+    std::thread holder([&] {
+      MutexLock l(mu);
+      locked.Notify();
+      absl::SleepFor(hold);
+    });
+    locked.WaitForNotification();
+    lock();
+    holder.join();
+  }
+
+  static std::optional<MutexProfiler::Site> FindSite(int line) {
+    for (const auto& site : MutexProfiler::TopContendedSites(
+             MutexProfiler::kMaxSites + 1)) {
+      if (site.file != nullptr && absl::string_view(site.file) == __FILE__ &&
+          site.line == line) {
+        return site;
+      }
+    }
+    return std::nullopt;
+  }
+};
+
+TEST_F(MutexProfilerTest, ContendedWaitIsAttributedToItsSite) {
+  Mutex mu;
+  const int line = __LINE__ + 1;
+  auto lock = [&mu] { MutexLock l(&mu); };
+  Contend(&mu, absl::Milliseconds(50), lock);
+  auto site = FindSite(line);
+  ASSERT_TRUE(site.has_value());
+  EXPECT_EQ(site->contentions, 1u);
+  EXPECT_GE(site->total_wait_ns,
+            absl::ToInt64Nanoseconds(absl::Milliseconds(10)));
+  EXPECT_EQ(site->max_wait_ns, site->total_wait_ns);
+}
+
+TEST_F(MutexProfilerTest, HoldTimesAreSampled) {
+  Mutex mu;
+  const int line = __LINE__ + 1;
+  auto lock = [&mu] { ReleasableMutexLock l(&mu); };
+  Contend(&mu, absl::Milliseconds(10), lock);
+  for (int i = 0; i < 128; ++i) lock();
+  auto site = FindSite(line);
+  ASSERT_TRUE(site.has_value());
+  EXPECT_EQ(site->contentions, 1u);
+  EXPECT_GE(site->hold_samples, 2u);
+}
+
+TEST_F(MutexProfilerTest, DisabledRecordsNothing) {
+  MutexProfiler::Disable();
+  EXPECT_FALSE(MutexProfiler::Enabled());
+  Mutex mu;
+  const int line = __LINE__ + 1;
+  auto lock = [&mu] { MutexLock l(&mu); };
+  Contend(&mu, absl::Milliseconds(10), lock);
+  EXPECT_FALSE(FindSite(line).has_value());
+  MutexProfiler::Enable();
+}
+
+TEST_F(MutexProfilerTest, EnableNests) {
+  MutexProfiler::Enable();
+  MutexProfiler::Disable();
+  EXPECT_TRUE(MutexProfiler::Enabled());
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
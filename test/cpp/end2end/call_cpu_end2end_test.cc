@@ -0,0 +1,104 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+
+#include <memory>
+#include <string>
+
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+#include "src/core/ext/transport/chaotic_good/chaotic_good.h"
+#include "src/core/lib/experiments/config.h"
+#include "src/core/telemetry/call_cpu.h"
+#include "src/core/telemetry/metrics.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/end2end/test_service_impl.h"
+#include "xds/data/orca/v3/orca_load_report.pb.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+constexpr char kCallCpuTimeCost[] = "grpc.call.cpu_time_ns";
+
+// Chaotic good server calls are call v3 calls, so gRPC's work on them is done
+// polling the call's party.  With call metric recording enabled the server
+// has a BackendMetricProvider on every call, so the trailers carry an ORCA
+// report with the CPU time charged to the call.
+TEST(CallCpuEnd2endTest, OrcaReportCarriesCpuTimeChargedByPartyPolling) {
+  TestServiceImpl service;
+  const std::string address =
+      absl::StrCat("localhost:", grpc_pick_unused_port_or_die());
+  ServerBuilder builder;
+  builder.AddChannelArgument(
+      GRPC_ARG_PREFERRED_TRANSPORT_PROTOCOLS,
+      std::string(grpc_core::chaotic_good::WireFormatPreferences()));
+  builder.AddListeningPort(address, InsecureServerCredentials());
+  builder.RegisterService(&service);
+  ServerBuilder::experimental_type(&builder).EnableCallMetricRecording();
+  std::unique_ptr<Server> server = builder.BuildAndStart();
+  ChannelArguments args;
+  args.SetString(GRPC_ARG_PREFERRED_TRANSPORT_PROTOCOLS,
+                 std::string(grpc_core::chaotic_good::WireFormatPreferences()));
+  auto stub = EchoTestService::NewStub(
+      CreateCustomChannel(address, InsecureChannelCredentials(), args));
+  // A stream, so that the server polls the call several times after the
+  // account is installed and before it sends trailers.
+  ClientContext context;
+  auto stream = stub->BidiStream(&context);
+  EchoRequest request;
+  EchoResponse response;
+  for (int i = 0; i < 10; ++i) {
+    request.set_message(absl::StrCat("hello ", i));
+    ASSERT_TRUE(stream->Write(request));
+    ASSERT_TRUE(stream->Read(&response));
+    EXPECT_EQ(response.message(), request.message());
+  }
+  ASSERT_TRUE(stream->WritesDone());
+  ASSERT_TRUE(stream->Finish().ok());
+  const auto& trailers = context.GetServerTrailingMetadata();
+  auto it = trailers.find("endpoint-load-metrics-bin");
+  ASSERT_NE(it, trailers.end());
+  xds::data::orca::v3::OrcaLoadReport report;
+  ASSERT_TRUE(report.ParseFromArray(it->second.data(), it->second.size()));
+  auto cost = report.request_cost().find(kCallCpuTimeCost);
+  ASSERT_NE(cost, report.request_cost().end());
+  EXPECT_GT(cost->second, 0);
+  server->Shutdown();
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc_core::ForceEnableExperiment("event_engine_client", true);
+  grpc_core::ForceEnableExperiment("event_engine_listener", true);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_core::GlobalStatsPluginRegistry::RegisterStatsPlugin(
+      grpc_core::MakeCallCpuStatsPlugin());
+  return RUN_ALL_TESTS();
+}
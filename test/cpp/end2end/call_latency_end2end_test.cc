@@ -0,0 +1,120 @@
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+#include <grpc/support/port_platform.h>
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "absl/strings/str_cat.h"
+#include "absl/types/span.h"
+#include "gtest/gtest.h"
+#include "src/core/telemetry/call_latency.h"
+#include "src/core/telemetry/instrument.h"
+#include "src/core/telemetry/metrics.h"
+#include "src/core/util/sync.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/end2end/test_service_impl.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+constexpr char kMethod[] = "grpc.testing.EchoTestService/Echo";
+
+// Counts the samples recorded into CallLatencyDomain, keyed by
+// "<instrument> <method>".
+class RecordedLatencies {
+ public:
+  static RecordedLatencies& Get() {
+    static RecordedLatencies* recorded = new RecordedLatencies();
+    return *recorded;
+  }
+
+  int Count(absl::string_view instrument) {
+    grpc_core::MutexLock lock(&mu_);
+    return counts_[absl::StrCat(instrument, " ", kMethod)];
+  }
+
+ private:
+  RecordedLatencies() {
+    grpc_core::RegisterHistogramCollectionHook(
+        [this](const grpc_core::InstrumentMetadata::Description* instrument,
+               absl::Span<const std::string> labels, int64_t /*value*/) {
+          if (instrument->domain != grpc_core::CallLatencyDomain::Domain()) {
+            return;
+          }
+          grpc_core::MutexLock lock(&mu_);
+          ++counts_[absl::StrCat(instrument->name, " ", labels[0])];
+        });
+  }
+
+  grpc_core::Mutex mu_;
+  std::map<std::string, int> counts_ ABSL_GUARDED_BY(mu_);
+};
+
+TEST(CallLatencyEnd2endTest, Chttp2RecordsTransportStages) {
+#ifndef GPR_LINUX
+  GTEST_SKIP() << "kernel write timestamps are only collected on Linux";
+#endif
+  RecordedLatencies& recorded = RecordedLatencies::Get();
+  TestServiceImpl service;
+  const std::string address =
+      absl::StrCat("localhost:", grpc_pick_unused_port_or_die());
+  ServerBuilder builder;
+  builder.AddListeningPort(address, InsecureServerCredentials());
+  builder.RegisterService(&service);
+  std::unique_ptr<Server> server = builder.BuildAndStart();
+  auto stub = EchoTestService::NewStub(
+      CreateChannel(address, InsecureChannelCredentials()));
+  EchoRequest request;
+  request.set_message("hello");
+  EchoResponse response;
+  ClientContext context;
+  ASSERT_TRUE(stub->Echo(&context, request, &response).ok());
+  // The kernel reports the write as sent and acknowledged after the call
+  // may already be done.
+  for (int i = 0; i < 100; ++i) {
+    if (recorded.Count("grpc.client.attempt.network_latency") > 0) break;
+    gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(100));
+  }
+  EXPECT_GT(recorded.Count("grpc.client.attempt.transport_write_queue_latency"),
+            0);
+  EXPECT_GT(recorded.Count("grpc.client.attempt.kernel_send_latency"), 0);
+  EXPECT_GT(recorded.Count("grpc.client.attempt.network_latency"), 0);
+  server->Shutdown();
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_core::GlobalStatsPluginRegistry::RegisterStatsPlugin(
+      grpc_core::MakeCallLatencyStatsPlugin());
+  return RUN_ALL_TESTS();
+}
@@ -27,16 +27,21 @@
 #include <grpcpp/support/client_callback.h>
 
 #include <algorithm>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <mutex>
 #include <sstream>
 #include <thread>
+#include <vector>
 
 #include "absl/log/log.h"
 #include "absl/memory/memory.h"
+#include "absl/strings/str_cat.h"
 #include "gtest/gtest.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/iomgr.h"
+#include "src/core/lib/surface/completion_queue.h"
 #include "src/core/util/env.h"
 #include "src/core/util/grpc_check.h"
 #include "src/proto/grpc/testing/echo.grpc.pb.h"
@@ -1563,6 +1568,185 @@ std::vector<TestScenario> CreateTestScenarios(bool test_insecure) {
 INSTANTIATE_TEST_SUITE_P(ClientCallbackEnd2endTest, ClientCallbackEnd2endTest,
                          ::testing::ValuesIn(CreateTestScenarios(true)));
 
+// Echo service recording the thread each handler runs on.
+class ThreadRecordingEchoService : public EchoTestService::CallbackService {
+ public:
+  ServerUnaryReactor* Echo(CallbackServerContext* context,
+                           const EchoRequest* request,
+                           EchoResponse* response) override {
+    {
+      std::lock_guard<std::mutex> l(mu_);
+      handler_threads_.push_back(std::this_thread::get_id());
+    }
+    response->set_message(request->message());
+    auto* reactor = context->DefaultReactor();
+    reactor->Finish(Status::OK);
+    return reactor;
+  }
+
+  std::vector<std::thread::id> handler_threads() {
+    std::lock_guard<std::mutex> l(mu_);
+    return handler_threads_;
+  }
+
+ private:
+  std::mutex mu_;
+  std::vector<std::thread::id> handler_threads_;
+};
+
+// Makes \a num_calls Echo calls one after the other from the current thread
+// to a server whose Echo handler may run inline for as long as it takes less
+// than \a budget, and returns the threads the handlers ran on.
+std::vector<std::thread::id> EchoWithInlineHandlerBudget(
+    std::chrono::nanoseconds budget, int num_calls) {
+  ThreadRecordingEchoService service;
+  ServerBuilder builder;
+  builder.RegisterService(&service);
+  builder.experimental().EnableInlineCallbackHandler(
+      "/grpc.testing.EchoTestService/Echo", budget);
+  std::unique_ptr<Server> server = builder.BuildAndStart();
+  EXPECT_NE(server, nullptr);
+  if (server == nullptr) return {};
+  auto stub = grpc::testing::EchoTestService::NewStub(
+      server->InProcessChannel(ChannelArguments()));
+  for (int i = 0; i < num_calls; ++i) {
+    EchoRequest request;
+    EchoResponse response;
+    ClientContext cli_ctx;
+    request.set_message(absl::StrCat("Hello ", i));
+    std::mutex mu;
+    std::condition_variable cv;
+    bool done = false;
+    stub->async()->Echo(&cli_ctx, &request, &response,
+                        [&request, &response, &done, &mu, &cv](Status s) {
+                          EXPECT_TRUE(s.ok()) << s.error_message();
+                          EXPECT_EQ(request.message(), response.message());
+                          std::lock_guard<std::mutex> l(mu);
+                          done = true;
+                          cv.notify_one();
+                        });
+    std::unique_lock<std::mutex> l(mu);
+    while (!done) cv.wait(l);
+  }
+  server->Shutdown();
+  return service.handler_threads();
+}
+
+// The in-process transport reads the request on the thread that starts the
+// client call, so the server's request completes there.  An inline handler
+// runs on that thread, when it flushes its ExecCtx, rather than on an
+// EventEngine thread.
+TEST(InlineCallbackHandlerTest, HandlerRunsOnThreadThatReadTheRequest) {
+  std::vector<std::thread::id> threads =
+      EchoWithInlineHandlerBudget(std::chrono::seconds(1), 10);
+  ASSERT_EQ(threads.size(), 10u);
+  for (std::thread::id id : threads) {
+    EXPECT_EQ(id, std::this_thread::get_id());
+  }
+}
+
+// A handler that takes longer than its budget is handed off to the
+// EventEngine again, and calls still succeed.
+TEST(InlineCallbackHandlerTest, HandlerOverBudgetIsOffloaded) {
+  std::vector<std::thread::id> threads =
+      EchoWithInlineHandlerBudget(std::chrono::nanoseconds(1), 10);
+  ASSERT_EQ(threads.size(), 10u);
+  // There is no run time to go by before the first call.
+  EXPECT_EQ(threads[0], std::this_thread::get_id());
+  for (size_t i = 1; i < threads.size(); ++i) {
+    EXPECT_NE(threads[i], std::this_thread::get_id()) << "call " << i;
+  }
+}
+
+// Completion queue functor recording the thread it runs on.
+class ThreadRecordingFunctor : public grpc_completion_queue_functor {
+ public:
+  ThreadRecordingFunctor(std::mutex* mu, std::condition_variable* cv,
+                         int* remaining)
+      : mu_(mu), cv_(cv), remaining_(remaining) {
+    functor_run = &ThreadRecordingFunctor::Run;
+    inlineable = GRPC_CQ_FUNCTOR_RUN_INLINE;
+  }
+
+  std::thread::id thread() const { return thread_; }
+  grpc_cq_completion* completion() { return &completion_; }
+
+ private:
+  static void Run(grpc_completion_queue_functor* cb, int /*ok*/) {
+    auto* self = static_cast<ThreadRecordingFunctor*>(cb);
+    std::lock_guard<std::mutex> l(*self->mu_);
+    self->thread_ = std::this_thread::get_id();
+    if (--*self->remaining_ == 0) self->cv_->notify_one();
+  }
+
+  std::mutex* mu_;
+  std::condition_variable* cv_;
+  int* remaining_;
+  std::thread::id thread_;
+  grpc_cq_completion completion_;
+};
+
+// Ending more inline operations than a thread may defer at a time runs the
+// first GRPC_CQ_MAX_PENDING_INLINE_FUNCTORS on that thread, once its ExecCtx
+// flushes, and offloads the rest to the EventEngine.
+TEST(InlineCallbackHandlerTest, FunctorsOverPendingLimitAreOffloaded) {
+  constexpr int kInline = GRPC_CQ_MAX_PENDING_INLINE_FUNCTORS;
+  constexpr int kFunctors = kInline + 4;
+  std::mutex mu;
+  std::condition_variable cv;
+  int remaining = kFunctors;
+  std::vector<std::unique_ptr<ThreadRecordingFunctor>> functors;
+  for (int i = 0; i < kFunctors; ++i) {
+    functors.push_back(
+        std::make_unique<ThreadRecordingFunctor>(&mu, &cv, &remaining));
+  }
+  ThreadRecordingFunctor shutdown(&mu, &cv, &remaining);
+  grpc_completion_queue* cq =
+      grpc_completion_queue_create_for_callback(&shutdown, nullptr);
+  {
+    grpc_core::ExecCtx exec_ctx;
+    for (auto& functor : functors) {
+      ASSERT_TRUE(grpc_cq_begin_op(cq, functor.get()));
+      grpc_cq_end_op(
+          cq, functor.get(), absl::OkStatus(),
+          [](void* /*done_arg*/, grpc_cq_completion* /*storage*/) {}, nullptr,
+          functor->completion());
+    }
+  }
+  {
+    std::unique_lock<std::mutex> l(mu);
+    while (remaining != 0) cv.wait(l);
+  }
+  for (int i = 0; i < kFunctors; ++i) {
+    if (i < kInline) {
+      EXPECT_EQ(functors[i]->thread(), std::this_thread::get_id())
+          << "functor " << i;
+    } else {
+      EXPECT_NE(functors[i]->thread(), std::this_thread::get_id())
+          << "functor " << i;
+    }
+  }
+  {
+    std::unique_lock<std::mutex> l(mu);
+    remaining = 1;
+  }
+  grpc_completion_queue_shutdown(cq);
+  {
+    std::unique_lock<std::mutex> l(mu);
+    while (remaining != 0) cv.wait(l);
+  }
+  grpc_completion_queue_destroy(cq);
+}
+
+TEST(InlineCallbackHandlerTest, UnknownMethod) {
+  CallbackTestServiceImpl service;
+  ServerBuilder builder;
+  builder.RegisterService(&service);
+  builder.experimental().EnableInlineCallbackHandler(
+      "/grpc.testing.EchoTestService/NoSuchMethod");
+  EXPECT_EQ(builder.BuildAndStart(), nullptr);
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc
@@ -17,6 +17,7 @@
 //
 
 #include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/time.h>
 #include <grpcpp/channel.h>
@@ -29,9 +30,11 @@
 #include <grpcpp/server.h>
 #include <grpcpp/server_builder.h>
 #include <grpcpp/server_context.h>
+#include <grpcpp/support/message_buffer_allocator.h>
 #include <grpcpp/support/string_ref.h>
 #include <grpcpp/test/channel_test_peer.h>
 
+#include <atomic>
 #include <mutex>
 #include <thread>
 
@@ -2244,6 +2247,233 @@ TEST_P(ResourceQuotaEnd2endTest, SimpleRequest) {
   EXPECT_TRUE(s.ok());
 }
 
+class SyncHandlersOnEventEngineEnd2endTest : public End2endTest {
+ public:
+  void ConfigureServerBuilder(ServerBuilder* builder) override {
+    End2endTest::ConfigureServerBuilder(builder);
+    builder->AddChannelArgument(GRPC_ARG_SERVER_SYNC_HANDLERS_ON_EVENT_ENGINE,
+                                1);
+  }
+};
+
+TEST_P(SyncHandlersOnEventEngineEnd2endTest, MultipleRpcs) {
+  ResetStub();
+  std::vector<std::thread> threads;
+  threads.reserve(10);
+  for (int i = 0; i < 10; ++i) {
+    threads.emplace_back(SendRpc, stub_.get(), 10, false);
+  }
+  for (int i = 0; i < 10; ++i) {
+    threads[i].join();
+  }
+}
+
+TEST_P(SyncHandlersOnEventEngineEnd2endTest, BidiStream) {
+  ResetStub();
+  EchoRequest request;
+  EchoResponse response;
+  ClientContext context;
+  std::string msg("hello");
+
+  auto stream = stub_->BidiStream(&context);
+
+  for (int i = 0; i < kServerDefaultResponseStreamsToSend; ++i) {
+    request.set_message(msg + std::to_string(i));
+    EXPECT_TRUE(stream->Write(request));
+    EXPECT_TRUE(stream->Read(&response));
+    EXPECT_EQ(response.message(), request.message());
+  }
+
+  stream->WritesDone();
+  EXPECT_FALSE(stream->Read(&response));
+
+  Status s = stream->Finish();
+  EXPECT_TRUE(s.ok());
+}
+
+TEST_P(SyncHandlersOnEventEngineEnd2endTest, ConcurrentBlockingHandlers) {
+  ResetStub();
+  // More handlers sleep at once than the EventEngine starts threads for.
+  constexpr int kNumRpcs = 64;
+  std::vector<std::thread> threads;
+  threads.reserve(kNumRpcs);
+  for (int i = 0; i < kNumRpcs; ++i) {
+    threads.emplace_back([this]() {
+      EchoRequest request;
+      EchoResponse response;
+      request.set_message("Hello");
+      request.mutable_param()->set_server_sleep_us(500 * 1000);
+      ClientContext context;
+      Status s = stub_->Echo(&context, request, &response);
+      EXPECT_EQ(response.message(), request.message());
+      EXPECT_TRUE(s.ok());
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+TEST_P(SyncHandlersOnEventEngineEnd2endTest, UnimplementedRpc) {
+  ResetStub();
+  EchoRequest request;
+  EchoResponse response;
+  request.set_message("Hello");
+
+  ClientContext context;
+  Status s = stub_->Unimplemented(&context, request, &response);
+  EXPECT_EQ(s.error_code(), StatusCode::UNIMPLEMENTED);
+}
+
+class SyncHandlersOnEventEngineThreadQuotaEnd2endTest
+    : public SyncHandlersOnEventEngineEnd2endTest {
+ protected:
+  static constexpr int kMaxThreads = 4;
+
+  SyncHandlersOnEventEngineThreadQuotaEnd2endTest()
+      : server_resource_quota_("server_resource_quota") {
+    server_resource_quota_.SetMaxThreads(kMaxThreads);
+  }
+
+  void ConfigureServerBuilder(ServerBuilder* builder) override {
+    SyncHandlersOnEventEngineEnd2endTest::ConfigureServerBuilder(builder);
+    builder->SetResourceQuota(server_resource_quota_);
+  }
+
+ private:
+  ResourceQuota server_resource_quota_;
+};
+
+TEST_P(SyncHandlersOnEventEngineThreadQuotaEnd2endTest,
+       HandlersPastMaxThreadsAreRejected) {
+  ResetStub();
+  // Many more handlers block at once than the quota has threads for.
+  constexpr int kNumRpcs = 4 * kMaxThreads;
+  std::atomic<int> ok{0};
+  std::atomic<int> exhausted{0};
+  std::vector<std::thread> threads;
+  threads.reserve(kNumRpcs);
+  for (int i = 0; i < kNumRpcs; ++i) {
+    threads.emplace_back([this, &ok, &exhausted]() {
+      EchoRequest request;
+      EchoResponse response;
+      request.set_message("Hello");
+      request.mutable_param()->set_server_sleep_us(2 * 1000 * 1000);
+      ClientContext context;
+      Status s = stub_->Echo(&context, request, &response);
+      if (s.ok()) {
+        EXPECT_EQ(response.message(), request.message());
+        ++ok;
+      } else {
+        EXPECT_EQ(s.error_code(), StatusCode::RESOURCE_EXHAUSTED);
+        ++exhausted;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_GT(ok.load(), 0);
+  EXPECT_LE(ok.load(), kMaxThreads);
+  EXPECT_GE(exhausted.load(), kNumRpcs - kMaxThreads);
+  // Threads are given back once their handlers are done.
+  EchoRequest request;
+  EchoResponse response;
+  request.set_message("Hello");
+  ClientContext context;
+  EXPECT_TRUE(stub_->Echo(&context, request, &response).ok());
+}
+
+// Hands out malloc'd buffers and counts them.
+class CountingMessageBufferAllocator
+    : public experimental::MessageBufferAllocator {
+ public:
+  void* Allocate(size_t length) override {
+    allocated_bytes_ += length;
+    ++allocations_;
+    return gpr_malloc(length);
+  }
+
+  void Release(void* buffer, size_t /*length*/) override {
+    gpr_free(buffer);
+    ++releases_;
+  }
+
+  size_t allocated_bytes() const { return allocated_bytes_; }
+  int allocations() const { return allocations_; }
+  int releases() const { return releases_; }
+
+ private:
+  std::atomic<size_t> allocated_bytes_{0};
+  std::atomic<int> allocations_{0};
+  std::atomic<int> releases_{0};
+};
+
+class MessageBufferAllocatorEnd2endTest : public End2endTest {
+ public:
+  void ConfigureServerBuilder(ServerBuilder* builder) override {
+    End2endTest::ConfigureServerBuilder(builder);
+    builder->experimental().SetMessageBufferAllocator(
+        "/grpc.testing.EchoTestService/Echo", allocator_);
+  }
+
+ protected:
+  std::shared_ptr<CountingMessageBufferAllocator> allocator_ =
+      std::make_shared<CountingMessageBufferAllocator>();
+};
+
+TEST_P(MessageBufferAllocatorEnd2endTest, LargeRequest) {
+  ResetStub();
+  EchoRequest request;
+  EchoResponse response;
+  request.set_message(std::string(1024 * 1024, 'a'));
+
+  ClientContext context;
+  Status s = stub_->Echo(&context, request, &response);
+  EXPECT_EQ(response.message(), request.message());
+  EXPECT_TRUE(s.ok());
+  // The whole request was received into one buffer from the allocator.
+  EXPECT_EQ(allocator_->allocations(), 1);
+  EXPECT_GE(allocator_->allocated_bytes(), request.message().size());
+  // Released once the server is done with the request.
+  const gpr_timespec deadline = grpc_timeout_seconds_to_deadline(10);
+  while (allocator_->releases() != allocator_->allocations() &&
+         gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), deadline) < 0) {
+    gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(10));
+  }
+  EXPECT_EQ(allocator_->releases(), allocator_->allocations());
+}
+
+TEST_P(MessageBufferAllocatorEnd2endTest, UnregisteredMethod) {
+  ResetStub();
+  EchoRequest request;
+  EchoResponse response;
+  request.set_message("Hello");
+
+  ClientContext context;
+  auto stream = stub_->BidiStream(&context);
+  EXPECT_TRUE(stream->Write(request));
+  EXPECT_TRUE(stream->Read(&response));
+  EXPECT_EQ(response.message(), request.message());
+  stream->WritesDone();
+  EXPECT_TRUE(stream->Finish().ok());
+  EXPECT_EQ(allocator_->allocations(), 0);
+}
+
+TEST_P(MessageBufferAllocatorEnd2endTest, OversizedRequestIsNotAllocated) {
+  ResetStub();
+  EchoRequest request;
+  EchoResponse response;
+  // Over the server's default 4 MiB receive limit: the allocator must not be
+  // asked for a buffer the peer's length prefix alone chose.
+  request.set_message(std::string(5 * 1024 * 1024, 'a'));
+
+  ClientContext context;
+  Status s = stub_->Echo(&context, request, &response);
+  EXPECT_EQ(s.error_code(), StatusCode::RESOURCE_EXHAUSTED);
+  EXPECT_EQ(allocator_->allocations(), 0);
+}
+
 // TODO(vjpai): refactor arguments into a struct if it makes sense
 std::vector<TestScenario> CreateTestScenarios(bool use_proxy,
                                               bool test_insecure,
@@ -2329,6 +2559,23 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::ValuesIn(CreateTestScenarios(false, true, true, true, true)),
     &TestScenario::Name);
 
+INSTANTIATE_TEST_SUITE_P(
+    SyncHandlersOnEventEngineEnd2end, SyncHandlersOnEventEngineEnd2endTest,
+    ::testing::ValuesIn(CreateTestScenarios(false, true, true, true, false)),
+    &TestScenario::Name);
+
+INSTANTIATE_TEST_SUITE_P(
+    SyncHandlersOnEventEngineThreadQuotaEnd2end,
+    SyncHandlersOnEventEngineThreadQuotaEnd2endTest,
+    ::testing::ValuesIn(CreateTestScenarios(false, true, true, true, false)),
+    &TestScenario::Name);
+
+// The in-process transport has no reassembly path to receive messages into.
+INSTANTIATE_TEST_SUITE_P(
+    MessageBufferAllocatorEnd2end, MessageBufferAllocatorEnd2endTest,
+    ::testing::ValuesIn(CreateTestScenarios(false, true, true, false, true)),
+    &TestScenario::Name);
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc
@@ -62,6 +62,39 @@ TEST(LatentSeeServiceTest, Works) {
   server.reset();
 }
 
+TEST(LatentSeeServiceTest, FlightRecordingNeedsFlightRecorder) {
+  auto service =
+      std::make_unique<LatentSeeService>(LatentSeeService::Options());
+  ServerBuilder builder;
+  builder.RegisterService(service.get());
+  auto server = builder.BuildAndStart();
+  auto channel = server->InProcessChannel(ChannelArguments());
+  auto stub = std::make_unique<channelz::v2::LatentSee::Stub>(channel);
+  grpc_core::latent_see::DiscardOutput output;
+  EXPECT_EQ(FetchLatentSeeFlightRecording(stub.get(), &output).error_code(),
+            StatusCode::FAILED_PRECONDITION);
+  server->Shutdown();
+  server.reset();
+}
+
+TEST(LatentSeeServiceTest, FlightRecordingWorks) {
+  auto service = std::make_unique<LatentSeeService>(
+      LatentSeeService::Options().set_flight_recorder(true));
+  ServerBuilder builder;
+  builder.RegisterService(service.get());
+  auto server = builder.BuildAndStart();
+  auto channel = server->InProcessChannel(ChannelArguments());
+  auto stub = std::make_unique<channelz::v2::LatentSee::Stub>(channel);
+  std::ostringstream out;
+  auto output = std::make_unique<grpc_core::latent_see::JsonOutput>(out);
+  EXPECT_TRUE(FetchLatentSeeFlightRecording(stub.get(), output.get()).ok());
+  output.reset();
+  auto obj = grpc_core::JsonParse(out.str());
+  CHECK_OK(obj);
+  server->Shutdown();
+  server.reset();
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc
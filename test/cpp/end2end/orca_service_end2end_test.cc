@@ -30,12 +30,17 @@
 
 #include <memory>
 #include <optional>
+#include <string>
+#include <vector>
 
 #include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
 #include "absl/time/time.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "src/core/lib/resource_tracker/resource_tracker.h"
 #include "src/core/util/notification.h"
 #include "src/core/util/time.h"
 #include "src/proto/grpc/testing/xds/v3/orca_service.grpc.pb.h"
@@ -238,6 +243,46 @@ TEST_F(OrcaServiceEnd2endTest, Basic) {
   });
 }
 
+// Reports fixed container utilization.
+class FakeResourceTracker : public grpc_core::ResourceTracker {
+ public:
+  std::vector<std::string> GetMetrics() const override {
+    return {kCpuMetric, kMemoryMetric};
+  }
+  absl::StatusOr<double> GetMetricValue(
+      const std::string& metric_name) const override {
+    if (metric_name == kCpuMetric) return 0.25;
+    if (metric_name == kMemoryMetric) return 0.75;
+    return absl::NotFoundError(metric_name);
+  }
+};
+
+TEST_F(OrcaServiceEnd2endTest, ContainerUtilizationFallback) {
+  FakeResourceTracker tracker;
+  grpc_core::ResourceTracker* old_tracker = grpc_core::ResourceTracker::Get();
+  grpc_core::ResourceTracker::Set(&tracker);
+  auto stub = OpenRcaService::NewStub(channel_);
+  Stream stream(stub.get(), grpc_core::Duration::Milliseconds(2500));
+  // Not reported unless enabled.
+  OrcaLoadReport response = stream.ReadResponse();
+  EXPECT_EQ(response.cpu_utilization(), 0);
+  EXPECT_EQ(response.mem_utilization(), 0);
+  server_metric_recorder_->SetContainerUtilizationFallback(true);
+  response = stream.ReadResponse();
+  EXPECT_EQ(response.cpu_utilization(), 0.25);
+  EXPECT_EQ(response.mem_utilization(), 0.75);
+  // Values set by the application take precedence.
+  server_metric_recorder_->SetCpuUtilization(0.5);
+  response = stream.ReadResponse();
+  EXPECT_EQ(response.cpu_utilization(), 0.5);
+  EXPECT_EQ(response.mem_utilization(), 0.75);
+  server_metric_recorder_->SetContainerUtilizationFallback(false);
+  response = stream.ReadResponse();
+  EXPECT_EQ(response.cpu_utilization(), 0.5);
+  EXPECT_EQ(response.mem_utilization(), 0);
+  grpc_core::ResourceTracker::Set(old_tracker);
+}
+
 TEST_F(OrcaServiceEnd2endTest, ClientClosesBeforeSendingMessage) {
   auto stub = std::make_unique<GenericStub>(channel_);
   GenericOrcaClientReactor reactor(stub.get());
@@ -1018,6 +1018,56 @@ TEST_F(RlsEnd2endTest, CachedResponse) {
   EXPECT_EQ(backends_[0]->service_.request_count(), 2);
 }
 
+TEST_F(RlsEnd2endTest, CachedResponseFromManyThreads) {
+  const char* kHeaderData = "header_data";
+  constexpr int kNumThreads = 8;
+  constexpr int kRpcsPerThread = 50;
+  StartBackends(1);
+  SetNextResolution(
+      MakeServiceConfigBuilder()
+          .AddKeyBuilder(absl::StrFormat("\"names\":[{"
+                                         "  \"service\":\"%s\","
+                                         "  \"method\":\"%s\""
+                                         "}],"
+                                         "\"headers\":["
+                                         "  {"
+                                         "    \"key\":\"%s\","
+                                         "    \"names\":["
+                                         "      \"key1\""
+                                         "    ]"
+                                         "  }"
+                                         "]",
+                                         kServiceValue, kMethodValue, kTestKey))
+          .Build());
+  rls_server_->service_.SetResponse(
+      BuildRlsRequest({{kTestKey, kTestValue}}),
+      BuildRlsResponse({grpc_core::LocalIpUri(backends_[0]->port_)},
+                       kHeaderData));
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValue}}));
+  EXPECT_THAT(backends_[0]->service_.rls_data(),
+              ::testing::ElementsAre(kHeaderData));
+  // Once the entry has data, pickers serve it from their snapshot of the
+  // cache, concurrently and without further RLS requests, and still attach
+  // the header data.
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&]() {
+      for (int j = 0; j < kRpcsPerThread; ++j) {
+        CheckRpcSendOk(DEBUG_LOCATION,
+                       RpcOptions().set_metadata({{"key1", kTestValue}}));
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_EQ(rls_server_->service_.request_count(), 1);
+  EXPECT_EQ(rls_server_->service_.response_count(), 1);
+  EXPECT_EQ(backends_[0]->service_.request_count(),
+            1 + kNumThreads * kRpcsPerThread);
+  EXPECT_THAT(backends_[0]->service_.rls_data(),
+              ::testing::ElementsAre(kHeaderData));
+}
+
 TEST_F(RlsEnd2endTest, StaleCacheEntry) {
   StartBackends(1);
   SetNextResolution(
@@ -1686,6 +1736,73 @@ TEST_F(RlsMetricsEnd2endTest, MetricValuesDefaultTargetRpcs) {
       ::testing::Optional(1));
 }
 
+TEST_F(RlsMetricsEnd2endTest, EntryUsedFromPickerSnapshotIsNotEvictedFirst) {
+  auto kMetricCacheSize =
+      grpc_core::GlobalInstrumentsRegistryTestPeer::
+          FindCallbackInt64GaugeHandleByName("grpc.lb.rls.cache_size")
+              .value();
+  // Keys of equal length, so that all entries have the same size.
+  const char* kTestValueA = "test_value_a";
+  const char* kTestValueB = "test_value_b";
+  const char* kTestValueC = "test_value_c";
+  auto service_config = [&](int64_t cache_size_bytes) {
+    return MakeServiceConfigBuilder()
+        .AddKeyBuilder(absl::StrFormat("\"names\":[{"
+                                       "  \"service\":\"%s\","
+                                       "  \"method\":\"%s\""
+                                       "}],"
+                                       "\"headers\":["
+                                       "  {"
+                                       "    \"key\":\"%s\","
+                                       "    \"names\":["
+                                       "      \"key1\""
+                                       "    ]"
+                                       "  }"
+                                       "]",
+                                       kServiceValue, kMethodValue, kTestKey))
+        .set_cache_size_bytes(cache_size_bytes)
+        .Build();
+  };
+  StartBackends(1);
+  const std::string target = grpc_core::LocalIpUri(backends_[0]->port_);
+  for (const char* value : {kTestValueA, kTestValueB, kTestValueC}) {
+    rls_server_->service_.SetResponse(BuildRlsRequest({{kTestKey, value}}),
+                                      BuildRlsResponse({target}));
+  }
+  SetNextResolution(service_config(10485760));
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValueA}}));
+  // Shrink the cache to hold two entries but not three.
+  stats_plugin_->TriggerCallbacks();
+  auto entry_size = stats_plugin_->GetInt64CallbackGaugeValue(
+      kMetricCacheSize, {target_uri_, rls_server_target_, kRlsInstanceUuid},
+      {});
+  ASSERT_THAT(entry_size, ::testing::Optional(::testing::Gt(0)));
+  SetNextResolution(service_config(*entry_size * 5 / 2));
+  // Add B after A, so that A is first in the LRU list.
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValueB}}));
+  EXPECT_EQ(rls_server_->service_.request_count(), 2);
+  // Wait for min_eviction_time to elapse.
+  gpr_sleep_until(grpc_timeout_seconds_to_deadline(6));
+  // Use A again.  This is a hit in the current picker's snapshot of the
+  // cache, which doesn't update the LRU list itself.
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValueA}}));
+  EXPECT_EQ(rls_server_->service_.request_count(), 2);
+  // Adding C must evict B, the least recently used entry, rather than A.
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValueC}}));
+  EXPECT_EQ(rls_server_->service_.request_count(), 3);
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValueA}}));
+  EXPECT_EQ(rls_server_->service_.request_count(), 3);
+  CheckRpcSendOk(DEBUG_LOCATION,
+                 RpcOptions().set_metadata({{"key1", kTestValueB}}));
+  EXPECT_EQ(rls_server_->service_.request_count(), 4);
+  EXPECT_EQ(backends_[0]->service_.request_count(), 6);
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc
@@ -28,6 +28,7 @@
 
 static void BM_Arena_NoOp(benchmark::State& state) {
   auto factory = grpc_core::SimpleArenaAllocator();
+  HardwareCounters counters(state);
   for (auto _ : state) {
     factory->MakeArena();
   }
@@ -39,6 +40,7 @@ static void BM_Arena_ManyAlloc(benchmark::State& state) {
   auto a = allocator->MakeArena();
   const size_t realloc_after =
       1024 * 1024 * 1024 / ((state.range(1) + 15) & 0xffffff0u);
+  HardwareCounters counters(state);
   while (state.KeepRunning()) {
     a->Alloc(state.range(1));
     // periodically recreate arena to avoid OOM
@@ -51,6 +53,7 @@ BENCHMARK(BM_Arena_ManyAlloc)->Ranges({{1, 1024 * 1024}, {1, 32 * 1024}});
 
 static void BM_Arena_Batch(benchmark::State& state) {
   auto allocator = grpc_core::SimpleArenaAllocator(state.range(0));
+  HardwareCounters counters(state);
   for (auto _ : state) {
     auto a = allocator->MakeArena();
     for (int i = 0; i < state.range(1); i++) {
@@ -69,6 +72,7 @@ struct TestThingToAllocate {
 
 static void BM_Arena_MakePooled_Small(benchmark::State& state) {
   auto a = grpc_core::SimpleArenaAllocator()->MakeArena();
+  HardwareCounters counters(state);
   for (auto _ : state) {
     a->MakePooled<TestThingToAllocate>();
   }
@@ -77,6 +81,7 @@ BENCHMARK(BM_Arena_MakePooled_Small);
 
 static void BM_Arena_MakePooled3_Small(benchmark::State& state) {
   auto a = grpc_core::SimpleArenaAllocator()->MakeArena();
+  HardwareCounters counters(state);
   for (auto _ : state) {
     auto x = a->MakePooled<TestThingToAllocate>();
     auto y = a->MakePooled<TestThingToAllocate>();
@@ -86,6 +91,7 @@ static void BM_Arena_MakePooled3_Small(benchmark::State& state) {
 BENCHMARK(BM_Arena_MakePooled3_Small);
 
 static void BM_Arena_NewDeleteComparison_Small(benchmark::State& state) {
+  HardwareCounters counters(state);
   for (auto _ : state) {
     benchmark::DoNotOptimize(std::make_unique<TestThingToAllocate>());
   }
@@ -27,6 +27,25 @@ namespace testing {
 // CONFIGURATIONS
 //
 
+// Runs the Echo handler on the thread that read the request.
+class InlineHandlerConfiguration : public FixtureConfiguration {
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    b->experimental().EnableInlineCallbackHandler(
+        "/grpc.testing.EchoTestService/Echo");
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+  }
+};
+
+template <class Base>
+class InlineHandlerize : public Base {
+ public:
+  explicit InlineHandlerize(Service* service)
+      : Base(service, InlineHandlerConfiguration()) {}
+};
+
+typedef InlineHandlerize<InProcess> InlineInProcess;
+typedef InlineHandlerize<SockPair> InlineSockPair;
+
 // Replace "benchmark::internal::Benchmark" with "::testing::Benchmark" to use
 // internal microbenchmarking tooling
 static void SweepSizesArgs(benchmark::internal::Benchmark* b) {
@@ -48,6 +67,18 @@ BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPong, MinInProcess, NoOpMutator,
                    NoOpMutator)
     ->Apply(SweepSizesArgs);
 
+// Unary ping pong with the handler run inline, to compare against the
+// default of handing it off to the EventEngine
+BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPong, SockPair, NoOpMutator,
+                   NoOpMutator)
+    ->Args({0, 0});
+BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPong, InlineSockPair, NoOpMutator,
+                   NoOpMutator)
+    ->Args({0, 0});
+BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPong, InlineInProcess, NoOpMutator,
+                   NoOpMutator)
+    ->Apply(SweepSizesArgs);
+
 // Client context with different metadata
 BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPong, InProcess,
                    Client_AddMetadata<RandomBinaryMetadata<10>, 1>, NoOpMutator)
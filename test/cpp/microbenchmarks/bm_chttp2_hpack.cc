@@ -113,6 +113,7 @@ static void BM_HpackEncoderEncodeDeadline(benchmark::State& state) {
   grpc_core::FakeCallTracer call_tracer;
   grpc_slice_buffer outbuf;
   grpc_slice_buffer_init(&outbuf);
+  HardwareCounters counters(state);
   while (state.KeepRunning()) {
     c.EncodeHeaders(
         grpc_core::HPackCompressor::EncodeHeaderOptions{
@@ -138,6 +139,7 @@ static void BM_HpackEncoderEncodeHeader(benchmark::State& state) {
   grpc_core::FakeCallTracer call_tracer;
   grpc_slice_buffer outbuf;
   grpc_slice_buffer_init(&outbuf);
+  HardwareCounters counters(state);
   while (state.KeepRunning()) {
     static constexpr int kEnsureMaxFrameAtLeast = 2;
     c.EncodeHeaders(
@@ -379,10 +381,13 @@ static void BM_HpackParserParseHeader(benchmark::State& state) {
     }
   };
   parse_vec(init_slices);
-  while (state.KeepRunning()) {
-    b->Clear();
-    parse_vec(benchmark_slices);
-    grpc_core::ExecCtx::Get()->Flush();
+  {
+    HardwareCounters counters(state);
+    while (state.KeepRunning()) {
+      b->Clear();
+      parse_vec(benchmark_slices);
+      grpc_core::ExecCtx::Get()->Flush();
+    }
   }
   // Clean up
   b.Destroy();
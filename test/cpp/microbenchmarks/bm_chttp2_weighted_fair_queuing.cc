@@ -0,0 +1,178 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark the latency of small unary RPCs that share a connection with bulk
+// streams, with and without weighted fair queuing in the HTTP/2 transport
+
+#include <benchmark/benchmark.h>
+#include <grpc/impl/channel_arg_names.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/sync.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/callback_test_service.h"
+#include "test/cpp/microbenchmarks/fullstack_fixtures.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+class WeightedFairQueuingConfiguration : public FixtureConfiguration {
+ public:
+  explicit WeightedFairQueuingConfiguration(bool enabled)
+      : enabled_(enabled) {}
+
+  void ApplyCommonChannelArguments(ChannelArguments* c) const override {
+    c->SetInt(GRPC_ARG_HTTP2_WEIGHTED_FAIR_QUEUING, enabled_);
+    FixtureConfiguration::ApplyCommonChannelArguments(c);
+  }
+
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    b->AddChannelArgument(GRPC_ARG_HTTP2_WEIGHTED_FAIR_QUEUING, enabled_);
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+  }
+
+ private:
+  const bool enabled_;
+};
+
+// Ping-pongs large responses on a bidi stream until stopped, keeping the
+// server's side of the connection busy with DATA frames.
+class BulkStream : public ClientBidiReactor<EchoRequest, EchoResponse> {
+ public:
+  BulkStream(EchoTestService::Stub* stub, int response_size) {
+    context_.AddMetadata(kServerMessageSize, std::to_string(response_size));
+    stub->async()->BidiStream(&context_, this);
+    StartWrite(&request_);
+    StartRead(&response_);
+    StartCall();
+  }
+
+  void OnWriteDone(bool ok) override { MaybeStartNextRound(ok); }
+  void OnReadDone(bool ok) override { MaybeStartNextRound(ok); }
+  void OnDone(const Status& /*status*/) override { done_.Notify(); }
+
+  void StopAndWait() {
+    {
+      grpc_core::MutexLock lock(&mu_);
+      stopping_ = true;
+    }
+    done_.WaitForNotification();
+  }
+
+ private:
+  void MaybeStartNextRound(bool ok) {
+    bool done;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      ok_ = ok_ && ok;
+      if (--pending_ops_ > 0) return;
+      done = !ok_ || stopping_;
+      if (!done) pending_ops_ = 2;
+    }
+    if (done) {
+      StartWritesDone();
+      return;
+    }
+    StartWrite(&request_);
+    StartRead(&response_);
+  }
+
+  ClientContext context_;
+  EchoRequest request_;
+  EchoResponse response_;
+  grpc_core::Mutex mu_;
+  int pending_ops_ ABSL_GUARDED_BY(mu_) = 2;
+  bool ok_ ABSL_GUARDED_BY(mu_) = true;
+  bool stopping_ ABSL_GUARDED_BY(mu_) = false;
+  grpc_core::Notification done_;
+};
+
+// First argument enables weighted fair queuing, second is the number of bulk
+// streams.  Small RPCs ask for the highest weight, bulk streams use the
+// default.
+static void BM_SmallUnaryUnderBulkStreams(benchmark::State& state) {
+  constexpr int kBulkResponseSize = 4 * 1024 * 1024;
+  CallbackStreamingTestService service;
+  std::unique_ptr<TCP> fixture(
+      new TCP(&service, WeightedFairQueuingConfiguration(state.range(0) != 0)));
+  std::unique_ptr<EchoTestService::Stub> stub(
+      EchoTestService::NewStub(fixture->channel()));
+  std::vector<std::unique_ptr<BulkStream>> bulk_streams;
+  for (int i = 0; i < state.range(1); ++i) {
+    bulk_streams.push_back(
+        std::make_unique<BulkStream>(stub.get(), kBulkResponseSize));
+  }
+  EchoRequest request;
+  EchoResponse response;
+  std::vector<double> latencies_us;
+  for (auto _ : state) {
+    ClientContext context;
+    context.AddMetadata("grpc-stream-weight", "256");
+    const absl::Time start = absl::Now();
+    Status status = stub->Echo(&context, request, &response);
+    latencies_us.push_back(absl::ToDoubleMicroseconds(absl::Now() - start));
+    GRPC_CHECK(status.ok());
+  }
+  for (auto& bulk_stream : bulk_streams) bulk_stream->StopAndWait();
+  bulk_streams.clear();
+  fixture.reset();
+  if (!latencies_us.empty()) {
+    std::sort(latencies_us.begin(), latencies_us.end());
+    auto percentile = [&latencies_us](double p) {
+      return latencies_us[static_cast<size_t>(p * (latencies_us.size() - 1))];
+    };
+    state.counters["p50_us"] = percentile(0.5);
+    state.counters["p99_us"] = percentile(0.99);
+  }
+}
+BENCHMARK(BM_SmallUnaryUnderBulkStreams)
+    ->ArgNames({"wfq", "bulk_streams"})
+    ->Args({0, 0})
+    ->Args({0, 4})
+    ->Args({1, 4})
+    ->Args({0, 16})
+    ->Args({1, 16})
+    ->UseRealTime();
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
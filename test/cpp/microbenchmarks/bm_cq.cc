@@ -24,6 +24,9 @@
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/impl/grpc_library.h>
 
+#include <memory>
+#include <vector>
+
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/surface/completion_queue.h"
 #include "src/core/util/crash.h"
@@ -129,6 +132,74 @@ static void BM_Pluck1Core(benchmark::State& state) {
 }
 BENCHMARK(BM_Pluck1Core);
 
+// Queues state.range(0) completions per iteration, then drains them either
+// one at a time with Next or with NextBatch.
+template <bool kBatch>
+static void BM_PassNCpp(benchmark::State& state) {
+  const size_t num_events = state.range(0);
+  CompletionQueue cq;
+  grpc_completion_queue* c_cq = cq.cq();
+  std::vector<grpc_cq_completion> completions(num_events);
+  std::vector<PhonyTag> phony_tags(num_events);
+  std::vector<void*> tags(num_events);
+  std::unique_ptr<bool[]> oks(new bool[num_events]);
+  for (auto _ : state) {
+    {
+      grpc_core::ExecCtx exec_ctx;
+      for (size_t i = 0; i < num_events; ++i) {
+        GRPC_CHECK(grpc_cq_begin_op(c_cq, &phony_tags[i]));
+        grpc_cq_end_op(c_cq, &phony_tags[i], absl::OkStatus(),
+                       DoneWithCompletionOnStack, nullptr, &completions[i]);
+      }
+    }
+    for (size_t got = 0; got < num_events;) {
+      if (kBatch) {
+        got += cq.NextBatch(&tags[got], &oks[got], num_events - got);
+      } else {
+        GRPC_CHECK(cq.Next(&tags[got], &oks[got]));
+        ++got;
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_events);
+}
+BENCHMARK_TEMPLATE(BM_PassNCpp, false)->Range(1, 256);
+BENCHMARK_TEMPLATE(BM_PassNCpp, true)->Range(1, 256);
+
+// Core API counterpart of BM_PassNCpp, comparing grpc_completion_queue_next
+// with grpc_completion_queue_next_batch.
+template <bool kBatch>
+static void BM_PassNCore(benchmark::State& state) {
+  const size_t num_events = state.range(0);
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
+  std::vector<grpc_cq_completion> completions(num_events);
+  std::vector<grpc_event> events(num_events);
+  for (auto _ : state) {
+    {
+      grpc_core::ExecCtx exec_ctx;
+      for (size_t i = 0; i < num_events; ++i) {
+        GRPC_CHECK(grpc_cq_begin_op(cq, nullptr));
+        grpc_cq_end_op(cq, nullptr, absl::OkStatus(),
+                       DoneWithCompletionOnStack, nullptr, &completions[i]);
+      }
+    }
+    for (size_t got = 0; got < num_events;) {
+      if (kBatch) {
+        got += grpc_completion_queue_next_batch(
+            cq, events.data(), num_events - got, deadline, nullptr);
+      } else {
+        grpc_completion_queue_next(cq, deadline, nullptr);
+        ++got;
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_events);
+  grpc_completion_queue_destroy(cq);
+}
+BENCHMARK_TEMPLATE(BM_PassNCore, false)->Range(1, 256);
+BENCHMARK_TEMPLATE(BM_PassNCore, true)->Range(1, 256);
+
 static void BM_EmptyCore(benchmark::State& state) {
   // TODO(sreek): Templatize this benchmark and pass polling_type as a param
   grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
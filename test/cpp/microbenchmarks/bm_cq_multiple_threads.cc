@@ -22,6 +22,7 @@
 #include <string.h>
 
 #include <atomic>
+#include <vector>
 
 #include "absl/log/log.h"
 #include "src/core/lib/iomgr/ev_posix.h"
@@ -42,6 +43,8 @@ static gpr_mu g_mu;
 static gpr_cv g_cv;
 static int g_threads_active;
 static bool g_active;
+// Number of completions pollset_work queues each time it is called.
+static int g_events_per_poll;
 
 namespace grpc {
 namespace testing {
@@ -68,7 +71,7 @@ static void cq_done_cb(void* /*done_arg*/, grpc_cq_completion* cq_completion) {
   gpr_free(cq_completion);
 }
 
-// Queues a completion tag if deadline is > 0.
+// Queues g_events_per_poll completion tags if deadline is > 0.
 // Does nothing if deadline is 0 (i.e gpr_time_0(GPR_CLOCK_MONOTONIC))
 static grpc_error_handle pollset_work(grpc_pollset* ps,
                                       grpc_pollset_worker** /*worker*/,
@@ -81,10 +84,12 @@ static grpc_error_handle pollset_work(grpc_pollset* ps,
   gpr_mu_unlock(&ps->mu);
 
   void* tag = reinterpret_cast<void*>(10);  // Some random number
-  GRPC_CHECK(grpc_cq_begin_op(g_cq, tag));
-  grpc_cq_end_op(
-      g_cq, tag, absl::OkStatus(), cq_done_cb, nullptr,
-      static_cast<grpc_cq_completion*>(gpr_malloc(sizeof(grpc_cq_completion))));
+  for (int i = 0; i < g_events_per_poll; ++i) {
+    GRPC_CHECK(grpc_cq_begin_op(g_cq, tag));
+    grpc_cq_end_op(g_cq, tag, absl::OkStatus(), cq_done_cb, nullptr,
+                   static_cast<grpc_cq_completion*>(
+                       gpr_malloc(sizeof(grpc_cq_completion))));
+  }
   grpc_core::ExecCtx::Get()->Flush();
   gpr_mu_lock(&ps->mu);
   return absl::OkStatus();
@@ -114,7 +119,8 @@ static grpc_event_engine_vtable make_engine_vtable(const char* name) {
   return vtable;
 }
 
-static void setup() {
+static void setup(int events_per_poll) {
+  g_events_per_poll = events_per_poll;
   grpc_init();
   GRPC_CHECK(strcmp(grpc_get_poll_strategy_name(), "none") == 0 ||
              strcmp(grpc_get_poll_strategy_name(), "bm_cq_multiple_threads") ==
@@ -157,14 +163,21 @@ static void teardown() {
 // by grpc, and its Finish call must take place before grpc_shutdown so that it
 // can use grpc_stats).
 //
+// state.range(0) completions become ready per poll. With kBatch, each thread
+// dequeues them with grpc_completion_queue_next_batch instead of one at a
+// time with grpc_completion_queue_next.
+template <bool kBatch>
 static void BM_Cq_Throughput(benchmark::State& state) {
   gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
   auto thd_idx = state.thread_index();
+  const int events_per_poll = state.range(0);
+  std::vector<grpc_event> events(events_per_poll);
+  int64_t events_processed = 0;
 
   gpr_mu_lock(&g_mu);
   g_threads_active++;
   if (thd_idx == 0) {
-    setup();
+    setup(events_per_poll);
     g_active = true;
     gpr_cv_broadcast(&g_cv);
   } else {
@@ -175,11 +188,19 @@ static void BM_Cq_Throughput(benchmark::State& state) {
   gpr_mu_unlock(&g_mu);
 
   for (auto _ : state) {
-    GRPC_CHECK(grpc_completion_queue_next(g_cq, deadline, nullptr).type ==
-               GRPC_OP_COMPLETE);
+    if (kBatch) {
+      size_t n = grpc_completion_queue_next_batch(
+          g_cq, events.data(), events.size(), deadline, nullptr);
+      GRPC_CHECK(events[0].type == GRPC_OP_COMPLETE);
+      events_processed += n;
+    } else {
+      GRPC_CHECK(grpc_completion_queue_next(g_cq, deadline, nullptr).type ==
+                 GRPC_OP_COMPLETE);
+      ++events_processed;
+    }
   }
 
-  state.SetItemsProcessed(state.iterations());
+  state.SetItemsProcessed(events_processed);
 
   gpr_mu_lock(&g_mu);
   g_threads_active--;
@@ -198,7 +219,16 @@ static void BM_Cq_Throughput(benchmark::State& state) {
   }
 }
 
-BENCHMARK(BM_Cq_Throughput)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Cq_Throughput, false)
+    ->Arg(1)
+    ->Arg(16)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Cq_Throughput, true)
+    ->Arg(1)
+    ->Arg(16)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
 
 namespace {
 const grpc_event_engine_vtable g_none_vtable =
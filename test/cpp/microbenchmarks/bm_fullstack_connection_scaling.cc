@@ -0,0 +1,180 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark concurrent unary calls against a server with a low
+// MAX_CONCURRENT_STREAMS setting, with and without subchannel connection
+// scaling.
+
+#include <benchmark/benchmark.h>
+#include <grpc/impl/channel_arg_names.h>
+
+#include <memory>
+#include <vector>
+
+#include "src/core/util/grpc_check.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/fullstack_fixtures.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+constexpr int kServerMaxConcurrentStreams = 4;
+
+template <int kMaxConnections>
+class ConnectionScalingConfiguration : public FixtureConfiguration {
+  void ApplyCommonChannelArguments(ChannelArguments* a) const override {
+    a->SetInt(GRPC_ARG_MAX_CONNECTIONS_PER_SUBCHANNEL, kMaxConnections);
+    a->SetInt(GRPC_ARG_SUBCHANNEL_MAX_STREAMS_PER_CONNECTION,
+              kServerMaxConcurrentStreams);
+    FixtureConfiguration::ApplyCommonChannelArguments(a);
+  }
+
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    b->AddChannelArgument(GRPC_ARG_MAX_CONCURRENT_STREAMS,
+                          kServerMaxConcurrentStreams);
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+  }
+};
+
+template <int kMaxConnections>
+class LowMaxStreamsTCP : public TCP {
+ public:
+  explicit LowMaxStreamsTCP(Service* service)
+      : TCP(service, ConnectionScalingConfiguration<kMaxConnections>()) {}
+};
+
+//******************************************************************************
+// BENCHMARKING KERNELS
+//
+
+enum class TagKind : intptr_t {
+  kServerRequest = 0,
+  kServerFinish = 1,
+  kClientFinish = 2,
+};
+
+static void* tag(TagKind kind, int slot) {
+  return reinterpret_cast<void*>(slot * 4 + static_cast<intptr_t>(kind));
+}
+
+// Starts state.range(0) unary calls at once and waits for all of them to
+// complete.
+template <class Fixture>
+static void BM_ConcurrentUnary(benchmark::State& state) {
+  const int num_calls = state.range(0);
+  EchoTestService::AsyncService service;
+  std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  EchoRequest send_request;
+  EchoResponse send_response;
+  struct ServerEnv {
+    ServerContext ctx;
+    EchoRequest recv_request;
+    grpc::ServerAsyncResponseWriter<EchoResponse> response_writer;
+    ServerEnv() : response_writer(&ctx) {}
+  };
+  struct ClientEnv {
+    ClientContext ctx;
+    EchoResponse recv_response;
+    Status recv_status;
+    std::unique_ptr<ClientAsyncResponseReader<EchoResponse>> response_reader;
+  };
+  std::vector<std::unique_ptr<ServerEnv>> server_env(num_calls);
+  auto request_echo = [&](int slot) {
+    server_env[slot] = std::make_unique<ServerEnv>();
+    service.RequestEcho(&server_env[slot]->ctx, &server_env[slot]->recv_request,
+                        &server_env[slot]->response_writer, fixture->cq(),
+                        fixture->cq(), tag(TagKind::kServerRequest, slot));
+  };
+  for (int i = 0; i < num_calls; ++i) request_echo(i);
+  std::unique_ptr<EchoTestService::Stub> stub(
+      EchoTestService::NewStub(fixture->channel()));
+  for (auto _ : state) {
+    std::vector<std::unique_ptr<ClientEnv>> client_env(num_calls);
+    for (int i = 0; i < num_calls; ++i) {
+      client_env[i] = std::make_unique<ClientEnv>();
+      client_env[i]->response_reader =
+          stub->AsyncEcho(&client_env[i]->ctx, send_request, fixture->cq());
+      client_env[i]->response_reader->Finish(
+          &client_env[i]->recv_response, &client_env[i]->recv_status,
+          tag(TagKind::kClientFinish, i));
+    }
+    // Each call completes once on the server and once on the client.
+    for (int pending = 2 * num_calls; pending > 0;) {
+      void* t;
+      bool ok;
+      GRPC_CHECK(fixture->cq()->Next(&t, &ok));
+      GRPC_CHECK(ok);
+      const intptr_t value = reinterpret_cast<intptr_t>(t);
+      const int slot = static_cast<int>(value / 4);
+      switch (static_cast<TagKind>(value % 4)) {
+        case TagKind::kServerRequest:
+          server_env[slot]->response_writer.Finish(
+              send_response, Status::OK, tag(TagKind::kServerFinish, slot));
+          break;
+        case TagKind::kServerFinish:
+          request_echo(slot);
+          --pending;
+          break;
+        case TagKind::kClientFinish:
+          GRPC_CHECK(client_env[slot]->recv_status.ok());
+          --pending;
+          break;
+      }
+    }
+  }
+  stub.reset();
+  fixture.reset();
+  state.SetItemsProcessed(state.iterations() * num_calls);
+}
+
+//******************************************************************************
+// CONFIGURATIONS
+//
+
+static void SweepConcurrentCalls(benchmark::internal::Benchmark* b) {
+  for (int i = kServerMaxConcurrentStreams; i <= 64; i *= 4) {
+    b->Arg(i);
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_ConcurrentUnary, LowMaxStreamsTCP<1>)
+    ->Apply(SweepConcurrentCalls);
+BENCHMARK_TEMPLATE(BM_ConcurrentUnary, LowMaxStreamsTCP<4>)
+    ->Apply(SweepConcurrentCalls);
+BENCHMARK_TEMPLATE(BM_ConcurrentUnary, LowMaxStreamsTCP<16>)
+    ->Apply(SweepConcurrentCalls);
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,191 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark the goodput of an overloaded server, with calls waiting for the
+// application served in arrival order or earliest deadline first.
+
+#include <benchmark/benchmark.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+
+#include <atomic>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "src/core/server/server.h"
+#include "src/core/util/grpc_check.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+// The server handles one call at a time and takes kServiceTime over each, so
+// it serves at most 1000 calls per second.
+constexpr absl::Duration kServiceTime = absl::Milliseconds(1);
+// Clients give up on calls after kCallTimeout.
+constexpr absl::Duration kCallTimeout = absl::Milliseconds(20);
+
+// Async Echo server with a single handler thread.  The handler spends
+// kServiceTime on every call it is handed, whether or not the client is still
+// waiting, so under overload calls back up in the server's pending list.
+class SlowServer {
+ public:
+  explicit SlowServer(bool deadline_ordered) {
+    port_ = grpc_pick_unused_port_or_die();
+    std::ostringstream addr;
+    addr << "localhost:" << port_;
+    address_ = addr.str();
+    ServerBuilder b;
+    b.AddListeningPort(address_, InsecureServerCredentials());
+    b.AddChannelArgument(GRPC_ARG_SERVER_DEADLINE_ORDERED_PENDING_REQUESTS,
+                         deadline_ordered);
+    cq_ = b.AddCompletionQueue();
+    b.RegisterService(&service_);
+    server_ = b.BuildAndStart();
+    handler_ = std::thread([this]() { Serve(); });
+  }
+
+  ~SlowServer() {
+    server_->Shutdown(grpc_timeout_milliseconds_to_deadline(0));
+    handler_.join();
+    cq_->Shutdown();
+    void* t;
+    bool ok;
+    while (cq_->Next(&t, &ok)) {
+    }
+    grpc_recycle_unused_port(port_);
+  }
+
+  const std::string& address() const { return address_; }
+
+ private:
+  void Serve() {
+    void* t;
+    bool ok;
+    while (true) {
+      ServerContext svr_ctx;
+      EchoRequest recv_request;
+      ServerAsyncResponseWriter<EchoResponse> response_writer(&svr_ctx);
+      service_.RequestEcho(&svr_ctx, &recv_request, &response_writer,
+                           cq_.get(), cq_.get(), this);
+      // Requests fail once the server is shutting down.
+      if (!cq_->Next(&t, &ok) || !ok) return;
+      absl::SleepFor(kServiceTime);
+      response_writer.Finish(EchoResponse(), Status::OK, this);
+      if (!cq_->Next(&t, &ok)) return;
+    }
+  }
+
+  EchoTestService::AsyncService service_;
+  std::unique_ptr<ServerCompletionQueue> cq_;
+  std::unique_ptr<Server> server_;
+  std::string address_;
+  int port_;
+  std::thread handler_;
+};
+
+// Unary call with the state its completion needs.
+struct OpenLoopCall {
+  ClientContext cli_ctx;
+  EchoResponse recv_response;
+  Status recv_status;
+  std::unique_ptr<ClientAsyncResponseReader<EchoResponse>> response_reader;
+};
+
+// First argument enables deadline ordered pending requests, second is the
+// offered load as a percentage of what the server can handle.  Calls are
+// started on a fixed schedule whether or not earlier ones have finished, and
+// goodput counts the calls per second that succeeded within their deadline.
+static void BM_PendingCallGoodput(benchmark::State& state) {
+  SlowServer server(state.range(0) != 0);
+  std::shared_ptr<Channel> channel =
+      CreateChannel(server.address(), InsecureChannelCredentials());
+  GRPC_CHECK(channel->WaitForConnected(grpc_timeout_seconds_to_deadline(10)));
+  std::unique_ptr<EchoTestService::Stub> stub(
+      EchoTestService::NewStub(channel));
+  CompletionQueue client_cq;
+  std::atomic<int64_t> succeeded{0};
+  std::thread collector([&client_cq, &succeeded]() {
+    void* t;
+    bool ok;
+    while (client_cq.Next(&t, &ok)) {
+      auto* call = static_cast<OpenLoopCall*>(t);
+      if (call->recv_status.ok()) succeeded.fetch_add(1);
+      delete call;
+    }
+  });
+  const absl::Duration interval = kServiceTime * 100 / state.range(1);
+  EchoRequest send_request;
+  const absl::Time start = absl::Now();
+  absl::Time next_call = start;
+  for (auto _ : state) {
+    absl::SleepFor(next_call - absl::Now());
+    next_call += interval;
+    auto* call = new OpenLoopCall;
+    call->cli_ctx.set_deadline(absl::ToChronoTime(absl::Now() + kCallTimeout));
+    call->response_reader =
+        stub->AsyncEcho(&call->cli_ctx, send_request, &client_cq);
+    call->response_reader->Finish(&call->recv_response, &call->recv_status,
+                                  call);
+  }
+  const double seconds = absl::ToDoubleSeconds(absl::Now() - start);
+  // Every call finishes by its deadline.
+  client_cq.Shutdown();
+  collector.join();
+  state.counters["goodput"] = succeeded.load() / seconds;
+  state.counters["offered"] = state.iterations() / seconds;
+  state.SetItemsProcessed(succeeded.load());
+}
+BENCHMARK(BM_PendingCallGoodput)
+    ->ArgNames({"edf", "load_pct"})
+    ->Args({0, 50})
+    ->Args({1, 50})
+    ->Args({0, 150})
+    ->Args({1, 150})
+    ->Args({0, 300})
+    ->Args({1, 300})
+    ->UseRealTime();
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,167 @@
+//
+//
+// Copyright 2025 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark matching incoming calls to application requests on an async
+// server with one completion queue per serving thread.
+
+#include <benchmark/benchmark.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/sync.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+// Server shared by all benchmark threads.
+struct SharedServer {
+  EchoTestService::AsyncService service;
+  std::vector<std::unique_ptr<ServerCompletionQueue>> cqs;
+  std::unique_ptr<Server> server;
+  std::string address;
+  int port;
+};
+
+static grpc_core::Mutex g_mu;
+static grpc_core::CondVar g_cv;
+static SharedServer* g_server ABSL_GUARDED_BY(g_mu) = nullptr;
+static int g_threads_active ABSL_GUARDED_BY(g_mu) = 0;
+
+static void* tag(intptr_t x) { return reinterpret_cast<void*>(x); }
+
+static SharedServer* StartServer(int num_cqs) {
+  auto* shared = new SharedServer;
+  shared->port = grpc_pick_unused_port_or_die();
+  std::ostringstream addr;
+  addr << "localhost:" << shared->port;
+  shared->address = addr.str();
+  ServerBuilder b;
+  b.AddListeningPort(shared->address, InsecureServerCredentials());
+  for (int i = 0; i < num_cqs; ++i) {
+    shared->cqs.push_back(b.AddCompletionQueue(true));
+  }
+  b.RegisterService(&shared->service);
+  shared->server = b.BuildAndStart();
+  return shared;
+}
+
+static void StopServer(SharedServer* shared) {
+  shared->server->Shutdown(grpc_timeout_milliseconds_to_deadline(0));
+  for (auto& cq : shared->cqs) {
+    cq->Shutdown();
+    void* t;
+    bool ok;
+    while (cq->Next(&t, &ok)) {
+    }
+  }
+  grpc_recycle_unused_port(shared->port);
+  delete shared;
+}
+
+// Each thread owns one server CQ and its own connection.  Every iteration
+// starts a call and then requests one on the thread's CQ, so calls often
+// arrive before a request is waiting and take the pending-call path.
+static void BM_ServerRequestMatching(benchmark::State& state) {
+  SharedServer* shared;
+  {
+    grpc_core::MutexLock lock(&g_mu);
+    if (state.thread_index() == 0) {
+      g_server = StartServer(state.threads());
+      g_cv.SignalAll();
+    }
+    while (g_server == nullptr) g_cv.Wait(&g_mu);
+    shared = g_server;
+    ++g_threads_active;
+  }
+  ServerCompletionQueue* server_cq = shared->cqs[state.thread_index()].get();
+  ChannelArguments args;
+  args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+  std::unique_ptr<EchoTestService::Stub> stub(
+      EchoTestService::NewStub(CreateCustomChannel(
+          shared->address, InsecureChannelCredentials(), args)));
+  CompletionQueue client_cq;
+  EchoRequest send_request;
+  EchoResponse send_response;
+  void* t;
+  bool ok;
+  for (auto _ : state) {
+    ClientContext cli_ctx;
+    EchoResponse recv_response;
+    Status recv_status;
+    std::unique_ptr<ClientAsyncResponseReader<EchoResponse>> response_reader(
+        stub->AsyncEcho(&cli_ctx, send_request, &client_cq));
+    response_reader->Finish(&recv_response, &recv_status, tag(1));
+    ServerContext svr_ctx;
+    EchoRequest recv_request;
+    ServerAsyncResponseWriter<EchoResponse> response_writer(&svr_ctx);
+    shared->service.RequestEcho(&svr_ctx, &recv_request, &response_writer,
+                                server_cq, server_cq, tag(2));
+    GRPC_CHECK(server_cq->Next(&t, &ok));
+    GRPC_CHECK(ok && t == tag(2));
+    response_writer.Finish(send_response, Status::OK, tag(3));
+    GRPC_CHECK(server_cq->Next(&t, &ok));
+    GRPC_CHECK(ok && t == tag(3));
+    GRPC_CHECK(client_cq.Next(&t, &ok));
+    GRPC_CHECK(ok && t == tag(1));
+    GRPC_CHECK(recv_status.ok());
+  }
+  state.SetItemsProcessed(state.iterations());
+  stub.reset();
+  client_cq.Shutdown();
+  while (client_cq.Next(&t, &ok)) {
+  }
+  grpc_core::MutexLock lock(&g_mu);
+  if (--g_threads_active == 0) {
+    StopServer(g_server);
+    g_server = nullptr;
+  }
+}
+
+BENCHMARK(BM_ServerRequestMatching)->ThreadRange(1, 16)->UseRealTime();
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
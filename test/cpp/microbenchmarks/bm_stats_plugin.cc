@@ -18,9 +18,17 @@
 #include <memory>
 
 #include "absl/log/absl_check.h"
+#include "absl/status/status.h"
 #include "absl/strings/string_view.h"
 #include "opentelemetry/sdk/metrics/meter_provider.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/promise/context.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/transport/call_final_info.h"
+#include "src/core/telemetry/call_tracer.h"
 #include "src/core/telemetry/metrics.h"
 #include "test/core/test_util/fake_stats_plugin.h"
 #include "test/core/test_util/test_config.h"
@@ -152,6 +160,97 @@ void BM_AddCounterWithLabelsWithNoPlugin(benchmark::State& state) {
 }
 BENCHMARK(BM_AddCounterWithLabelsWithNoPlugin);
 
+// Per-call cost of the OpenTelemetry plugin's call tracers with the
+// per-attempt/per-call metrics enabled, from tracer creation to the end of
+// the call.
+void BM_ClientCallWithOTelPlugin(benchmark::State& state) {
+  grpc_core::GlobalStatsPluginRegistryTestPeer::
+      ResetGlobalStatsPluginRegistry();
+  auto meter_provider =
+      std::make_shared<opentelemetry::sdk::metrics::MeterProvider>();
+  auto status =
+      grpc::OpenTelemetryPluginBuilder()
+          .EnableMetrics(
+              {grpc::OpenTelemetryPluginBuilder::
+                   kClientAttemptStartedInstrumentName,
+               grpc::OpenTelemetryPluginBuilder::
+                   kClientAttemptDurationInstrumentName,
+               grpc::OpenTelemetryPluginBuilder::
+                   kClientAttemptSentTotalCompressedMessageSizeInstrumentName,
+               grpc::OpenTelemetryPluginBuilder::
+                   kClientAttemptRcvdTotalCompressedMessageSizeInstrumentName})
+          .SetMeterProvider(std::move(meter_provider))
+          .BuildAndRegisterGlobal();
+  CHECK(status.ok());
+  grpc_event_engine::experimental::ChannelArgsEndpointConfig endpoint_config;
+  auto stats_plugin_group =
+      grpc_core::GlobalStatsPluginRegistry::GetStatsPluginsForChannel(
+          grpc_core::experimental::StatsPluginChannelScope(
+              "dns:///localhost:443", "", endpoint_config));
+  const grpc_core::Slice path =
+      grpc_core::Slice::FromStaticString("/pkg.Service/Method");
+  for (auto _ : state) {
+    auto arena = grpc_core::SimpleArenaAllocator()->MakeArena();
+    grpc_core::promise_detail::Context<grpc_core::Arena> arena_ctx(
+        arena.get());
+    stats_plugin_group->AddClientCallTracers(path, true, arena.get());
+    auto* attempt_tracer = arena->GetContext<grpc_core::ClientCallTracer>()
+                               ->StartNewAttempt(false);
+    grpc_metadata_batch send_initial_metadata;
+    attempt_tracer->RecordSendInitialMetadata(&send_initial_metadata);
+    grpc_metadata_batch recv_initial_metadata;
+    attempt_tracer->RecordReceivedInitialMetadata(&recv_initial_metadata);
+    grpc_metadata_batch recv_trailing_metadata;
+    attempt_tracer->RecordReceivedTrailingMetadata(
+        absl::OkStatus(), &recv_trailing_metadata, nullptr);
+    attempt_tracer->RecordEnd();
+  }
+}
+BENCHMARK(BM_ClientCallWithOTelPlugin);
+
+void BM_ServerCallWithOTelPlugin(benchmark::State& state) {
+  grpc_core::GlobalStatsPluginRegistryTestPeer::
+      ResetGlobalStatsPluginRegistry();
+  auto meter_provider =
+      std::make_shared<opentelemetry::sdk::metrics::MeterProvider>();
+  auto status =
+      grpc::OpenTelemetryPluginBuilder()
+          .EnableMetrics(
+              {grpc::OpenTelemetryPluginBuilder::
+                   kServerCallStartedInstrumentName,
+               grpc::OpenTelemetryPluginBuilder::
+                   kServerCallDurationInstrumentName,
+               grpc::OpenTelemetryPluginBuilder::
+                   kServerCallSentTotalCompressedMessageSizeInstrumentName,
+               grpc::OpenTelemetryPluginBuilder::
+                   kServerCallRcvdTotalCompressedMessageSizeInstrumentName})
+          .SetMeterProvider(std::move(meter_provider))
+          .BuildAndRegisterGlobal();
+  CHECK(status.ok());
+  auto stats_plugin_group =
+      grpc_core::GlobalStatsPluginRegistry::GetStatsPluginsForServer(
+          grpc_core::ChannelArgs());
+  grpc_call_final_info final_info{};
+  for (auto _ : state) {
+    auto arena = grpc_core::SimpleArenaAllocator()->MakeArena();
+    grpc_core::promise_detail::Context<grpc_core::Arena> arena_ctx(
+        arena.get());
+    stats_plugin_group->AddServerCallTracers(arena.get(), {});
+    auto* server_tracer = arena->GetContext<grpc_core::ServerCallTracer>();
+    grpc_metadata_batch recv_initial_metadata;
+    recv_initial_metadata.Set(
+        grpc_core::HttpPathMetadata(),
+        grpc_core::Slice::FromStaticString("/pkg.Service/Method"));
+    server_tracer->RecordReceivedInitialMetadata(&recv_initial_metadata);
+    grpc_metadata_batch send_initial_metadata;
+    server_tracer->RecordSendInitialMetadata(&send_initial_metadata);
+    grpc_metadata_batch send_trailing_metadata;
+    server_tracer->RecordSendTrailingMetadata(&send_trailing_metadata);
+    server_tracer->RecordEnd(&final_info);
+  }
+}
+BENCHMARK(BM_ServerCallWithOTelPlugin);
+
 }  // namespace
 
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
@@ -152,6 +152,28 @@ class UDS : public FullstackFixture {
   }
 };
 
+// Like UDS, with the connection moved onto shared memory rings.
+class SharedMemory : public FullstackFixture {
+ public:
+  explicit SharedMemory(Service* service,
+                        const FixtureConfiguration& fixture_configuration =
+                            FixtureConfiguration())
+      : FullstackFixture(service, fixture_configuration, MakeAddress(&port_)) {}
+
+  ~SharedMemory() override { grpc_recycle_unused_port(port_); }
+
+ private:
+  int port_;
+
+  static std::string MakeAddress(int* port) {
+    *port = grpc_pick_unused_port_or_die();  // just for a unique id - not a
+                                             // real port
+    std::stringstream addr;
+    addr << "shm:/tmp/bm_fullstack_shm." << *port;
+    return addr.str();
+  }
+};
+
 class InProcess : public FullstackFixture {
  public:
   explicit InProcess(Service* service,
@@ -20,6 +20,15 @@
 
 #include <string.h>
 
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <optional>
+
 #include "src/core/util/grpc_check.h"
 
 static LibraryInitializer* g_libraryInitializer;
@@ -35,3 +44,96 @@ LibraryInitializer& LibraryInitializer::get() {
   GRPC_CHECK_NE(g_libraryInitializer, nullptr);
   return *g_libraryInitializer;
 }
+
+#ifdef __linux__
+
+namespace {
+
+struct HardwareEvent {
+  const char* name;
+  uint32_t type;
+  uint64_t config;
+};
+
+constexpr HardwareEvent kHardwareEvents[] = {
+    {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"cache_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {"branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {"context_switches", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES},
+};
+
+int OpenHardwareEvent(const HardwareEvent& event) {
+  perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = event.type;
+  attr.config = event.config;
+  attr.disabled = 1;
+  // Unprivileged processes can usually only count user space.  Context
+  // switches happen in the kernel, so they must include it.
+  attr.exclude_kernel = event.type == PERF_TYPE_HARDWARE;
+  attr.exclude_hv = 1;
+  attr.read_format =
+      PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(syscall(__NR_perf_event_open, &attr, /*pid=*/0,
+                                  /*cpu=*/-1, /*group_fd=*/-1, /*flags=*/0));
+}
+
+// Returns the count, scaled up if the kernel had to multiplex the counter
+// with others, or nullopt if it never ran.
+std::optional<double> ReadHardwareEvent(int fd) {
+  struct {
+    uint64_t value;
+    uint64_t time_enabled;
+    uint64_t time_running;
+  } data;
+  if (read(fd, &data, sizeof(data)) != sizeof(data) ||
+      data.time_running == 0) {
+    return std::nullopt;
+  }
+  return static_cast<double>(data.value) * data.time_enabled /
+         data.time_running;
+}
+
+}  // namespace
+
+HardwareCounters::HardwareCounters(benchmark::State& state) : state_(state) {
+  for (const auto& event : kHardwareEvents) {
+    const int fd = OpenHardwareEvent(event);
+    if (fd < 0) continue;
+    events_.push_back({event.name, fd});
+  }
+  for (const auto& event : events_) {
+    ioctl(event.fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(event.fd, PERF_EVENT_IOC_ENABLE, 0);
+  }
+}
+
+HardwareCounters::~HardwareCounters() {
+  for (const auto& event : events_) {
+    ioctl(event.fd, PERF_EVENT_IOC_DISABLE, 0);
+  }
+  std::optional<double> instructions;
+  std::optional<double> cycles;
+  for (const auto& event : events_) {
+    std::optional<double> value = ReadHardwareEvent(event.fd);
+    close(event.fd);
+    if (!value.has_value()) continue;
+    if (event.name == "instructions") instructions = value;
+    if (event.name == "cycles") cycles = value;
+    state_.counters[event.name] =
+        benchmark::Counter(*value, benchmark::Counter::kAvgIterations);
+  }
+  if (instructions.has_value() && cycles.has_value() && *cycles > 0) {
+    state_.counters["ipc"] = *instructions / *cycles;
+  }
+}
+
+#else  // !__linux__
+
+HardwareCounters::HardwareCounters(benchmark::State& state) : state_(state) {}
+
+HardwareCounters::~HardwareCounters() {}
+
+#endif  // __linux__
@@ -24,6 +24,7 @@
 #include <grpcpp/impl/grpc_library.h>
 
 #include <sstream>
+#include <string>
 #include <vector>
 
 #include "src/core/telemetry/stats.h"
@@ -40,4 +41,29 @@ class LibraryInitializer {
   grpc::internal::GrpcLibrary init_lib_;
 };
 
+// Counts hardware events on the calling thread, using perf_event_open(2),
+// from construction until destruction, and adds them to `state`'s counters
+// averaged per iteration: instructions, cycles, ipc, cache_misses,
+// branch_misses and context_switches.  Declare it just before the benchmark
+// loop.  Events that can't be counted here (outside Linux, without a PMU, or
+// when perf_event_paranoid forbids it) are left out, so on those machines
+// this does nothing.  Threads other than the calling one are not counted.
+class HardwareCounters {
+ public:
+  explicit HardwareCounters(benchmark::State& state);
+  ~HardwareCounters();
+
+  HardwareCounters(const HardwareCounters&) = delete;
+  HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+ private:
+  struct Event {
+    std::string name;
+    int fd;
+  };
+
+  benchmark::State& state_;
+  std::vector<Event> events_;
+};
+
 #endif  // GRPC_TEST_CPP_MICROBENCHMARKS_HELPERS_H
@@ -249,6 +249,26 @@ class Client {
 
   bool IsClosedLoop() { return closed_loop_; }
 
+  bool CorrectsCoordinatedOmission() const {
+    return correct_coordinated_omission_;
+  }
+
+  // Converts a time from NextIssueTime() to the clock UsageTimer::Now()
+  // reads.
+  static double IssueTimeToUsageTime(gpr_timespec issue_time) {
+    const gpr_timespec t =
+        gpr_convert_clock_type(issue_time, GPR_CLOCK_REALTIME);
+    return t.tv_sec + (1e-9 * t.tv_nsec);
+  }
+
+  // Returns when an RPC that was due to be issued at `issue_time` should
+  // count as having started: when it was due if correcting for coordinated
+  // omission, and now otherwise.
+  double IssueStartTime(gpr_timespec issue_time) const {
+    if (!correct_coordinated_omission_) return UsageTimer::Now();
+    return IssueTimeToUsageTime(issue_time);
+  }
+
   gpr_timespec NextIssueTime(int thread_idx) {
     const gpr_timespec result = next_time_[thread_idx];
     next_time_[thread_idx] =
@@ -342,6 +362,7 @@ class Client {
 
  protected:
   bool closed_loop_;
+  bool correct_coordinated_omission_ = false;
   gpr_atm thread_pool_done_;
   double median_latency_collection_interval_seconds_;  // In seconds
 
@@ -372,6 +393,8 @@ class Client {
       case LoadParams::kPoisson:
         random_dist = std::make_unique<ExpDist>(load.poisson().offered_load() /
                                                 num_threads);
+        correct_coordinated_omission_ =
+            load.poisson().correct_coordinated_omission();
         break;
       default:
         grpc_core::Crash("unreachable");
@@ -28,6 +28,7 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <thread>
@@ -61,6 +62,31 @@ class ClientRpcContext {
 
   virtual void Start(CompletionQueue* cq, const ClientConfig& config) = 0;
   virtual void TryCancel() = 0;
+
+  // Whether latency is measured from when each RPC was due to be issued; see
+  // Client::IssueStartTime().
+  bool correct_coordinated_omission_ = false;
+
+ protected:
+  // Returns the time to issue the next RPC at, and remembers it for
+  // StartTime().
+  gpr_timespec NextIssueTime(const std::function<gpr_timespec()>& next_issue) {
+    issue_time_ = next_issue();
+    return *issue_time_;
+  }
+
+  // Returns when the RPC (or message) being started counts as having started.
+  double StartTime() {
+    std::optional<gpr_timespec> issue_time =
+        std::exchange(issue_time_, std::nullopt);
+    if (!correct_coordinated_omission_ || !issue_time.has_value()) {
+      return UsageTimer::Now();
+    }
+    return Client::IssueTimeToUsageTime(*issue_time);
+  }
+
+ private:
+  std::optional<gpr_timespec> issue_time_;
 };
 
 template <class RequestType, class ResponseType>
@@ -92,7 +118,7 @@ class ClientRpcContextUnaryImpl : public ClientRpcContext {
   bool RunNextState(bool /*ok*/, HistogramEntry* entry) override {
     switch (next_state_) {
       case State::READY:
-        start_ = UsageTimer::Now();
+        start_ = StartTime();
         response_reader_ = prepare_req_(stub_, &context_, req_, cq_);
         response_reader_->StartCall();
         next_state_ = State::RESP_DONE;
@@ -114,6 +140,7 @@ class ClientRpcContextUnaryImpl : public ClientRpcContext {
   void StartNewClone(CompletionQueue* cq) override {
     auto* clone = new ClientRpcContextUnaryImpl(stub_, req_, next_issue_,
                                                 prepare_req_, callback_);
+    clone->correct_coordinated_omission_ = correct_coordinated_omission_;
     clone->StartInternal(cq);
   }
   void TryCancel() override { context_.TryCancel(); }
@@ -144,7 +171,7 @@ class ClientRpcContextUnaryImpl : public ClientRpcContext {
       RunNextState(true, nullptr);
     } else {  // wait for the issue time
       alarm_ = std::make_unique<Alarm>();
-      alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+      alarm_->Set(cq_, NextIssueTime(next_issue_), ClientRpcContext::tag(this));
     }
   }
 };
@@ -189,6 +216,8 @@ class AsyncClient : public ClientImpl<StubType, RequestType> {
         auto* cq = cli_cqs_[t].get();
         auto ctx =
             setup_ctx(channels_[ch].get_stub(), next_issuers_[t], request_);
+        ctx->correct_coordinated_omission_ =
+            this->CorrectsCoordinatedOmission();
         ctx->Start(cq, config);
         if (config.distribute_load_across_threads()) {
           t = (t + 1) % cli_cqs_.size();
@@ -378,13 +407,14 @@ class ClientRpcContextStreamingPingPongImpl : public ClientRpcContext {
         case State::WAIT:
           next_state_ = State::READY_TO_WRITE;
           alarm_ = std::make_unique<Alarm>();
-          alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+          alarm_->Set(cq_, NextIssueTime(next_issue_),
+                      ClientRpcContext::tag(this));
           return true;
         case State::READY_TO_WRITE:
           if (!ok) {
             return false;
           }
-          start_ = UsageTimer::Now();
+          start_ = StartTime();
           next_state_ = State::WRITE_DONE;
           if (coalesce_ && messages_issued_ == messages_per_stream_ - 1) {
             stream_->WriteLast(req_, WriteOptions(),
@@ -434,6 +464,7 @@ class ClientRpcContextStreamingPingPongImpl : public ClientRpcContext {
   void StartNewClone(CompletionQueue* cq) override {
     auto* clone = new ClientRpcContextStreamingPingPongImpl(
         stub_, req_, next_issue_, prepare_req_, callback_);
+    clone->correct_coordinated_omission_ = correct_coordinated_omission_;
     clone->StartInternal(cq, messages_per_stream_, coalesce_);
   }
   void TryCancel() override { context_.TryCancel(); }
@@ -472,7 +503,6 @@ class ClientRpcContextStreamingPingPongImpl : public ClientRpcContext {
   int messages_issued_;
   // Whether to use coalescing API.
   bool coalesce_;
-
   void StartInternal(CompletionQueue* cq, int messages_per_stream,
                      bool coalesce) {
     cq_ = cq;
@@ -563,14 +593,15 @@ class ClientRpcContextStreamingFromClientImpl : public ClientRpcContext {
           break;  // loop around, don't return
         case State::WAIT:
           alarm_ = std::make_unique<Alarm>();
-          alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+          alarm_->Set(cq_, NextIssueTime(next_issue_),
+                      ClientRpcContext::tag(this));
           next_state_ = State::READY_TO_WRITE;
           return true;
         case State::READY_TO_WRITE:
           if (!ok) {
             return false;
           }
-          start_ = UsageTimer::Now();
+          start_ = StartTime();
           next_state_ = State::WRITE_DONE;
           stream_->Write(req_, ClientRpcContext::tag(this));
           return true;
@@ -590,6 +621,7 @@ class ClientRpcContextStreamingFromClientImpl : public ClientRpcContext {
   void StartNewClone(CompletionQueue* cq) override {
     auto* clone = new ClientRpcContextStreamingFromClientImpl(
         stub_, req_, next_issue_, prepare_req_, callback_);
+    clone->correct_coordinated_omission_ = correct_coordinated_omission_;
     clone->StartInternal(cq);
   }
   void TryCancel() override { context_.TryCancel(); }
@@ -690,7 +722,7 @@ class ClientRpcContextStreamingFromServerImpl : public ClientRpcContext {
           if (!ok) {
             return false;
           }
-          start_ = UsageTimer::Now();
+          start_ = StartTime();
           next_state_ = State::READ_DONE;
           stream_->Read(&response_, ClientRpcContext::tag(this));
           return true;
@@ -711,6 +743,7 @@ class ClientRpcContextStreamingFromServerImpl : public ClientRpcContext {
   void StartNewClone(CompletionQueue* cq) override {
     auto* clone = new ClientRpcContextStreamingFromServerImpl(
         stub_, req_, next_issue_, prepare_req_, callback_);
+    clone->correct_coordinated_omission_ = correct_coordinated_omission_;
     clone->StartInternal(cq);
   }
   void TryCancel() override { context_.TryCancel(); }
@@ -811,13 +844,14 @@ class ClientRpcContextGenericStreamingImpl : public ClientRpcContext {
         case State::WAIT:
           next_state_ = State::READY_TO_WRITE;
           alarm_ = std::make_unique<Alarm>();
-          alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+          alarm_->Set(cq_, NextIssueTime(next_issue_),
+                      ClientRpcContext::tag(this));
           return true;
         case State::READY_TO_WRITE:
           if (!ok) {
             return false;
           }
-          start_ = UsageTimer::Now();
+          start_ = StartTime();
           next_state_ = State::WRITE_DONE;
           stream_->Write(req_, ClientRpcContext::tag(this));
           return true;
@@ -855,6 +889,7 @@ class ClientRpcContextGenericStreamingImpl : public ClientRpcContext {
   void StartNewClone(CompletionQueue* cq) override {
     auto* clone = new ClientRpcContextGenericStreamingImpl(
         stub_, req_, next_issue_, prepare_req_, callback_);
+    clone->correct_coordinated_omission_ = correct_coordinated_omission_;
     clone->StartInternal(cq, messages_per_stream_);
   }
   void TryCancel() override { context_.TryCancel(); }
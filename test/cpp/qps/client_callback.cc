@@ -176,17 +176,19 @@ class CallbackUnaryClient final : public CallbackClient {
       if (ctx_[vector_idx]->alarm_ == nullptr) {
         ctx_[vector_idx]->alarm_ = std::make_unique<Alarm>();
       }
-      ctx_[vector_idx]->alarm_->Set(next_issue_time,
-                                    [this, t, vector_idx](bool /*ok*/) {
-                                      IssueUnaryCallbackRpc(t, vector_idx);
-                                    });
+      ctx_[vector_idx]->alarm_->Set(
+          next_issue_time, [this, t, vector_idx, next_issue_time](bool /*ok*/) {
+            IssueUnaryCallbackRpc(t, vector_idx,
+                                  IssueStartTime(next_issue_time));
+          });
     } else {
-      IssueUnaryCallbackRpc(t, vector_idx);
+      IssueUnaryCallbackRpc(t, vector_idx, UsageTimer::Now());
     }
   }
 
-  void IssueUnaryCallbackRpc(Thread* t, size_t vector_idx) {
-    double start = UsageTimer::Now();
+  // `start` is when the RPC counts as having started; see
+  // Client::IssueStartTime().
+  void IssueUnaryCallbackRpc(Thread* t, size_t vector_idx, double start) {
     ctx_[vector_idx]->stub_->async()->UnaryCall(
         (&ctx_[vector_idx]->context_), &request_, &ctx_[vector_idx]->response_,
         [this, t, start, vector_idx](grpc::Status s) {
@@ -257,9 +259,9 @@ class CallbackStreamingPingPongReactor final
       std::unique_ptr<CallbackClientRpcContext> ctx)
       : client_(client), ctx_(std::move(ctx)), messages_issued_(0) {}
 
-  void StartNewRpc() {
+  void StartNewRpc(double start) {
     ctx_->stub_->async()->StreamingCall(&(ctx_->context_), this);
-    write_time_ = UsageTimer::Now();
+    write_time_ = start;
     StartWrite(client_->request());
     writes_done_started_.clear();
     StartCall();
@@ -294,8 +296,8 @@ class CallbackStreamingPingPongReactor final
       gpr_timespec next_issue_time = client_->NextRPCIssueTime();
       // Start an alarm callback to run the internal callback after
       // next_issue_time
-      ctx_->alarm_->Set(next_issue_time, [this](bool /*ok*/) {
-        write_time_ = UsageTimer::Now();
+      ctx_->alarm_->Set(next_issue_time, [this, next_issue_time](bool /*ok*/) {
+        write_time_ = client_->IssueStartTime(next_issue_time);
         StartWrite(client_->request());
       });
     } else {
@@ -321,10 +323,11 @@ class CallbackStreamingPingPongReactor final
       if (ctx_->alarm_ == nullptr) {
         ctx_->alarm_ = std::make_unique<Alarm>();
       }
-      ctx_->alarm_->Set(next_issue_time,
-                        [this](bool /*ok*/) { StartNewRpc(); });
+      ctx_->alarm_->Set(next_issue_time, [this, next_issue_time](bool /*ok*/) {
+        StartNewRpc(client_->IssueStartTime(next_issue_time));
+      });
     } else {
-      StartNewRpc();
+      StartNewRpc(UsageTimer::Now());
     }
   }
 
@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+#
+# Copyright 2025 gRPC authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Measures latency/throughput curves of the C++ transports on localhost.
+
+Runs each latency_sweep scenario from
+tools/run_tests/performance/scenario_config.py at a range of open-loop
+offered loads, using qps_json_driver --offered_load_sweep, and prints p50 to
+p99.9 latency against achieved throughput for each transport:
+
+  chttp2        HTTP2 scenarios, over TCP between two local workers
+  chaotic_good  CHAOTIC_GOOD scenarios, over TCP between two local workers
+  inproc        HTTP2 scenarios, run with qps_json_driver --run_inproc
+
+The scenarios measure latency from when each RPC was scheduled to start, so
+these curves include time spent queued behind earlier RPCs.
+
+Typical use, from the repository root:
+
+  test/cpp/qps/latency_sweep.py --out latency.json
+"""
+
+import argparse
+import json
+import os
+import re
+import socket
+import subprocess
+import sys
+import tempfile
+
+sys.path.append(
+    os.path.abspath(
+        os.path.join(os.path.dirname(__file__), "../../../tools/run_tests")
+    )
+)
+
+import performance.scenario_config as scenario_config
+
+_BIN_DIR = "bazel-bin/test/cpp/qps"
+_NUM_WORKERS = 2
+
+argp = argparse.ArgumentParser(
+    description="Sweep offered load over the C++ transports"
+)
+argp.add_argument(
+    "--offered_loads",
+    type=str,
+    default="1000,2000,5000,10000,20000,50000,100000,200000",
+    help="Comma-separated offered loads (RPCs/s), in increasing order",
+)
+argp.add_argument(
+    "--scenario_filter",
+    type=str,
+    default=None,
+    help="Only run latency_sweep scenarios whose names match this regex",
+)
+argp.add_argument(
+    "--transports",
+    nargs="+",
+    default=["chttp2", "chaotic_good", "inproc"],
+    help="Transports to measure",
+)
+argp.add_argument(
+    "--benchmark_seconds",
+    type=int,
+    default=None,
+    help="Override how long each point is measured for",
+)
+argp.add_argument(
+    "--warmup_seconds",
+    type=int,
+    default=None,
+    help="Override how long each point is warmed up for",
+)
+argp.add_argument("--out", type=str, help="Write the curves to this file")
+argp.add_argument(
+    "--skip_build", action="store_true", help="Use the binaries already built"
+)
+args = argp.parse_args()
+
+
+def _build():
+    subprocess.check_call(
+        [
+            "tools/bazel",
+            "build",
+            "-c",
+            "opt",
+            "test/cpp/qps:qps_json_driver",
+            "test/cpp/qps:qps_worker",
+        ]
+    )
+
+
+def _unused_port():
+    with socket.socket(socket.AF_INET6, socket.SOCK_STREAM) as s:
+        s.bind(("", 0))
+        return s.getsockname()[1]
+
+
+def _scenarios():
+    """Yields (transport, scenario) for each run to make."""
+    for scenario in scenario_config.CXXLanguage().scenarios():
+        if scenario_config.LATENCY_SWEEP not in scenario["CATEGORIES"]:
+            continue
+        if args.scenario_filter and not re.search(
+            args.scenario_filter, scenario["name"]
+        ):
+            continue
+        scenario = scenario_config.remove_nonproto_fields(scenario)
+        if args.benchmark_seconds is not None:
+            scenario["benchmark_seconds"] = args.benchmark_seconds
+        if args.warmup_seconds is not None:
+            scenario["warmup_seconds"] = args.warmup_seconds
+        if scenario["client_config"].get("protocol") == "CHAOTIC_GOOD":
+            transports = ["chaotic_good"]
+        else:
+            transports = ["chttp2", "inproc"]
+        for transport in transports:
+            if transport in args.transports:
+                yield transport, scenario
+
+
+def _sweep(transport, scenario):
+    """Runs one scenario over one transport, returning its curve."""
+    with tempfile.NamedTemporaryFile(suffix=".json") as out:
+        argv = [
+            os.path.join(_BIN_DIR, "qps_json_driver"),
+            "--scenarios_json=%s" % json.dumps({"scenarios": [scenario]}),
+            "--offered_load_sweep=%s" % args.offered_loads,
+            "--sweep_file_out=%s" % out.name,
+        ]
+        env = dict(os.environ)
+        workers = []
+        if transport == "inproc":
+            argv.append("--run_inproc")
+        else:
+            addresses = []
+            for _ in range(_NUM_WORKERS):
+                driver_port = _unused_port()
+                workers.append(
+                    subprocess.Popen(
+                        [
+                            os.path.join(_BIN_DIR, "qps_worker"),
+                            "--driver_port=%d" % driver_port,
+                            "--server_port=%d" % _unused_port(),
+                        ]
+                    )
+                )
+                addresses.append("localhost:%d" % driver_port)
+            env["QPS_WORKERS"] = ",".join(addresses)
+        try:
+            subprocess.check_call(argv, env=env)
+        finally:
+            for worker in workers:
+                worker.terminate()
+                worker.wait()
+        sweeps = json.load(out)
+    return sweeps[0]["points"] if sweeps else []
+
+
+def _print_curve(label, points):
+    print(label)
+    print(
+        "%12s %12s %10s %10s %10s %10s %10s"
+        % (
+            "offered",
+            "achieved",
+            "p50(us)",
+            "p90(us)",
+            "p95(us)",
+            "p99(us)",
+            "p99.9(us)",
+        )
+    )
+    for p in points:
+        print(
+            "%12.1f %12.1f %10.1f %10.1f %10.1f %10.1f %10.1f"
+            % (
+                p["offered_load"],
+                p["qps"],
+                p["latency_50"] / 1e3,
+                p["latency_90"] / 1e3,
+                p["latency_95"] / 1e3,
+                p["latency_99"] / 1e3,
+                p["latency_999"] / 1e3,
+            )
+        )
+    print()
+
+
+if not args.skip_build:
+    _build()
+
+curves = []
+for transport, scenario in _scenarios():
+    curves.append(
+        {
+            "transport": transport,
+            "scenario": scenario["name"],
+            "points": _sweep(transport, scenario),
+        }
+    )
+
+for curve in curves:
+    _print_curve(
+        "%s: %s" % (curve["transport"], curve["scenario"]), curve["points"]
+    )
+
+if args.out:
+    with open(args.out, "w") as f:
+        json.dump(curves, f, indent=2)
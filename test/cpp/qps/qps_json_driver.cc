@@ -22,9 +22,17 @@
 #include <iostream>
 #include <memory>
 #include <set>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "absl/flags/flag.h"
 #include "absl/log/log.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/grpc_check.h"
 #include "test/core/test_util/test_config.h"
@@ -59,6 +67,15 @@ ABSL_FLAG(double, error_tolerance, 0.01,
           "range is narrower than the error_tolerance computed range, we "
           "stop the search.");
 
+ABSL_FLAG(std::string, offered_load_sweep, "",
+          "Comma-separated list of Poisson offered loads (RPCs/s per client) "
+          "to run each scenario at, in increasing order, to measure its "
+          "latency/throughput curve. The sweep of a scenario stops at the "
+          "first load it cannot keep up with.");
+ABSL_FLAG(std::string, sweep_file_out, "",
+          "File to write the curves measured by --offered_load_sweep to, as "
+          "JSON.");
+
 ABSL_FLAG(std::string, qps_server_target_override, "",
           "Override QPS server target to configure in client configs."
           "Only applicable if there is a single benchmark server.");
@@ -236,6 +253,104 @@ static double SearchOfferedLoad(
   return targeted_offered_load;
 }
 
+// A scenario is considered saturated once it achieves less than this
+// fraction of its offered load: past that point, latency only measures how
+// far behind the clients have fallen.
+constexpr double kSaturatedFraction = 0.9;
+
+struct SweepPoint {
+  double offered_load;
+  ScenarioResultSummary summary;
+};
+
+static std::vector<double> ParseOfferedLoadSweep() {
+  std::vector<double> offered_loads;
+  for (absl::string_view load :
+       absl::StrSplit(absl::GetFlag(FLAGS_offered_load_sweep), ',',
+                      absl::SkipWhitespace())) {
+    double offered_load;
+    if (!absl::SimpleAtod(load, &offered_load) || offered_load <= 0) {
+      grpc_core::Crash(
+          absl::StrCat("Bad offered load in --offered_load_sweep: ", load));
+    }
+    offered_loads.push_back(offered_load);
+  }
+  return offered_loads;
+}
+
+static std::vector<SweepPoint> SweepOfferedLoad(
+    Scenario* scenario, const std::vector<double>& offered_loads,
+    const std::map<std::string, std::string>& per_worker_credential_types,
+    bool* success) {
+  if (!scenario->client_config().load_params().has_poisson()) {
+    grpc_core::Crash(absl::StrCat("--offered_load_sweep needs Poisson load, "
+                                  "which scenario ",
+                                  scenario->name(), " does not use"));
+  }
+  std::vector<SweepPoint> points;
+  for (double offered_load : offered_loads) {
+    scenario->mutable_client_config()
+        ->mutable_load_params()
+        ->mutable_poisson()
+        ->set_offered_load(offered_load);
+    auto result = RunAndReport(*scenario, per_worker_credential_types, success);
+    if (!*success) {
+      LOG(ERROR) << "Client/Server Failure";
+      break;
+    }
+    points.push_back({offered_load, result->summary()});
+    const double total_offered_load = offered_load * scenario->num_clients();
+    if (result->summary().qps() < total_offered_load * kSaturatedFraction) {
+      LOG(INFO) << scenario->name() << " saturated at offered load "
+                << offered_load;
+      break;
+    }
+  }
+  return points;
+}
+
+static void ReportSweep(const std::string& name,
+                        const std::vector<SweepPoint>& points) {
+  std::cerr << "LATENCY/THROUGHPUT CURVE: " << name << "\n";
+  std::cerr << absl::StrFormat("%12s %12s %10s %10s %10s %10s %10s\n",
+                               "offered", "achieved", "p50(us)", "p90(us)",
+                               "p95(us)", "p99(us)", "p99.9(us)");
+  for (const SweepPoint& point : points) {
+    const ScenarioResultSummary& s = point.summary;
+    std::cerr << absl::StrFormat(
+        "%12.1f %12.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n",
+        point.offered_load, s.qps(), s.latency_50() / 1000,
+        s.latency_90() / 1000, s.latency_95() / 1000, s.latency_99() / 1000,
+        s.latency_999() / 1000);
+  }
+}
+
+static void WriteSweeps(
+    const std::vector<std::pair<std::string, std::vector<SweepPoint>>>&
+        sweeps) {
+  std::ofstream out(absl::GetFlag(FLAGS_sweep_file_out));
+  out << "[";
+  for (size_t i = 0; i < sweeps.size(); i++) {
+    out << (i == 0 ? "\n" : ",\n") << "  {\"scenario\": \"" << sweeps[i].first
+        << "\", \"points\": [";
+    const std::vector<SweepPoint>& points = sweeps[i].second;
+    for (size_t j = 0; j < points.size(); j++) {
+      const ScenarioResultSummary& s = points[j].summary;
+      out << (j == 0 ? "\n" : ",\n")
+          << absl::StrFormat(
+                 "    {\"offered_load\": %g, \"qps\": %g, "
+                 "\"latency_50\": %g, \"latency_90\": %g, "
+                 "\"latency_95\": %g, \"latency_99\": %g, "
+                 "\"latency_999\": %g}",
+                 points[j].offered_load, s.qps(), s.latency_50(),
+                 s.latency_90(), s.latency_95(), s.latency_99(),
+                 s.latency_999());
+    }
+    out << "]}";
+  }
+  out << "\n]\n";
+}
+
 static bool QpsDriver() {
   std::string json;
 
@@ -249,6 +364,13 @@ static bool QpsDriver() {
         "or --quit must be set");
   }
 
+  const std::vector<double> offered_load_sweep = ParseOfferedLoadSweep();
+  if (!offered_load_sweep.empty() &&
+      !absl::GetFlag(FLAGS_search_param).empty()) {
+    grpc_core::Crash(
+        "At most one of --offered_load_sweep and --search_param may be set");
+  }
+
   auto per_worker_credential_types = ConstructPerWorkerCredentialTypesMap();
   if (scfile) {
     // Read the json data from disk
@@ -277,8 +399,16 @@ static bool QpsDriver() {
   // Make sure that there is at least some valid scenario here
   GRPC_CHECK_GT(scenarios.scenarios_size(), 0);
 
+  std::vector<std::pair<std::string, std::vector<SweepPoint>>> sweeps;
   for (int i = 0; i < scenarios.scenarios_size(); i++) {
-    if (absl::GetFlag(FLAGS_search_param).empty()) {
+    if (!offered_load_sweep.empty()) {
+      Scenario* scenario = scenarios.mutable_scenarios(i);
+      std::vector<SweepPoint> points =
+          SweepOfferedLoad(scenario, offered_load_sweep,
+                           per_worker_credential_types, &success);
+      ReportSweep(scenario->name(), points);
+      sweeps.emplace_back(scenario->name(), std::move(points));
+    } else if (absl::GetFlag(FLAGS_search_param).empty()) {
       const Scenario& scenario = scenarios.scenarios(i);
       RunAndReport(scenario, per_worker_credential_types, &success);
     } else {
@@ -296,6 +426,9 @@ static bool QpsDriver() {
       }
     }
   }
+  if (!absl::GetFlag(FLAGS_sweep_file_out).empty()) {
+    WriteSweeps(sweeps);
+  }
   return success;
 }
 
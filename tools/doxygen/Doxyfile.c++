@@ -1078,6 +1078,7 @@ include/grpcpp/support/config.h \
 include/grpcpp/support/global_callback_hook.h \
 include/grpcpp/support/interceptor.h \
 include/grpcpp/support/message_allocator.h \
+include/grpcpp/support/message_buffer_allocator.h \
 include/grpcpp/support/method_handler.h \
 include/grpcpp/support/proto_buffer_reader.h \
 include/grpcpp/support/proto_buffer_writer.h \
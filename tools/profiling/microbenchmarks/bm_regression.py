@@ -0,0 +1,236 @@
+#!/usr/bin/env python3
+#
+# Copyright 2025 gRPC authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Runs microbenchmarks and compares them against a stored baseline.
+
+Each benchmark is run with --benchmark_repetitions, and every repetition is
+kept as a sample of its CPU time and of the hardware counters reported by
+HardwareCounters in test/cpp/microbenchmarks/helpers.h.  A metric is
+reported as changed when a Mann-Whitney U test finds the two sets of samples
+differ at --alpha and the medians differ by more than --threshold.
+
+Typical use:
+
+  # on the base commit
+  tools/profiling/microbenchmarks/bm_regression.py --save_baseline base.json
+  # on the change
+  tools/profiling/microbenchmarks/bm_regression.py --baseline base.json
+"""
+
+import argparse
+import json
+import math
+import statistics
+import subprocess
+import sys
+import tempfile
+
+_DEFAULT_BENCHMARKS = [
+    "bm_arena",
+    "bm_chttp2_hpack",
+]
+
+# Metrics compared, and whether a larger value is worse.
+_METRICS = {
+    "cpu_time": True,
+    "instructions": True,
+    "cycles": True,
+    "ipc": False,
+    "cache_misses": True,
+    "branch_misses": True,
+    "context_switches": True,
+}
+
+_TIME_UNIT_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+argp = argparse.ArgumentParser(
+    description="Diff microbenchmarks against a baseline"
+)
+argp.add_argument(
+    "-b",
+    "--benchmarks",
+    nargs="+",
+    default=_DEFAULT_BENCHMARKS,
+    help="bm_* targets in test/cpp/microbenchmarks to run",
+)
+argp.add_argument(
+    "--benchmark_filter",
+    type=str,
+    default=None,
+    help="Passed to each benchmark binary",
+)
+argp.add_argument(
+    "-r",
+    "--repetitions",
+    type=int,
+    default=10,
+    help="Samples to take of each benchmark",
+)
+argp.add_argument(
+    "--save_baseline", type=str, help="Write the results to this file"
+)
+argp.add_argument(
+    "--baseline", type=str, help="Compare the results to this file"
+)
+argp.add_argument(
+    "--alpha",
+    type=float,
+    default=0.01,
+    help="Significance level of the comparison",
+)
+argp.add_argument(
+    "--threshold",
+    type=float,
+    default=0.03,
+    help="Relative change in the median below which changes are ignored",
+)
+argp.add_argument(
+    "--fail_on_regression",
+    action="store_true",
+    help="Exit with a non-zero status if anything regressed",
+)
+argp.add_argument(
+    "--skip_build", action="store_true", help="Use the binaries already built"
+)
+args = argp.parse_args()
+
+
+def _build(benchmarks):
+    subprocess.check_call(
+        ["tools/bazel", "build", "-c", "opt"]
+        + ["test/cpp/microbenchmarks:%s" % bm for bm in benchmarks]
+    )
+
+
+def _run(benchmark):
+    """Runs one benchmark binary, returning {name: {metric: [samples]}}."""
+    with tempfile.NamedTemporaryFile(suffix=".json") as out:
+        argv = [
+            "bazel-bin/test/cpp/microbenchmarks/%s" % benchmark,
+            "--benchmark_repetitions=%d" % args.repetitions,
+            "--benchmark_out=%s" % out.name,
+            "--benchmark_out_format=json",
+        ]
+        if args.benchmark_filter:
+            argv.append("--benchmark_filter=%s" % args.benchmark_filter)
+        subprocess.check_call(argv, stdout=subprocess.DEVNULL)
+        report = json.load(out)
+    ret = {}
+    for run in report["benchmarks"]:
+        # Skip the mean/median/stddev rows; we want the raw repetitions.
+        if run.get("run_type", "iteration") != "iteration":
+            continue
+        samples = ret.setdefault(run.get("run_name", run["name"]), {})
+        for metric in _METRICS:
+            if metric not in run:
+                continue
+            value = float(run[metric])
+            if metric == "cpu_time":
+                value *= _TIME_UNIT_NS[run.get("time_unit", "ns")]
+            samples.setdefault(metric, []).append(value)
+    return ret
+
+
+def _mann_whitney_p(a, b):
+    """Two-sided p-value of a Mann-Whitney U test (normal approximation)."""
+    n1 = len(a)
+    n2 = len(b)
+    if n1 == 0 or n2 == 0:
+        return 1.0
+    ranked = sorted([(v, 0) for v in a] + [(v, 1) for v in b])
+    ranks = [0.0] * len(ranked)
+    tie_term = 0.0
+    i = 0
+    while i < len(ranked):
+        j = i
+        while j + 1 < len(ranked) and ranked[j + 1][0] == ranked[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1
+        t = j - i + 1
+        tie_term += t**3 - t
+        i = j + 1
+    r1 = sum(r for r, (_, which) in zip(ranks, ranked) if which == 0)
+    u = r1 - n1 * (n1 + 1) / 2.0
+    n = n1 + n2
+    variance = n1 * n2 / 12.0 * ((n + 1) - tie_term / (n * (n - 1)))
+    if variance <= 0:
+        return 1.0
+    # Continuity correction.
+    z = (abs(u - n1 * n2 / 2.0) - 0.5) / math.sqrt(variance)
+    return max(0.0, min(1.0, math.erfc(max(z, 0.0) / math.sqrt(2))))
+
+
+def _compare(old, cur):
+    """Prints significant changes; returns the number of regressions."""
+    regressions = 0
+    lines = []
+    for bm in sorted(cur):
+        for name in sorted(cur[bm]):
+            if name not in old.get(bm, {}):
+                continue
+            for metric, larger_is_worse in _METRICS.items():
+                a = old[bm][name].get(metric)
+                b = cur[bm][name].get(metric)
+                if not a or not b:
+                    continue
+                old_median = statistics.median(a)
+                cur_median = statistics.median(b)
+                if old_median == 0:
+                    continue
+                change = (cur_median - old_median) / abs(old_median)
+                if abs(change) < args.threshold:
+                    continue
+                p = _mann_whitney_p(a, b)
+                if p >= args.alpha:
+                    continue
+                worse = (change > 0) == larger_is_worse
+                if worse:
+                    regressions += 1
+                lines.append(
+                    "%s %-60s %-16s %12.4g -> %12.4g  %+7.1f%%  p=%.3g"
+                    % (
+                        "REGRESSED" if worse else "improved ",
+                        name,
+                        metric,
+                        old_median,
+                        cur_median,
+                        change * 100,
+                        p,
+                    )
+                )
+    if lines:
+        print("\n".join(lines))
+    else:
+        print("No significant changes.")
+    return regressions
+
+
+if not args.skip_build:
+    _build(args.benchmarks)
+cur = {bm: _run(bm) for bm in args.benchmarks}
+
+if args.save_baseline:
+    with open(args.save_baseline, "w") as f:
+        json.dump(cur, f, indent=2, sort_keys=True)
+
+if args.baseline:
+    with open(args.baseline) as f:
+        old = json.load(f)
+    regressions = _compare(old, cur)
+    if regressions and args.fail_on_regression:
+        sys.exit(1)
+elif not args.save_baseline:
+    print(json.dumps(cur, indent=2, sort_keys=True))
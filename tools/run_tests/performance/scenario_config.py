@@ -25,6 +25,9 @@ SMOKETEST = "smoketest"
 SCALABLE = "scalable"
 INPROC = "inproc"
 SWEEP = "sweep"
+# Open-loop scenarios meant to be run at a range of offered loads with
+# qps_json_driver --offered_load_sweep (see test/cpp/qps/latency_sweep.py).
+LATENCY_SWEEP = "latency_sweep"
 PSM = "psm"
 # A small superset of the benchmarks required to produce
 # https://grafana-dot-grpc-testing.appspot.com/
@@ -95,13 +98,15 @@ def _payload_type(use_generic_payload, req_size, resp_size):
     return r
 
 
-def _load_params(offered_load):
+def _load_params(offered_load, correct_coordinated_omission=False):
     r = {}
     if offered_load is None:
         r["closed_loop"] = {}
     else:
         load = {}
         load["offered_load"] = offered_load
+        if correct_coordinated_omission:
+            load["correct_coordinated_omission"] = True
         r["poisson"] = load
     return r
 
@@ -147,6 +152,10 @@ def _ping_pong_scenario(
     excluded_poll_engines=None,
     minimal_stack=False,
     offered_load=None,
+    server_channel_args=None,
+    protocol=None,
+    async_client_threads=None,
+    correct_coordinated_omission=False,
 ):
     """Creates a basic ping pong scenario."""
     scenario = {
@@ -224,7 +233,16 @@ def _ping_pong_scenario(
         scenario["client_config"]["async_client_threads"] = 1
         optimization_target = "latency"
 
-    scenario["client_config"]["load_params"] = _load_params(offered_load)
+    if async_client_threads is not None:
+        scenario["client_config"]["async_client_threads"] = async_client_threads
+
+    scenario["client_config"]["load_params"] = _load_params(
+        offered_load, correct_coordinated_omission
+    )
+
+    if protocol:
+        scenario["client_config"]["protocol"] = protocol
+        scenario["server_config"]["protocol"] = protocol
 
     optimization_channel_arg = {
         "name": "grpc.optimization_target",
@@ -237,6 +255,10 @@ def _ping_pong_scenario(
         _add_channel_arg(scenario["client_config"], "grpc.minimal_stack", 1)
         _add_channel_arg(scenario["server_config"], "grpc.minimal_stack", 1)
 
+    if server_channel_args:
+        for key, value in server_channel_args.items():
+            _add_channel_arg(scenario["server_config"], key, value)
+
     if messages_per_stream:
         scenario["client_config"]["messages_per_stream"] = messages_per_stream
     if client_language:
@@ -542,6 +564,42 @@ class CXXLanguage(Language):
                 warmup_seconds=CXX_WARMUP_SECONDS,
             )
 
+            # Same as above, with the sync handlers run on the EventEngine's
+            # thread pool instead of on the sync server's own threads.
+            yield _ping_pong_scenario(
+                "cpp_protobuf_async_client_sync_server_event_engine_unary_qps_unconstrained_%s"
+                % (secstr),
+                rpc_type="UNARY",
+                client_type="ASYNC_CLIENT",
+                server_type="SYNC_SERVER",
+                unconstrained_client="async",
+                secure=secure,
+                minimal_stack=not secure,
+                server_channel_args={
+                    "grpc.experimental.server_sync_handlers_on_event_engine": 1
+                },
+                categories=smoketest_categories
+                + inproc_categories
+                + [SCALABLE],
+                warmup_seconds=CXX_WARMUP_SECONDS,
+            )
+
+            yield _ping_pong_scenario(
+                "cpp_protobuf_async_client_sync_server_event_engine_streaming_qps_unconstrained_%s"
+                % secstr,
+                rpc_type="STREAMING",
+                client_type="ASYNC_CLIENT",
+                server_type="SYNC_SERVER",
+                unconstrained_client="async",
+                secure=secure,
+                minimal_stack=not secure,
+                server_channel_args={
+                    "grpc.experimental.server_sync_handlers_on_event_engine": 1
+                },
+                categories=[SWEEP],
+                warmup_seconds=CXX_WARMUP_SECONDS,
+            )
+
             yield _ping_pong_scenario(
                 "cpp_protobuf_async_unary_ping_pong_%s_1MB" % secstr,
                 rpc_type="UNARY",
@@ -713,6 +771,37 @@ class CXXLanguage(Language):
                                 warmup_seconds=CXX_WARMUP_SECONDS,
                             )
 
+        # Latency/throughput curves: open-loop load with latency measured
+        # from when each RPC was scheduled, so that queueing behind a slow
+        # RPC is not hidden.  The offered load here is only a default; these
+        # are meant to be swept (see LATENCY_SWEEP).
+        for rpc_type in ["unary", "streaming"]:
+            for protocol in ["HTTP2", "CHAOTIC_GOOD"]:
+                for threads in [1, None]:
+                    yield _ping_pong_scenario(
+                        "cpp_protobuf_async_%s_latency_sweep_%s_%s"
+                        % (
+                            rpc_type,
+                            protocol.lower(),
+                            "1thread" if threads else "multithread",
+                        ),
+                        rpc_type=rpc_type.upper(),
+                        client_type="ASYNC_CLIENT",
+                        server_type="ASYNC_SERVER",
+                        unconstrained_client="async",
+                        secure=False,
+                        channels=4,
+                        outstanding=100,
+                        num_clients=1,
+                        async_client_threads=threads,
+                        async_server_threads=threads or 0,
+                        offered_load=1000,
+                        correct_coordinated_omission=True,
+                        protocol=protocol,
+                        categories=[LATENCY_SWEEP],
+                        warmup_seconds=CXX_WARMUP_SECONDS,
+                    )
+
     def __str__(self):
         return "c++"
 
@@ -605,7 +605,13 @@ def main():
     )
     argp.add_argument(
         "--category",
-        choices=["smoketest", "all", "scalable", "sweep"],
+        choices=[
+            "smoketest",
+            "all",
+            "scalable",
+            "sweep",
+            "latency_sweep",
+        ],
         default="all",
         help="Select a category of tests to run.",
     )